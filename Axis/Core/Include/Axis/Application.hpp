@@ -7,6 +7,9 @@
 #pragma once
 
 #include "../../Graphics/Include/Axis/SwapChain.hpp"
+#include "../../System/Include/Axis/Assert.hpp"
+#include "../../System/Include/Axis/JobSystem.hpp"
+#include "../../System/Include/Axis/Task.hpp"
 #include "../../System/Include/Axis/TimePeriod.hpp"
 #include "ComponentCollection.hpp"
 #include "CoreExport.hpp"
@@ -74,6 +77,21 @@ class AXIS_CORE_API Application : public System::ISharedFromThis
     /// \brief Gets the immediate graphics device context used by swap chain.
     AXIS_NODISCARD inline const System::SharedPointer<Graphics::IDeviceContext>& GetImmediateGraphicsContext() const noexcept { return _swapChain->Description.ImmediateGraphicsContext; }
 
+    /// \brief Gets the scheduler of the coroutines, it resumes them once per frame before \a `Update`.
+    ///
+    /// \note Spawn the loading coroutines here (e.g. in \a `LoadContent`) to load the assets without
+    ///       stalling the frames.
+    AXIS_NODISCARD inline System::TaskScheduler& GetTaskScheduler() noexcept { return _taskScheduler; }
+
+    /// \brief Gets the job system running the background work, created by \a `Run` before
+    ///        \a `LoadContent`; mustn't be called earlier (e.g. from the constructor).
+    AXIS_NODISCARD inline System::JobSystem& GetJobSystem() const noexcept
+    {
+        AXIS_ASSERT(_jobSystem, "The job system is only available once `Run` has started!");
+
+        return *_jobSystem;
+    }
+
     /// \brief Gets all created immediate device contexts.
     AXIS_NODISCARD inline const System::List<System::SharedPointer<Graphics::IDeviceContext>>& GetImmediateDeviceContexts() const noexcept { return _immediateDeviceContexts; }
 
@@ -149,6 +167,8 @@ class AXIS_CORE_API Application : public System::ISharedFromThis
     Bool                                                          _vSync                   = true;                                          ///< Indicates whether vsync is enabled or not.
     System::TimePeriod                                            _timeStep                = System::TimePeriod::FromSeconds(1.0f / 60.0f); ///< Specifies fixed time step if the application run in fixed time step. (Default value is 60 Fps)
     Bool                                                          _fixedTimeStep           = {};                                            ///< Specifies whether application is running
+    System::TaskScheduler                                         _taskScheduler           = {};                                            ///< Resumes the coroutines once per frame
+    System::UniquePointer<System::JobSystem>                      _jobSystem               = nullptr;                                       ///< Runs the background work (destructs before the scheduler)
 };
 
 } // namespace Core
@@ -10,9 +10,12 @@
 #include <Axis/DisplayWindow.hpp>
 #include <Axis/GraphicsDevice.hpp>
 #include <Axis/GraphicsSystem.hpp>
+#include <Axis/Memory.hpp>
+#include <Axis/Profiler.hpp>
 #include <Axis/StaticArray.hpp>
 #include <Axis/System.hpp>
 #include <Axis/Timer.hpp>
+#include <Axis/TrackingAllocator.hpp>
 
 namespace Axis
 {
@@ -333,6 +336,9 @@ void Application::Run()
     if (!_swapChain)
         throw System::InvalidOperationException("Failed to create swap chain!");
 
+    // Starts the worker threads for the background work
+    _jobSystem = System::UniquePointer<System::JobSystem>(System::New<System::JobSystem>());
+
     LoadContent();
 
     Bool windowShouldClose = false;
@@ -347,11 +353,37 @@ void Application::Run()
     // Timer for delta time
     System::Timer timer;
 
+    // When the next tick is due with the fixed time step, advanced by the time step every tick so
+    // the late wake-ups don't accumulate
+    System::TimePeriod nextTickTime = System::Timer::GetTimestamp();
+
+    AXIS_PROFILE_THREAD_NAME("Main");
+
     auto Tick = [&]() {
+        // Starts the profiler's new frame, the zone below belongs to it
+        AXIS_PROFILE_FRAME();
+        AXIS_PROFILE_SCOPE("Application::Tick");
+
+        // Recycles the per-frame memory of two frames ago
+        System::FrameArenaAllocator::Reset();
+
+        // Starts counting the allocations of the new frame
+        System::AllocationTracker::BeginFrame();
+
         const System::TimePeriod deltaTime = timer.Reset();
 
+        // Resumes the coroutines whose awaited work has finished
+        {
+            AXIS_PROFILE_SCOPE("TaskScheduler::RunFrame");
+            _taskScheduler.RunFrame();
+        }
+
         Components.UpdateAll(deltaTime);
-        Update(deltaTime);
+
+        {
+            AXIS_PROFILE_SCOPE("Application::Update");
+            Update(deltaTime);
+        }
 
         const auto& swapChainGraphicsContext = _swapChain->Description.ImmediateGraphicsContext;
 
@@ -361,7 +393,11 @@ void Application::Run()
         swapChainGraphicsContext->SetRenderTarget({{renderTargetView}, depthStencilView});
 
         Components.RenderAll(deltaTime);
-        Render(deltaTime);
+
+        {
+            AXIS_PROFILE_SCOPE("Application::Render");
+            Render(deltaTime);
+        }
 
         _swapChain->Present(_vSync ? 1 : 0);
     };
@@ -383,9 +419,16 @@ void Application::Run()
 
         if (_fixedTimeStep && !_vSync)
         {
-            System::TimePeriod timePassed = timer.GetElapsedTimePeriod();
-            if (timePassed < _timeStep)
-                System::Sleep(_timeStep - timePassed);
+            nextTickTime += _timeStep;
+
+            const System::TimePeriod currentTime = System::Timer::GetTimestamp();
+
+            // Fell behind by more than a whole tick (e.g. the window was being dragged), restarts the
+            // schedule rather than running the missed ticks back to back
+            if (nextTickTime + _timeStep < currentTime)
+                nextTickTime = currentTime;
+            else
+                System::PreciseSleepUntil(nextTickTime);
         }
 
         Tick();
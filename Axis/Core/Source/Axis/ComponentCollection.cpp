@@ -5,6 +5,7 @@
 #include <Axis/CorePch.hpp>
 
 #include <Axis/ComponentCollection.hpp>
+#include <Axis/Profiler.hpp>
 
 namespace Axis
 {
@@ -180,6 +181,8 @@ Bool ComponentCollection::Remove(const ApplicationComponent& component)
 
 void ComponentCollection::UpdateAll(const System::TimePeriod& timeStep)
 {
+    AXIS_PROFILE_SCOPE("ComponentCollection::UpdateAll");
+
     // Updates all the components in the collection.
     for (Size i = 0; i < _componentsUpdateOrder.GetLength(); ++i)
     {
@@ -194,6 +197,8 @@ void ComponentCollection::UpdateAll(const System::TimePeriod& timeStep)
 
 void ComponentCollection::RenderAll(const System::TimePeriod& timeStep)
 {
+    AXIS_PROFILE_SCOPE("ComponentCollection::RenderAll");
+
     // Draws all the components in the collection.
     for (Size i = 0; i < _componentsDrawOrder.GetLength(); ++i)
     {
@@ -6,7 +6,7 @@
 #define AXIS_VULKANCOMMANDBUFFER_HPP
 #pragma once
 
-#include "../../../../System/Include/Axis/HashSet.hpp"
+#include "../../../../System/Include/Axis/FlatHashMap.hpp"
 #include "../../../Include/Axis/DeviceChild.hpp"
 #include "VkPtr.hpp"
 
@@ -42,8 +42,8 @@ struct VulkanCommandBuffer final : public DeviceChild
     // Resets command buffer and also release all the resource references bound to this command buffer.
     void ResetCommandBuffer() noexcept;
 
-    // Binds the resource to this command buffer.
-    void AddResourceStrongReference(const System::SharedPointer<void>& reference);
+    // Binds the resource to this command buffer, the strong reference is only acquired the first time.
+    void AddResourceStrongReference(System::SharedRef<void> reference);
 
     // Checks if command buffer is ready for submission.
     Bool IsCommandBufferAvailable() const noexcept;
@@ -69,23 +69,13 @@ struct VulkanCommandBuffer final : public DeviceChild
     inline VkSemaphore GetSignalVkSemaphore() const noexcept { return _signalSemaphore; }
 
 private:
-    // Void reference pointer hasher
-    struct ReferencePointerHasher
-    {
-        // Gets the hash for the void reference pointer
-        Size operator()(const System::SharedPointer<void>& referencePointer) const noexcept
-        {
-            return (Size)((PVoid)referencePointer);
-        }
-    };
-
-    VkPtr<VkCommandBuffer>                                               _commandBuffer         = {};
-    VkPtr<VkSemaphore>                                                   _signalSemaphore       = {};
-    VkPtr<VkFence>                                                       _submitFence           = {};
-    Bool                                                                 _isRecording           = false;
-    System::HashSet<System::SharedPointer<void>, ReferencePointerHasher> _resourceReference     = {}; // Keeps the strong reference
-    System::SharedPointer<IRenderPass>                                   _activatingRenderPass  = {};
-    System::SharedPointer<IFramebuffer>                                  _activatingFramebuffer = {};
+    VkPtr<VkCommandBuffer>                                  _commandBuffer         = {};
+    VkPtr<VkSemaphore>                                      _signalSemaphore       = {};
+    VkPtr<VkFence>                                          _submitFence           = {};
+    Bool                                                    _isRecording           = false;
+    System::FlatHashMap<PVoid, System::SharedPointer<void>> _resourceReference     = {}; // Keeps the strong reference, keyed by the resource's address
+    System::SharedPointer<IRenderPass>                      _activatingRenderPass  = {};
+    System::SharedPointer<IFramebuffer>                     _activatingFramebuffer = {};
 
     friend struct VulkanDeviceQueue;
 };
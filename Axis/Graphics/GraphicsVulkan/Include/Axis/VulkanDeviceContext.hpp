@@ -6,6 +6,7 @@
 #define AXIS_VULKANDEVICECONTEXT_HPP
 #pragma once
 
+#include "../../../../System/Include/Axis/TrackingAllocator.hpp"
 #include "../../../Include/Axis/DeviceContext.hpp"
 #include "../../../Include/Axis/GraphicsDevice.hpp"
 #include "VulkanCommandPool.hpp"
@@ -42,22 +43,22 @@ class VulkanDeviceContext final : public IDeviceContext
     void WaitQueueIdle() const noexcept override final;
 
     // An implementation of IDeviceContext::TransitTextureState in Vulkan backend
-    void TransitTextureState(const System::SharedPointer<ITexture>& textureResource,
-                             ResourceState                          initialState,
-                             ResourceState                          finalState,
-                             Uint32                                 baseArrayIndex,
-                             Uint32                                 arrayLevelCount,
-                             Uint32                                 baseMipLevel,
-                             Uint32                                 mipLevelCount,
-                             Bool                                   discardContent,
-                             Bool                                   recordState) override final;
+    void TransitTextureState(System::SharedRef<ITexture> textureResource,
+                             ResourceState               initialState,
+                             ResourceState               finalState,
+                             Uint32                      baseArrayIndex,
+                             Uint32                      arrayLevelCount,
+                             Uint32                      baseMipLevel,
+                             Uint32                      mipLevelCount,
+                             Bool                        discardContent,
+                             Bool                        recordState) override final;
 
     // An implementation of IDeviceContext::TransitBufferState in Vulkan backend
-    void TransitBufferState(const System::SharedPointer<IBuffer>& bufferResource,
-                            ResourceState                         initialState,
-                            ResourceState                         finalState,
-                            Bool                                  discardContent,
-                            Bool                                  recordState) override final;
+    void TransitBufferState(System::SharedRef<IBuffer> bufferResource,
+                            ResourceState              initialState,
+                            ResourceState              finalState,
+                            Bool                       discardContent,
+                            Bool                       recordState) override final;
 
     // An implementation of IDeviceContext::CopyBuffer in Vulkan backend
     void CopyBuffer(const System::SharedPointer<IBuffer>& sourceBuffer,
@@ -96,10 +97,10 @@ class VulkanDeviceContext final : public IDeviceContext
                          StateTransition            stateTransition) override final;
 
     // An implementation of IDeviceContext::BindVertexBuffers in Vulkan backend
-    void BindVertexBuffers(Uint32                                              firstBinding,
-                           const System::Span<System::SharedPointer<IBuffer>>& vertexBuffers,
-                           const System::Span<Size>&                           offsets,
-                           StateTransition                                     stateTransition) override final;
+    void BindVertexBuffers(Uint32                                          firstBinding,
+                           const System::Span<System::SharedRef<IBuffer>>& vertexBuffers,
+                           const System::Span<Size>&                       offsets,
+                           StateTransition                                 stateTransition) override final;
 
     // An implementation of IDeviceContext::BindIndexBuffer in Vulkan backend
     ///
@@ -171,6 +172,14 @@ class VulkanDeviceContext final : public IDeviceContext
     inline VulkanCommandBuffer* GetVulkanCommandBuffer() noexcept { return _currentVulkanCommandBuffer.GetPointer(); }
 
 private:
+    // Tag of the device context's allocations in `System::AllocationTracker`
+    struct AllocationTag
+    {
+        static constexpr const char* Name = "GraphicsVulkan::VulkanDeviceContext";
+    };
+
+    using TemporaryAllocator = System::TaggedAllocator<AllocationTag>; // Allocator of the temporary lists used by the commands
+
     void CommitRenderPass();                                                  // Binds the pending render target and starts an implicit render pass. (Subpass with no dependency)
     void CommitPipelineBinding();                                             // Binds the stored pipeline binding upon draw commands.
     void CommitVertexBufferBinding();                                         // Binds the vertex buffer upon draw commands.
@@ -6,13 +6,12 @@
 #define AXIS_VULKANFRAMEBUFFERCACHE_HPP
 #pragma once
 
-#include "../../../../System/Include/Axis/HashMap.hpp"
-#include "../../../../System/Include/Axis/List.hpp"
+#include "../../../../System/Include/Axis/ConcurrentHashMap.hpp"
+#include "../../../../System/Include/Axis/InlineList.hpp"
 #include "../../../../System/Include/Axis/SmartPointer.hpp"
 #include "../../../../System/Include/Axis/Utility.hpp"
 #include "../../../Include/Axis/DeviceChild.hpp"
 #include "VulkanRenderPassCache.hpp"
-#include <mutex>
 
 namespace Axis
 {
@@ -29,7 +28,7 @@ class IGraphicsDevice;
 struct VulkanFramebufferCacheKey final
 {
     // Render target texture views
-    System::List<System::WeakPointer<ITextureView>> RenderTargetViews = nullptr;
+    System::InlineList<System::WeakPointer<ITextureView>, InlineRenderTargetCount> RenderTargetViews = nullptr;
 
     // Depth stencil texture view
     System::WeakPointer<ITextureView> DepthStencilView = nullptr;
@@ -76,9 +75,10 @@ struct VulkanFramebufferCache final : public DeviceChild
     void CleanUp();
 
 private:
-    VulkanRenderPassCache                                                                                            _vulkanRenderPassCache;
-    System::HashMap<VulkanFramebufferCacheKey, System::SharedPointer<IFramebuffer>, VulkanFramebufferCacheKey::Hash> _hashCache = {};
-    std::mutex                                                                                                       _mutex     = {};
+    VulkanRenderPassCache _vulkanRenderPassCache;
+
+    // Shared by the device contexts recording on the different threads.
+    System::ConcurrentHashMap<VulkanFramebufferCacheKey, System::SharedPointer<IFramebuffer>, VulkanFramebufferCacheKey::Hash> _hashCache = {};
 };
 
 } // namespace Graphics
@@ -6,11 +6,10 @@
 #define AXIS_VULKANRENDERPASSCACHE_HPP
 #pragma once
 
-#include "../../../../System/Include/Axis/HashMap.hpp"
-#include "../../../../System/Include/Axis/List.hpp"
+#include "../../../../System/Include/Axis/ConcurrentHashMap.hpp"
+#include "../../../../System/Include/Axis/InlineList.hpp"
 #include "../../../Include/Axis/DeviceChild.hpp"
 #include "../../../Include/Axis/GraphicsCommon.hpp"
-#include <mutex>
 
 namespace Axis
 {
@@ -33,7 +32,7 @@ struct VulkanRenderPassCacheKey final
     TextureFormat DepthStencilViewFormat = TextureFormat::Unknown;
 
     // Render target view formats
-    System::List<TextureFormat> RenderTargetViewFormats = nullptr;
+    System::InlineList<TextureFormat, InlineRenderTargetCount> RenderTargetViewFormats = nullptr;
 
     // Gets hash key for this render pass key.
     Size GetHash() const noexcept;
@@ -73,8 +72,8 @@ struct VulkanRenderPassCache final : public DeviceChild
     System::SharedPointer<IRenderPass> GetRenderPass(const VulkanRenderPassCacheKey& renderPassCacheKey);
 
 private:
-    System::HashMap<VulkanRenderPassCacheKey, System::SharedPointer<IRenderPass>, VulkanRenderPassCacheKey::Hash> _hashCache = {};
-    std::mutex                                                                                                    _mutex     = {};
+    // Shared by the device contexts recording on the different threads.
+    System::ConcurrentHashMap<VulkanRenderPassCacheKey, System::SharedPointer<IRenderPass>, VulkanRenderPassCacheKey::Hash> _hashCache = {};
 };
 
 } // namespace Graphics
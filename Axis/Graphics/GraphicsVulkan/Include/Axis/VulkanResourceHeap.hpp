@@ -6,6 +6,7 @@
 #define AXIS_VULKANRESOURCEHEAP_HPP
 #pragma once
 
+#include "../../../../System/Include/Axis/Hashing.hpp"
 #include "../../../Include/Axis/GraphicsCommon.hpp"
 #include "../../../Include/Axis/ResourceHeap.hpp"
 #include "../../../System/Include/Axis/List.hpp"
@@ -37,17 +38,17 @@ class VulkanResourceHeap final : public IResourceHeap
                        VulkanGraphicsDevice&          vulkanGraphicsDevice);
 
     // Implementation of IResourceHeap::BindBuffers class in Vulkan platform.
-    void BindBuffers(Uint32                                              bindingIndex,
-                     const System::Span<System::SharedPointer<IBuffer>>& buffers,
-                     const System::Span<Size>&                           offsets,
-                     const System::Span<Size>&                           sizes,
-                     Uint32                                              startingArrayIndex) override final;
+    void BindBuffers(Uint32                                          bindingIndex,
+                     const System::Span<System::SharedRef<IBuffer>>& buffers,
+                     const System::Span<Size>&                       offsets,
+                     const System::Span<Size>&                       sizes,
+                     Uint32                                          startingArrayIndex) override final;
 
     // Implementation of IResourceHeap::BindSamplers class in Vulkan platform.
-    void BindSamplers(Uint32                                                   bindingIndex,
-                      const System::Span<System::SharedPointer<ISampler>>&     samplers,
-                      const System::Span<System::SharedPointer<ITextureView>>& textureViews,
-                      Uint32                                                   startingArrayIndex) final;
+    void BindSamplers(Uint32                                               bindingIndex,
+                      const System::Span<System::SharedRef<ISampler>>&     samplers,
+                      const System::Span<System::SharedRef<ITextureView>>& textureViews,
+                      Uint32                                               startingArrayIndex) final;
 
     // Inserts the barrier for the resources. Prepare for binding.
     void PrepareResourceHeapBinding(VulkanDeviceContext& deviceContext,
@@ -67,19 +68,14 @@ class VulkanResourceHeap final : public IResourceHeap
         Uint32 BindingIndex = {};
         Uint32 ArrayIndex   = {};
 
-        inline constexpr Size GetHash() const noexcept
-        {
-            Size hash = BindingIndex;
-            hash      = System::Math::HashCombine(hash, ArrayIndex);
-            return hash;
-        }
+        inline Size GetHash() const noexcept { return System::Hashing::HashValues(BindingIndex, ArrayIndex); }
 
         inline constexpr Bool operator==(const ResourceLocation& other) const noexcept { return BindingIndex == other.BindingIndex && ArrayIndex == other.ArrayIndex; }
         inline constexpr Bool operator!=(const ResourceLocation& other) const noexcept { return BindingIndex != other.BindingIndex || ArrayIndex != other.ArrayIndex; }
 
         struct Hash
         {
-            inline constexpr Size operator()(const ResourceLocation& obj) const noexcept { return obj.GetHash(); }
+            inline Size operator()(const ResourceLocation& obj) const noexcept { return obj.GetHash(); }
         };
     };
 
@@ -139,9 +139,12 @@ void VulkanCommandBuffer::ResetCommandBuffer() noexcept
     vkResetCommandBuffer(_commandBuffer, 0);
 }
 
-void VulkanCommandBuffer::AddResourceStrongReference(const System::SharedPointer<void>& reference)
+void VulkanCommandBuffer::AddResourceStrongReference(System::SharedRef<void> reference)
 {
-    _resourceReference.Insert(reference);
+    // The resources are usually referenced many times per recording, looks up
+    // by the address first and touches the reference count only once.
+    if (_resourceReference.Find(reference.GetPointer()) == _resourceReference.end())
+        _resourceReference.Insert({reference.GetPointer(), (System::SharedPointer<void>)reference});
 }
 
 Bool VulkanCommandBuffer::IsCommandBufferAvailable() const noexcept
@@ -5,6 +5,7 @@
 
 #include <Axis/GraphicsVulkanPch.hpp>
 
+#include <Axis/Profiler.hpp>
 #include <Axis/VulkanBuffer.hpp>
 #include <Axis/VulkanCommandBuffer.hpp>
 #include <Axis/VulkanCommandPool.hpp>
@@ -72,15 +73,15 @@ void VulkanDeviceContext::WaitQueueIdle() const noexcept
     GetVulkanDeviceQueue().WaitQueueIdle();
 }
 
-void VulkanDeviceContext::TransitTextureState(const System::SharedPointer<ITexture>& textureResource,
-                                              ResourceState                          initialState,
-                                              ResourceState                          finalState,
-                                              Uint32                                 baseArrayIndex,
-                                              Uint32                                 arrayLevelCount,
-                                              Uint32                                 baseMipLevel,
-                                              Uint32                                 mipLevelCount,
-                                              Bool                                   discardContent,
-                                              Bool                                   recordState)
+void VulkanDeviceContext::TransitTextureState(System::SharedRef<ITexture> textureResource,
+                                              ResourceState               initialState,
+                                              ResourceState               finalState,
+                                              Uint32                      baseArrayIndex,
+                                              Uint32                      arrayLevelCount,
+                                              Uint32                      baseMipLevel,
+                                              Uint32                      mipLevelCount,
+                                              Bool                        discardContent,
+                                              Bool                        recordState)
 {
     // Validates the arguments
     IDeviceContext::TransitTextureState(textureResource,
@@ -140,11 +141,11 @@ void VulkanDeviceContext::TransitTextureState(const System::SharedPointer<ITextu
         textureResource->SetResourceState(finalState);
 }
 
-void VulkanDeviceContext::TransitBufferState(const System::SharedPointer<IBuffer>& bufferResource,
-                                             ResourceState                         initialState,
-                                             ResourceState                         finalState,
-                                             Bool                                  discardContent,
-                                             Bool                                  recordState)
+void VulkanDeviceContext::TransitBufferState(System::SharedRef<IBuffer> bufferResource,
+                                             ResourceState              initialState,
+                                             ResourceState              finalState,
+                                             Bool                       discardContent,
+                                             Bool                       recordState)
 {
     // Validates the arguments
     IDeviceContext::TransitBufferState(bufferResource,
@@ -502,13 +503,12 @@ void VulkanDeviceContext::SetRenderTarget(const RenderTargetBinding& renderTarge
                                     stateTransition);
 
     // Creates framebuffer out of render target views
+    // The key stays in place for up to `InlineRenderTargetCount` render targets, the lookup doesn't allocate.
     VulkanFramebufferCacheKey framebufferCacheKey = {};
-    framebufferCacheKey.RenderTargetViews         = System::List<System::WeakPointer<ITextureView>>(GetCurrentRenderTargetBinding().RenderTargetViews.GetLength());
+    framebufferCacheKey.RenderTargetViews.ReserveFor(GetCurrentRenderTargetBinding().RenderTargetViews.GetLength());
 
-    for (Size i = 0; i < GetCurrentRenderTargetBinding().RenderTargetViews.GetLength(); i++)
-    {
-        framebufferCacheKey.RenderTargetViews[i] = GetCurrentRenderTargetBinding().RenderTargetViews[i];
-    }
+    for (const auto& renderTargetView : GetCurrentRenderTargetBinding().RenderTargetViews)
+        framebufferCacheKey.RenderTargetViews.EmplaceBack(renderTargetView);
 
     framebufferCacheKey.DepthStencilView = GetCurrentRenderTargetBinding().DepthStencilView;
 
@@ -556,10 +556,10 @@ void VulkanDeviceContext::SetRenderTarget(const RenderTargetBinding& renderTarge
     _renderPassUpToDate = false;
 }
 
-void VulkanDeviceContext::BindVertexBuffers(Uint32                                              firstBinding,
-                                            const System::Span<System::SharedPointer<IBuffer>>& vertexBuffers,
-                                            const System::Span<Size>&                           offsets,
-                                            StateTransition                                     stateTransition)
+void VulkanDeviceContext::BindVertexBuffers(Uint32                                          firstBinding,
+                                            const System::Span<System::SharedRef<IBuffer>>& vertexBuffers,
+                                            const System::Span<Size>&                       offsets,
+                                            StateTransition                                 stateTransition)
 {
     // Validates the arguments
     IDeviceContext::BindVertexBuffers(firstBinding,
@@ -1016,6 +1016,8 @@ void VulkanDeviceContext::AppendWaitFence(const System::SharedPointer<IFence>& f
 
 void VulkanDeviceContext::Flush()
 {
+    AXIS_PROFILE_SCOPE("VulkanDeviceContext::Flush");
+
     // Gets a new command buffer upfront here, to avoid the command buffer being destroyed while we are using it.
     auto backupVulkanCommand = _vulkanCommandPool->GetCommandBuffer();
 
@@ -1034,6 +1036,9 @@ void VulkanDeviceContext::Flush()
     _resourceHeapUpToDate        = true;
     _framebufferCache.CleanUp();
 
+    // Frees the removed framebuffers and their views now, not once enough removals pile up.
+    System::ReclaimRemovedNodes();
+
     try
     {
         // Submits command buffer to the queue.
@@ -1133,9 +1138,8 @@ void VulkanDeviceContext::CommitVertexBufferBinding()
 {
     if (!_vertexBufferBindingUpToDate)
     {
-        System::List<VkBuffer>        bufferBinding;
-        System::List<Uint64>          bufferBindingOffset;
-        System::List<GraphicsAdapter> graphicsAdapters = GetCreatorDevice()->GraphicsSystem->GetGraphicsAdapters();
+        System::List<VkBuffer, TemporaryAllocator> bufferBinding;
+        System::List<Uint64, TemporaryAllocator>   bufferBindingOffset;
 
         bufferBinding.ReserveFor(GetCurrentBindingVertexBuffers().GetLength());
         bufferBindingOffset.ReserveFor(GetCurrentBindingVertexBuffers().GetLength());
@@ -1160,7 +1164,7 @@ void VulkanDeviceContext::CommitVertexBufferBinding()
 
         vkCmdBindVertexBuffers(_currentVulkanCommandBuffer->GetVkCommandBufferHandle(),
                                0,
-                               graphicsAdapters[GetCreatorDevice()->GraphicsAdapterIndex].Capability.MaxVertexInputBinding,
+                               (Uint32)bufferBinding.GetLength(), // The binding list is as long as `GraphicsCapability::MaxVertexInputBinding`
                                bufferBinding.GetData(),
                                bufferBindingOffset.GetData());
 
@@ -21,13 +21,12 @@ namespace Graphics
 
 Size VulkanFramebufferCacheKey::GetHash() const noexcept
 {
-    std::hash<ITextureView*> hasher     = {};
-    std::hash<Size>          sizeHasher = {};
-    Size                     hash       = hasher(DepthStencilView.GetPointer());
-    hash                                = System::Math::HashCombine(hash, sizeHasher(RenderTargetViews.GetLength()));
+    System::Hash<ITextureView*> hasher = {};
+    Size                        hash   = hasher(DepthStencilView.GetPointer());
+    hash                               = System::Hashing::Combine(hash, RenderTargetViews.GetLength());
 
     for (const auto& renderTargetView : RenderTargetViews)
-        hash = System::Math::HashCombine(hash, hasher(renderTargetView.GetPointer()));
+        hash = System::Hashing::Combine(hash, hasher(renderTargetView.GetPointer()));
 
     return hash;
 }
@@ -68,8 +67,8 @@ System::SharedPointer<IFramebuffer> VulkanFramebufferCache::GetFramebuffer(const
 {
     AXIS_ASSERT(framebufferCacheKey.RenderTargetViews, "framebufferCacheKey.RenderTargetViews wasn't nullptr!");
 
-    auto                                iterator = _hashCache.Find(framebufferCacheKey);
-    System::SharedPointer<IFramebuffer> result;
+    if (auto framebuffer = _hashCache.Find(framebufferCacheKey))
+        return *framebuffer;
 
     constexpr auto CreateFramebuffer = [](const VulkanFramebufferCacheKey& cacheKey,
                                           VulkanRenderPassCache&           renderPassCache,
@@ -97,11 +96,11 @@ System::SharedPointer<IFramebuffer> VulkanFramebufferCache::GetFramebuffer(const
 
         VulkanRenderPassCacheKey renderPassCacheKey = {};
 
-        renderPassCacheKey.DepthStencilViewFormat  = cacheKey.DepthStencilView == nullptr ? TextureFormat::Unknown : cacheKey.DepthStencilView.GetPointer()->Description.ViewFormat;
-        renderPassCacheKey.RenderTargetViewFormats = System::List<TextureFormat>(cacheKey.RenderTargetViews.GetLength());
+        renderPassCacheKey.DepthStencilViewFormat = cacheKey.DepthStencilView == nullptr ? TextureFormat::Unknown : cacheKey.DepthStencilView.GetPointer()->Description.ViewFormat;
+        renderPassCacheKey.RenderTargetViewFormats.ReserveFor(cacheKey.RenderTargetViews.GetLength());
 
-        for (Size i = 0; i < cacheKey.RenderTargetViews.GetLength(); i++)
-            renderPassCacheKey.RenderTargetViewFormats[i] = cacheKey.RenderTargetViews[i].GetPointer()->Description.ViewFormat;
+        for (const auto& renderTargetView : cacheKey.RenderTargetViews)
+            renderPassCacheKey.RenderTargetViewFormats.Append(renderTargetView.GetPointer()->Description.ViewFormat);
 
         renderPassCacheKey.SampleCount = cacheKey.RenderTargetViews[0].GetPointer()->Description.ViewTexture->Description.Sample;
 
@@ -110,58 +109,33 @@ System::SharedPointer<IFramebuffer> VulkanFramebufferCache::GetFramebuffer(const
         return vulkanGraphicsDevice->CreateFramebuffer(framebufferDesc);
     };
 
-    if (iterator == _hashCache.end())
-    {
-        auto framebuffer = CreateFramebuffer(framebufferCacheKey,
-                                             _vulkanRenderPassCache,
-                                             (VulkanGraphicsDevice*)GetCreatorDevice());
+    auto framebuffer = CreateFramebuffer(framebufferCacheKey,
+                                         _vulkanRenderPassCache,
+                                         (VulkanGraphicsDevice*)GetCreatorDevice());
 
-        if (!framebuffer)
-        {
-            result = nullptr;
-        }
-        else
-        {
-            _hashCache.Insert({framebufferCacheKey, framebuffer});
+    // The failed creations aren't cached.
+    if (!framebuffer)
+        return nullptr;
 
-            result = framebuffer;
-        }
-    }
-    else
-    {
-        result = iterator->Second;
-    }
-
-    return result;
+    // Another thread may have created the framebuffer meanwhile, its framebuffer wins.
+    return _hashCache.GetOrCreate(framebufferCacheKey, [&]() { return framebuffer; });
 }
 
 void VulkanFramebufferCache::CleanUp()
 {
-    auto it = _hashCache.begin();
-    while (it != _hashCache.end())
-    {
-        Bool shouldErase = false;
-        // strong count is 1 (which means that our cached framebuffer holds that strong reference).
-        if (it->First.DepthStencilView.GetStrongCount() == 1)
-            shouldErase = true;
+    // Strong count is 1 (which means that our cached framebuffer holds that strong reference).
+    _hashCache.RemoveIf([](const VulkanFramebufferCacheKey& key, const System::SharedPointer<IFramebuffer>&) {
+        if (key.DepthStencilView.GetStrongCount() == 1)
+            return true;
 
-        if (!shouldErase)
+        for (const auto& renderTargetView : key.RenderTargetViews)
         {
-            for (const auto& renderTargetView : it->First.RenderTargetViews)
-            {
-                if (renderTargetView.GetStrongCount() == 1)
-                {
-                    shouldErase = true;
-                    break;
-                }
-            }
+            if (renderTargetView.GetStrongCount() == 1)
+                return true;
         }
 
-        if (shouldErase)
-            it = _hashCache.Remove(it->First).Second;
-        else
-            it++;
-    }
+        return false;
+    });
 }
 
 } // namespace Graphics
@@ -19,16 +19,12 @@ namespace Graphics
 
 Size VulkanRenderPassCacheKey::GetHash() const noexcept
 {
-    std::hash<Uint8> hasher = {};
-
-    Size hash = hasher(SampleCount);
-
-    hash = System::Math::HashCombine(hash, hasher(System::Enum::GetUnderlyingValue(DepthStencilViewFormat)));
+    Size hash = System::Hashing::HashValues(SampleCount, DepthStencilViewFormat);
 
     if (RenderTargetViewFormats)
     {
         for (const auto& format : RenderTargetViewFormats)
-            hash = System::Math::HashCombine(hash, hasher(System::Enum::GetUnderlyingValue(format)));
+            hash = System::Hashing::Combine(hash, System::Enum::GetUnderlyingValue(format));
     }
 
     return hash;
@@ -70,13 +66,8 @@ System::SharedPointer<IRenderPass> VulkanRenderPassCache::GetRenderPass(const Vu
 {
     AXIS_ASSERT(renderPassCacheKey.RenderTargetViewFormats, "renderPassCacheKey.RenderTargetViewFormats can't be nullptr!");
 
-    std::scoped_lock lockGuard(_mutex);
-
-    auto                               iterator = _hashCache.Find(renderPassCacheKey);
-    System::SharedPointer<IRenderPass> result;
-
-    if (iterator == _hashCache.end())
-    {
+    // The render pass is created without locking, the other threads keep reading the cache.
+    return _hashCache.GetOrCreate(renderPassCacheKey, [&]() {
         RenderPassDescription renderPassDesc = {};
         renderPassDesc.Attachments           = System::List<RenderPassAttachment>(renderPassCacheKey.DepthStencilViewFormat == TextureFormat::Unknown ? renderPassCacheKey.RenderTargetViewFormats.GetLength() : renderPassCacheKey.RenderTargetViewFormats.GetLength() + 1);
         renderPassDesc.Subpasses             = System::List<SubpassDescription>(1);
@@ -123,18 +114,8 @@ System::SharedPointer<IRenderPass> VulkanRenderPassCache::GetRenderPass(const Vu
             renderPassDesc.Subpasses[0].RenderTargetReferences[i].SubpassState = ResourceState::RenderTarget;
         }
 
-        System::SharedPointer<IRenderPass> renderPass = GetCreatorDevice()->CreateRenderPass(renderPassDesc);
-
-        _hashCache.Insert({renderPassCacheKey, renderPass});
-
-        result = renderPass;
-    }
-    else
-    {
-        result = iterator->Second;
-    }
-
-    return result;
+        return GetCreatorDevice()->CreateRenderPass(renderPassDesc);
+    });
 }
 
 } // namespace Graphics
@@ -32,11 +32,11 @@ VulkanResourceHeap::VulkanResourceHeap(const ResourceHeapDescription& descriptio
     _currentDescriptorSetGroup = _descriptorPool.GetDescriptorSetGroup();
 }
 
-void VulkanResourceHeap::BindBuffers(Uint32                                              bindingIndex,
-                                     const System::Span<System::SharedPointer<IBuffer>>& buffers,
-                                     const System::Span<Size>&                           offsets,
-                                     const System::Span<Size>&                           sizes,
-                                     Uint32                                              startingArrayIndex)
+void VulkanResourceHeap::BindBuffers(Uint32                                          bindingIndex,
+                                     const System::Span<System::SharedRef<IBuffer>>& buffers,
+                                     const System::Span<Size>&                       offsets,
+                                     const System::Span<Size>&                       sizes,
+                                     Uint32                                          startingArrayIndex)
 {
     // Validates the arguments.
     IResourceHeap::BindBuffers(bindingIndex,
@@ -74,10 +74,10 @@ void VulkanResourceHeap::BindBuffers(Uint32
     _descriptorPool.MarkAllAsNotUpToDate();
 }
 
-void VulkanResourceHeap::BindSamplers(Uint32                                                   bindingIndex,
-                                      const System::Span<System::SharedPointer<ISampler>>&     samplers,
-                                      const System::Span<System::SharedPointer<ITextureView>>& textureViews,
-                                      Uint32                                                   startingArrayIndex)
+void VulkanResourceHeap::BindSamplers(Uint32                                               bindingIndex,
+                                      const System::Span<System::SharedRef<ISampler>>&     samplers,
+                                      const System::Span<System::SharedRef<ITextureView>>& textureViews,
+                                      Uint32                                               startingArrayIndex)
 {
     // Validates the arguments
     IResourceHeap::BindSamplers(bindingIndex,
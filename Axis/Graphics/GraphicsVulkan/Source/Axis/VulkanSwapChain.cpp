@@ -7,6 +7,7 @@
 #include <Axis/DisplayWindow.hpp>
 #include <Axis/Exception.hpp>
 #include <Axis/Math.hpp>
+#include <Axis/Profiler.hpp>
 #include <Axis/VulkanCommandBuffer.hpp>
 #include <Axis/VulkanDeviceContext.hpp>
 #include <Axis/VulkanDeviceQueueFamily.hpp>
@@ -346,6 +347,8 @@ System::SharedPointer<ITextureView> VulkanSwapChain::GetCurrentDepthStencilView(
 
 void VulkanSwapChain::Present(Uint8 syncIntervals)
 {
+    AXIS_PROFILE_SCOPE("VulkanSwapChain::Present");
+
     Bool vSync = syncIntervals != 0;
 
     if (vSync != _vSyncEnabled)
@@ -8,6 +8,7 @@
 
 #include "../../../System/Include/Axis/Config.hpp"
 #include "../../../System/Include/Axis/Enum.hpp"
+#include "../../../System/Include/Axis/InlineList.hpp"
 #include "../../../System/Include/Axis/List.hpp"
 #include "../../../System/Include/Axis/Rectangle.hpp"
 #include "../../../System/Include/Axis/Span.hpp"
@@ -44,7 +45,7 @@ struct RenderTargetBinding final
     /// \note This filed is required (should not be nullptr or empty)
     ///
     /// Each of the attachment in the array is corresponded to the out index in the fragment shader.
-    System::List<System::SharedPointer<ITextureView>> RenderTargetViews = {};
+    System::InlineList<System::SharedPointer<ITextureView>, InlineRenderTargetCount> RenderTargetViews = {};
 
     /// \brief Uses for depth stencil attachment. (optional)
     System::SharedPointer<ITextureView> DepthStencilView = nullptr;
@@ -137,15 +138,15 @@ class AXIS_GRAPHICS_API IDeviceContext : public DeviceChild
     /// \param[in] mipLevelCount The number of texture's mip level to transition, starts from the \a baseMipLevel.
     /// \param[in] discardContent Discards the content of the resource if possible for the better performance.
     /// \param[in] recordState Specifies whether to record the \a `finalState` into the resource.
-    virtual void TransitTextureState(const System::SharedPointer<ITexture>& textureResource,
-                                     ResourceState                          initialState,
-                                     ResourceState                          finalState,
-                                     Uint32                                 baseArrayIndex,
-                                     Uint32                                 arrayLevelCount,
-                                     Uint32                                 baseMipLevel,
-                                     Uint32                                 mipLevelCount,
-                                     Bool                                   discardContent,
-                                     Bool                                   recordState) = 0;
+    virtual void TransitTextureState(System::SharedRef<ITexture> textureResource,
+                                     ResourceState               initialState,
+                                     ResourceState               finalState,
+                                     Uint32                      baseArrayIndex,
+                                     Uint32                      arrayLevelCount,
+                                     Uint32                      baseMipLevel,
+                                     Uint32                      mipLevelCount,
+                                     Bool                        discardContent,
+                                     Bool                        recordState) = 0;
 
     /// \brief Transits the buffer's resource state.
     ///
@@ -155,11 +156,11 @@ class AXIS_GRAPHICS_API IDeviceContext : public DeviceChild
     /// \param[in] finalState The resource state which buffer will be transited to.
     /// \param[in] discardContent Discards the content of the resource if possible for the better performance.
     /// \param[in] recordState Specifies whether to record the \a `finalState` into the resource.
-    virtual void TransitBufferState(const System::SharedPointer<IBuffer>& bufferResource,
-                                    ResourceState                         initialState,
-                                    ResourceState                         finalState,
-                                    Bool                                  discardContent,
-                                    Bool                                  recordState) = 0;
+    virtual void TransitBufferState(System::SharedRef<IBuffer> bufferResource,
+                                    ResourceState              initialState,
+                                    ResourceState              finalState,
+                                    Bool                       discardContent,
+                                    Bool                       recordState) = 0;
 
     /// \brief Copies the data from one buffer to the another.
     ///
@@ -263,10 +264,10 @@ class AXIS_GRAPHICS_API IDeviceContext : public DeviceChild
     ///                    \a vertexBuffers span.
     /// \param[in] stateTransition Specifies the resource's state transition behavior.
     ///
-    virtual void BindVertexBuffers(Uint32                                              firstBinding,
-                                   const System::Span<System::SharedPointer<IBuffer>>& vertexBuffers,
-                                   const System::Span<Size>&                           offsets,
-                                   StateTransition                                     stateTransition = StateTransition::Transit) = 0;
+    virtual void BindVertexBuffers(Uint32                                          firstBinding,
+                                   const System::Span<System::SharedRef<IBuffer>>& vertexBuffers,
+                                   const System::Span<Size>&                       offsets,
+                                   StateTransition                                 stateTransition = StateTransition::Transit) = 0;
 
     /// \brief Binds the index buffer to the context.
     ///
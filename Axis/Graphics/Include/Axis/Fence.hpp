@@ -6,6 +6,7 @@
 #define AXIS_GRAPHICS_FENCE_HPP
 #pragma once
 
+#include "../../../System/Include/Axis/Task.hpp"
 #include "DeviceChild.hpp"
 
 namespace Axis
@@ -33,6 +34,16 @@ class AXIS_GRAPHICS_API IFence : public DeviceChild
     IFence() noexcept;
 };
 
+/// \brief Awaits the fence reaching the value without blocking the frame, the scheduler checks the
+///        fence once per frame.
+///
+/// \param[in] scheduler Scheduler resuming the awaiting coroutine.
+/// \param[in] fence Fence to wait for.
+/// \param[in] value Value the fence must reach.
+AXIS_NODISCARD AXIS_GRAPHICS_API System::TaskScheduler::ConditionAwaiter WaitForFenceAsync(System::TaskScheduler&               scheduler,
+                                                                                           const System::SharedPointer<IFence>& fence,
+                                                                                           Uint64                               value);
+
 } // namespace Graphics
 
 } // namespace Axis
@@ -24,6 +24,9 @@ struct TextureViewDescription;
 struct PipelineDescription;
 struct GraphicsCapability;
 
+/// \brief Number of the render targets which can be bound without allocating memory.
+constexpr Size InlineRenderTargetCount = 4;
+
 /// \brief Defines types of surface formats.
 enum class TextureFormat : Uint8
 {
@@ -43,11 +43,11 @@ class AXIS_GRAPHICS_API IResourceHeap : public DeviceChild
     /// \param[in] offsets The offset of the buffer in each of \a `buffers` span to bind. (Leaves `nullptr` to set all the offsets as 0.)
     /// \param[in] sizes The size of the buffer in each of \a `buffers` span to bind. (Leaves `nullptr` to set all the sizes as the size of each buffer.)
     /// \param[in] startingArrayIndex The index at resource heap's array to start binding the resources.
-    virtual void BindBuffers(Uint32                                              bindingIndex,
-                             const System::Span<System::SharedPointer<IBuffer>>& buffers,
-                             const System::Span<Size>&                           offsets            = nullptr,
-                             const System::Span<Size>&                           sizes              = nullptr,
-                             Uint32                                              startingArrayIndex = 0) = 0;
+    virtual void BindBuffers(Uint32                                          bindingIndex,
+                             const System::Span<System::SharedRef<IBuffer>>& buffers,
+                             const System::Span<Size>&                       offsets            = nullptr,
+                             const System::Span<Size>&                       sizes              = nullptr,
+                             Uint32                                          startingArrayIndex = 0) = 0;
 
     /// \brief Binds the sampler to the resource heap at specified index.
     ///
@@ -55,10 +55,10 @@ class AXIS_GRAPHICS_API IResourceHeap : public DeviceChild
     /// \param[in] samplers The span of sampler objects to bind to the resource heap.
     /// \param[in] textureViews The span of texture views to bind to the resource heap.
     /// \param[in] startingArrayIndex The index at resource heap's array to start binding the resources.
-    virtual void BindSamplers(Uint32                                                   bindingIndex,
-                              const System::Span<System::SharedPointer<ISampler>>&     samplers,
-                              const System::Span<System::SharedPointer<ITextureView>>& textureViews,
-                              Uint32                                                   startingArrayIndex = 0) = 0;
+    virtual void BindSamplers(Uint32                                               bindingIndex,
+                              const System::Span<System::SharedRef<ISampler>>&     samplers,
+                              const System::Span<System::SharedRef<ITextureView>>& textureViews,
+                              Uint32                                               startingArrayIndex = 0) = 0;
 
 protected:
     IResourceHeap(const ResourceHeapDescription& description);
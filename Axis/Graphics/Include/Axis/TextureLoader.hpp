@@ -7,6 +7,8 @@
 #pragma once
 
 #include "../../../System/Include/Axis/FileStream.hpp"
+#include "../../../System/Include/Axis/MappedFileStream.hpp"
+#include "../../../System/Include/Axis/Task.hpp"
 #include "Texture.hpp"
 
 
@@ -23,6 +25,7 @@ namespace Graphics
 class IGraphicsDevice;
 class IDeviceContext;
 class IBuffer;
+class IFence;
 
 /// \brief Informations used in image loading and texture creation.
 struct TextureLoadConfiguration
@@ -67,21 +70,38 @@ class AXIS_GRAPHICS_API TextureLoader
     TextureLoader(System::FileStream&&            fileStream,
                   const TextureLoadConfiguration& loadDescription);
 
+    /// \brief Constructs the texture loader object, decodes the image straight from the mapped file.
+    ///
+    /// \param[in] fileStream The mapped image file, unmapped once the image is decoded.
+    /// \param[in] loadDescription Specifies the image loading configurations.
+    TextureLoader(System::MappedFileStream&&      fileStream,
+                  const TextureLoadConfiguration& loadDescription);
+
     /// \brief Destructor
     ~TextureLoader() noexcept;
 
     /// \brief Creates the texture out of loaded image.
     System::SharedPointer<ITexture> CreateTexture();
 
+    /// \brief Creates the texture out of loaded image without blocking the frame, the task finishes
+    ///        once the GPU has uploaded the image. The loader must outlive the task.
+    ///
+    /// \param[in] scheduler Scheduler resuming the awaiting coroutine.
+    System::Task<System::SharedPointer<ITexture>> CreateTextureAsync(System::TaskScheduler& scheduler);
+
     /// \brief Gets \a `TextureDescription` that used in texture
     ///        creation.
     TextureDescription GetTextureDescription() const;
 
 private:
+    /// Creates the texture and records the upload of the image, without flushing.
+    System::SharedPointer<ITexture> RecordTextureUpload();
+
     /// Private members
     TextureLoadConfiguration       _loadConfiguration = {};
     System::SharedPointer<IBuffer> _stagingBuffer     = {}; // Staging buffer for immutable textures.
-    System::FileStream             _fileStream;
+    System::SharedPointer<IFence>  _uploadFence       = {}; // Signaled once the asynchronous uploads finish.
+    Uint64                         _uploadFenceValue  = 0;  // Value of the last asynchronous upload.
     stbi_uc*                       _pixels      = nullptr;
     Int32                          _texWidth    = 0;
     Int32                          _texHeight   = 0;
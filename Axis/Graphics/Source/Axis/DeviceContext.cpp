@@ -31,15 +31,15 @@ IDeviceContext::IDeviceContext(IGraphicsDevice&    graphicsDevice,
     SupportedQueueOperations(supportedQueueOperations),
     _bindingVertexBuffers(graphicsDevice.GraphicsSystem->GetGraphicsAdapters()[graphicsDevice.GraphicsAdapterIndex].Capability.MaxVertexInputBinding) {}
 
-void IDeviceContext::TransitTextureState(const System::SharedPointer<ITexture>& textureResource,
-                                         ResourceState                          initialState,
-                                         ResourceState                          finalState,
-                                         Uint32                                 baseArrayIndex,
-                                         Uint32                                 arrayLevelCount,
-                                         Uint32                                 baseMipLevel,
-                                         Uint32                                 mipLevelCount,
-                                         Bool                                   discardContent,
-                                         Bool                                   recordState)
+void IDeviceContext::TransitTextureState(System::SharedRef<ITexture> textureResource,
+                                         ResourceState               initialState,
+                                         ResourceState               finalState,
+                                         Uint32                      baseArrayIndex,
+                                         Uint32                      arrayLevelCount,
+                                         Uint32                      baseMipLevel,
+                                         Uint32                      mipLevelCount,
+                                         Bool                        discardContent,
+                                         Bool                        recordState)
 {
     if (!textureResource)
         throw System::InvalidArgumentException("textureResource was nullptr!");
@@ -57,11 +57,11 @@ void IDeviceContext::TransitTextureState(const System::SharedPointer<ITexture>&
         throw System::InvalidArgumentException("baseMipLevel + mipLevelCount was greater than textureResource->Description.MipLevels!");
 }
 
-void IDeviceContext::TransitBufferState(const System::SharedPointer<IBuffer>& bufferResource,
-                                        ResourceState                         initialState,
-                                        ResourceState                         finalState,
-                                        Bool                                  discardContent,
-                                        Bool                                  recordState)
+void IDeviceContext::TransitBufferState(System::SharedRef<IBuffer> bufferResource,
+                                        ResourceState              initialState,
+                                        ResourceState              finalState,
+                                        Bool                       discardContent,
+                                        Bool                       recordState)
 {
     if (!bufferResource)
         throw System::InvalidArgumentException("bufferResource was nullptr!");
@@ -226,10 +226,10 @@ void IDeviceContext::SetRenderTarget(const RenderTargetBinding& renderTargetBind
     _currentRenderTargetBinding = renderTargetBinding;
 }
 
-void IDeviceContext::BindVertexBuffers(Uint32                                              firstBinding,
-                                       const System::Span<System::SharedPointer<IBuffer>>& vertexBuffers,
-                                       const System::Span<Size>&                           offsets,
-                                       StateTransition                                     stateTransition /*StateTransition::Transit*/)
+void IDeviceContext::BindVertexBuffers(Uint32                                          firstBinding,
+                                       const System::Span<System::SharedRef<IBuffer>>& vertexBuffers,
+                                       const System::Span<Size>&                       offsets,
+                                       StateTransition                                 stateTransition /*StateTransition::Transit*/)
 {
     if (!(Bool)(SupportedQueueOperations & QueueOperation::Graphics))
         throw System::InvalidOperationException("this device context did not support graphics operations!");
@@ -266,9 +266,9 @@ void IDeviceContext::BindVertexBuffers(Uint32
     for (const auto& vertexBuffer : vertexBuffers)
     {
         if (offsets)
-            _bindingVertexBuffers[firstBinding + index] = {vertexBuffer, offsets[index]};
+            _bindingVertexBuffers[firstBinding + index] = {(System::SharedPointer<IBuffer>)vertexBuffer, offsets[index]};
         else
-            _bindingVertexBuffers[firstBinding + index] = {vertexBuffer, 0};
+            _bindingVertexBuffers[firstBinding + index] = {(System::SharedPointer<IBuffer>)vertexBuffer, 0};
         index++;
     }
 }
@@ -4,6 +4,7 @@
 
 #include <Axis/GraphicsPch.hpp>
 
+#include <Axis/Exception.hpp>
 #include <Axis/Fence.hpp>
 
 namespace Axis
@@ -15,6 +16,16 @@ namespace Graphics
 // Default constructor
 IFence::IFence() noexcept = default;
 
+System::TaskScheduler::ConditionAwaiter WaitForFenceAsync(System::TaskScheduler&               scheduler,
+                                                          const System::SharedPointer<IFence>& fence,
+                                                          Uint64                               value)
+{
+    if (!fence)
+        throw System::InvalidArgumentException("fence was nullptr!");
+
+    return scheduler.WaitUntil([fence, value]() { return fence->GetCurrentValue() >= value; });
+}
+
 } // namespace Graphics
 
 } // namespace Axis
\ No newline at end of file
@@ -20,11 +20,11 @@ IResourceHeap::IResourceHeap(const ResourceHeapDescription& description) :
     Description(description) {}
 
 // Default constructor
-void IResourceHeap::BindBuffers(Uint32                                              bindingIndex,
-                                const System::Span<System::SharedPointer<IBuffer>>& buffers,
-                                const System::Span<Size>&                           offsets,
-                                const System::Span<Size>&                           sizes,
-                                Uint32                                              startingArrayIndex)
+void IResourceHeap::BindBuffers(Uint32                                          bindingIndex,
+                                const System::Span<System::SharedRef<IBuffer>>& buffers,
+                                const System::Span<Size>&                       offsets,
+                                const System::Span<Size>&                       sizes,
+                                Uint32                                          startingArrayIndex)
 {
     if (!buffers)
         throw System::InvalidArgumentException("`buffers` was nullptr!");
@@ -97,10 +97,10 @@ void IResourceHeap::BindBuffers(Uint32
     }
 }
 
-void IResourceHeap::BindSamplers(Uint32                                                   bindingIndex,
-                                 const System::Span<System::SharedPointer<ISampler>>&     samplers,
-                                 const System::Span<System::SharedPointer<ITextureView>>& textureViews,
-                                 Uint32                                                   startingArrayIndex)
+void IResourceHeap::BindSamplers(Uint32                                               bindingIndex,
+                                 const System::Span<System::SharedRef<ISampler>>&     samplers,
+                                 const System::Span<System::SharedRef<ITextureView>>& textureViews,
+                                 Uint32                                               startingArrayIndex)
 {
     Size arrayIndex = SIZE_MAX;
     Size currIndex  = 0;
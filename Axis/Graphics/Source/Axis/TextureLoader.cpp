@@ -8,8 +8,11 @@
 #include <Axis/Buffer.hpp>
 #include <Axis/DeviceContext.hpp>
 #include <Axis/Exception.hpp>
+#include <Axis/Fence.hpp>
 #include <Axis/GraphicsDevice.hpp>
+#include <Axis/Profiler.hpp>
 #include <Axis/TextureLoader.hpp>
+#include <limits>
 #include <stb_image/stb_image.hpp>
 
 namespace Axis
@@ -32,19 +35,44 @@ static void ValidateTextureLoadConfiguration(const TextureLoadConfiguration& loa
 
 TextureLoader::TextureLoader(System::FileStream&&            fileStream,
                              const TextureLoadConfiguration& loadConfiguration) :
-    _loadConfiguration(loadConfiguration),
-    _fileStream(std::move(fileStream))
+    _loadConfiguration(loadConfiguration)
 {
-    if (!_fileStream.IsOpen())
+    // The file is closed once the image is decoded
+    System::FileStream imageFile = std::move(fileStream);
+
+    if (!imageFile.IsOpen())
         throw System::InvalidArgumentException("fileStream was not opened!");
 
-    if (!_fileStream.CanRead())
+    if (!imageFile.CanRead())
         throw System::InvalidArgumentException("fileStream was not readable!");
 
-    if (!(Bool)(_fileStream.GetFileModes() & System::FileMode::Binary))
+    if (!(Bool)(imageFile.GetFileModes() & System::FileMode::Binary))
         throw System::InvalidArgumentException("fileStream was not in binary mode!");
 
-    _pixels = stbi_load_from_file(_fileStream.GetFileHandle(), &_texWidth, &_texHeight, &_texChannels, STBI_rgb_alpha);
+    _pixels = stbi_load_from_file(imageFile.GetFileHandle(), &_texWidth, &_texHeight, &_texChannels, STBI_rgb_alpha);
+
+    ValidateTextureLoadConfiguration(loadConfiguration);
+
+    if (!_pixels)
+        throw System::ExternalException("Failed to load image!");
+}
+
+TextureLoader::TextureLoader(System::MappedFileStream&&      fileStream,
+                             const TextureLoadConfiguration& loadConfiguration) :
+    _loadConfiguration(loadConfiguration)
+{
+    // The file is unmapped once the image is decoded
+    const System::MappedFileStream imageFile = std::move(fileStream);
+
+    if (!imageFile.IsOpen())
+        throw System::InvalidArgumentException("fileStream was not opened!");
+
+    const System::Span<Byte> imageBytes = imageFile.GetView();
+
+    if (imageBytes.GetLength() > (Size)std::numeric_limits<int>::max())
+        throw System::InvalidArgumentException("fileStream was too large to decode!");
+
+    _pixels = stbi_load_from_memory(imageBytes.GetData(), (int)imageBytes.GetLength(), &_texWidth, &_texHeight, &_texChannels, STBI_rgb_alpha);
 
     ValidateTextureLoadConfiguration(loadConfiguration);
 
@@ -59,6 +87,35 @@ TextureLoader::~TextureLoader() noexcept
 }
 
 System::SharedPointer<ITexture> TextureLoader::CreateTexture()
+{
+    AXIS_PROFILE_SCOPE("TextureLoader::CreateTexture");
+
+    auto texture = RecordTextureUpload();
+
+    _loadConfiguration.ImmediateDeviceContext->Flush();
+
+    return texture;
+}
+
+System::Task<System::SharedPointer<ITexture>> TextureLoader::CreateTextureAsync(System::TaskScheduler& scheduler)
+{
+    auto texture = RecordTextureUpload();
+
+    if (!_uploadFence)
+        _uploadFence = _loadConfiguration.GraphicsDevice->CreateFence(0);
+
+    const Uint64 fenceValue = ++_uploadFenceValue;
+
+    _loadConfiguration.ImmediateDeviceContext->AppendSignalFence(_uploadFence, fenceValue);
+    _loadConfiguration.ImmediateDeviceContext->Flush();
+
+    // Keeps the frames going while the GPU copies the image.
+    co_await WaitForFenceAsync(scheduler, _uploadFence, fenceValue);
+
+    co_return texture;
+}
+
+System::SharedPointer<ITexture> TextureLoader::RecordTextureUpload()
 {
     auto textureDescription = GetTextureDescription();
     auto texture            = _loadConfiguration.GraphicsDevice->CreateTexture(textureDescription);
@@ -100,8 +157,6 @@ System::SharedPointer<ITexture> TextureLoader::CreateTexture()
         _loadConfiguration.ImmediateDeviceContext->GenerateMips(defaultTextureView);
     }
 
-    _loadConfiguration.ImmediateDeviceContext->Flush();
-
     return texture;
 }
 
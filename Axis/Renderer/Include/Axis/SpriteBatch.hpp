@@ -11,9 +11,10 @@
 #include "../../Graphics/Include/Axis/Sampler.hpp"
 #include "../../Graphics/Include/Axis/ShaderModule.hpp"
 #include "../../System/Include/Axis/Event.hpp"
-#include "../../System/Include/Axis/HashMap.hpp"
+#include "../../System/Include/Axis/FlatHashMap.hpp"
 #include "../../System/Include/Axis/SmartPointer.hpp"
 #include "../../System/Include/Axis/StringView.hpp"
+#include "../../System/Include/Axis/TrackingAllocator.hpp"
 #include "../../System/Include/Axis/Vector2.hpp"
 #include "RendererExport.hpp"
 
@@ -241,10 +242,17 @@ class AXIS_RENDERER_API SpriteBatch final : public System::ISharedFromThis
                                        const Graphics::SamplerDescription&) const noexcept;
     };
 
+    /// Tag of the sprite batch's allocations in `System::AllocationTracker`
+    struct AllocationTag
+    {
+        static constexpr const char* Name = "Renderer::SpriteBatch";
+    };
+
     /// Using
-    using PipelineCache = System::HashMap<PipelineStateKey, System::SharedPointer<Graphics::IGraphicsPipeline>, PipelineStateKey::Hasher>;
-    using SamplerCache  = System::HashMap<Graphics::SamplerDescription, System::SharedPointer<Graphics::ISampler>, SamplerDescriptionHasher, SamplerDescriptionComparer>;
-    using IndexType     = Uint16; // Index buffer's index type
+    using PipelineCache  = System::FlatHashMap<PipelineStateKey, System::SharedPointer<Graphics::IGraphicsPipeline>, PipelineStateKey::Hasher>;
+    using SamplerCache   = System::FlatHashMap<Graphics::SamplerDescription, System::SharedPointer<Graphics::ISampler>, SamplerDescriptionHasher, SamplerDescriptionComparer>;
+    using IndexType      = Uint16;                                                               // Index buffer's index type
+    using BatchAllocator = System::TaggedAllocator<AllocationTag, System::FrameArenaAllocator>; // Allocator of the per-frame batch lists
 
     /// Private method
     System::SharedPointer<Graphics::IGraphicsPipeline> GetGraphicsPipeline(const PipelineStateKey& key);
@@ -287,10 +295,11 @@ class AXIS_RENDERER_API SpriteBatch final : public System::ISharedFromThis
     /// Batch states
     System::SharedPointer<Graphics::IBuffer> _vertexBuffer = {};
     System::SharedPointer<Graphics::IBuffer> _indexBuffer  = {};
-    System::List<Vertex>                     _vertices     = {}; // Contains vertices data
-    System::List<IndexType>                  _indices      = {}; // Contains indices data
-    Bool                                     _isBegun      = false;
-    Size                                     _spriteCount  = 0;
+    System::List<Vertex, BatchAllocator>     _vertices         = {};       // Contains vertices data (per-frame memory)
+    System::List<IndexType, BatchAllocator>  _indices          = {};       // Contains indices data (per-frame memory)
+    Size                                     _arenaFrameNumber = ~(Size)0; // Frame arena's frame number in which the lists were allocated
+    Bool                                     _isBegun          = false;
+    Size                                     _spriteCount      = 0;
 
     /// Graphics states
     PipelineStateKey                                   _currentPipelineStateKey   = {};      // Current pipeline state key (Used in caching)
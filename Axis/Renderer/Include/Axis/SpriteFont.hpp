@@ -8,7 +8,9 @@
 
 #include "../../../Graphics/Include/Axis/Texture.hpp"
 #include "../../../System/Include/Axis/FileStream.hpp"
-#include "../../../System/Include/Axis/HashMap.hpp"
+#include "../../../System/Include/Axis/FlatHashMap.hpp"
+#include "../../../System/Include/Axis/MappedFileStream.hpp"
+#include "../../../System/Include/Axis/Nullable.hpp"
 #include "../../../System/Include/Axis/Rectangle.hpp"
 #include "../../../System/Include/Axis/SmartPointer.hpp"
 #include "../../../System/Include/Axis/Vector2.hpp"
@@ -100,6 +102,15 @@ class AXIS_RENDERER_API SpriteFont : public System::ISharedFromThis
                Uint32                        size,
                const FontAtlasConfiguration& atlasConfiguration);
 
+    /// \brief Loads font straight from the mapped font file, without copying it.
+    ///
+    /// \param[in] fileStream Mapped true type font file, kept mapped for the font's lifetime.
+    /// \param[in] size Size or height of the font (in pixel).
+    /// \param[in] atlasConfiguration Configuration of the font atlas texture.
+    SpriteFont(System::MappedFileStream&&    fileStream,
+               Uint32                        size,
+               const FontAtlasConfiguration& atlasConfiguration);
+
     /// \brief Loads font from the specified font data.
     ///
     /// \param[in] fontData True type font data. The font data will be copied.
@@ -119,12 +130,12 @@ class AXIS_RENDERER_API SpriteFont : public System::ISharedFromThis
     /// \brief Gets characters atlas texture rectangle map.
     ///
     /// \return Characters atlas texture rectangle map.
-    inline const System::HashMap<WChar, System::RectangleUI>& GetCharactersRectangleMap() const noexcept { return _charRects; }
+    inline const System::FlatHashMap<WChar, System::RectangleUI>& GetCharactersRectangleMap() const noexcept { return _charRects; }
 
     /// \brief Gets characters glyph map.
     ///
     /// \return Characters glyph map.
-    inline const System::HashMap<WChar, Glyph>& GetCharacterGlyphsMap() const noexcept { return _charGlyphs; }
+    inline const System::FlatHashMap<WChar, Glyph>& GetCharacterGlyphsMap() const noexcept { return _charGlyphs; }
 
     /// \brief Gets font size.
     ///
@@ -169,17 +180,18 @@ class AXIS_RENDERER_API SpriteFont : public System::ISharedFromThis
     };
     void Initialize(); ///< Initializes the font
 
-    FontFaceRAII                                  _fontFace      = nullptr; // FT_Face
-    System::UniquePointer<Byte[]>                 _fontByte      = nullptr;
-    Size                                          _fontByteSize  = 0;
-    Uint32                                        _fontSize      = 0;       // Font Size
-    System::SharedPointer<Graphics::ITexture>     _fontAtlas     = nullptr; // Font atlas texture
-    System::SharedPointer<Graphics::ITextureView> _fontAtlasView = nullptr; // Font atlas texture view
-    System::HashMap<WChar, System::RectangleUI>   _charRects     = {};      // Character rectangles
-    System::HashMap<WChar, System::RectangleUI>   _charDebug     = {};      // Character rectangles
-    System::HashMap<WChar, Glyph>                 _charGlyphs    = {};      // Character glyphs
-    FontAtlasConfiguration                        _atlasConfig   = {};      // Font atlas configuration
-    Size                                          _lineHeight    = 0;       // Line height
+    System::UniquePointer<Byte[]>                   _fontByte      = nullptr; // Copied font file
+    System::Nullable<System::MappedFileStream>      _fontFile      = nullptr; // Mapped font file
+    System::Span<Byte>                              _fontBytes     = nullptr; // Font file read by the font face
+    FontFaceRAII                                    _fontFace      = nullptr; // FT_Face, released before the font file
+    Uint32                                          _fontSize      = 0;       // Font Size
+    System::SharedPointer<Graphics::ITexture>       _fontAtlas     = nullptr; // Font atlas texture
+    System::SharedPointer<Graphics::ITextureView>   _fontAtlasView = nullptr; // Font atlas texture view
+    System::FlatHashMap<WChar, System::RectangleUI> _charRects     = {};      // Character rectangles
+    System::FlatHashMap<WChar, System::RectangleUI> _charDebug     = {};      // Character rectangles
+    System::FlatHashMap<WChar, Glyph>               _charGlyphs    = {};      // Character glyphs
+    FontAtlasConfiguration                          _atlasConfig   = {};      // Font atlas configuration
+    Size                                            _lineHeight    = 0;       // Line height
 };
 
 } // namespace Renderer
@@ -13,6 +13,7 @@
 #include <Axis/GraphicsPipeline.hpp>
 #include <Axis/Matrix.hpp>
 #include <Axis/Pipeline.hpp>
+#include <Axis/Profiler.hpp>
 #include <Axis/RendererPch.hpp>
 #include <Axis/ResourceHeap.hpp>
 #include <Axis/ResourceHeapLayout.hpp>
@@ -148,7 +149,7 @@ SpriteBatch::SpriteBatch(const System::SharedPointer<Graphics::IGraphicsDevice>&
 
     UpdateTranslationMatrix();
 
-    System::SharedPointer<Graphics::IBuffer> uniformBuffers[] = {_currentMatrixTranslation};
+    System::SharedRef<Graphics::IBuffer> uniformBuffers[] = {_currentMatrixTranslation};
 
     _resourceHeap->BindBuffers(0, uniformBuffers);
 
@@ -219,6 +220,19 @@ void SpriteBatch::Begin()
         _graphicsStateChanged = false;
     }
 
+    // The batch lists are allocated from the frame arena, allocates them again once the arena moved on to the next frame.
+    if (_arenaFrameNumber != System::FrameArenaAllocator::GetFrameNumber())
+    {
+        _vertices = {};
+        _indices  = {};
+
+        // Reserves the whole batch up front, the lists never grow beyond it
+        _vertices.ReserveFor(_maxSpriteCountsPerBatch * 4);
+        _indices.ReserveFor(_maxSpriteCountsPerBatch * 6);
+
+        _arenaFrameNumber = System::FrameArenaAllocator::GetFrameNumber();
+    }
+
     _isBegun = true;
 }
 
@@ -500,45 +514,40 @@ SpriteBatch::Vertex::Vertex(const System::Vector3F& position,
 
 Size SpriteBatch::PipelineStateKey::Hasher::operator()(const SpriteBatch::PipelineStateKey& pipelineStateKey) const noexcept
 {
-    Size hash = 0;
-
-    hash = System::Math::HashCombine(hash, (Size)pipelineStateKey.Blend.BlendEnable);
-    hash = System::Math::HashCombine(hash, System::Enum::GetUnderlyingValue(pipelineStateKey.Blend.DestAlphaBlendFactor));
-    hash = System::Math::HashCombine(hash, System::Enum::GetUnderlyingValue(pipelineStateKey.Blend.DestColorBlendFactor));
-    hash = System::Math::HashCombine(hash, System::Enum::GetUnderlyingValue(pipelineStateKey.Blend.SourceAlphaBlendFactor));
-    hash = System::Math::HashCombine(hash, System::Enum::GetUnderlyingValue(pipelineStateKey.Blend.SourceAlphaBlendFactor));
-    hash = System::Math::HashCombine(hash, System::Enum::GetUnderlyingValue(pipelineStateKey.Blend.AlphaOperation));
-    hash = System::Math::HashCombine(hash, System::Enum::GetUnderlyingValue(pipelineStateKey.Blend.ColorOperation));
-    hash = System::Math::HashCombine(hash, System::Enum::GetUnderlyingValue(pipelineStateKey.Blend.WriteChannelFlags));
-
-    hash = System::Math::HashCombine(hash, (Size)pipelineStateKey.Depth.DepthTestEnable);
-    hash = System::Math::HashCombine(hash, (Size)pipelineStateKey.Depth.DepthWriteEnable);
-    hash = System::Math::HashCombine(hash, (Size)pipelineStateKey.Depth.StencilEnable);
-    hash = System::Math::HashCombine(hash, (Size)pipelineStateKey.Depth.StencilReadMask);
-    hash = System::Math::HashCombine(hash, (Size)pipelineStateKey.Depth.StencilWriteMask);
-    hash = System::Math::HashCombine(hash, System::Enum::GetUnderlyingValue(pipelineStateKey.Depth.DepthCompareFunction));
-    hash = System::Math::HashCombine(hash, System::Enum::GetUnderlyingValue(pipelineStateKey.Depth.BackFaceStencilOperation.StencilCompareFunction));
-    hash = System::Math::HashCombine(hash, System::Enum::GetUnderlyingValue(pipelineStateKey.Depth.BackFaceStencilOperation.StencilFailOperation));
-    hash = System::Math::HashCombine(hash, System::Enum::GetUnderlyingValue(pipelineStateKey.Depth.BackFaceStencilOperation.StencilPassDepthPassOperation));
-    hash = System::Math::HashCombine(hash, System::Enum::GetUnderlyingValue(pipelineStateKey.Depth.BackFaceStencilOperation.StencilPassDepthFailOperation));
-    hash = System::Math::HashCombine(hash, System::Enum::GetUnderlyingValue(pipelineStateKey.Depth.FrontFaceStencilOperation.StencilCompareFunction));
-    hash = System::Math::HashCombine(hash, System::Enum::GetUnderlyingValue(pipelineStateKey.Depth.FrontFaceStencilOperation.StencilFailOperation));
-    hash = System::Math::HashCombine(hash, System::Enum::GetUnderlyingValue(pipelineStateKey.Depth.FrontFaceStencilOperation.StencilPassDepthPassOperation));
-    hash = System::Math::HashCombine(hash, System::Enum::GetUnderlyingValue(pipelineStateKey.Depth.FrontFaceStencilOperation.StencilPassDepthFailOperation));
-
-    Uint32 depthBiasClampHash       = (*(Uint32*)(&pipelineStateKey.Rasterizer.DepthBiasClamp));
-    Uint32 slopeScaledDepthBiasHash = (*(Uint32*)(&pipelineStateKey.Rasterizer.SlopeScaledDepthBias));
-
-    hash = System::Math::HashCombine(hash, (Size)pipelineStateKey.Rasterizer.DepthClipEnable);
-    hash = System::Math::HashCombine(hash, (Size)pipelineStateKey.Rasterizer.ScissorTestEnable);
-    hash = System::Math::HashCombine(hash, (Size)pipelineStateKey.Rasterizer.DepthBias);
-    hash = System::Math::HashCombine(hash, (Size)depthBiasClampHash);
-    hash = System::Math::HashCombine(hash, (Size)slopeScaledDepthBiasHash);
-    hash = System::Math::HashCombine(hash, System::Enum::GetUnderlyingValue(pipelineStateKey.Rasterizer.FaceCulling));
-    hash = System::Math::HashCombine(hash, System::Enum::GetUnderlyingValue(pipelineStateKey.Rasterizer.FrontFaceWinding));
-    hash = System::Math::HashCombine(hash, System::Enum::GetUnderlyingValue(pipelineStateKey.Rasterizer.PrimitiveFillMode));
-
-    return hash;
+    const auto& blend      = pipelineStateKey.Blend;
+    const auto& depth      = pipelineStateKey.Depth;
+    const auto& rasterizer = pipelineStateKey.Rasterizer;
+
+    return System::Hashing::HashValues(blend.BlendEnable,
+                                       blend.SourceColorBlendFactor,
+                                       blend.DestColorBlendFactor,
+                                       blend.SourceAlphaBlendFactor,
+                                       blend.DestAlphaBlendFactor,
+                                       blend.ColorOperation,
+                                       blend.AlphaOperation,
+                                       blend.WriteChannelFlags,
+                                       depth.DepthTestEnable,
+                                       depth.DepthWriteEnable,
+                                       depth.StencilEnable,
+                                       depth.StencilReadMask,
+                                       depth.StencilWriteMask,
+                                       depth.DepthCompareFunction,
+                                       depth.BackFaceStencilOperation.StencilCompareFunction,
+                                       depth.BackFaceStencilOperation.StencilFailOperation,
+                                       depth.BackFaceStencilOperation.StencilPassDepthPassOperation,
+                                       depth.BackFaceStencilOperation.StencilPassDepthFailOperation,
+                                       depth.FrontFaceStencilOperation.StencilCompareFunction,
+                                       depth.FrontFaceStencilOperation.StencilFailOperation,
+                                       depth.FrontFaceStencilOperation.StencilPassDepthPassOperation,
+                                       depth.FrontFaceStencilOperation.StencilPassDepthFailOperation,
+                                       rasterizer.DepthClipEnable,
+                                       rasterizer.ScissorTestEnable,
+                                       rasterizer.DepthBias,
+                                       rasterizer.DepthBiasClamp,
+                                       rasterizer.SlopeScaledDepthBias,
+                                       rasterizer.FaceCulling,
+                                       rasterizer.FrontFaceWinding,
+                                       rasterizer.PrimitiveFillMode);
 }
 
 Bool SpriteBatch::PipelineStateKey::operator==(const SpriteBatch::PipelineStateKey& pipelineStateKey) const noexcept
@@ -581,37 +590,21 @@ Bool SpriteBatch::PipelineStateKey::operator==(const SpriteBatch::PipelineStateK
 
 Size SpriteBatch::SamplerDescriptionHasher::operator()(const Graphics::SamplerDescription& samplerDescription) const noexcept
 {
-    Size hash = 0;
-    hash      = System::Math::HashCombine(hash, (Size)samplerDescription.MaxAnisotropyLevel);
-    hash      = System::Math::HashCombine(hash, (Size)samplerDescription.AnisotropyEnable);
-    hash      = System::Math::HashCombine(hash, System::Enum::GetUnderlyingValue(samplerDescription.AddressModeU));
-    hash      = System::Math::HashCombine(hash, System::Enum::GetUnderlyingValue(samplerDescription.AddressModeV));
-    hash      = System::Math::HashCombine(hash, System::Enum::GetUnderlyingValue(samplerDescription.AddressModeW));
-
-    Uint32 colorRHash = (*(Uint32*)(&samplerDescription.BorderColor.R));
-    Uint32 colorGHash = (*(Uint32*)(&samplerDescription.BorderColor.G));
-    Uint32 colorBHash = (*(Uint32*)(&samplerDescription.BorderColor.B));
-    Uint32 colorAHash = (*(Uint32*)(&samplerDescription.BorderColor.A));
-
-    Uint32 loadBias = (*(Uint32*)(&samplerDescription.MipLODBias));
-    Uint32 minLoad  = (*(Uint32*)(&samplerDescription.MinLOD));
-    Uint32 maxLoad  = (*(Uint32*)(&samplerDescription.MaxLOD));
-
-    hash = System::Math::HashCombine(hash, colorRHash);
-    hash = System::Math::HashCombine(hash, colorGHash);
-    hash = System::Math::HashCombine(hash, colorBHash);
-    hash = System::Math::HashCombine(hash, colorAHash);
-
-    hash = System::Math::HashCombine(hash, loadBias);
-    hash = System::Math::HashCombine(hash, minLoad);
-    hash = System::Math::HashCombine(hash, maxLoad);
-
-
-    hash = System::Math::HashCombine(hash, System::Enum::GetUnderlyingValue(samplerDescription.MagFilter));
-    hash = System::Math::HashCombine(hash, System::Enum::GetUnderlyingValue(samplerDescription.MinFilter));
-    hash = System::Math::HashCombine(hash, System::Enum::GetUnderlyingValue(samplerDescription.MipFilter));
-
-    return hash;
+    return System::Hashing::HashValues(samplerDescription.MinFilter,
+                                       samplerDescription.MagFilter,
+                                       samplerDescription.MipFilter,
+                                       samplerDescription.AddressModeU,
+                                       samplerDescription.AddressModeV,
+                                       samplerDescription.AddressModeW,
+                                       samplerDescription.MipLODBias,
+                                       samplerDescription.AnisotropyEnable,
+                                       samplerDescription.MaxAnisotropyLevel,
+                                       samplerDescription.BorderColor.R,
+                                       samplerDescription.BorderColor.G,
+                                       samplerDescription.BorderColor.B,
+                                       samplerDescription.BorderColor.A,
+                                       samplerDescription.MinLOD,
+                                       samplerDescription.MaxLOD);
 }
 
 Bool SpriteBatch::SamplerDescriptionComparer::operator()(const Graphics::SamplerDescription& LHS, const Graphics::SamplerDescription& RHS) const noexcept
@@ -761,6 +754,8 @@ void SpriteBatch::PreDraw(const System::SharedPointer<Graphics::ITextureView>& t
 
 void SpriteBatch::Flush()
 {
+    AXIS_PROFILE_SCOPE("SpriteBatch::Flush");
+
     if (!_currentTextureView)
         return;
 
@@ -786,9 +781,10 @@ void SpriteBatch::Flush()
         _immediateGraphicsDeviceContext->UnmapBuffer(_indexBuffer);
     }
 
-    System::SharedPointer<Graphics::ISampler>     samplers[]      = {_currentSampler};
-    System::SharedPointer<Graphics::ITextureView> textureViews[]  = {_currentTextureView};
-    System::SharedPointer<Graphics::IBuffer>      vertexBuffers[] = {_vertexBuffer};
+    // Borrowed, the bindings acquire the references they keep
+    System::SharedRef<Graphics::ISampler>     samplers[]      = {_currentSampler};
+    System::SharedRef<Graphics::ITextureView> textureViews[]  = {_currentTextureView};
+    System::SharedRef<Graphics::IBuffer>      vertexBuffers[] = {_vertexBuffer};
 
     // Binds sampler to the resource heap
     _resourceHeap->BindSamplers(1, samplers, textureViews);
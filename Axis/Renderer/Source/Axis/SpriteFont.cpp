@@ -59,8 +59,8 @@ SpriteFont::SpriteFont(System::FileStream&           fileStream,
         // Copies all the data from the file stream to the buffer
         _fontByte = System::UniquePointer<Byte[]>(Axis::System::NewArray<Byte>(fileStream.GetLength()));
 
-        // Stores the font byte size
-        _fontByteSize = fileStream.GetLength();
+        // Stores the font bytes
+        _fontBytes = System::Span<Byte>(_fontByte.GetPointer(), _fontByte.GetPointer() + fileStream.GetLength());
 
         // Reads the file stream into the buffer
         fileStream.Read(_fontByte.GetPointer(), 0, fileStream.GetLength());
@@ -69,6 +69,25 @@ SpriteFont::SpriteFont(System::FileStream&           fileStream,
     Initialize();
 }
 
+SpriteFont::SpriteFont(System::MappedFileStream&&    fileStream,
+                       Uint32                        fontSize,
+                       const FontAtlasConfiguration& atlasConfiguration) :
+    _fontFile(std::move(fileStream)),
+    _fontSize(fontSize),
+    _atlasConfig(atlasConfiguration)
+{
+    if (!_fontFile->IsOpen())
+        throw System::IOException("MappedFileStream was not open!");
+
+    // The atlas renders every glyph of the range right away, reads in the most of the file
+    _fontFile->Prefetch(0, _fontFile->GetLength());
+
+    // The font face reads the mapping directly, it stays mapped as long as the font
+    _fontBytes = _fontFile->GetView();
+
+    Initialize();
+}
+
 SpriteFont::SpriteFont(CPVoid                        fontData,
                        Size                          fontDataSize,
                        Uint32                        fontSize,
@@ -89,6 +108,9 @@ SpriteFont::SpriteFont(CPVoid                        fontData,
 
         // Copies the font data
         std::memcpy(_fontByte.GetPointer(), fontData, fontDataSize);
+
+        // Stores the font bytes
+        _fontBytes = System::Span<Byte>(_fontByte.GetPointer(), _fontByte.GetPointer() + fontDataSize);
     }
 
     Initialize();
@@ -214,7 +236,7 @@ void SpriteFont::Initialize()
         FT_Face ftFace = nullptr;
 
         // Creates the font face
-        if (FT_New_Memory_Face(s_FreetypeLibrary, _fontByte.GetPointer(), FT_Long(_fontByteSize), FT_Long{0}, &ftFace))
+        if (FT_New_Memory_Face(s_FreetypeLibrary, _fontBytes.GetData(), FT_Long(_fontBytes.GetLength()), FT_Long{0}, &ftFace))
             throw System::ExternalException("Freetype library failed to create a new font face");
 
         _fontFace = FontFaceRAII(ftFace);
@@ -332,7 +354,7 @@ void SpriteFont::Initialize()
     _fontAtlas     = _atlasConfig.GraphicsDevice->CreateTexture(textureDescription);
     _fontAtlasView = _fontAtlas->CreateDefaultTextureView();
 
-    System::HashMap<WChar, Size> charOffsetMap = {};
+    System::FlatHashMap<WChar, Size> charOffsetMap = {};
     charOffsetMap.Reserve(result.SpriteLocations.GetSize());
 
     // Maps the staging buffer
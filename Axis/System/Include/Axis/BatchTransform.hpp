@@ -0,0 +1,89 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#ifndef AXIS_SYSTEM_BATCHTRANSFORM_HPP
+#define AXIS_SYSTEM_BATCHTRANSFORM_HPP
+#pragma once
+
+#include "Config.hpp"
+#include "Matrix.hpp"
+#include "Span.hpp"
+#include "SystemExport.hpp"
+#include "Vector2.hpp"
+#include "Vector3.hpp"
+
+namespace Axis
+{
+
+namespace System
+{
+
+// The batch kernels process the points 8 at a time with AVX2 or 4 at a time with SSE2, the
+// arrays don't need to be aligned and the remaining points go through a padded buffer.
+// The destination can be the same array as the source, but mustn't partially overlap it.
+namespace Math
+{
+    /// \brief Transforms the points by the matrix, as \a `FloatMatrix4x4::TransformPoint` does.
+    ///
+    /// \param[in] points Points to transform.
+    /// \param[in] matrix Transformation matrix.
+    /// \param[out] destination Buffer with room for \a `points.GetLength()` points.
+    AXIS_SYSTEM_API void TransformPoints(const Span<Vector3F>& points,
+                                         const FloatMatrix4x4& matrix,
+                                         Vector3F*             destination) noexcept;
+
+    /// \brief Transforms the points stored as the separate arrays of the components.
+    ///
+    /// \param[in] x X components of the points.
+    /// \param[in] y Y components of the points.
+    /// \param[in] z Z components of the points.
+    /// \param[in] count Number of the points.
+    /// \param[in] matrix Transformation matrix.
+    /// \param[out] destinationX Buffer with room for \a `count` X components.
+    /// \param[out] destinationY Buffer with room for \a `count` Y components.
+    /// \param[out] destinationZ Buffer with room for \a `count` Z components.
+    AXIS_SYSTEM_API void TransformPoints(const Float32*        x,
+                                         const Float32*        y,
+                                         const Float32*        z,
+                                         Size                  count,
+                                         const FloatMatrix4x4& matrix,
+                                         Float32*              destinationX,
+                                         Float32*              destinationY,
+                                         Float32*              destinationZ) noexcept;
+
+    /// \brief Rotates the points around the origin, then translates them.
+    ///
+    /// \param[in] points Points to transform.
+    /// \param[in] rotation Counterclockwise rotation in radian.
+    /// \param[in] translation Translation applied after the rotation.
+    /// \param[out] destination Buffer with room for \a `points.GetLength()` points.
+    AXIS_SYSTEM_API void RotateTranslate2D(const Span<Vector2F>& points,
+                                           Float32               rotation,
+                                           const Vector2F&       translation,
+                                           Vector2F*             destination) noexcept;
+
+    /// \brief Rotates the points stored as the separate arrays of the components, then translates them.
+    ///
+    /// \param[in] x X components of the points.
+    /// \param[in] y Y components of the points.
+    /// \param[in] count Number of the points.
+    /// \param[in] rotation Counterclockwise rotation in radian.
+    /// \param[in] translation Translation applied after the rotation.
+    /// \param[out] destinationX Buffer with room for \a `count` X components.
+    /// \param[out] destinationY Buffer with room for \a `count` Y components.
+    AXIS_SYSTEM_API void RotateTranslate2D(const Float32*  x,
+                                           const Float32*  y,
+                                           Size            count,
+                                           Float32         rotation,
+                                           const Vector2F& translation,
+                                           Float32*        destinationX,
+                                           Float32*        destinationY) noexcept;
+
+} // namespace Math
+
+} // namespace System
+
+} // namespace Axis
+
+#endif // AXIS_SYSTEM_BATCHTRANSFORM_HPP
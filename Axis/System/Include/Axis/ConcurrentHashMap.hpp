@@ -0,0 +1,231 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#ifndef AXIS_SYSTEM_CONCURRENTHASHMAP_HPP
+#define AXIS_SYSTEM_CONCURRENTHASHMAP_HPP
+#pragma once
+
+#include "ConcurrentQueue.hpp"
+#include "HashSet.hpp"
+#include "Hashing.hpp"
+#include "Nullable.hpp"
+#include "SystemExport.hpp"
+#include <mutex>
+
+namespace Axis
+{
+
+namespace System
+{
+
+namespace Detail
+{
+
+/// \brief Marks the calling thread as reading the shared nodes for the lifetime of the guard; the
+///        nodes retired meanwhile aren't freed until the guard is destroyed.
+///
+/// Epoch-based reclamation shared by all the concurrent containers: the writers retire the
+/// unlinked nodes with the current global epoch, and the nodes are freed once the epoch has
+/// advanced twice, which only happens after every thread inside a guard has observed the newer
+/// epoch. The guards can be nested.
+///
+/// \private
+class AXIS_SYSTEM_API EpochGuard final
+{
+public:
+    /// \brief Enters the current epoch, registers the thread on its first guard.
+    EpochGuard();
+
+    /// \brief Leaves the epoch, the outermost guard lets the epoch advance past it.
+    ~EpochGuard() noexcept;
+
+    EpochGuard(const EpochGuard&) = delete;
+    EpochGuard& operator=(const EpochGuard&) = delete;
+};
+
+/// \brief Function freeing the retired object.
+using RetiredDeleter = void (*)(PVoid owner, PVoid object) noexcept;
+
+/// \brief Frees the object once no thread can still be reading it.
+///
+/// \param[in] owner Container the object belongs to, passed to the deleter.
+/// \param[in] object Object unlinked from the container.
+/// \param[in] deleter Function freeing the object.
+///
+/// \private
+AXIS_SYSTEM_API void RetireObject(PVoid          owner,
+                                  PVoid          object,
+                                  RetiredDeleter deleter);
+
+/// \brief Frees all the retired objects of the owner right away, called by the destructor of the
+///        container once no thread can read it.
+///
+/// \private
+AXIS_SYSTEM_API void ReclaimObjects(PVoid owner) noexcept;
+
+} // namespace Detail
+
+/// \brief Advances the epoch shared by the concurrent containers and frees their removed nodes and
+///        values which no reader can reach anymore.
+///
+/// The containers only reclaim on their own once a batch of the nodes has been removed; call this
+/// once per frame when the removed values hold the resources which must be released in time
+/// (e.g. the cached framebuffers and their views). The nodes removed while the calling thread is
+/// inside a \a `Detail::EpochGuard` stay alive.
+AXIS_SYSTEM_API void ReclaimRemovedNodes();
+
+/// \brief Hash map which can be read, inserted into and removed from by many threads at once,
+///        suitable for the caches shared across the threads (the pipelines, the render passes and
+///        the samplers).
+///
+/// The map is split into \a `ShardCount` shards by the key's hash. The lookups take no locks:
+/// they walk the bucket chains through the atomic pointers inside an \a `Detail::EpochGuard`,
+/// so the removed nodes and the replaced bucket arrays stay alive until no reader can reach them.
+/// The writers lock only the shard of the key.
+///
+/// The values are returned by copy, e.g. \a `SharedPointer`s, since the stored one may be removed
+/// by the other thread right after the lookup. Iteration isn't provided, see \a `ForEach`.
+///
+/// \tparam TKey Type of key object.
+/// \tparam TValue Type of value object.
+/// \tparam Hasher Type of hasher object.
+/// \tparam Comparer Type of comparer object.
+/// \tparam Allocator Memory allocator of the nodes and the bucket arrays.
+template <RawType TKey, RawType TValue, HasherType<TKey> Hasher = Hash<TKey>, ComparerType<TKey> Comparer = EqualityComparer<TKey>, AllocatorType Allocator = DefaultAllocator>
+class ConcurrentHashMap final : private Detail::AllocatorStorage<Allocator>
+{
+    static_assert(std::is_copy_constructible_v<TValue>, "ConcurrentHashMap values are returned by copy");
+
+public:
+    /// \brief Number of the independently locked shards.
+    static constexpr Size ShardCount = 16;
+
+    /// \brief Constructs the empty map, no memory is allocated.
+    ConcurrentHashMap() noexcept(std::is_nothrow_default_constructible_v<Allocator>) = default;
+
+    /// \brief Constructs the empty map, no memory is allocated.
+    ///
+    /// \param[in] allocator Allocator instance used by the map.
+    explicit ConcurrentHashMap(const Allocator& allocator) noexcept;
+
+    /// \brief Destroys all the pairs, no thread may be using the map.
+    ~ConcurrentHashMap() noexcept;
+
+    ConcurrentHashMap(const ConcurrentHashMap&) = delete;
+    ConcurrentHashMap& operator=(const ConcurrentHashMap&) = delete;
+
+    /// \brief Gets the number of the pairs, only exact when no thread is writing.
+    AXIS_NODISCARD Size GetLength() const noexcept;
+
+    /// \brief Finds the value of the key without locking.
+    ///
+    /// \return Copy of the value, or null if the key isn't in the map.
+    AXIS_NODISCARD Nullable<TValue> Find(const TKey& key) const;
+
+    /// \brief Checks whether the key is in the map without locking.
+    AXIS_NODISCARD Bool Contains(const TKey& key) const;
+
+    /// \brief Inserts the pair if the key isn't in the map yet.
+    ///
+    /// \return true if the pair was inserted, false if the key was already there.
+    template <class... Args>
+    Bool TryInsert(const TKey& key,
+                   Args&&... args) requires(std::is_constructible_v<TValue, Args...>);
+
+    /// \brief Gets the value of the key, or inserts the value created by the factory.
+    ///
+    /// The lookup takes no locks. On a miss the factory runs without holding any lock, so the
+    /// slow creations (e.g. the pipeline compilation) don't block the other threads; if another
+    /// thread has inserted the key meanwhile, the created value is dropped and the stored one is
+    /// returned, so all the threads agree on one value.
+    ///
+    /// \param[in] key Key to look up.
+    /// \param[in] factory Function creating the value, `TValue()`.
+    ///
+    /// \return Copy of the stored value.
+    template <class Factory>
+    TValue GetOrCreate(const TKey& key,
+                       Factory&&   factory) requires(std::is_constructible_v<TValue, std::invoke_result_t<Factory&>>);
+
+    /// \brief Removes the pair of the key, the node is freed once no reader can reach it, see
+    ///        \a `ReclaimRemovedNodes`.
+    ///
+    /// \return true if the key was in the map.
+    Bool Remove(const TKey& key);
+
+    /// \brief Removes the pairs matching the predicate, `Bool(const TKey&, const TValue&)`.
+    ///
+    /// \return Number of the pairs removed.
+    template <class Predicate>
+    Size RemoveIf(Predicate&& predicate);
+
+    /// \brief Removes all the pairs.
+    void Clear();
+
+    /// \brief Calls the function with every pair, `void(const TKey&, const TValue&)`. Each shard is
+    ///        locked while its pairs are visited, the function mustn't write to the map.
+    template <class Function>
+    void ForEach(Function&& function) const;
+
+private:
+    /// Immutable pair linked into the bucket chain.
+    struct Node
+    {
+        template <class... Args>
+        Node(Size hash, const TKey& key, Args&&... args) :
+            Hash(hash),
+            Key(key),
+            Value(std::forward<Args>(args)...) {}
+
+        std::atomic<Node*> Next = nullptr; // Next node of the bucket chain
+        const Size         Hash;           // Hash of the key
+        const TKey         Key;            // Key of the pair
+        const TValue       Value;          // Value of the pair
+    };
+
+    /// Bucket heads, followed by the array of `Mask + 1` atomic node pointers.
+    struct BucketArray
+    {
+        Size Mask = 0; // Number of the buckets minus one
+
+        AXIS_NODISCARD inline std::atomic<Node*>* GetBuckets() noexcept { return reinterpret_cast<std::atomic<Node*>*>(this + 1); }
+    };
+
+    /// Independently locked part of the map.
+    struct alignas(CacheLineSize) Shard
+    {
+        std::atomic<BucketArray*> Buckets = nullptr; // Bucket array, replaced when the shard grows
+        std::atomic<Size>         Version = 0;       // Odd while the nodes are relinked into the grown array
+        std::atomic<Size>         Length  = 0;       // Number of the pairs
+        mutable std::mutex        Mutex   = {};      // Serializes the writers
+    };
+
+    AXIS_NODISCARD static Size GetShardIndex(Size hash) noexcept;
+
+    AXIS_NODISCARD Shard& GetShard(Size hash) const noexcept;
+
+    const Node* FindNode(const Shard& shard, Size hash, const TKey& key) const noexcept; // Finds the node inside `EpochGuard` or with the shard locked.
+    void        LinkNode(Shard& shard, Node* node);                                     // Links the new node into the locked shard, grows the shard if needed.
+    void        GrowShard(Shard& shard);                                                // Relinks the nodes of the locked shard into the twice as large bucket array.
+    void        DestroyNode(Node* node) noexcept;                                       // Destructs and deallocates the node.
+
+    template <class... Args>
+    Node* CreateNode(Size hash, const TKey& key, Args&&... args); // Allocates and constructs the node.
+
+    template <class Predicate>
+    Size RemoveNodes(Shard& shard, Predicate& predicate); // Unlinks and retires the nodes of the locked shard matching the predicate.
+
+    static void DeleteRetiredNode(PVoid owner, PVoid object) noexcept;        // Deleter of the removed nodes.
+    static void DeleteRetiredBucketArray(PVoid owner, PVoid object) noexcept; // Deleter of the replaced bucket arrays.
+
+    mutable Shard _shards[ShardCount] = {}; ///< Shards selected by the key's hash.
+};
+
+} // namespace System
+
+} // namespace Axis
+
+#include "../../Private/Axis/ConcurrentHashMapImpl.inl"
+
+#endif // AXIS_SYSTEM_CONCURRENTHASHMAP_HPP
@@ -0,0 +1,224 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#ifndef AXIS_SYSTEM_CONCURRENTQUEUE_HPP
+#define AXIS_SYSTEM_CONCURRENTQUEUE_HPP
+#pragma once
+
+#include "Memory.hpp"
+#include "Trait.hpp"
+#include <atomic>
+
+namespace Axis
+{
+
+namespace System
+{
+
+/// \brief Size of the cache line assumed by the concurrent containers, the indices written by
+///        the different threads are kept this far apart to avoid false sharing.
+inline constexpr Size CacheLineSize = 64;
+
+/// \brief Bounded lock-free queue with a single producer thread and a single consumer thread.
+///
+/// The elements are stored in a ring buffer allocated once at the construction. Each side keeps
+/// its own index on a separate cache line along with the last seen index of the other side, so
+/// the threads only touch the shared cache lines when the queue looks full or empty.
+///
+/// Only one thread at a time may push and only one thread at a time may pop; the functions never
+/// block, they fail when the queue is full or empty.
+///
+/// \tparam T Element type, popped by the move assignment.
+/// \tparam Allocator Memory allocator of the ring buffer.
+template <RawType T, AllocatorType Allocator = DefaultAllocator>
+class alignas(CacheLineSize) SpscQueue final : private Detail::AllocatorStorage<Allocator>
+{
+public:
+    /// \brief Constructs the empty queue.
+    ///
+    /// \param[in] capacity Minimum number of the elements the queue can hold, rounded up to the
+    ///                     power of two.
+    /// \param[in] allocator Allocator instance used by the queue.
+    ///
+    /// \throws InvalidArgumentException If `capacity` is zero.
+    explicit SpscQueue(Size             capacity,
+                       const Allocator& allocator = Allocator());
+
+    /// \brief Destroys the elements left in the queue.
+    ~SpscQueue() noexcept;
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    /// \brief Gets the number of the elements the queue can hold.
+    AXIS_NODISCARD inline Size GetCapacity() const noexcept { return _mask + 1; }
+
+    /// \brief Gets the number of the elements in the queue, only exact when neither side is
+    ///        running.
+    AXIS_NODISCARD Size GetLength() const noexcept;
+
+    /// \brief Constructs the element at the back of the queue, called by the producer.
+    ///
+    /// \return false if the queue was full.
+    template <class... Args>
+    Bool TryEmplace(Args&&... args) requires(std::is_constructible_v<T, Args...>);
+
+    /// \brief Pushes the copy of the element, called by the producer.
+    ///
+    /// \return false if the queue was full.
+    Bool TryPush(const T& element) requires(std::is_copy_constructible_v<T>);
+
+    /// \brief Pushes the element, called by the producer.
+    ///
+    /// \return false if the queue was full, the element isn't moved from then.
+    Bool TryPush(T&& element) requires(std::is_move_constructible_v<T>);
+
+    /// \brief Pushes the copies of as many elements as fit, publishing them to the consumer at once.
+    ///
+    /// \param[in] elements Elements to push, in order.
+    /// \param[in] count Number of the elements to push.
+    ///
+    /// \return Number of the elements pushed, the leading part of `elements`.
+    Size TryPushRange(const T* elements,
+                      Size     count) requires(std::is_copy_constructible_v<T>);
+
+    /// \brief Pops the element at the front of the queue, called by the consumer.
+    ///
+    /// \param[out] element Element to move the popped element into.
+    ///
+    /// \return false if the queue was empty.
+    Bool TryPop(T& element) requires(std::is_move_assignable_v<T>);
+
+    /// \brief Pops up to `maxCount` elements, releasing their slots to the producer at once.
+    ///
+    /// \param[out] elements Elements to move the popped elements into, in order.
+    /// \param[in] maxCount Maximum number of the elements to pop.
+    ///
+    /// \return Number of the elements popped.
+    Size TryPopRange(T*   elements,
+                     Size maxCount) requires(std::is_move_assignable_v<T>);
+
+private:
+    T*   _buffer = nullptr; ///< Ring buffer of the elements.
+    Size _mask   = 0;       ///< Capacity minus one, maps the indices to the slots.
+
+    alignas(CacheLineSize) std::atomic<Size> _head = 0; ///< Index of the front element, written by the consumer.
+    Size _cachedTail                                = 0; ///< Last tail seen by the consumer.
+
+    alignas(CacheLineSize) std::atomic<Size> _tail = 0; ///< Index past the back element, written by the producer.
+    Size _cachedHead                                = 0; ///< Last head seen by the producer.
+};
+
+/// \brief Bounded lock-free queue with any number of the producer and the consumer threads.
+///
+/// Dmitry Vyukov's bounded MPMC queue: every slot carries a sequence number telling which lap of
+/// the ring the slot is ready for, so a push or a pop only takes one compare-and-swap of the
+/// shared index and the threads never wait for each other to finish. The range functions claim
+/// the consecutive slots with a single compare-and-swap.
+///
+/// The functions never block, they fail when the queue is full or empty. The element's
+/// construction and the move assignment mustn't throw, a claimed slot can't be given back.
+///
+/// \tparam T Element type, popped by the move assignment.
+/// \tparam Allocator Memory allocator of the slots.
+template <RawType T, AllocatorType Allocator = DefaultAllocator>
+class alignas(CacheLineSize) MpmcQueue final : private Detail::AllocatorStorage<Allocator>
+{
+    static_assert(std::is_nothrow_move_assignable_v<T> && std::is_nothrow_destructible_v<T>,
+                  "MpmcQueue elements must be nothrow move assignable");
+
+public:
+    /// \brief Constructs the empty queue.
+    ///
+    /// \param[in] capacity Minimum number of the elements the queue can hold, rounded up to the
+    ///                     power of two. The queue always holds at least two elements.
+    /// \param[in] allocator Allocator instance used by the queue.
+    ///
+    /// \throws InvalidArgumentException If `capacity` is zero.
+    explicit MpmcQueue(Size             capacity,
+                       const Allocator& allocator = Allocator());
+
+    /// \brief Destroys the elements left in the queue.
+    ~MpmcQueue() noexcept;
+
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    /// \brief Gets the number of the elements the queue can hold.
+    AXIS_NODISCARD inline Size GetCapacity() const noexcept { return _mask + 1; }
+
+    /// \brief Gets the number of the elements in the queue, only exact when no thread is pushing
+    ///        or popping.
+    AXIS_NODISCARD Size GetLength() const noexcept;
+
+    /// \brief Constructs the element at the back of the queue.
+    ///
+    /// \return false if the queue was full.
+    template <class... Args>
+    Bool TryEmplace(Args&&... args) noexcept requires(std::is_nothrow_constructible_v<T, Args...>);
+
+    /// \brief Pushes the copy of the element.
+    ///
+    /// \return false if the queue was full.
+    Bool TryPush(const T& element) noexcept requires(std::is_nothrow_copy_constructible_v<T>);
+
+    /// \brief Pushes the element.
+    ///
+    /// \return false if the queue was full, the element isn't moved from then.
+    Bool TryPush(T&& element) noexcept requires(std::is_nothrow_move_constructible_v<T>);
+
+    /// \brief Pushes the copies of as many elements as there are consecutive free slots.
+    ///
+    /// \param[in] elements Elements to push, in order.
+    /// \param[in] count Number of the elements to push.
+    ///
+    /// \return Number of the elements pushed, the leading part of `elements`.
+    Size TryPushRange(const T* elements,
+                      Size     count) noexcept requires(std::is_nothrow_copy_constructible_v<T>);
+
+    /// \brief Pops the element at the front of the queue.
+    ///
+    /// \param[out] element Element to move the popped element into.
+    ///
+    /// \return false if the queue was empty.
+    Bool TryPop(T& element) noexcept;
+
+    /// \brief Pops up to `maxCount` elements from the consecutive ready slots.
+    ///
+    /// \param[out] elements Elements to move the popped elements into, in order.
+    /// \param[in] maxCount Maximum number of the elements to pop.
+    ///
+    /// \return Number of the elements popped.
+    Size TryPopRange(T*   elements,
+                     Size maxCount) noexcept;
+
+private:
+    /// Slot of the ring and the lap it's ready for.
+    struct Cell
+    {
+        std::atomic<Size> Sequence = 0; // Index of the push (equal) or the pop (one past) the slot is ready for
+        alignas(T) Byte Storage[sizeof(T)]; // Element, constructed between the push and the pop
+
+        AXIS_NODISCARD inline T* GetElement() noexcept { return reinterpret_cast<T*>(Storage); }
+    };
+
+    template <Bool Push>
+    Size ClaimSlots(std::atomic<Size>& position,
+                    Size               maxCount,
+                    Size&              first) noexcept; // Claims up to `maxCount` consecutive free (push) or ready (pop) slots, returns their count.
+
+    Cell* _cells = nullptr; ///< Slots of the ring.
+    Size  _mask  = 0;       ///< Capacity minus one, maps the indices to the slots.
+
+    alignas(CacheLineSize) std::atomic<Size> _pushPosition = 0; ///< Index of the next push.
+    alignas(CacheLineSize) std::atomic<Size> _popPosition  = 0; ///< Index of the next pop.
+};
+
+} // namespace System
+
+} // namespace Axis
+
+#include "../../Private/Axis/ConcurrentQueueImpl.inl"
+
+#endif // AXIS_SYSTEM_CONCURRENTQUEUE_HPP
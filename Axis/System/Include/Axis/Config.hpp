@@ -67,6 +67,33 @@
 #    define AXIS_64_BIT_PTR
 #endif
 
+/// SIMD instruction set detection, can be disabled by defining `AXIS_DISABLE_SIMD`
+#if !defined(AXIS_DISABLE_SIMD) &&                                    \
+    (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) ||     \
+     (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+
+/// \brief SSE2 instructions are available.
+#    define AXIS_SIMD_SSE2
+#endif
+
+#if defined(AXIS_SIMD_SSE2) && (defined(__SSE4_1__) || defined(__AVX__))
+
+/// \brief SSE4.1 instructions are available.
+#    define AXIS_SIMD_SSE41
+#endif
+
+#if defined(AXIS_SIMD_SSE2) && defined(__AVX2__)
+
+/// \brief AVX2 instructions are available.
+#    define AXIS_SIMD_AVX2
+#endif
+
+#if !defined(AXIS_DISABLE_SIMD) && (defined(__ARM_NEON) || defined(_M_ARM64))
+
+/// \brief NEON instructions are available.
+#    define AXIS_SIMD_NEON
+#endif
+
 /// DLL import / export macros for Windows NT
 #if defined(AXIS_PLATFORM_WINDOWS)
 
@@ -7,7 +7,8 @@
 #pragma once
 
 #include "Function.hpp"
-#include "HashMap.hpp"
+#include "List.hpp"
+#include "TrackingAllocator.hpp"
 #include "Trait.hpp"
 
 namespace Axis
@@ -16,6 +17,49 @@ namespace Axis
 namespace System
 {
 
+namespace Detail
+{
+
+/// Tag of the events' allocations in `AllocationTracker`
+struct EventAllocationTag
+{
+    static constexpr const char* Name = "System::Event";
+};
+
+/// Allocator of the events' handler arrays.
+using EventAllocator = TaggedAllocator<EventAllocationTag>;
+
+/// Specifies where the handler referred by a slot is stored.
+enum class EventHandlerLocation : Uint8
+{
+    None,                    // The slot is free.
+    FunctionPointers,        // The plain function array.
+    Functors,                // The function object array.
+    PendingFunctionPointers, // The plain functions added while the event is being raised.
+    PendingFunctors,         // The function objects added while the event is being raised.
+};
+
+/// Maps the token to the handler's current index in its array.
+struct EventSlot
+{
+    Uint32               Generation = 1;                          ///< Incremented every time the slot is freed, invalidates the old tokens.
+    Uint32               Index      = 0;                          ///< Index of the handler in its array.
+    EventHandlerLocation Location   = EventHandlerLocation::None; ///< Array containing the handler.
+};
+
+/// Handler stored in the contiguous array of the event.
+template <class Callback>
+struct EventHandler
+{
+    /// Marks the handler which has been removed, but not yet erased from the array.
+    static constexpr Uint32 RemovedSlot = ~Uint32(0);
+
+    Callback Handler = {};          ///< Callable object or plain function.
+    Uint32   Slot    = RemovedSlot; ///< Index of the slot referring to this handler.
+};
+
+} // namespace Detail
+
 /// \brief Defines an event notification class. When event is raised it will
 ///        notify all handlers whose interest in this event.
 template <class T>
@@ -23,20 +67,31 @@ class Event;
 
 /// \brief Defines an event notification class. When event is raised it will
 ///        notify all handlers that subscribed to this event.
+///
+/// The handlers are stored in contiguous arrays and invoked in the order they were added,
+/// the plain functions (including the lambdas without captures) are kept apart and called
+/// directly, before the function objects.
+///
+/// The handlers can add and remove the handlers, or raise the event again, while the event is
+/// being raised. The changes are applied once the outermost raise returns: the handlers added
+/// during the raise are not invoked by it, the removed ones are not invoked anymore.
 template <class ReturnType, class... Args>
 class Event<ReturnType(Args...)>
 {
 public:
+    /// \brief Plain function which can be subscribed to the event.
+    using FunctionPointer = ReturnType (*)(Args...);
+
     /// \brief Default constructor
     Event() noexcept = default;
 
     /// \brief Invokes all handlers that subscribed to this event
     ///        with the given arguments.
-    void operator()(Args&&... args);
+    void operator()(Args... args);
 
     /// \brief Invokes all handlers that subscribed to this event
     ///        with the given arguments.
-    void Invoke(Args&&... args);
+    void Invoke(Args... args);
 
     /// \brief Interface for subscribing and unsubscribing to an event.
     class Register
@@ -44,13 +99,14 @@ class Event<ReturnType(Args...)>
     public:
         /// \brief Adds a handler to the event
         ///
+        /// The handlers convertible to the plain function are stored as it, and invoked
+        /// without going through \a `Function`.
+        ///
         /// \param[in] handler Callable object to subscribe to the event.
-        /// \param[in] token Token to identify the handler. If the token is collided with
-        ///                  another handler, new token will be generated.
         ///
-        /// \return Returns the token that was used to subscribe to the event.
-        Size Add(const Function<ReturnType(Args...)>& handler,
-                 Size                                 token = 0);
+        /// \return Returns the token that was used to subscribe to the event, never 0.
+        template <class Handler>
+        Size Add(Handler&& handler) requires(std::is_convertible_v<Handler, FunctionPointer> || std::is_constructible_v<Function<ReturnType(Args...)>, Handler>);
 
         /// \brief Removes a handler from the event
         ///
@@ -67,6 +123,9 @@ class Event<ReturnType(Args...)>
         /// \return Returns true if the event has any handlers with the given token
         Bool TokenExists(Size token) const noexcept;
 
+        /// \brief Gets the number of handlers subscribed to the event.
+        AXIS_NODISCARD Size GetHandlerCount() const noexcept;
+
     private:
         /// \brief Private default constructor
         Register() noexcept = default;
@@ -86,8 +145,44 @@ class Event<ReturnType(Args...)>
         /// \brief Private move assignment operator
         Register& operator=(Register&& other) = default;
 
-        /// Contains handlers that subscribed to this event.
-        HashMap<Size, Function<ReturnType(Args...)>> _handlers;
+        using FunctionPointerHandler = Detail::EventHandler<FunctionPointer>;
+        using FunctorHandler         = Detail::EventHandler<Function<ReturnType(Args...)>>;
+
+        template <class HandlerType>
+        using HandlerList = List<HandlerType, Detail::EventAllocator>;
+
+        /// Number of the token's bits storing the slot index, the rest store the generation.
+        static constexpr Size SlotIndexBits = sizeof(Size) * 4;
+
+        template <class HandlerType, class Handler>
+        Size AddHandler(HandlerList<HandlerType>&     handlers,
+                        Detail::EventHandlerLocation location,
+                        Handler&&                    handler);
+
+        Uint32 AcquireSlot();                          // Gets a free slot, allocates a new one if there's none.
+        void   ReleaseSlot(Uint32 slotIndex) noexcept; // Frees the slot and invalidates its tokens.
+        Size   FindSlot(Size token) const noexcept;    // Gets the index of the slot in use referred by the token, or the slot count.
+        void   Invoke(Args&... args);                  // Invokes the handlers, defers the changes until the outermost call returns.
+        void   EndInvoke();                            // Applies the changes made during the raise.
+        void   EraseRemovedHandlers() noexcept;        // Erases the handlers which have been removed.
+        void   AppendPendingHandlers();                // Moves the handlers added during the raise to their arrays.
+
+        template <class HandlerType>
+        void EraseRemovedHandlers(HandlerList<HandlerType>& handlers) noexcept;
+
+        template <class HandlerType>
+        void AppendPendingHandlers(HandlerList<HandlerType>&     handlers,
+                                   HandlerList<HandlerType>&     pendingHandlers,
+                                   Detail::EventHandlerLocation location);
+
+        HandlerList<FunctionPointerHandler>             _functionPointers        = {};    ///< Plain functions subscribed to the event.
+        HandlerList<FunctorHandler>                     _functors                = {};    ///< Function objects subscribed to the event.
+        HandlerList<FunctionPointerHandler>             _pendingFunctionPointers = {};    ///< Plain functions added while the event is being raised.
+        HandlerList<FunctorHandler>                     _pendingFunctors         = {};    ///< Function objects added while the event is being raised.
+        List<Detail::EventSlot, Detail::EventAllocator> _slots                   = {};    ///< Maps the tokens to the handlers.
+        List<Uint32, Detail::EventAllocator>            _freeSlots               = {};    ///< Indices of the free slots, has the capacity of all the slots.
+        Size                                            _invokeDepth             = 0;     ///< Number of the raises in progress.
+        Bool                                            _hasRemovedHandlers      = false; ///< Whether some handlers are waiting to be erased.
 
         // Friend declaration
         friend class Event;
@@ -115,19 +210,9 @@ class EventToken<ReturnType(Args...)>
     ///
     /// \param[in] event Event to subscribe to.
     /// \param[in] handler Callable object to subscribe to the event.
-    /// \param[in] token The token that may be used in event subscription.
-    EventToken(typename Event<ReturnType(Args...)>::Register& event,
-               const Function<ReturnType(Args...)>&           handler,
-               Size                                           token = 0);
-
-    /// \brief Constructor
-    ///
-    /// \param[in] event Event to subscribe to.
-    /// \param[in] handler Callable object to subscribe to the event.
-    /// \param[in] token The token that may be used in event subscription.
+    template <class Handler>
     EventToken(typename Event<ReturnType(Args...)>::Register& event,
-               Function<ReturnType(Args...)>&&                handler,
-               Size                                           token = 0);
+               Handler&&                                      handler);
 
     /// \brief Destructor
     ~EventToken() noexcept;
@@ -163,4 +248,4 @@ class EventToken<ReturnType(Args...)>
 
 #include "../../Private/Axis/EventImpl.inl"
 
-#endif // AXIS_SYSTEM_EVENT_HPP
\ No newline at end of file
+#endif // AXIS_SYSTEM_EVENT_HPP
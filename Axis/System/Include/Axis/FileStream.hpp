@@ -10,6 +10,7 @@
 #include "Stream.hpp"
 #include "StringView.hpp"
 #include "SystemExport.hpp"
+#include "Task.hpp"
 #include "Utility.hpp"
 
 namespace Axis
@@ -149,6 +150,16 @@ class AXIS_SYSTEM_API FileStream final : public Stream
     FileModeFlags _fileModes  = {};      ///< File mode used during construction.
 };
 
+/// \brief Reads the whole file on a worker of the job system, the awaiting coroutine resumes on the
+///        frame thread of the scheduler with the bytes of the file.
+///
+/// \param[in] scheduler Scheduler resuming the awaiting coroutine.
+/// \param[in] jobSystem Job system running the read.
+/// \param[in] filePath Path of the file to read.
+AXIS_NODISCARD AXIS_SYSTEM_API Task<List<Uint8>> ReadFileAsync(TaskScheduler& scheduler,
+                                                               JobSystem&     jobSystem,
+                                                               WString        filePath);
+
 } // namespace System
 
 } // namespace Axis
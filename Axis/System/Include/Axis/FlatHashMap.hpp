@@ -0,0 +1,109 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#ifndef AXIS_SYSTEM_FLATHASHMAP_HPP
+#define AXIS_SYSTEM_FLATHASHMAP_HPP
+#pragma once
+
+#include "FlatHashSet.hpp"
+#include "HashMap.hpp"
+
+namespace Axis
+{
+
+namespace System
+{
+
+/// \brief Key-value paired object container for fast lookup using
+///        hash code, the pairs are stored inline in \a `FlatHashSet`.
+///
+/// Prefer it over \a `HashMap` for the lookup heavy tables. The pairs are
+/// moved on insertion and removal, see \a `FlatHashSet`.
+///
+/// \tparam TKey Type of key object.
+/// \tparam TValue Type of value object.
+/// \tparam Hasher Type of hasher object.
+/// \tparam Comparer Type of comparer object.
+template <RawType TKey, RawType TValue, HasherType<TKey> Hasher = Hash<TKey>, ComparerType<TKey> Comparer = EqualityComparer<TKey>, AllocatorType Allocator = DefaultAllocator>
+class FlatHashMap final : private FlatHashSet<Pair<const TKey, TValue>, Detail::HashMapHasher<TKey, TValue, Hasher>, Detail::HashMapComparer<TKey, TValue, Comparer>, Allocator>
+{
+public:
+    /// \brief Internal hash table type
+    using HashSetBase = FlatHashSet<Pair<const TKey, TValue>, Detail::HashMapHasher<TKey, TValue, Hasher>, Detail::HashMapComparer<TKey, TValue, Comparer>, Allocator>;
+
+    /// \brief Default constructor
+    FlatHashMap() = default;
+
+    /// \brief Allocator constructor
+    ///
+    /// \param[in] allocator Allocator instance used by the hash map.
+    explicit FlatHashMap(const Allocator& allocator) noexcept :
+        HashSetBase(allocator) {}
+
+    /// \brief Copy constructor
+    FlatHashMap(const FlatHashMap& other) = default;
+
+    /// \brief Move constructor
+    FlatHashMap(FlatHashMap&& other) = default;
+
+    /// \brief Copy assignment operator
+    FlatHashMap& operator=(const FlatHashMap&) = default;
+
+    /// \brief Move assignment operator
+    FlatHashMap& operator=(FlatHashMap&&) = default;
+
+    /// \brief Finds the key-value pair in the hash map by the given key.
+    ///
+    /// \param key Key object to find.
+    ///
+    /// \return Iterator to the key-value pair in the hash map if found, otherwise `end()`.
+    typename HashSetBase::iterator Find(const TKey& key) noexcept;
+
+    /// \brief Finds the key-value pair in the hash map by the given key.
+    ///
+    /// \param key Key object to find.
+    ///
+    /// \return Iterator to the key-value pair in the hash map if found, otherwise `end()`.
+    typename HashSetBase::const_iterator Find(const TKey& key) const noexcept;
+
+    /// \brief Removes the key-value pair in the hash map by the given key.
+    ///
+    /// \param key Key object to remove.
+    ///
+    /// \return Returns a paired object containing `Bool` value indicating whether the key-value pair was removed or not.
+    ///         The first element of the pair is `True` if the key-value pair was removed, otherwise `False`. The second
+    ///         element of the pair is the iterator to the next key-value pair in the hash map.
+    Pair<Bool, typename HashSetBase::iterator> Remove(const TKey& key) noexcept;
+
+    /// \brief Non-const iterator to the first key-value pair in the hash map.
+    typename HashSetBase::iterator begin() noexcept;
+
+    /// \brief Non-const iterator to the end of the hash map.
+    typename HashSetBase::iterator end() noexcept;
+
+    using HashSetBase::begin;                ///< Inherits base class iterators.
+    using HashSetBase::end;                  ///< Inherits base class iterators.
+    using HashSetBase::GetSize;              ///< Inherits base class size getter.
+    using HashSetBase::GetCapacity;          ///< Inherits base class capacity getter.
+    using HashSetBase::GetCurrentLoadFactor; ///< Inherits base class load factor getter.
+    using HashSetBase::GetMaxLoadFactor;     ///< Inherits base class max load factor getter.
+    using HashSetBase::SetMaxLoadFactor;     ///< Inherits base class max load factor setter.
+    using HashSetBase::Insert;               ///< Inherits base class insert function.
+    using HashSetBase::Reserve;              ///< Inherits base class reserve function.
+    using HashSetBase::Clear;                ///< Inherits base class clear function.
+    using HashSetBase::GetAllocator;         ///< Inherits base class allocator getter.
+};
+
+/// \brief `FlatHashMap` has the same relocatability as its underlying \a `FlatHashSet`.
+template <RawType TKey, RawType TValue, HasherType<TKey> Hasher, ComparerType<TKey> Comparer, AllocatorType Allocator>
+struct IsTriviallyRelocatable<FlatHashMap<TKey, TValue, Hasher, Comparer, Allocator>> : IsTriviallyRelocatable<typename FlatHashMap<TKey, TValue, Hasher, Comparer, Allocator>::HashSetBase>
+{};
+
+} // namespace System
+
+} // namespace Axis
+
+#include "../../Private/Axis/FlatHashMapImpl.inl"
+
+#endif // AXIS_SYSTEM_FLATHASHMAP_HPP
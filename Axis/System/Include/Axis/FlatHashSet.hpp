@@ -0,0 +1,281 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#ifndef AXIS_SYSTEM_FLATHASHSET_HPP
+#define AXIS_SYSTEM_FLATHASHSET_HPP
+#pragma once
+
+#include "HashSet.hpp"
+
+#ifdef AXIS_SIMD_SSE2
+#    include <emmintrin.h>
+#endif
+
+namespace Axis
+{
+
+namespace System
+{
+
+namespace Detail
+{
+
+/// \brief Control bytes of the consecutive slots in \a `FlatHashSet`, probed
+///        all at once.
+///
+/// Every control byte is either \a `EmptyControl` or the lowest 7 bits of
+/// the hash of the element stored in the slot. Uses SSE2 when available and
+/// 64-bit scalar operations otherwise.
+///
+/// \private
+class FlatHashGroup
+{
+public:
+    /// \brief Number of the control bytes in a group.
+    static constexpr Size Width = 16;
+
+    /// \brief Control byte of the empty slot.
+    static constexpr Uint8 EmptyControl = 0x80;
+
+    /// \brief Loads the group starting at the given control byte.
+    explicit FlatHashGroup(const Uint8* controls) noexcept;
+
+    /// \brief Gets the bit mask of the slots whose control byte equals `hash`.
+    ///
+    /// The scalar fallback may report false positives, the elements are
+    /// compared anyway.
+    AXIS_NODISCARD Uint32 Match(Uint8 hash) const noexcept;
+
+    /// \brief Gets the bit mask of the empty slots.
+    AXIS_NODISCARD Uint32 MatchEmpty() const noexcept;
+
+    /// \brief Gets the bit mask of the occupied slots.
+    AXIS_NODISCARD Uint32 MatchFull() const noexcept;
+
+private:
+#ifdef AXIS_SIMD_SSE2
+    __m128i _controls; // <-- Control bytes of the group
+#else
+    Uint64 _controls[2]; // <-- Control bytes of the group
+#endif
+};
+
+} // namespace Detail
+
+/// \brief Hash table template container implemented in open addressing method.
+///
+/// Unlike \a `HashSet`, the elements are stored inline in a single array and
+/// the lookups probe the control bytes of 16 slots at a time, which keeps them
+/// cache friendly. Collisions are resolved by linear probing and the removal
+/// shifts the following elements backward, so the table never accumulates
+/// tombstones.
+///
+/// The elements are moved on rehash and removal, the iterators and pointers to
+/// the elements are invalidated by any insertion or removal.
+///
+/// \tparam T Data type to be contained within the table.
+/// \tparam Hasher Functor object used for hash calculation from the \a `T` object.
+/// \tparam Comparer Functor object used for comparing \a `T` object equality.
+/// \tparam Allocator Memory allocator for all dynamic memory allocation in the hash table.
+///
+/// The allocator instance is stored in the hash set (taking no space for the stateless allocators),
+/// it's propagated on copy / move construction and move assignment but not on copy assignment.
+template <RawType T, HasherType<T> Hasher = Hash<T>, ComparerType<T> Comparer = EqualityComparer<T>, AllocatorType Allocator = DefaultAllocator>
+class FlatHashSet : private Detail::AllocatorStorage<Allocator>
+{
+public:
+    /// \brief Default constructor
+    FlatHashSet() noexcept(std::is_nothrow_default_constructible_v<Allocator>) = default;
+
+    /// \brief Allocator constructor
+    ///
+    /// \param[in] allocator Allocator instance used by the hash set.
+    explicit FlatHashSet(const Allocator& allocator) noexcept;
+
+    /// \brief Destructor
+    ~FlatHashSet() noexcept;
+
+    /// \brief Copy constructor
+    ///
+    /// \param[in] other Other object to copy from.
+    FlatHashSet(const FlatHashSet& other) requires(std::is_copy_constructible_v<T>);
+
+    /// \brief Move constructor
+    ///
+    /// \param[in] other Other object to move from.
+    FlatHashSet(FlatHashSet&& other) noexcept;
+
+    /// \brief Copy assignment operator
+    ///
+    /// \param[in] other Other object to copy from.
+    FlatHashSet& operator=(const FlatHashSet& other) requires(std::is_copy_constructible_v<T>);
+
+    /// \brief Move assignment operator
+    ///
+    /// \param[in] other Other object to move from.
+    FlatHashSet& operator=(FlatHashSet&& other) noexcept;
+
+    /// \brief Hash set container iterator
+    template <class Reference, class Pointer>
+    struct Iterator;
+
+    /// \brief Non-const iterator
+    typedef Iterator<T&, T*> iterator;
+
+    /// \brief Const iterator
+    typedef Iterator<const T&, const T*> const_iterator;
+
+    /// \brief Gets the number of elements in the hash table.
+    ///
+    /// \return Number of elements in the hash table.
+    AXIS_NODISCARD Size GetSize() const noexcept;
+
+    /// \brief Gets the number of slots in the hash table.
+    AXIS_NODISCARD Size GetCapacity() const noexcept;
+
+    /// \brief Gets the allocator instance used by the hash set.
+    AXIS_NODISCARD const Allocator& GetAllocator() const noexcept;
+
+    /// \brief Gets the current load factor of the hash table.
+    ///
+    /// \return Current load factor of the hash table.
+    AXIS_NODISCARD Float32 GetCurrentLoadFactor() const noexcept;
+
+    /// \brief Gets the current max load factor.
+    ///
+    /// - The default value is 0.8.
+    /// - If the load factor would exceed the max load factor, the container will be resized.
+    AXIS_NODISCARD Float32 GetMaxLoadFactor() const noexcept;
+
+    /// \brief Sets the current max load factor.
+    ///
+    /// - The default value is 0.8.
+    /// - If the load factor would exceed the max load factor, the container will be resized.
+    ///
+    /// \param[in] maxLoadFactor New max load factor.
+    ///
+    /// \pre maxLoadFactor Should be greater than `0.0` and less than `1.0`, the open addressing
+    ///      table always needs an empty slot.
+    Bool SetMaxLoadFactor(Float32 maxLoadFactor) noexcept;
+
+    /// \brief Finds the specified element in the hash table.
+    ///
+    /// \return Iterator to the found element or `end()` if the element is not found.
+    const_iterator Find(const T& element) const noexcept;
+
+    /// \brief Inserts new element into the hash set. If the element is already present, the function does nothing.
+    ///
+    /// \param[in] value Element to be inserted.
+    ///
+    /// \return Returns a pair of iterator and \a `Bool` value. The iterator points to the inserted element.
+    ///         If the element is already present, the iterator points to the existing element and the \a `Bool` value is \a `false`.
+    Pair<Bool, iterator> Insert(const T& value) requires(std::is_copy_constructible_v<T>);
+
+    /// \brief Inserts new element into the hash set. If the element is already present, the function does nothing.
+    ///
+    /// \param[in] value Element to be inserted.
+    ///
+    /// \return Returns a pair of iterator and \a `Bool` value. The iterator points to the inserted element.
+    ///         If the element is already present, the iterator points to the existing element and the \a `Bool` value is \a `false`.
+    Pair<Bool, iterator> Insert(T&& value) requires(std::is_move_constructible_v<T>);
+
+    /// \brief Reserves memory space for the specified number of elements.
+    ///
+    /// \param[in] elementSize Number of elements to be reserved.
+    void Reserve(Size elementSize);
+
+    /// \brief Removes the specified element from the hash set.
+    ///
+    /// \param[in] value Element to be removed.
+    ///
+    /// \return Returns pair of iterator and \a `Bool` value. The iterator points to the next element.
+    ///         If the element is not found, the iterator points to the end() and the \a `Bool` value is \a `false`.
+    ///
+    /// \note The removal shifts the following elements backward. When removing while iterating,
+    ///       the elements shifted across the end of the table may be visited twice.
+    Pair<Bool, const_iterator> Remove(const T& element) noexcept;
+
+    /// \brief Clears all elements from the hash set, keeps the allocated memory.
+    void Clear() noexcept;
+
+    /// \brief Iterator to the first element in the hash set.
+    ///
+    /// \return Iterator to the first element in the hash set.
+    AXIS_NODISCARD const_iterator begin() const noexcept;
+
+    /// \brief Iterator to the end of the hash set.
+    ///
+    /// \return Iterator to the end of the hash set.
+    AXIS_NODISCARD const_iterator end() const noexcept;
+
+    /// \brief Smallest number of slots in the non-empty table.
+    static constexpr Size MinimumCapacity = Detail::FlatHashGroup::Width;
+
+protected:
+    /// \brief Finds the specified element in the hash table.
+    ///
+    /// Can pass another type into this function to find the element. Ensures that the hasher can
+    /// calculates hash for the specified type.
+    /// Equality comparer must provides the same functionality for the specified type.
+    ///
+    /// \return Iterator to the found element or `end()` if the element is not found.
+    template <class IndirectType, class IteratorVariant>
+    IteratorVariant FindIndirect(const IndirectType& element) const noexcept;
+
+    /// \brief Removes the specified element from the hash set.
+    ///
+    /// Can pass another type into this function to find the element. Ensures that the hasher can
+    /// calculates hash for the specified type.
+    /// Equality comparer must provides the same functionality for the specified type.
+    ///
+    /// \return Iterator to the next element or `end()` if the element is not found.
+    template <class IndirectType, class IteratorVariant>
+    Pair<Bool, IteratorVariant> RemoveIndirect(const IndirectType& element) noexcept;
+
+    /// \brief Iterator to the first element in the hash set.
+    ///
+    /// \return Iterator to the first element in the hash set.
+    AXIS_NODISCARD iterator NonConstBegin() noexcept;
+
+    /// \brief Iterator to the end of the hash set.
+    ///
+    /// \return Iterator to the end of the hash set.
+    AXIS_NODISCARD iterator NonConstEnd() noexcept;
+
+private:
+    template <class IndirectType> Size                   FindIndex(const IndirectType& element, Size hash) const noexcept;
+    template <class... Args> Pair<Bool, iterator>        InsertPerfectForwarding(Args&&... args);
+    Size                                                 FindEmptyIndex(Size hash) const noexcept;
+    void                                                 Rehash(Size capacity);
+    void                                                 RemoveAtIndex(Size index) noexcept;
+    void                                                 SetControl(Size index, Uint8 control) noexcept;
+    void                                                 RelocateSlot(Size from, Size to) noexcept;
+    void                                                 CopyElements(const FlatHashSet& other) requires(std::is_copy_constructible_v<T>);
+    void                                                 Destroy() noexcept;
+    template <class IteratorVariant> IteratorVariant     MakeIterator(Size index) const noexcept;
+    static Size                                          MixHash(Size hash) noexcept;
+    static Size                                          GetGrowthLimit(Size capacity, Float32 maxLoadFactor) noexcept;
+
+    T*       _slots         = nullptr; // <-- Elements, `_capacity` slots
+    Uint8*   _controls      = nullptr; // <-- Control bytes, `_capacity` + `FlatHashGroup::Width - 1` cloned bytes
+    Size     _capacity      = 0;       // <-- Number of slots, always power of two
+    Size     _size          = 0;       // <-- Number of elements
+    Size     _growthLimit   = 0;       // <-- Number of elements which triggers the rehash
+    Float32  _maxLoadFactor = 0.8f;    // <-- Maximum ratio of elements to slots
+    Hasher   _hasher        = {};
+    Comparer _comparer      = {};
+};
+
+/// \brief `FlatHashSet` only holds the pointers to the table, the counters and the functors.
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+struct IsTriviallyRelocatable<FlatHashSet<T, Hasher, Comparer, Allocator>> : std::bool_constant<TriviallyRelocatable<Allocator> && TriviallyRelocatable<Hasher> && TriviallyRelocatable<Comparer>>
+{};
+
+} // namespace System
+
+} // namespace Axis
+
+#include "../../Private/Axis/FlatHashSetImpl.inl"
+
+#endif // AXIS_SYSTEM_FLATHASHSET_HPP
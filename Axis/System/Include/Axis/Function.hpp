@@ -16,68 +16,101 @@ namespace Axis
 namespace System
 {
 
-/// \brief Template type erasure container class for containing all callable objects.
-template <class T, AllocatorType Allocator = DefaultAllocator>
-struct Function;
+/// \brief Default size of the inline buffer of \a `Function` and \a `UniqueFunction`, fits the
+///        lambdas capturing up to three pointers or references without allocating.
+constexpr Size DefaultFunctionInlineSize = Axis::PointerSize * 3;
 
-/// \brief Template type erasure container class for containing all callable objects.
-///
-/// To use this class, the functor object that you want to store must have the following conditions:
-/// - Must have noexcept copy and move constructors.
-/// - The functor object must have a function call operator.
+namespace Detail
+{
+
+/// Checks whether the functor can be stored in the function object.
+template <class T, Bool Copyable, class ReturnType, class... Args>
+concept StorableFunctor = (Copyable && Callable<T, ReturnType, Args...>) || (!Copyable && MovableCallable<T, ReturnType, Args...>);
+
+/// Emulates the vtable of the functor stored in the function object.
 template <AllocatorType Allocator, class ReturnType, class... Args>
-struct Function<ReturnType(Args...), Allocator>
+struct FunctionVTable final
+{
+    using InvokePtr   = ReturnType (*)(PVoid, Args&&...);
+    using CopyPtr     = void (*)(PVoid, CPVoid, Allocator&);
+    using RelocatePtr = void (*)(PVoid, PVoid) noexcept;
+    using DestroyPtr  = void (*)(PVoid, Allocator&) noexcept;
+
+    InvokePtr   Invoke   = nullptr; // Invokes the functor's operator()
+    CopyPtr     Copy     = nullptr; // Copy constructs the functor into the empty storage, null if the function is move-only.
+    RelocatePtr Relocate = nullptr; // Moves the functor into the empty storage and destroys the source, null if the bytes can be copied.
+    DestroyPtr  Destroy  = nullptr; // Destroys the functor and frees its memory, null if there's nothing to do.
+    Bool        IsInline = false;   // Whether the functor is stored in the inline buffer.
+};
+
+/// \brief Template type erasure container class, implementation of \a `Function` and \a `UniqueFunction`.
+template <class T, AllocatorType Allocator, Size InlineSize, Bool Copyable>
+class BasicFunction;
+
+/// \brief Template type erasure container class, implementation of \a `Function` and \a `UniqueFunction`.
+///
+/// The functor is stored in the inline buffer of \a `InlineSize` bytes if it fits and can be moved
+/// without throwing, otherwise it's allocated from the allocator. Moving the function object never
+/// allocates.
+///
+/// The allocator instance used for the large functors is stored in the object (taking no space
+/// for the stateless allocators), it's propagated on copy / move construction and move assignment.
+template <AllocatorType Allocator, Size InlineSize, Bool Copyable, class ReturnType, class... Args>
+class BasicFunction<ReturnType(Args...), Allocator, InlineSize, Copyable> : private Detail::AllocatorStorage<Allocator>
 {
 public:
     /// \brief Default constructor
     ///
     /// The object can't be called if it was constructed with this constructor
-    Function() noexcept;
+    BasicFunction() noexcept(std::is_nothrow_default_constructible_v<Allocator>) = default;
 
     /// \brief Constructs object in null state.
     ///
     /// The object can't be called if it was constructed with this constructor
-    Function(NullptrType) noexcept;
+    BasicFunction(NullptrType) noexcept(std::is_nothrow_default_constructible_v<Allocator>);
 
-    /// \brief Constructs and copies the functor object into this `Axis::Function` object.
+    /// \brief Constructs and copies / moves the functor object into this object.
     ///
-    /// \param[in] f Callable object to copy.
-    template <Callable<ReturnType, Args...> Functor, typename = std::enable_if_t<!std::is_same_v<Functor, Function>>>
-    Function(const Functor& f);
+    /// \param[in] f Callable object to copy or move.
+    template <class Functor>
+    BasicFunction(Functor&& f) requires(StorableFunctor<std::decay_t<Functor>, Copyable, ReturnType, Args...> && !std::is_same_v<std::decay_t<Functor>, BasicFunction>);
 
-    /// \brief Constructs and moves the functor object into this `Axis::Function` object.
+    /// \brief Constructs and copies / moves the functor object into this object
+    ///        using the specified allocator.
     ///
-    /// \param[in] f Callable object to move.
-    template <Callable<ReturnType, Args...> Functor, typename = std::enable_if_t<!std::is_same_v<Functor, Function>>>
-    Function(Functor&& f);
+    /// \param[in] f Callable object to copy or move.
+    /// \param[in] allocator Allocator instance used for allocating the functor object.
+    template <class Functor>
+    BasicFunction(Functor&&        f,
+                  const Allocator& allocator) requires(StorableFunctor<std::decay_t<Functor>, Copyable, ReturnType, Args...> && !std::is_same_v<std::decay_t<Functor>, BasicFunction>);
 
     /// \brief Copy constructor
     ///
     /// \param[in] other Instance to copy
-    Function(const Function& other);
+    BasicFunction(const BasicFunction& other) requires(Copyable);
 
     /// \brief Move constructor
     ///
     /// \param[in] other Instance to move
-    Function(Function&& other) noexcept;
+    BasicFunction(BasicFunction&& other) noexcept;
 
     /// \brief Destructor
-    ~Function() noexcept;
+    ~BasicFunction() noexcept;
 
     /// \brief Invokes the underlying function object with specified arguments.
     ///
     /// \param[in] args Variadic template arguments to invoke the underlying callable object.
-    ReturnType operator()(Args&&... args);
+    ReturnType operator()(Args... args);
 
     /// \brief Copy assignemt operator
     ///
     /// \param[in] other Instance to copy
-    Function& operator=(const Function& other);
+    BasicFunction& operator=(const BasicFunction& other) requires(Copyable);
 
     /// \brief Move assignment operator
     ///
     /// \param[in] other Instance to move
-    Function& operator=(Function&& other) noexcept;
+    BasicFunction& operator=(BasicFunction&& other) noexcept;
 
     /// \brief Checks whether the object is in null state or not.
     Bool operator==(NullptrType) const noexcept;
@@ -86,40 +119,102 @@ struct Function<ReturnType(Args...), Allocator>
     Bool operator!=(NullptrType) const noexcept;
 
     /// \brief Turns this object into null state.
-    Function& operator=(NullptrType) noexcept;
+    BasicFunction& operator=(NullptrType) noexcept;
 
-    /// \brief Specifies whether this `Axis::Function` object is callable.
+    /// \brief Specifies whether this object is callable.
     operator Bool() const noexcept;
 
+    /// \brief Checks whether the functor is stored in the inline buffer.
+    AXIS_NODISCARD Bool IsInline() const noexcept;
+
+    /// \brief Gets the allocator instance used by this object.
+    AXIS_NODISCARD const Allocator& GetAllocator() const noexcept;
 
 private:
-    /// Size of small buffer contained in the object.
-    static constexpr Size SmallBufferOptimizationSize = Axis::PointerSize;
+    /// Size of the storage, large enough to hold the pointer to the allocated functor.
+    static constexpr Size StorageSize = InlineSize > sizeof(PVoid) ? InlineSize : sizeof(PVoid);
 
-    /// Function pointer signature using
-    using InvokePtr        = ReturnType (*)(void*, Args&&...);
-    using DestructorPtr    = void (*)(void*);
-    using CopyConstructPtr = void (*)(void*, const void*);
-    using MoveConstructPtr = void (*)(void*, void*);
+    /// Alignment of the storage, the functors with larger alignment are allocated.
+    static constexpr Size StorageAlignment = alignof(PVoid);
 
-    /// Emulates the vtable that stores different kinds of functions.
-    struct VTable final
-    {
-        InvokePtr        Invoke        = nullptr; // Invokes the functor's operator()
-        DestructorPtr    Destruct      = nullptr; // Invokes the functor's destructor
-        CopyConstructPtr CopyConstruct = nullptr; // Invokes copy constructor
-        MoveConstructPtr MoveConstruct = nullptr; // Invokes move constructor
-    };
+    using VTable  = FunctionVTable<Allocator, ReturnType, Args...>;
+    using Storage = StaticStorage<StorageSize, StorageAlignment>;
+
+    template <class Functor>
+    void Construct(Functor&& f); // Stores the functor, the object must be in null state.
+
+    void Take(BasicFunction& other) noexcept; // Takes the functor of the other object, the object must be in null state.
+    void Destroy() noexcept;                  // Destroys the functor and turns the object into null state.
+
+    static void Relocate(const VTable* vtable,
+                         Storage&      destination,
+                         Storage&      source) noexcept;
+
+    const VTable* _pVtable = nullptr; ///< Pointer to the vtable object, null if the object is in null state.
+    Storage       _storage;           ///< Inline functor or the pointer to the allocated one.
+};
+
+} // namespace Detail
+
+/// \brief Template type erasure container class for containing all callable objects.
+///
+/// To use this class, the functor object that you want to store must have the following conditions:
+/// - Must be copy constructible, the copy constructor may throw.
+/// - The functor object must have a function call operator.
+///
+/// The functors with a throwing move constructor are stored on the heap. Copying gives the strong
+/// exception guarantee: the copy is made before the old functor is released.
+///
+/// \tparam T Function signature, e.g. `void(Int32)`.
+/// \tparam Allocator Allocator used for the functors which don't fit the inline buffer.
+/// \tparam InlineSize Size of the inline buffer in bytes.
+template <class T, AllocatorType Allocator = DefaultAllocator, Size InlineSize = DefaultFunctionInlineSize>
+using Function = Detail::BasicFunction<T, Allocator, InlineSize, true>;
+
+/// \brief Move-only version of \a `Function`, also accepts the functors which can't be copied.
+///
+/// \tparam T Function signature, e.g. `void(Int32)`.
+/// \tparam Allocator Allocator used for the functors which don't fit the inline buffer.
+/// \tparam InlineSize Size of the inline buffer in bytes.
+template <class T, AllocatorType Allocator = DefaultAllocator, Size InlineSize = DefaultFunctionInlineSize>
+using UniqueFunction = Detail::BasicFunction<T, Allocator, InlineSize, false>;
 
-    void Destroy() noexcept;
+/// \brief Non-owning reference to a callable object, never allocates.
+template <class T>
+class FunctionRef;
 
-    const VTable* _pVtable           = nullptr; // Pointer to the vtable object
-    Size          _dynamicBufferSize = 0;       // Size of dynamic buffer
-    union
+/// \brief Non-owning reference to a callable object, never allocates.
+///
+/// Suitable for the callbacks which are only invoked during the call they are passed to
+/// (job bodies, iteration visitors). The referenced callable object must outlive the
+/// \a `FunctionRef`; the plain functions are stored by value.
+template <class ReturnType, class... Args>
+class FunctionRef<ReturnType(Args...)>
+{
+public:
+    /// \brief Refers to the specified callable object.
+    ///
+    /// \param[in] f Callable object or function to refer to.
+    template <class Functor>
+    FunctionRef(Functor&& f) noexcept requires(std::is_invocable_r_v<ReturnType, Functor&, Args...> && !std::is_same_v<std::decay_t<Functor>, FunctionRef>);
+
+    /// \brief Invokes the referenced callable object with specified arguments.
+    ///
+    /// \param[in] args Variadic template arguments to invoke the referenced callable object.
+    ReturnType operator()(Args... args) const;
+
+private:
+    /// Either the address of the callable object or the function pointer.
+    union Target
     {
-        PVoid                                      DynamicBuffer;
-        StaticStorage<SmallBufferOptimizationSize> Storage;
+        PVoid Object;
+        void (*Function)();
     };
+
+    using InvokePtr = ReturnType (*)(Target, Args&&...);
+
+    Target    _target  = {};      ///< Referenced callable object.
+    InvokePtr _pInvoke = nullptr; ///< Invokes the referenced callable object.
 };
 
 } // namespace System
@@ -72,6 +72,12 @@ class HashMap final : private HashSet<Pair<const TKey, TValue>, Detail::HashMapH
     /// \brief Default constructor
     HashMap() = default;
 
+    /// \brief Allocator constructor
+    ///
+    /// \param[in] allocator Allocator instance used by the hash map.
+    explicit HashMap(const Allocator& allocator) noexcept :
+        HashSetBase(allocator) {}
+
     /// \brief Copy constructor
     HashMap(const HashMap& other) = default;
 
@@ -121,6 +127,7 @@ class HashMap final : private HashSet<Pair<const TKey, TValue>, Detail::HashMapH
     using HashSetBase::SetMaxLoadFactor;     ///< Inherits base class max load factor setter.
     using HashSetBase::Insert;               ///< Inherits base class insert function.
     using HashSetBase::Reserve;              ///< Inherits base class reserve function.
+    using HashSetBase::GetAllocator;         ///< Inherits base class allocator getter.
 };
 
 } // namespace System
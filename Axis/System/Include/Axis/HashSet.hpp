@@ -6,6 +6,7 @@
 #define AXIS_SYSTEM_HASHSET_HPP
 #pragma once
 
+#include "Hashing.hpp"
 #include "Memory.hpp"
 #include "Trait.hpp"
 #include "Utility.hpp"
@@ -16,28 +17,6 @@ namespace Axis
 namespace System
 {
 
-/// \brief Functor object for calculating hash.
-///
-/// \tparam T Type of object to calculate hash
-///
-/// The library provides hash calculation for basic integer types and pointers.
-///
-/// To provide custom hash object, the class should provides `operator(const T&)` function
-/// which returns \a `Size` as result (hash).
-template <RawType T>
-struct Hash final
-{
-    /// \brief Calculates hash for the object.
-    ///
-    /// This function should be pure function, which means the result should be always
-    /// the same if the inputs are always the same.
-    ///
-    /// \param[in] object Object to calculate hash value.
-    ///
-    /// \return Hash value
-    AXIS_NODISCARD Size operator()(const T& object) const noexcept { return (Size)object; }
-};
-
 /// \brief Functor object for comparing object equality.
 ///
 /// \tparam T Type of object to calculate hash
@@ -84,12 +63,20 @@ concept ComparerType = requires(const T& comparer, const U& object)
 /// \tparam Hasher Functor object used for hash calculation from the \a `T` object.
 /// \tparam Comparer Functor object used for comparing \a `T` object equality.
 /// \tparam Allocator Memory allocator for all dynamic memory allocation in the hash table.
+///
+/// The allocator instance is stored in the hash set (taking no space for the stateless allocators),
+/// it's propagated on copy / move construction and move assignment but not on copy assignment.
 template <RawType T, HasherType<T> Hasher = Hash<T>, ComparerType<T> Comparer = EqualityComparer<T>, AllocatorType Allocator = DefaultAllocator>
-class HashSet
+class HashSet : private Detail::AllocatorStorage<Allocator>
 {
 public:
     /// \brief Default constructor
-    HashSet() noexcept = default;
+    HashSet() noexcept(std::is_nothrow_default_constructible_v<Allocator>) = default;
+
+    /// \brief Allocator constructor
+    ///
+    /// \param[in] allocator Allocator instance used by the hash set.
+    explicit HashSet(const Allocator& allocator) noexcept;
 
     /// \brief Destructor
     ~HashSet() noexcept;
@@ -129,6 +116,9 @@ class HashSet
     /// \return Number of elements in the hash table.
     AXIS_NODISCARD Size GetSize() const noexcept;
 
+    /// \brief Gets the allocator instance used by the hash set.
+    AXIS_NODISCARD const Allocator& GetAllocator() const noexcept;
+
     /// \brief Gets the current load factor of the hash table.
     ///
     /// \return Current load factor of the hash table.
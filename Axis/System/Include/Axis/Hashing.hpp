@@ -0,0 +1,142 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#ifndef AXIS_SYSTEM_HASHING_HPP
+#define AXIS_SYSTEM_HASHING_HPP
+#pragma once
+
+#include "Config.hpp"
+#include "Trait.hpp"
+#include <type_traits>
+
+namespace Axis
+{
+
+namespace System
+{
+
+/// \brief Types whose hash can be calculated from their bytes.
+///
+/// Floating point numbers are accepted as well, the negative zero is hashed
+/// as the positive zero.
+template <class T>
+concept HashableValueType = std::is_floating_point_v<T> || std::has_unique_object_representations_v<T>;
+
+namespace Hashing
+{
+    /// \brief Calculates the 64 bits hash of the byte range.
+    ///
+    /// Uses the wyhash algorithm, which reads 16 bytes per step and passes
+    /// SMHasher. The result depends on the byte order of the platform, it must
+    /// not be persisted.
+    ///
+    /// \param[in] data Pointer to the first byte.
+    /// \param[in] size Number of bytes.
+    /// \param[in] seed Seed of the hash.
+    ///
+    /// \return The hash of the bytes.
+    AXIS_NODISCARD Uint64 HashBytes(const void* data,
+                                    Size        size,
+                                    Uint64      seed = 0) noexcept;
+
+    /// \brief Scrambles the bits of the integer, every input bit affects every
+    ///        output bit.
+    ///
+    /// \param[in] value Value to scramble.
+    ///
+    /// \return The scrambled value.
+    AXIS_NODISCARD Uint64 Mix(Uint64 value) noexcept;
+
+    /// \brief Combines two hashes into one. Unlike \a `Math::HashCombine`, the
+    ///        result is fully mixed.
+    ///
+    /// \param[in] hash The hash to combine into.
+    /// \param[in] anotherHash The hash to combine with.
+    ///
+    /// \return The combined hash.
+    AXIS_NODISCARD Size Combine(Size hash,
+                                Size anotherHash) noexcept;
+
+    /// \brief Calculates the hash of the object from its bytes.
+    ///
+    /// Suitable for the descriptors which don't have padding bytes nor
+    /// floating point numbers, the whole object is hashed in one pass.
+    ///
+    /// \param[in] object Object to calculate the hash.
+    ///
+    /// \return The hash of the object.
+    template <class T>
+    AXIS_NODISCARD Size HashPod(const T& object) noexcept requires(std::has_unique_object_representations_v<T>);
+
+    /// \brief Calculates the hash of multiple values in one pass.
+    ///
+    /// The values are packed next to each other into a stack buffer which is
+    /// hashed by \a `HashBytes`. Used for hashing the descriptors member by
+    /// member, skipping their padding bytes.
+    ///
+    /// \param[in] values Values to calculate the hash.
+    ///
+    /// \return The hash of the values.
+    template <HashableValueType... Args>
+    AXIS_NODISCARD Size HashValues(const Args&... values) noexcept requires(sizeof...(Args) > 0);
+
+} // namespace Hashing
+
+/// \brief Functor object for calculating hash.
+///
+/// \tparam T Type of object to calculate hash
+///
+/// The library provides hash calculation for basic integer types, floating point
+/// types, pointers and strings.
+///
+/// To provide custom hash object, the class should provides `operator(const T&)` function
+/// which returns \a `Size` as result (hash).
+template <RawType T>
+struct Hash final
+{
+    /// \brief Calculates hash for the object.
+    ///
+    /// This function should be pure function, which means the result should be always
+    /// the same if the inputs are always the same.
+    ///
+    /// \param[in] object Object to calculate hash value.
+    ///
+    /// \return Hash value
+    AXIS_NODISCARD Size operator()(const T& object) const noexcept { return (Size)object; }
+};
+
+/// \brief Integer and enum hash, the value is mixed so the keys which differ
+///        only in their high bits don't collide.
+template <RawType T>
+requires(std::is_integral_v<T> || std::is_enum_v<T>) struct Hash<T> final
+{
+    /// \brief Calculates hash for the object.
+    AXIS_NODISCARD Size operator()(const T& object) const noexcept { return (Size)Hashing::Mix((Uint64)object); }
+};
+
+/// \brief Floating point hash, the negative and the positive zero have the
+///        same hash.
+template <RawType T>
+requires(std::is_floating_point_v<T>) struct Hash<T> final
+{
+    /// \brief Calculates hash for the object.
+    AXIS_NODISCARD Size operator()(const T& object) const noexcept { return Hashing::HashValues(object); }
+};
+
+/// \brief Pointer hash, the address is mixed so the alignment bits which are
+///        always zero don't cluster the keys.
+template <class T>
+struct Hash<T*> final
+{
+    /// \brief Calculates hash for the object.
+    AXIS_NODISCARD Size operator()(T* object) const noexcept { return (Size)Hashing::Mix((Uint64)reinterpret_cast<UintPtr>(object)); }
+};
+
+} // namespace System
+
+} // namespace Axis
+
+#include "../../Private/Axis/HashingImpl.inl"
+
+#endif // AXIS_SYSTEM_HASHING_HPP
@@ -0,0 +1,276 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#ifndef AXIS_SYSTEM_INLINELIST_HPP
+#define AXIS_SYSTEM_INLINELIST_HPP
+#pragma once
+
+#include "Memory.hpp"
+#include "Trait.hpp"
+#include "Utility.hpp"
+
+namespace Axis
+{
+
+namespace System
+{
+
+/// \brief Template array container class with the same interface as \a `List`, which stores
+///        up to \a `N` elements in place.
+///
+/// The list doesn't allocate until it grows beyond \a `N` elements, then the elements are moved
+/// to the memory allocated from the allocator. Suitable for the small lists which are created
+/// frequently, such as the lookup keys.
+///
+/// The functions provide the same `strong exception guarantee` as \a `List`, except the move
+/// construction and the move assignment of the inline elements which can only provide the basic
+/// guarantee if the element's move constructor throws.
+///
+/// The allocator instance is stored in the list (taking no space for the stateless allocators),
+/// it's propagated on copy / move construction and move assignment but not on copy assignment.
+///
+/// \tparam T Data type to be contained within the list.
+/// \tparam N Number of elements stored in place.
+/// \tparam Allocator Memory allocator used after the list grows beyond \a `N` elements.
+template <RawType T, Size N, AllocatorType Allocator = DefaultAllocator>
+class InlineList : private Detail::AllocatorStorage<Allocator>
+{
+    static_assert(N > 0, "InlineList must store at least one element in place");
+
+public:
+    /// \brief Number of the elements stored in place.
+    static constexpr Size InlineCapacity = N;
+
+    /// \brief Default constructor.
+    ///
+    /// The list is initialized with a size of 0 and no memory is allocated.
+    InlineList() noexcept(std::is_nothrow_default_constructible_v<Allocator>) = default;
+
+    /// \brief Allocator constructor.
+    ///
+    /// The list is initialized with a size of 0 and no memory is allocated.
+    ///
+    /// \param[in] allocator Allocator instance used by the list.
+    explicit InlineList(const Allocator& allocator) noexcept;
+
+    /// \brief Copy constructor.
+    ///
+    /// \param other List to copy from.
+    InlineList(const InlineList& other) requires(std::is_copy_constructible_v<T>);
+
+    /// \brief Copy constructor with the specified allocator.
+    ///
+    /// \param[in] other List to copy from.
+    /// \param[in] allocator Allocator instance used by the list.
+    InlineList(const InlineList& other,
+               const Allocator&  allocator) requires(std::is_copy_constructible_v<T>);
+
+    /// \brief Move constructor.
+    ///
+    /// The allocated memory is taken from the other list, the inline elements are moved one by one.
+    ///
+    /// \param other List to move from.
+    InlineList(InlineList&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    /// \brief nullptr constructor.
+    ///
+    /// The list is initialized with a size of 0 and no memory is allocated.
+    InlineList(NullptrType) noexcept(std::is_nothrow_default_constructible_v<Allocator>);
+
+    /// \brief Initializer constructor
+    ///
+    /// Initializes the list with the specified length,
+    /// and initializes the  elements with the specified value.
+    ///
+    /// \param[in] length The length of the list.
+    /// \param[in] args Arguments to forward to the constructor of the object to insert.
+    template <class... Args>
+    InlineList(Size length, Args... args) requires(std::is_constructible_v<T, Args...>);
+
+    /// \brief Initializer list constructor.
+    ///
+    /// \param[in] init Initializer list to copy from.
+    InlineList(const std::initializer_list<T>& init) requires(std::is_copy_constructible_v<T>);
+
+    /// \brief Initializer list constructor with the specified allocator.
+    ///
+    /// \param[in] init Initializer list to copy from.
+    /// \param[in] allocator Allocator instance used by the list.
+    InlineList(const std::initializer_list<T>& init,
+               const Allocator&                allocator) requires(std::is_copy_constructible_v<T>);
+
+    /// \brief Destructor.
+    ~InlineList() noexcept;
+
+    /// \brief Copy assignment operator.
+    ///
+    /// \param[in] other List to copy from.
+    InlineList& operator=(const InlineList& other) requires(std::is_copy_constructible_v<T>);
+
+    /// \brief Move assignment operator.
+    ///
+    /// \param[in] other List to move from.
+    InlineList& operator=(InlineList&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    /// \brief Returns the length of the list.
+    ///
+    /// \return The length of the list.
+    AXIS_NODISCARD Size GetLength() const noexcept;
+
+    /// \brief Returns the number of elements the list can hold without allocating.
+    AXIS_NODISCARD Size GetCapacity() const noexcept;
+
+    /// \brief Checks whether the elements are stored in place.
+    AXIS_NODISCARD Bool IsInline() const noexcept;
+
+    /// \brief Gets the allocator instance used by the list.
+    AXIS_NODISCARD const Allocator& GetAllocator() const noexcept;
+
+    /// \brief Reserves memory for the list to the specified length.
+    ///
+    /// If the list's capacity is already larger than the specified length,
+    /// the list is not resized.
+    ///
+    /// \param[in] length The length of the elements to reserve.
+    void ReserveFor(Size length);
+
+    /// \brief Clears the list.
+    ///
+    /// - Invokes the destructor on all the elements in the list.
+    /// - The list is then resized to 0. The memory is not deallocated.
+    void Clear() noexcept;
+
+    /// \brief Invokes the destructor followed by constructor forwarded on all the elements in the list.
+    template <class... Args>
+    void Reset(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>) requires(std::is_constructible_v<T, Args...>);
+
+    /// \brief Constructs an element at the end of the list.
+    ///
+    /// - The list is expanded to accommodate the new element.
+    /// - New memory might be allocated if necessary and might invalidate iterators.
+    ///
+    /// \param[in] args Arguments to forward to the constructor of the object to insert.
+    ///
+    /// \returns An iterator to the newly constructed element.
+    template <class... Args>
+    T* EmplaceBack(Args&&... args) requires(std::is_constructible_v<T, Args...> && (std::is_copy_constructible_v<T> || std::is_nothrow_move_constructible_v<T>));
+
+    /// \brief Appends an element at the end of the list.
+    ///
+    /// - The list is expanded to accommodate the new element.
+    /// - New memory might be allocated if necessary and might invalidate iterators.
+    ///
+    /// \param[in] element The element to append.
+    ///
+    /// \returns An iterator to the newly constructed element.
+    T* Append(const T& element) requires(std::is_copy_constructible_v<T>);
+
+    /// \brief Appends an element at the end of the list.
+    ///
+    /// - The list is expanded to accommodate the new element.
+    /// - New memory might be allocated if necessary and might invalidate iterators.
+    ///
+    /// \param[in] element The element to append.
+    ///
+    /// \returns An iterator to the newly constructed element.
+    T* Append(T&& element) requires(std::is_move_constructible_v<T>);
+
+    /// \brief Constructs an element at the specified index of the list.
+    ///
+    /// An insertion pushes all the elements after the insertion point to the right.
+    ///
+    /// - The list is expanded to accommodate the new element.
+    /// - New memory might be allocated if necessary and might invalidate iterators.
+    ///
+    /// \param[in] index The index of the element to insert.
+    /// \param[in] args Arguments to forward to the constructor of the object to insert.
+    ///
+    /// \remark If the index is equal to the list's length, the function calls \a `EmplaceBack` instead.
+    ///
+    /// \return An iterator to the inserted element.
+    template <class... Args>
+    T* Emplace(Size index, Args&&... args) requires(std::is_constructible_v<T, Args...> && (std::is_copy_constructible_v<T> || std::is_nothrow_move_constructible_v<T>));
+
+    /// \brief Removes the element at the end of the list.
+    ///
+    /// - The list memory is not deallocated. The element is only destroyed.
+    /// - The list is shrunk to accommodate the removed element.
+    void PopBack() noexcept;
+
+    /// \brief Removes the element at the specified index.
+    ///
+    /// - The list memory is not deallocated. The element is only destroyed.
+    /// - The list is shrunk to accommodate the removed element.
+    ///
+    /// \param[in] index The index of the element to remove.
+    void RemoveAt(Size index) requires(std::is_move_constructible_v<T> || std::is_copy_constructible_v<T>);
+
+    /// \brief Gets the pointer to the first element of the list.
+    AXIS_NODISCARD T* GetData() noexcept;
+
+    /// \brief Gets the pointer to the first element of the list.
+    AXIS_NODISCARD const T* GetData() const noexcept;
+
+    /// \brief Resizes the list with the specified length.
+    ///
+    /// Unlike \a `List::Resize`, the first elements are kept, the new ones are default constructed.
+    void Resize(Size length) requires(std::is_default_constructible_v<T> && (std::is_copy_constructible_v<T> || std::is_nothrow_move_constructible_v<T>));
+
+    /// \brief Index operator
+    ///
+    /// \param[in] index The index of the element to access.
+    ///
+    /// \returns A reference to the element at the specified index.
+    AXIS_NODISCARD T& operator[](Size index);
+
+    /// \brief Constant index operator
+    ///
+    /// \param[in] index The index of the element to access.
+    ///
+    /// \returns A reference to the element at the specified index.
+    AXIS_NODISCARD const T& operator[](Size index) const;
+
+    /// \brief Iterator to the beginning of the list.
+    AXIS_NODISCARD T* begin() noexcept;
+
+    /// \brief Iterator to the beginning of the list.
+    AXIS_NODISCARD const T* begin() const noexcept;
+
+    /// \brief Iterator to the end of the list.
+    AXIS_NODISCARD T* end() noexcept;
+
+    /// \brief Iterator to the end of the list.
+    AXIS_NODISCARD const T* end() const noexcept;
+
+    /// \brief Implicit conversion: checks if the list is empty or not.
+    ///
+    /// \returns `false` if the list is empty, `true` otherwise.
+    AXIS_NODISCARD operator Bool() const noexcept;
+
+private:
+    T*          GetInlineBuffer() noexcept;
+    T*          AllocateBuffer(Size capacity);                               // Allocates the buffer holding `capacity` elements.
+    void        AdoptBuffer(T* buffer, Size capacity) noexcept;              // Deallocates the current buffer and uses the given one instead.
+    void        TakeElements(InlineList& other) noexcept(std::is_nothrow_move_constructible_v<T>); // Takes the elements of the other list, this list must be empty.
+    void        Grow(Size capacity);                                         // Moves the elements to the new buffer of the given capacity.
+    static void ConstructRange(T* destination, const T* source, Size count); // Copy constructs the elements, destroys the constructed ones if throws.
+    static void TransferRange(T* destination, T* source, Size count);        // Moves the elements to the uninitialized memory, copies them if the move may throw. The source must be released by `ReleaseRange` afterward.
+    static void ReleaseRange(T* source, Size count) noexcept;                // Ends the lifetime of the elements transferred by `TransferRange`.
+    static void DestroyRange(T* buffer, Size count) noexcept;
+    static Size GetGrowthCapacity(Size length) noexcept;                     // Gets the capacity of the allocated buffer for the given length.
+
+    T*   _buffer   = reinterpret_cast<T*>(_inlineStorage); ///< Pointer to the inline storage or the allocated memory.
+    Size _capacity = N;                                    ///< Number of elements the buffer can hold.
+    Size _length   = 0;                                    ///< The length of the list.
+
+    alignas(T) Byte _inlineStorage[sizeof(T) * N]; ///< Storage of the first `N` elements.
+};
+
+} // namespace System
+
+} // namespace Axis
+
+#include "../../Private/Axis/InlineListImpl.inl"
+
+#endif // AXIS_SYSTEM_INLINELIST_HPP
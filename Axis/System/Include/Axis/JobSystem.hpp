@@ -0,0 +1,148 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#ifndef AXIS_SYSTEM_JOBSYSTEM_HPP
+#define AXIS_SYSTEM_JOBSYSTEM_HPP
+#pragma once
+
+#include "Config.hpp"
+#include "Function.hpp"
+#include "SystemExport.hpp"
+#include <atomic>
+#include <mutex>
+
+namespace Axis
+{
+
+namespace System
+{
+
+namespace Detail
+{
+
+/// Job queued in the job system, allocated from the \a `PoolAllocator`.
+struct Job;
+
+/// Worker thread of the job system.
+struct JobWorker;
+
+} // namespace Detail
+
+/// \brief Counts the unfinished jobs submitted with it, used to wait for the jobs (fork-join) and to
+///        start the jobs after the others (dependencies).
+///
+/// The counter must outlive the jobs submitted with it and the jobs depending on it. It can be
+/// reused once it reaches zero.
+class AXIS_SYSTEM_API JobCounter final
+{
+public:
+    /// \brief Constructs the counter with no unfinished jobs.
+    JobCounter() noexcept = default;
+
+    /// \brief Destructor, the counter must have no unfinished jobs.
+    ~JobCounter() noexcept;
+
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    /// \brief Checks whether all the jobs submitted with the counter have finished.
+    AXIS_NODISCARD inline Bool IsDone() const noexcept { return _count.load(std::memory_order_acquire) == 0; }
+
+private:
+    /// Set in `_count` while a thread is accessing `_pContinuations`. Locking through the count
+    /// lets the last job unlock and reach zero at once, the waiters may destroy the counter as soon
+    /// as they see zero.
+    static constexpr Size LockBit = (Size)1 << (sizeof(Size) * 8 - 1);
+
+    std::atomic<Size> _count          = 0;       ///< Number of the unfinished jobs and `LockBit`.
+    Detail::Job*      _pContinuations = nullptr; ///< Jobs waiting for the counter to reach zero.
+
+    friend class JobSystem;
+};
+
+/// \brief Runs the jobs on a fixed pool of the worker threads.
+///
+/// Every worker owns a work-stealing (Chase-Lev) deque: the jobs submitted from a worker go to its
+/// own deque, which it runs in the LIFO order while the idle workers steal the oldest jobs from it.
+/// The jobs submitted from the other threads go through a shared queue. The idle workers sleep
+/// until the new jobs are submitted.
+///
+/// \a `WaitFor` runs the other jobs while it waits, so the jobs can wait for their own child jobs
+/// without blocking the workers.
+///
+/// The jobs mustn't throw exceptions.
+class AXIS_SYSTEM_API JobSystem final
+{
+public:
+    /// \brief Job body, the small lambdas are stored without allocating.
+    using JobFunction = UniqueFunction<void()>;
+
+    /// \brief Starts the worker threads.
+    ///
+    /// \param[in] workerCount Number of the worker threads, at least one.
+    explicit JobSystem(Size workerCount = GetDefaultWorkerCount());
+
+    /// \brief Runs the remaining jobs, then stops the worker threads.
+    ~JobSystem() noexcept;
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    /// \brief Gets the default number of the worker threads, one less than the hardware threads,
+    ///        so the calling thread has its own core.
+    AXIS_NODISCARD static Size GetDefaultWorkerCount() noexcept;
+
+    /// \brief Gets the number of the worker threads.
+    AXIS_NODISCARD inline Size GetWorkerCount() const noexcept { return _workerCount; }
+
+    /// \brief Checks whether the calling thread is one of the workers of this job system.
+    AXIS_NODISCARD Bool IsWorkerThread() const noexcept;
+
+    /// \brief Submits the job, can be called from any thread.
+    ///
+    /// \param[in] function Job body.
+    /// \param[in] counter Counter incremented now and decremented when the job finishes, can be null.
+    void Submit(JobFunction function,
+                JobCounter* counter = nullptr);
+
+    /// \brief Submits the job which starts once all the jobs of the \a `dependency` have finished.
+    ///
+    /// \param[in] function Job body.
+    /// \param[in] dependency Counter to wait for.
+    /// \param[in] counter Counter incremented now and decremented when the job finishes, can be null.
+    void Submit(JobFunction function,
+                JobCounter& dependency,
+                JobCounter* counter = nullptr);
+
+    /// \brief Waits until all the jobs of the counter have finished, runs the other jobs meanwhile.
+    ///
+    /// \param[in] counter Counter to wait for.
+    void WaitFor(JobCounter& counter) noexcept;
+
+private:
+    Detail::Job* FindJob(Detail::JobWorker* worker) noexcept;
+    void         Push(Detail::Job* job) noexcept;
+    void         Execute(Detail::Job* job) noexcept;
+    void         Finish(JobCounter& counter) noexcept;
+    void         WakeWorker() noexcept;
+    void         RunWorker(Size index) noexcept;
+
+    Size               _workerCount = 0;       ///< Number of the worker threads.
+    Detail::JobWorker* _pWorkers    = nullptr; ///< Worker states, `_workerCount` elements.
+
+    std::mutex        _queueMutex = {}; ///< Guards the shared queue of the jobs submitted from the other threads.
+    Detail::Job*      _pQueueHead = {}; ///< Oldest job of the shared queue.
+    Detail::Job*      _pQueueTail = {}; ///< Newest job of the shared queue.
+    std::atomic<Size> _queueCount = 0;  ///< Number of the jobs in the shared queue, checked before locking.
+
+    std::atomic<Size> _sleepingCount = 0;     ///< Number of the workers about to sleep or sleeping.
+    std::atomic<Size> _wakeSignal    = 0;     ///< Incremented to wake the sleeping workers, they wait on it.
+    std::atomic<Bool> _stopping      = false; ///< Whether the destructor is stopping the workers.
+};
+
+} // namespace System
+
+} // namespace Axis
+
+#endif // AXIS_SYSTEM_JOBSYSTEM_HPP
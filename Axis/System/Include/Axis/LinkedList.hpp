@@ -21,8 +21,11 @@ namespace System
 ///
 /// \tparam T Type of object to store in the list.
 /// \tparam Allocator Type of allocator to use for memory management.
+///
+/// The allocator instance is stored in the linked list (taking no space for the stateless allocators),
+/// it's propagated on copy / move construction and move assignment but not on copy assignment.
 template <RawType T, AllocatorType Allocator = DefaultAllocator>
-class LinkedList final
+class LinkedList final : private Detail::AllocatorStorage<Allocator>
 {
 public:
     /// \brief Linked list's node data structure.
@@ -41,7 +44,12 @@ class LinkedList final
     };
 
     /// \brief Default constructor.
-    LinkedList() noexcept;
+    LinkedList() noexcept(std::is_nothrow_default_constructible_v<Allocator>);
+
+    /// \brief Allocator constructor.
+    ///
+    /// \param[in] allocator Allocator instance used by the linked list.
+    explicit LinkedList(const Allocator& allocator) noexcept;
 
     /// \brief Copy constructor.
     ///
@@ -70,6 +78,9 @@ class LinkedList final
     /// \return Reference to the linked list.
     LinkedList& operator=(LinkedList&& other) noexcept;
 
+    /// \brief Gets the allocator instance used by the linked list.
+    AXIS_NODISCARD const Allocator& GetAllocator() const noexcept;
+
     /// \brief Linked list's iterator.
     template <class Reference, class Pointer>
     struct Iterator;
@@ -23,20 +23,37 @@ namespace System
 ///
 /// All the functions in this class are categorized as `strong exception guarantee`. Which means that
 /// if an exception is thrown, the state of the object is rolled back to the state before the function.
+///
+/// The allocator instance is stored in the list (taking no space for the stateless allocators),
+/// it's propagated on copy / move construction and move assignment but not on copy assignment.
 template <RawType T, AllocatorType Allocator = DefaultAllocator>
-class List
+class List : private Detail::AllocatorStorage<Allocator>
 {
 public:
     /// \brief Default constructor.
     ///
     /// The list is initialized with a size of 0 and no memory is allocated.
-    List() noexcept = default;
+    List() noexcept(std::is_nothrow_default_constructible_v<Allocator>) = default;
+
+    /// \brief Allocator constructor.
+    ///
+    /// The list is initialized with a size of 0 and no memory is allocated.
+    ///
+    /// \param[in] allocator Allocator instance used by the list.
+    explicit List(const Allocator& allocator) noexcept;
 
     /// \brief Copy constructor.
     ///
     /// \param other List to copy from.
     List(const List& other) requires(std::is_copy_constructible_v<T>);
 
+    /// \brief Copy constructor with the specified allocator.
+    ///
+    /// \param[in] other List to copy from.
+    /// \param[in] allocator Allocator instance used by the list.
+    List(const List&      other,
+         const Allocator& allocator) requires(std::is_copy_constructible_v<T>);
+
     /// \brief Move constructor.
     ///
     /// \param other List to move from.
@@ -62,6 +79,13 @@ class List
     /// \param[in] init Initializer list to copy from.
     List(const std::initializer_list<T>& init) requires(std::is_copy_constructible_v<T>);
 
+    /// \brief Initializer list constructor with the specified allocator.
+    ///
+    /// \param[in] init Initializer list to copy from.
+    /// \param[in] allocator Allocator instance used by the list.
+    List(const std::initializer_list<T>& init,
+         const Allocator&                allocator) requires(std::is_copy_constructible_v<T>);
+
     /// \brief Destructor.
     ~List() noexcept;
 
@@ -80,6 +104,9 @@ class List
     /// \return The length of the list.
     AXIS_NODISCARD Size GetLength() const noexcept;
 
+    /// \brief Gets the allocator instance used by the list.
+    AXIS_NODISCARD const Allocator& GetAllocator() const noexcept;
+
     /// \brief Reserves memory for the list to the specified length.
     ///
     /// If the list's memory allocated length is already larger than the specified length,
@@ -217,14 +244,20 @@ class List
                                                              Size allocationSize, // Specifies zero if not specified
                                                              T*   begin,
                                                              Args&&... args); // Returns a tuple containing the pointer to the list and the size of allocated element.
-    template <Bool FreeMemory> static void ClearInternal(T*   buffer,
-                                                         Size length);
+    template <Bool FreeMemory> void        ClearInternal(T*   buffer,
+                                                         Size length) noexcept;
+    void                                   Relocate(Size allocatedLength) requires(TriviallyRelocatable<T>); // Moves the elements to the buffer of the given length bytewise, uses the allocator's `Reallocate` if available.
 
     T*   _buffer          = nullptr; ///< Pointer to the list's buffer.
     Size _allocatedLength = 0;       ///< The length of the allocated buffer.
     Size _length          = 0;       ///< The length of the list.
 };
 
+/// \brief `List` only holds the pointer to the buffer, the lengths and the allocator.
+template <RawType T, AllocatorType Allocator>
+struct IsTriviallyRelocatable<List<T, Allocator>> : IsTriviallyRelocatable<Allocator>
+{};
+
 } // namespace System
 
 } // namespace Axis
@@ -0,0 +1,130 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file `LICENSE`, which is part of this source code package.
+
+#ifndef AXIS_SYSTEM_MAPPEDFILESTREAM_HPP
+#define AXIS_SYSTEM_MAPPEDFILESTREAM_HPP
+#pragma once
+
+#include "Config.hpp"
+#include "Span.hpp"
+#include "Stream.hpp"
+#include "StringView.hpp"
+#include "SystemExport.hpp"
+
+namespace Axis
+{
+
+namespace System
+{
+
+/// \brief Tells the operating system how the mapped file is going to be read, so it can read ahead
+///        and drop the pages accordingly.
+enum class FileAccessPattern : Uint8
+{
+    /// \brief No particular order, the default read ahead.
+    Normal,
+
+    /// \brief Read from the beginning to the end once, e.g. the decoded images.
+    Sequential,
+
+    /// \brief Read in no predictable order, e.g. the font tables.
+    Random,
+};
+
+/// \brief Provides a read-only Stream over the file mapped into the memory.
+///
+/// The file's bytes are exposed directly through \a `GetView`, the loaders decode from them without
+/// copying the file into a buffer first, and the pages are shared with the other processes mapping
+/// the same file through the page cache. \a `Read` copies out of the mapping like the other streams.
+class AXIS_SYSTEM_API MappedFileStream final : public Stream
+{
+public:
+    /// \brief Maps the whole file into the memory.
+    ///
+    /// \param[in] filePath The name of the file to map.
+    /// \param[in] accessPattern How the file is going to be read.
+    MappedFileStream(const StringView<WChar>& filePath,
+                     FileAccessPattern        accessPattern = FileAccessPattern::Sequential);
+
+    /// \brief Destructor, unmaps the file.
+    ~MappedFileStream() noexcept override final;
+
+    /// \brief Move Constructor
+    ///
+    /// This causes the other MappedFileStream object to be moved into this object and become invalid.
+    MappedFileStream(MappedFileStream&&) noexcept;
+
+    /// \brief Move Assignment Operator
+    ///
+    /// This causes the other MappedFileStream object to be moved into this object and become invalid.
+    MappedFileStream& operator=(MappedFileStream&&) noexcept;
+
+    /// \brief Gets a value indicating whether the current stream is readable.
+    Bool CanRead() const override final;
+
+    /// \brief Always false, the file is mapped read-only.
+    Bool CanWrite() const override final;
+
+    /// \brief Gets a value indicating whether the current stream can seek.
+    Bool CanSeek() const override final;
+
+    /// \brief Gets the current position in the stream.
+    Size GetPosition() const override final;
+
+    /// \brief Gets the length in bytes of the stream.
+    Size GetLength() const override final;
+
+    /// \brief Copies a sequence of bytes from the mapping and
+    ///        advances the position within the stream by the number of bytes read.
+    ///
+    /// \param buffer The buffer to read the bytes into.
+    /// \param offset The zero-based byte offset in buffer at which to begin storing the data read from the current stream.
+    /// \param count The maximum number of bytes to be read.
+    ///
+    /// \return The total number of bytes read into the buffer, less than \a `count` at the end of the file.
+    Size Read(PVoid buffer,
+              Size  offset,
+              Size  count) override final;
+
+    /// \brief Always throws \a `InvalidOperationException`, the file is mapped read-only.
+    Size Write(PVoid buffer,
+               Size  offset,
+               Size  count) override final;
+
+    /// \brief Sets the position within the current stream.
+    ///
+    /// \param offset A byte offset relative to the origin parameter.
+    /// \param origin The origin from which the offset is calculated.
+    ///
+    /// \return The new position within the stream.
+    Size Seek(Int64      offset,
+              SeekOrigin origin) override final;
+
+    /// \brief Asks the operating system to start reading the range of the file in, ahead of its use.
+    ///
+    /// \param[in] offset Byte offset of the range in the file.
+    /// \param[in] length Length of the range in bytes, clamped to the end of the file.
+    void Prefetch(Size offset,
+                  Size length) const noexcept;
+
+    /// \brief Checks if the stream is open.
+    ///
+    /// \return True if the stream is open, false otherwise.
+    inline Bool IsOpen() const noexcept { return _isOpen; }
+
+    /// \brief Gets the mapped bytes of the whole file, valid until the stream is destroyed.
+    inline Span<Byte> GetView() const noexcept { return Span<Byte>(_data, _data + _length); }
+
+private:
+    const Byte* _data     = nullptr; ///< Beginning of the mapping, null for the empty files.
+    Size        _length   = 0;       ///< Length of the file.
+    Size        _position = 0;       ///< Position of the next \a `Read`.
+    Bool        _isOpen   = false;   ///< Whether the file was mapped.
+};
+
+} // namespace System
+
+} // namespace Axis
+
+#endif // AXIS_SYSTEM_MAPPEDFILESTREAM_HPP
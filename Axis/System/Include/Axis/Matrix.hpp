@@ -64,6 +64,9 @@ struct Matrix
 
     /// \brief Mutiplies two matrices together.
     ///
+    /// The 4 by 4 \a `Float32` matrices are multiplied with the SIMD instructions outside
+    /// of the constant evaluation.
+    ///
     /// \warning Matrix size's condition must satisfied in order to mutiplies the matrix.
     template <Size OtherRowSize, Size OtherColumnSize>
     AXIS_NODISCARD constexpr Matrix<T, RowSize, OtherColumnSize, IsColumnMajor> operator*(const Matrix<T, OtherRowSize, OtherColumnSize, IsColumnMajor>& other) const noexcept;
@@ -74,6 +77,29 @@ struct Matrix
     /// \brief Mutiplies matrix with scalar.
     AXIS_NODISCARD constexpr Matrix operator*(T scalar) const noexcept;
 
+    /// \brief Gets the transposed copy of the matrix.
+    AXIS_NODISCARD constexpr Matrix<T, ColumnSize, RowSize, IsColumnMajor> GetTransposed() const noexcept;
+
+    /// \brief Gets the inverse of the matrix.
+    ///
+    /// The 4 by 4 \a `Float32` matrices are inverted with the SSE2 instructions outside
+    /// of the constant evaluation.
+    ///
+    /// \warning The matrix must be invertible, the result of the singular matrix contains infinities.
+    AXIS_NODISCARD constexpr Matrix GetInverse() const noexcept requires(RowSize == 4 && ColumnSize == 4 && FloatingPointType<T>);
+
+    /// \brief Transforms the point, the vector extended with w = 1, by the matrix.
+    ///
+    /// \param[in] point Point to transform.
+    AXIS_NODISCARD constexpr Vector3<T> TransformPoint(const Vector3<T>& point) const noexcept requires(RowSize == 4 && ColumnSize == 4);
+
+    /// \brief Transforms the direction, the vector extended with w = 0, by the matrix.
+    ///
+    /// The translation of the matrix doesn't apply to the directions.
+    ///
+    /// \param[in] direction Direction to transform.
+    AXIS_NODISCARD constexpr Vector3<T> TransformDirection(const Vector3<T>& direction) const noexcept requires(RowSize == 4 && ColumnSize == 4);
+
     static_assert(RowSize, "`template <class T, Size ColumnSize, Size RowSize, Bool IsColumnMajor> Axis::Math::Matrix` template parameter `RowSize` was 0.");
     static_assert(ColumnSize, "`template <class T, Size ColumnSize, Size RowSize, Bool IsColumnMajor> Axis::Math::Matrix` template parameter `ColumnSize` was 0.");
 
@@ -113,6 +139,13 @@ struct Matrix
     constexpr static Matrix GetMatrixRotationY(T randian) noexcept requires(RowSize == 4 && ColumnSize == 4);
 
 private:
+    static constexpr Size GetIndex(Size row, Size column) noexcept; // Gets the index of the element in `_matrices`.
+
+    constexpr Vector3<T> Transform(const Vector3<T>& vector, T w) const noexcept requires(RowSize == 4 && ColumnSize == 4); // Transforms the vector extended with `w`.
+
+    template <ArithmeticType, Size, Size, Bool>
+    friend struct Matrix;
+
     T _matrices[ColumnSize * RowSize] = {};
 };
 
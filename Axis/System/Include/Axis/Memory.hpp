@@ -19,19 +19,41 @@ namespace System
 /// \brief Concept for checking if a type is capable being an allocator
 ///        for the memory management system.
 ///
-/// The type should have public static function `Allocate` and `Deallocate`
+/// The type should have public function `Allocate` and `Deallocate`, either
+/// static (stateless allocators) or non-static (stateful allocators which
+/// are stored in the containers).
 template <class T>
 concept AllocatorType = requires(T t)
 {
     {
         // Allocates memory with the given size and alignment
-        T::Allocate((Size)0, (Size)0)
+        t.Allocate((Size)0, (Size)0)
         } -> SameAs<PVoid>;
 
     {
         // Deallocates the given memory pointer
-        T::Deallocate((PVoid) nullptr)
+        t.Deallocate((PVoid) nullptr)
         } -> SameAs<PVoid>;
+}
+&&std::is_nothrow_copy_constructible_v<T>&& std::is_nothrow_move_constructible_v<T>;
+
+/// \brief Concept for checking if an allocator additionally provides the
+///        optional `Reallocate` hook.
+///
+/// `Reallocate(ptr, oldSize, newSize, alignment)` resizes the memory previously
+/// allocated with `oldSize` bytes and the same alignment, possibly in place. The
+/// first `min(oldSize, newSize)` bytes are preserved; if it throws, `ptr` is left
+/// untouched. `ptr` may be nullptr in which case it behaves like `Allocate`.
+///
+/// The containers fall back to `Allocate`, copy and `Deallocate` for the
+/// allocators without the hook.
+template <class T>
+concept ReallocatableAllocatorType = AllocatorType<T> && requires(T t)
+{
+    {
+        // Resizes the given memory
+        t.Reallocate((PVoid) nullptr, (Size)0, (Size)0, (Size)0)
+        } -> std::convertible_to<PVoid>;
 };
 
 /// \brief Allocator class which satisfies the concept `AllocatorType`.
@@ -45,6 +67,14 @@ struct AXIS_SYSTEM_API MallocAllocator
     /// \param[in] alignment The alignment of the memory to allocate
     AXIS_NODISCARD static PVoid Allocate(Size size, Size alignment);
 
+    /// \brief Resizes the given memory with `std::realloc`, see \a `ReallocatableAllocatorType`.
+    ///
+    /// \param[in] ptr The pointer to resize
+    /// \param[in] oldSize The size the memory was allocated with
+    /// \param[in] newSize The new size of the memory
+    /// \param[in] alignment The alignment the memory was allocated with
+    AXIS_NODISCARD static PVoid Reallocate(PVoid ptr, Size oldSize, Size newSize, Size alignment);
+
     /// \brief Deallocates the given memory pointer
     ///
     /// \param[in] ptr The pointer to deallocate
@@ -54,6 +84,12 @@ struct AXIS_SYSTEM_API MallocAllocator
 /// \brief Allocator class which satisfies the concept `AllocatorType`.
 ///        the allocator pools the memory when it is deallocated for the next
 ///        allocation.
+///
+/// Small blocks (up to 64 KiB with alignment up to 128 bytes) are served from
+/// a per-thread cache of size classes, so the common allocation and
+/// deallocation paths don't take any locks. The cache exchanges blocks with
+/// the shared pools in batches. Memory allocated on one thread can be
+/// deallocated on any other thread.
 struct AXIS_SYSTEM_API PoolAllocator
 {
     /// \brief Allocates / retrieves memory with the given size and alignment
@@ -62,19 +98,286 @@ struct AXIS_SYSTEM_API PoolAllocator
     /// \param[in] alignment The alignment of the memory to allocate
     AXIS_NODISCARD static PVoid Allocate(Size size, Size alignment);
 
+    /// \brief Resizes the given memory, see \a `ReallocatableAllocatorType`.
+    ///
+    /// Stays in place when the new size still fits in the pooled block.
+    ///
+    /// \param[in] ptr The pointer to resize
+    /// \param[in] oldSize The size the memory was allocated with
+    /// \param[in] newSize The new size of the memory
+    /// \param[in] alignment The alignment the memory was allocated with
+    AXIS_NODISCARD static PVoid Reallocate(PVoid ptr, Size oldSize, Size newSize, Size alignment);
+
     /// \brief Returns the given memory pointer back to the pool
     ///
     /// \param[in] ptr The pointer to deallocate
     static void Deallocate(PVoid ptr) noexcept;
+
+    /// \brief Gives all the blocks cached by the calling thread back to the
+    ///        shared pools.
+    ///
+    /// The cache is released automatically when the thread exits; this is
+    /// useful for long-lived threads which are done allocating.
+    static void ReleaseThreadCache() noexcept;
+};
+
+/// \brief Allocator class which satisfies the concept `AllocatorType`.
+///        The allocator bump-allocates short-lived memory which is only
+///        needed for the current frame.
+///
+/// Each thread bump-allocates from its own chunk, so the allocation doesn't
+/// take any locks unless the chunk runs out. \a `Deallocate` does nothing,
+/// all the memory is released in bulk by \a `Reset` once per frame.
+///
+/// The arena is double-buffered: memory allocated in one frame stays valid
+/// during the next frame as well (e.g. while the GPU is still reading it),
+/// and is recycled by the \a `Reset` after that.
+struct AXIS_SYSTEM_API FrameArenaAllocator
+{
+    /// \brief Number of frames whose memory is kept alive at the same time.
+    static constexpr Size BufferCount = 2;
+
+    /// \brief Default size of the chunks which the threads allocate from.
+    static constexpr Size ChunkSize = 64 * 1024;
+
+    /// \brief Allocates memory with the given size and alignment for the
+    ///        current frame.
+    ///
+    /// \param[in] size The size of the memory to allocate
+    /// \param[in] alignment The alignment of the memory to allocate
+    AXIS_NODISCARD static PVoid Allocate(Size size, Size alignment);
+
+    /// \brief Resizes the given memory, see \a `ReallocatableAllocatorType`.
+    ///
+    /// Grows or shrinks in place when the memory is the last allocation of the
+    /// calling thread.
+    ///
+    /// \param[in] ptr The pointer to resize
+    /// \param[in] oldSize The size the memory was allocated with
+    /// \param[in] newSize The new size of the memory
+    /// \param[in] alignment The alignment the memory was allocated with
+    AXIS_NODISCARD static PVoid Reallocate(PVoid ptr, Size oldSize, Size newSize, Size alignment);
+
+    /// \brief Does nothing, the memory is released by \a `Reset`.
+    ///
+    /// \param[in] ptr The pointer to deallocate
+    static void Deallocate(PVoid ptr) noexcept;
+
+    /// \brief Moves the arena to the next frame and recycles the memory
+    ///        allocated `BufferCount` frames ago.
+    ///
+    /// Should be called once per frame, when no other thread is allocating
+    /// from the arena. \a `Axis::Core::Application` calls it at the
+    /// beginning of every tick.
+    static void Reset() noexcept;
+
+    /// \brief Gets the number of the current frame, incremented by each
+    ///        \a `Reset`.
+    AXIS_NODISCARD static Size GetFrameNumber() noexcept;
 };
 
 /// \brief Axis's default container type memory allocator.
 using DefaultAllocator = MallocAllocator;
 
+/// \brief Interface of the memory sources which can be selected at runtime,
+///        used through \a `PolymorphicAllocator`.
+class AXIS_SYSTEM_API MemoryResource
+{
+public:
+    /// \brief Virtual destructor
+    virtual ~MemoryResource() noexcept = default;
+
+    /// \brief Allocates memory with the given size and alignment
+    ///
+    /// \param[in] size The size of the memory to allocate
+    /// \param[in] alignment The alignment of the memory to allocate
+    AXIS_NODISCARD virtual PVoid Allocate(Size size, Size alignment) = 0;
+
+    /// \brief Deallocates the given memory pointer
+    ///
+    /// \param[in] ptr The pointer to deallocate
+    virtual void Deallocate(PVoid ptr) noexcept = 0;
+};
+
+/// \brief \a `MemoryResource` which forwards the requests to the stateless
+///        allocator (e.g. \a `MallocAllocator` or \a `PoolAllocator`).
+template <AllocatorType Allocator>
+class AllocatorMemoryResource final : public MemoryResource
+{
+public:
+    /// \brief Allocates memory with the given size and alignment
+    ///
+    /// \param[in] size The size of the memory to allocate
+    /// \param[in] alignment The alignment of the memory to allocate
+    AXIS_NODISCARD PVoid Allocate(Size size, Size alignment) override final;
+
+    /// \brief Deallocates the given memory pointer
+    ///
+    /// \param[in] ptr The pointer to deallocate
+    void Deallocate(PVoid ptr) noexcept override final;
+
+private:
+    Allocator _allocator = {}; ///< Allocator to forward the requests to
+};
+
+/// \brief \a `MemoryResource` which bump-allocates from the chunks requested
+///        from the upstream resource.
+///
+/// \a `Deallocate` does nothing, all the memory is given back at once by
+/// \a `Release` or when the resource is destroyed. Useful for giving a
+/// subsystem its own heap and throwing it away in O(1).
+class AXIS_SYSTEM_API ArenaMemoryResource final : public MemoryResource
+{
+public:
+    /// \brief Default size of the chunks requested from the upstream resource.
+    static constexpr Size DefaultChunkSize = 64 * 1024;
+
+    /// \brief Constructs the arena.
+    ///
+    /// \param[in] chunkSize Size of the chunks requested from the upstream resource.
+    /// \param[in] upstream Resource to request the chunks from, uses the default memory resource if nullptr.
+    explicit ArenaMemoryResource(Size            chunkSize = DefaultChunkSize,
+                                 MemoryResource* upstream  = nullptr) noexcept;
+
+    /// \brief Destructor, releases all the memory.
+    ~ArenaMemoryResource() noexcept override;
+
+    ArenaMemoryResource(const ArenaMemoryResource&) = delete;
+    ArenaMemoryResource& operator=(const ArenaMemoryResource&) = delete;
+
+    /// \brief Allocates memory with the given size and alignment
+    ///
+    /// \param[in] size The size of the memory to allocate
+    /// \param[in] alignment The alignment of the memory to allocate
+    AXIS_NODISCARD PVoid Allocate(Size size, Size alignment) override;
+
+    /// \brief Does nothing, the memory is given back by \a `Release`.
+    ///
+    /// \param[in] ptr The pointer to deallocate
+    void Deallocate(PVoid ptr) noexcept override;
+
+    /// \brief Gives all the chunks back to the upstream resource, all the
+    ///        memory allocated from this arena becomes invalid.
+    void Release() noexcept;
+
+private:
+    struct Chunk;
+
+    MemoryResource* _upstream  = nullptr; ///< Resource to request the chunks from
+    Size            _chunkSize = 0;       ///< Size of the chunks requested from the upstream resource
+    Chunk*          _chunks    = nullptr; ///< Chunks requested so far, the first one is being allocated from
+    Size            _current   = 0;       ///< Address of the next free byte in the first chunk
+    Size            _end       = 0;       ///< Address past the end of the first chunk
+};
+
+/// \brief Gets the memory resource used by the default constructed
+///        \a `PolymorphicAllocator`s.
+///
+/// Defaults to the resource which forwards to \a `MallocAllocator`.
+AXIS_NODISCARD AXIS_SYSTEM_API MemoryResource* GetDefaultMemoryResource() noexcept;
+
+/// \brief Sets the memory resource used by the default constructed
+///        \a `PolymorphicAllocator`s.
+///
+/// \param[in] memoryResource New default memory resource, nullptr restores the initial one.
+///
+/// \return The previous default memory resource.
+AXIS_SYSTEM_API MemoryResource* SetDefaultMemoryResource(MemoryResource* memoryResource) noexcept;
+
+/// \brief Stateful allocator which satisfies the concept `AllocatorType`.
+///        Forwards the requests to the \a `MemoryResource` selected at
+///        runtime.
+class PolymorphicAllocator
+{
+public:
+    /// \brief Uses the default memory resource.
+    PolymorphicAllocator() noexcept;
+
+    /// \brief Uses the given memory resource.
+    ///
+    /// \param[in] memoryResource Memory resource to forward the requests to, must outlive the allocator.
+    PolymorphicAllocator(MemoryResource* memoryResource) noexcept;
+
+    /// \brief Allocates memory with the given size and alignment
+    ///
+    /// \param[in] size The size of the memory to allocate
+    /// \param[in] alignment The alignment of the memory to allocate
+    AXIS_NODISCARD PVoid Allocate(Size size, Size alignment) const;
+
+    /// \brief Deallocates the given memory pointer
+    ///
+    /// \param[in] ptr The pointer to deallocate
+    void Deallocate(PVoid ptr) const noexcept;
+
+    /// \brief Gets the memory resource which the allocator forwards to.
+    AXIS_NODISCARD MemoryResource* GetMemoryResource() const noexcept;
+
+    /// \brief Checks if both allocators use the same memory resource.
+    AXIS_NODISCARD Bool operator==(const PolymorphicAllocator& other) const noexcept;
+
+private:
+    MemoryResource* _memoryResource = nullptr; ///< Memory resource to forward the requests to
+};
+
+namespace Detail
+{
+
+/// \brief Stores the allocator instance in the containers. Stateless
+///        (empty) allocators are stored as the base class so that they take
+///        no space (empty base optimization).
+template <AllocatorType Allocator, Bool IsEmpty = std::is_empty_v<Allocator> && !std::is_final_v<Allocator>>
+class AllocatorStorage;
+
+/// \brief Empty allocator, stored as the base class.
+template <AllocatorType Allocator>
+class AllocatorStorage<Allocator, true> : private Allocator
+{
+public:
+    /// \brief Default constructor
+    AllocatorStorage() noexcept = default;
+
+    /// \brief Copies the given allocator.
+    AllocatorStorage(const Allocator& allocator) noexcept :
+        Allocator(allocator) {}
+
+    /// \brief Gets the stored allocator.
+    AXIS_NODISCARD inline Allocator& GetAllocatorInstance() noexcept { return *this; }
+
+    /// \brief Gets the stored allocator.
+    AXIS_NODISCARD inline const Allocator& GetAllocatorInstance() const noexcept { return *this; }
+};
+
+/// \brief Stateful allocator, stored as the member.
+template <AllocatorType Allocator>
+class AllocatorStorage<Allocator, false>
+{
+public:
+    /// \brief Default constructor
+    AllocatorStorage() noexcept(std::is_nothrow_default_constructible_v<Allocator>) = default;
+
+    /// \brief Copies the given allocator.
+    AllocatorStorage(const Allocator& allocator) noexcept :
+        _allocator(allocator) {}
+
+    /// \brief Gets the stored allocator.
+    AXIS_NODISCARD inline Allocator& GetAllocatorInstance() noexcept { return _allocator; }
+
+    /// \brief Gets the stored allocator.
+    AXIS_NODISCARD inline const Allocator& GetAllocatorInstance() const noexcept { return _allocator; }
+
+private:
+    Allocator _allocator = {}; ///< Stored allocator instance
+};
+
+} // namespace Detail
+
 /// \brief Creates a new instance of the specified type using the
 ///        specified allocator on the heap. Uses \a `Delete` to delete
 ///        the instance.
 ///
+/// The stateful allocators (e.g. \a `PolymorphicAllocator`) are default constructed once and kept
+/// along with the memory, \a `AllocatedDelete` frees through the same instance.
+///
 /// \tparam T Type of the instance to create.
 /// \tparam Allocator Type of the allocator to use.
 ///
@@ -86,6 +389,8 @@ AXIS_NODISCARD T* AllocatedNew(Args&&... args) noexcept(std::is_nothrow_construc
 ///        the specified allocator on the heap. Uses \a `DeleteArray` to
 ///        delete the array.
 ///
+/// The stateful allocators are kept along with the memory, the same as in \a `AllocatedNew`.
+///
 /// \tparam T Type of the instance to create.
 /// \tparam AllocatorType Type of the allocator to use.
 ///
@@ -0,0 +1,175 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#ifndef AXIS_SYSTEM_PARALLELALGORITHM_HPP
+#define AXIS_SYSTEM_PARALLELALGORITHM_HPP
+#pragma once
+
+#include "Config.hpp"
+#include "Function.hpp"
+#include "JobSystem.hpp"
+#include "List.hpp"
+#include "Span.hpp"
+#include "SystemExport.hpp"
+#include <functional>
+
+namespace Axis
+{
+
+namespace System
+{
+
+// The parallel algorithms split the elements into the chunks of at least `grainSize` elements, at
+// most a few chunks per thread, and run the chunks as the jobs of the job system. The ranges up to
+// `grainSize` elements run serially on the calling thread. The function objects are called from
+// several threads at once and mustn't throw exceptions.
+
+/// \brief Default number of the elements below which \a `ParallelSort` sorts serially.
+constexpr Size DefaultParallelSortGrainSize = 4096;
+
+namespace Detail
+{
+
+/// Gets the size of the chunks the parallel algorithms split the \a `count` elements into.
+AXIS_NODISCARD AXIS_SYSTEM_API Size GetParallelChunkSize(const JobSystem& jobSystem,
+                                                         Size             count,
+                                                         Size             grainSize) noexcept;
+
+/// Calls the \a `body` with the [begin, end) ranges of the chunks, the ranges start at the multiples
+/// of the \a `chunkSize`. Returns after all the chunks are done.
+AXIS_SYSTEM_API void ParallelForChunks(JobSystem&                  jobSystem,
+                                       Size                        count,
+                                       Size                        chunkSize,
+                                       FunctionRef<void(Size, Size)> body) noexcept;
+
+} // namespace Detail
+
+/// \brief Calls the \a `function` with every index in the range, in parallel.
+///
+/// \param[in] jobSystem Job system to run the chunks on.
+/// \param[in] begin First index of the range.
+/// \param[in] end Index past the last one of the range.
+/// \param[in] grainSize Minimum number of the indices per job.
+/// \param[in] function Function called with every index, `void(Size)`.
+template <class Function>
+void ParallelFor(JobSystem&      jobSystem,
+                 Size            begin,
+                 Size            end,
+                 Size            grainSize,
+                 const Function& function) requires(std::is_invocable_v<const Function&, Size>);
+
+/// \brief Calls the \a `function` with every element of the list, in parallel.
+///
+/// \param[in] jobSystem Job system to run the chunks on.
+/// \param[in] list Elements to process.
+/// \param[in] grainSize Minimum number of the elements per job.
+/// \param[in] function Function called with every element, `void(T&)`.
+template <class T, AllocatorType Allocator, class Function>
+void ParallelFor(JobSystem&          jobSystem,
+                 List<T, Allocator>& list,
+                 Size                grainSize,
+                 const Function&     function) requires(std::is_invocable_v<const Function&, T&>);
+
+/// \brief Combines the elements with the associative \a `reduce` function, in parallel.
+///
+/// The chunks are combined in order, so the result is the same on every run even if the function
+/// isn't commutative (e.g. the floating-point addition).
+///
+/// \param[in] jobSystem Job system to run the chunks on.
+/// \param[in] span Elements to combine.
+/// \param[in] grainSize Minimum number of the elements per job.
+/// \param[in] identity Identity value of the \a `reduce` function, the result of the empty span.
+/// \param[in] reduce Associative function, `T(const T&, const T&)`.
+template <class T, class Reduce>
+AXIS_NODISCARD T ParallelReduce(JobSystem&     jobSystem,
+                                const Span<T>& span,
+                                Size           grainSize,
+                                const T&       identity,
+                                const Reduce&  reduce);
+
+/// \brief Maps every index in the range to a value, then combines the values with the associative
+///        \a `reduce` function, in parallel.
+///
+/// \param[in] jobSystem Job system to run the chunks on.
+/// \param[in] begin First index of the range.
+/// \param[in] end Index past the last one of the range.
+/// \param[in] grainSize Minimum number of the indices per job.
+/// \param[in] identity Identity value of the \a `reduce` function, the result of the empty range.
+/// \param[in] map Function mapping the index to a value, `R(Size)`.
+/// \param[in] reduce Associative function, `R(const R&, const R&)`.
+template <class R, class Map, class Reduce>
+AXIS_NODISCARD R ParallelReduce(JobSystem&    jobSystem,
+                                Size          begin,
+                                Size          end,
+                                Size          grainSize,
+                                const R&      identity,
+                                const Map&    map,
+                                const Reduce& reduce);
+
+/// \brief Stores the results of the \a `function` of the elements to the destination, in parallel.
+///
+/// \param[in] jobSystem Job system to run the chunks on.
+/// \param[in] span Elements to transform.
+/// \param[out] destination Buffer with room for \a `span.GetLength()` elements.
+/// \param[in] grainSize Minimum number of the elements per job.
+/// \param[in] function Function transforming the element, `U(const T&)`.
+template <class T, class U, class Function>
+void ParallelTransform(JobSystem&      jobSystem,
+                       const Span<T>&  span,
+                       U*              destination,
+                       Size            grainSize,
+                       const Function& function);
+
+/// \brief Computes the inclusive prefix scan of the elements with the associative \a `operation`,
+///        in parallel. The element i of the destination combines the elements 0 to i.
+///
+/// \param[in] jobSystem Job system to run the chunks on.
+/// \param[in] span Elements to scan.
+/// \param[out] destination Buffer with room for \a `span.GetLength()` elements, can be the data of
+///             the span.
+/// \param[in] grainSize Minimum number of the elements per job.
+/// \param[in] identity Identity value of the \a `operation`.
+/// \param[in] operation Associative function, `T(const T&, const T&)`.
+template <class T, class Operation>
+void ParallelScan(JobSystem&       jobSystem,
+                  const Span<T>&   span,
+                  T*               destination,
+                  Size             grainSize,
+                  const T&         identity,
+                  const Operation& operation);
+
+/// \brief Sorts the elements in parallel, the chunks are sorted with `std::sort` then merged. The
+///        sort isn't stable.
+///
+/// \param[in] jobSystem Job system to run the chunks on.
+/// \param[in] begin First element to sort.
+/// \param[in] end Element past the last one to sort.
+/// \param[in] compare Strict weak ordering, `Bool(const T&, const T&)`.
+/// \param[in] grainSize Number of the elements below which the range is sorted serially.
+template <class T, class Compare = std::less<>>
+void ParallelSort(JobSystem&     jobSystem,
+                  T*             begin,
+                  T*             end,
+                  const Compare& compare   = {},
+                  Size           grainSize = DefaultParallelSortGrainSize) requires(std::is_default_constructible_v<T> && std::is_move_assignable_v<T>);
+
+/// \brief Sorts the elements of the list in parallel, see \a `ParallelSort`.
+///
+/// \param[in] jobSystem Job system to run the chunks on.
+/// \param[in] list Elements to sort.
+/// \param[in] compare Strict weak ordering, `Bool(const T&, const T&)`.
+/// \param[in] grainSize Number of the elements below which the list is sorted serially.
+template <class T, AllocatorType Allocator, class Compare = std::less<>>
+void ParallelSort(JobSystem&          jobSystem,
+                  List<T, Allocator>& list,
+                  const Compare&      compare   = {},
+                  Size                grainSize = DefaultParallelSortGrainSize) requires(std::is_default_constructible_v<T> && std::is_move_assignable_v<T>);
+
+} // namespace System
+
+} // namespace Axis
+
+#include "../../Private/Axis/ParallelAlgorithmImpl.inl"
+
+#endif // AXIS_SYSTEM_PARALLELALGORITHM_HPP
@@ -0,0 +1,48 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file `LICENSE`, which is part of this source code package.
+
+#ifndef AXIS_SYSTEM_POSIXTIMER_HPP
+#define AXIS_SYSTEM_POSIXTIMER_HPP
+#pragma once
+
+#include "../../SystemExport.hpp"
+#include "../../TimePeriod.hpp"
+
+namespace Axis
+{
+
+namespace System
+{
+
+/// \brief Represents the high resolution timer.
+///
+/// Reads `CLOCK_MONOTONIC_RAW`, which isn't slewed by NTP, or the CPU's time stamp counter
+/// calibrated against it when the kernel itself uses the counter as its clock source.
+struct AXIS_SYSTEM_API Timer final
+{
+public:
+    /// \brief Default constructor
+    Timer() noexcept;
+
+    /// \brief Destructor
+    ~Timer() noexcept;
+
+    /// \brief Gets the total elapsed time period since the construction / last Reset.
+    AXIS_NODISCARD TimePeriod GetElapsedTimePeriod() const noexcept;
+
+    /// \brief Gets the total elapsed time period since the construction / last Reset, and reset the current time.
+    TimePeriod Reset() noexcept;
+
+    /// \brief Gets the current time of the monotonic clock used by the timers, since an arbitrary point.
+    AXIS_NODISCARD static TimePeriod GetTimestamp() noexcept;
+
+private:
+    TimePeriod _lastestTime = {};
+};
+
+} // namespace System
+
+} // namespace Axis
+
+#endif // AXIS_SYSTEM_POSIXTIMER_HPP
@@ -31,6 +31,9 @@ struct AXIS_SYSTEM_API Timer final
     /// \brief Gets the total elapsed time period since the construction / last Reset, and reset the current time.
     TimePeriod Reset() noexcept;
 
+    /// \brief Gets the current time of the monotonic clock used by the timers, since an arbitrary point.
+    AXIS_NODISCARD static TimePeriod GetTimestamp() noexcept;
+
 private:
     TimePeriod _lastestTime = {};
 };
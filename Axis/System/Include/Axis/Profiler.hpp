@@ -0,0 +1,174 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#ifndef AXIS_SYSTEM_PROFILER_HPP
+#define AXIS_SYSTEM_PROFILER_HPP
+#pragma once
+
+#include "List.hpp"
+#include "String.hpp"
+#include "SystemExport.hpp"
+
+namespace Axis
+{
+
+namespace System
+{
+
+/// \brief Single timed zone recorded by \a `ProfileZone`.
+struct ProfileEvent
+{
+    const char* Name     = nullptr; ///< Name of the zone, has static storage duration
+    Uint64      Start    = 0;       ///< Timestamp at the zone's beginning, in nanoseconds
+    Uint64      End      = 0;       ///< Timestamp at the zone's end, in nanoseconds
+    Uint32      Depth    = 0;       ///< Number of the zones enclosing this one on the same thread
+    Uint32      ThreadId = 0;       ///< Index of the thread which recorded the zone
+};
+
+/// \brief Times spent in the zones of the same name during one frame, summed across the threads.
+struct ProfileZoneStatistics
+{
+    const char* Name      = nullptr; ///< Name of the zone
+    Uint32      Depth     = 0;       ///< Smallest nesting depth the zone was recorded at
+    Size        CallCount = 0;       ///< Number of the times the zone was entered
+    Uint64      TotalTime = 0;       ///< Nanoseconds spent inside the zone, including the nested zones
+    Uint64      SelfTime  = 0;       ///< Nanoseconds spent inside the zone, excluding the nested zones
+    Uint64      MaxTime   = 0;       ///< Longest single call of the zone, in nanoseconds
+};
+
+/// \brief Summary of the zones recorded during one frame.
+struct ProfileFrameSummary
+{
+    Uint64 FrameIndex = 0; ///< Index of the frame, counted by \a `Profiler::BeginFrame`
+    Uint64 Start      = 0; ///< Timestamp at the frame's beginning, in nanoseconds
+    Uint64 Duration   = 0; ///< Length of the frame, in nanoseconds
+
+    /// \brief Statistics of every zone that ended during the frame, ordered by their total time.
+    List<ProfileZoneStatistics> Zones = {};
+};
+
+/// \brief Global hierarchical CPU profiler, fed by \a `AXIS_PROFILE_SCOPE`.
+///
+/// Every thread records its zones into its own ring buffer of \a `EventCapacity` events, so the
+/// recording takes no locks and never allocates after the thread's first zone; the oldest events
+/// are overwritten once the ring is full. The exports read the rings while the threads keep
+/// recording and skip the events overwritten meanwhile.
+///
+/// The zones are only recorded when `AXIS_ENABLE_PROFILER` is defined, otherwise the macros expand
+/// to nothing.
+struct AXIS_SYSTEM_API Profiler
+{
+    /// \brief Number of the events kept per thread.
+    static constexpr Size EventCapacity = 1 << 14;
+
+    /// \brief Number of the frame boundaries kept for \a `GetFrameSummary`.
+    static constexpr Size FrameCapacity = 64;
+
+    /// \brief Gets the high resolution monotonic timestamp used by the zones, in nanoseconds.
+    AXIS_NODISCARD static Uint64 GetTimestamp() noexcept;
+
+    /// \brief Records the zone ended on the calling thread.
+    ///
+    /// \param[in] name Name of the zone, must have static storage duration.
+    /// \param[in] start Timestamp at the zone's beginning.
+    /// \param[in] end Timestamp at the zone's end.
+    /// \param[in] depth Number of the zones enclosing this one.
+    static void RecordZone(const char* name,
+                           Uint64      start,
+                           Uint64      end,
+                           Uint32      depth) noexcept;
+
+    /// \brief Names the calling thread in the exported traces.
+    ///
+    /// \param[in] name Name of the thread, must have static storage duration.
+    static void SetThreadName(const char* name) noexcept;
+
+    /// \brief Marks the beginning of the new frame.
+    ///
+    /// \a `Axis::Core::Application` calls it at the beginning of every tick.
+    static void BeginFrame() noexcept;
+
+    /// \brief Gets the number of the frames begun so far.
+    AXIS_NODISCARD static Uint64 GetFrameCount() noexcept;
+
+    /// \brief Sums the zones recorded during the frame.
+    ///
+    /// \param[in] framesAgo Which frame to summarize, 1 is the last completed frame.
+    ///
+    /// \return Summary of the frame, empty if the frame hasn't completed or is older than
+    ///         \a `FrameCapacity` frames.
+    AXIS_NODISCARD static ProfileFrameSummary GetFrameSummary(Size framesAgo = 1);
+
+    /// \brief Takes a snapshot of the events still held by the threads' rings, ordered by their
+    ///        start timestamps.
+    AXIS_NODISCARD static List<ProfileEvent> GetEvents();
+
+    /// \brief Dumps the events still held by the threads' rings as the Chrome `trace_event` JSON
+    ///        document, loadable by `chrome://tracing` and Perfetto.
+    AXIS_NODISCARD static String8 ExportChromeTrace();
+
+    /// \brief Drops all the recorded events and frames.
+    ///
+    /// The events recorded by the other threads at the same time may survive.
+    static void Clear() noexcept;
+};
+
+/// \brief Times the enclosing scope and records it to the \a `Profiler` on destruction, used
+///        through \a `AXIS_PROFILE_SCOPE`.
+class AXIS_SYSTEM_API ProfileZone final
+{
+public:
+    /// \brief Starts timing the zone.
+    ///
+    /// \param[in] name Name of the zone, must have static storage duration.
+    explicit ProfileZone(const char* name) noexcept;
+
+    /// \brief Records the zone.
+    ~ProfileZone() noexcept;
+
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+
+private:
+    const char* _name  = nullptr; ///< Name of the zone
+    Uint64      _start = 0;       ///< Timestamp at the zone's beginning
+    Uint32      _depth = 0;       ///< Number of the zones enclosing this one
+};
+
+} // namespace System
+
+} // namespace Axis
+
+#define AXIS_PROFILE_CONCAT_INTERNAL(x, y) x##y
+#define AXIS_PROFILE_CONCAT(x, y)          AXIS_PROFILE_CONCAT_INTERNAL(x, y)
+
+#ifdef AXIS_ENABLE_PROFILER
+/// \brief Times the rest of the enclosing scope as the zone of the given name.
+///
+/// \code
+/// void SpriteBatch::Flush()
+/// {
+///     AXIS_PROFILE_SCOPE("SpriteBatch::Flush");
+///     ...
+/// }
+/// \endcode
+#    define AXIS_PROFILE_SCOPE(name) const ::Axis::System::ProfileZone AXIS_PROFILE_CONCAT(axisProfileZone, __LINE__)(name)
+
+/// \brief Marks the beginning of the new frame for the profiler.
+#    define AXIS_PROFILE_FRAME() ::Axis::System::Profiler::BeginFrame()
+
+/// \brief Names the calling thread in the exported traces.
+#    define AXIS_PROFILE_THREAD_NAME(name) ::Axis::System::Profiler::SetThreadName(name)
+#else
+/// \brief Times the rest of the enclosing scope as the zone of the given name.
+#    define AXIS_PROFILE_SCOPE(name) ((void)0)
+
+/// \brief Marks the beginning of the new frame for the profiler.
+#    define AXIS_PROFILE_FRAME() ((void)0)
+
+/// \brief Names the calling thread in the exported traces.
+#    define AXIS_PROFILE_THREAD_NAME(name) ((void)0)
+#endif
+
+#endif // AXIS_SYSTEM_PROFILER_HPP
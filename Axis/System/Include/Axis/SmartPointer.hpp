@@ -124,6 +124,11 @@ class UniquePointer final
     friend class UniquePointer;
 };
 
+/// \brief `UniquePointer` only holds the pointer and the deleter.
+template <SmartPointerType T, SmartPointerDeleterType<T> Deleter>
+struct IsTriviallyRelocatable<UniquePointer<T, Deleter>> : IsTriviallyRelocatable<Deleter>
+{};
+
 /// \brief A scope-based smart pointer; it will automatically delete the object when it goes out of scope.
 template <SmartPointerType T, SmartPointerDeleterType<T> Deleter = DefaultDeleter<T>>
 using Scope = UniquePointer<T, Deleter>;
@@ -141,6 +146,11 @@ class SharedPointer;
 template <SmartPointerType T>
 class WeakPointer;
 
+/// \brief Non-owning reference to the object managed by \a `SharedPointer`, it doesn't
+///        manipulate the reference count.
+template <SmartPointerType T>
+class SharedRef;
+
 namespace Detail
 {
 
@@ -280,6 +290,9 @@ class SharedPointer final
     template <SmartPointerType U>
     friend class WeakPointer;
 
+    template <SmartPointerType U>
+    friend class SharedRef;
+
     friend class ISharedFromThis;
 
     template <SmartPointerType U, AllocatorType Allocator, class... Args, typename>
@@ -410,6 +423,103 @@ class WeakPointer final
     friend class WeakPointer;
 };
 
+/// \brief Non-owning reference to the object managed by \a `SharedPointer`, it doesn't
+///        manipulate the reference count.
+///
+/// Copying and destroying the reference are plain pointer copies, use it for the function parameters
+/// and the temporary arrays of resources instead of copying \a `SharedPointer`. The reference doesn't
+/// keep the object alive, the \a `SharedPointer` which it was created from must outlive it.
+///
+/// The strong reference can be acquired by converting it back to \a `SharedPointer`.
+template <SmartPointerType T>
+class SharedRef final
+{
+public:
+    /// \brief Checks if the template parameter U's pointer can be converted to the template parameter T's pointer.
+    template <SmartPointerType U>
+    static constexpr Bool ConvertibleFrom = std::is_convertible_v<Pointer<U>, Pointer<T>>&& std::is_unbounded_array_v<T> == std::is_unbounded_array_v<U>;
+
+    /// \brief Smart pointer internal pointer type.
+    using PointerType = Pointer<T>;
+
+    /// \brief Constructs a null reference. Default constructor.
+    SharedRef() noexcept = default;
+
+    /// \brief Constructs a null reference.
+    SharedRef(NullptrType) noexcept;
+
+    /// \brief Borrows the object from \a `SharedPointer` without incrementing the reference count.
+    ///
+    /// \param[in] pointer \a `SharedPointer` to borrow from, must outlive the reference.
+    template <SmartPointerType U>
+    SharedRef(const SharedPointer<U>& pointer) noexcept requires(ConvertibleFrom<U>);
+
+    /// \brief Copy constructor and casts to the given type.
+    template <SmartPointerType U>
+    SharedRef(const SharedRef<U>& other) noexcept requires(ConvertibleFrom<U>);
+
+    /// \brief Dereferences the pointer
+    template <SmartPointerType U = T, typename = std::enable_if_t<!std::disjunction_v<std::is_array<U>, std::is_void<U>>, Int32>>
+    AXIS_NODISCARD std::add_lvalue_reference_t<std::remove_all_extents_t<T>> operator*() const noexcept;
+
+    /// \brief Arrow operator
+    template <SmartPointerType U = T, typename = std::enable_if_t<!std::disjunction_v<std::is_array<U>, std::is_void<U>>, Int32>>
+    AXIS_NODISCARD PointerType operator->() const noexcept;
+
+    /// \brief Checks if the reference is null.
+    AXIS_NODISCARD Bool operator==(NullptrType) const noexcept;
+
+    /// \brief Checks if the reference is not null.
+    AXIS_NODISCARD Bool operator!=(NullptrType) const noexcept;
+
+    /// \brief Implicit conversion to bool
+    AXIS_NODISCARD operator Bool() const noexcept;
+
+    /// \brief Gets the pointer.
+    AXIS_NODISCARD PointerType GetPointer() const noexcept;
+
+    /// \brief Equality operator
+    ///
+    /// \param[in] other The other reference to compare with
+    ///
+    /// \return True if the pointers are equal, false otherwise
+    AXIS_NODISCARD Bool operator==(const SharedRef<T>& other) const noexcept;
+
+    /// \brief Inequality operator
+    ///
+    /// \param[in] other The other reference to compare with
+    ///
+    /// \return True if the pointers are not equal, false otherwise
+    AXIS_NODISCARD Bool operator!=(const SharedRef<T>& other) const noexcept;
+
+    /// \brief Acquires the strong reference and casts to the given type.
+    ///
+    /// \return \a `SharedPointer` sharing the ownership with the pointer the reference was created from.
+    template <SmartPointerType U>
+    AXIS_NODISCARD explicit operator SharedPointer<U>() const noexcept requires(std::is_unbounded_array_v<T> == std::is_unbounded_array_v<U>);
+
+    /// \brief Explicit conversion to the raw pointer.
+    template <SmartPointerType U>
+    AXIS_NODISCARD explicit operator U*() const noexcept requires(!std::is_unbounded_array_v<T> && !std::is_unbounded_array_v<U>);
+
+private:
+    PointerType                _objectPointer    = nullptr; ///< Pointer to the object.
+    Detail::IReferenceCounter* _referenceCounter = nullptr; ///< Pointer to the reference counter.
+
+    template <SmartPointerType U>
+    friend class SharedRef;
+};
+
+/// \brief `SharedPointer` only holds the pointers to the object and the reference counter.
+template <SmartPointerType T>
+struct IsTriviallyRelocatable<SharedPointer<T>> : std::true_type
+{};
+
+/// \brief `WeakPointer` only holds the pointers to the object and the reference counter.
+template <SmartPointerType T>
+struct IsTriviallyRelocatable<WeakPointer<T>> : std::true_type
+{};
+
 /// \brief Constructs a new instance of shared pointer of the specific type.
 ///        this is the preferred way to create shared object as it's more efficient.
 template <SmartPointerType T, class... Args, typename = std::enable_if_t<!std::is_unbounded_array_v<T>, Int32>>
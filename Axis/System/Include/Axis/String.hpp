@@ -6,9 +6,12 @@
 #define AXIS_SYSTEM_STRING_HPP
 #pragma once
 
+#include "Hashing.hpp"
 #include "Math.hpp"
 #include "Memory.hpp"
 #include "Trait.hpp"
+#include "Unicode.hpp"
+#include <bit>
 #include <concepts>
 
 namespace Axis
@@ -17,26 +20,44 @@ namespace Axis
 namespace System
 {
 
-/// \brief Type of character with different size.
-template <class T>
-concept CharType = std::is_same_v<T, Char> ||(std::is_same_v<T, WChar> || std::is_same_v<T, char8_t> || std::is_same_v<T, char16_t> || std::is_same_v<T, char32_t>);
-
 /// \brief Container which contains a null terminated character sequence.
 ///
 /// \tparam T internal string data type.
+///
+/// The string takes three words (24 bytes on 64-bit platforms), the short strings are
+/// stored in place: up to 22 characters for \a `String8`, 10 for \a `StringU16` and 4
+/// for \a `WString` on the platforms where \a `WChar` is 4 bytes.
+///
+/// Constructing or appending the characters of different size transcodes them between
+/// UTF-8, UTF-16 and UTF-32 (see \a `Unicode::Transcode`).
+///
+/// The allocator instance is stored in the string (taking no space for the stateless allocators),
+/// it's propagated on copy / move construction and move assignment but not on copy assignment.
 template <CharType T, AllocatorType Allocator = DefaultAllocator>
-class String final
+class String final : private Detail::AllocatorStorage<Allocator>
 {
+private:
+    /// Size of the storage in bytes, the last byte tells whether the string is stored in place.
+    static constexpr Size StorageSize = sizeof(T*) + sizeof(Size) * 2;
+
 public:
     /// \brief Number of elements in the string that would apply
     ///        the small string optimization.
-    static constexpr Size SmallStringSize = (Size)((sizeof(T*) + sizeof(Size)) / sizeof(T)) - 1;
+    ///
+    /// The last element of the storage holds the length of the small string, the one
+    /// before it holds the null terminator.
+    static constexpr Size SmallStringSize = StorageSize / sizeof(T) - 2;
 
     /// \brief Constructs an empty string.
     String(NullptrType) noexcept;
 
     /// \brief Default constructor, constructs an empty string.
-    String() noexcept = default;
+    String() noexcept(std::is_nothrow_default_constructible_v<Allocator>) = default;
+
+    /// \brief Constructs an empty string with the specified allocator.
+    ///
+    /// \param[in] allocator Allocator instance used by the string.
+    explicit String(const Allocator& allocator) noexcept;
 
     /// \brief Constructs a string from null terminated character sequence.
     ///
@@ -44,6 +65,14 @@ class String final
     template <CharType U>
     String(const U* str);
 
+    /// \brief Constructs a string from null terminated character sequence with the specified allocator.
+    ///
+    /// \param[in] str null terminated character sequence.
+    /// \param[in] allocator Allocator instance used by the string.
+    template <CharType U>
+    String(const U*         str,
+           const Allocator& allocator);
+
     /// \brief Constructs a string from the specified character range.
     ///
     /// \param[in] begin The beginning of the character range.
@@ -81,6 +110,9 @@ class String final
     /// \param[in] other instance to move
     String& operator=(String&& other) noexcept;
 
+    /// \brief Gets the allocator instance used by the string.
+    AXIS_NODISCARD const Allocator& GetAllocator() const noexcept;
+
     /// \brief Gets pointer to the internal string buffer.
     ///
     /// \return pointer to the internal string buffer.
@@ -215,27 +247,64 @@ class String final
     AXIS_NODISCARD static String<T, Allocator> ToString(const U& value);
 
 private:
-    template <Bool Move = true>
-    T* Reserve(Size size);
+    /// Highest bit of the capacity, marks the string allocated from the allocator. It's stored in
+    /// the last byte of the storage, where the small string keeps its length.
+    static constexpr Size DynamicStringFlag = Size(1) << (sizeof(Size) * 8 - 1);
+
+    /// Mask of the small string's length in the last byte of the storage.
+    static constexpr Uint8 SmallStringLengthMask = 0x7F;
+
+    template <Bool Keep = true>
+    T* Reserve(Size size); // Grows the buffer to hold `size` characters, discards them unless `Keep`.
+
+    T* MakeRoom(Size index,
+                Size count); // Opens the gap of `count` characters at `index` and updates the length.
+
+    template <CharType U>
+    void Assign(const U* string,
+                Size     length); // Replaces the characters, transcodes them if needed.
+
+    Bool IsSmallString() const noexcept;        // Whether the characters are stored in place.
+    T*   GetBuffer() noexcept;                  // Gets the buffer, even if the string is empty.
+    Size GetCapacity() const noexcept;          // Gets the number of characters fitting the buffer.
+    void SetLength(Size length) noexcept;       // Sets the length and writes the null terminator.
+    void ResetToSmallString() noexcept;         // Makes the string empty, the buffer must be freed.
 
     union
     {
         struct
         {
             T*   DynamicStringBuffer;        // Dynamic buffer allocation for the string.
-            Size DynamicMemoryAllocatedSize; // Size of dynamic allocated memory (per character! not bytes!), included null terminated character.
+            Size DynamicStringLength;        // Number of characters, not included null terminated character.
+            Size DynamicMemoryAllocatedSize; // Capacity in characters not including the null terminator, combined with `DynamicStringFlag`.
         };
 
-        T SmallStringBuffer[SmallStringSize + 1]; // Stack allocated buffer memory.
+        T     SmallStringBuffer[SmallStringSize + 2]; // Stack allocated buffer memory, the last element holds the length.
+        Uint8 StorageBytes[StorageSize] = {};         // Bytes of the storage, the last one tells whether the string is small.
     };
 
-    Size _stringLength  = 0;    // Caches the string length to this variable. not included null terminated character.
-    Bool _isSmallString = true; // Indicates whether the current string is using small string optimization.
+    // The flag is the highest bit of the capacity, which is in the last byte only in little endian.
+    static_assert(std::endian::native == std::endian::little);
 
     template <CharType, AllocatorType>
     friend class String;
 };
 
+/// \brief `String` doesn't point into its own small string buffer, it checks the last byte of the storage instead.
+template <CharType T, AllocatorType Allocator>
+struct IsTriviallyRelocatable<String<T, Allocator>> : IsTriviallyRelocatable<Allocator>
+{};
+
+/// \brief String hash, calculated from the characters excluding the null terminator.
+///
+/// Equals to the hash of the \a `StringView` viewing the same characters.
+template <CharType T, AllocatorType Allocator>
+struct Hash<String<T, Allocator>> final
+{
+    /// \brief Calculates hash for the string.
+    AXIS_NODISCARD Size operator()(const String<T, Allocator>& string) const noexcept { return (Size)Hashing::HashBytes(string.GetCString(), string.GetLength() * sizeof(T)); }
+};
+
 /// \brief Data structure which contains null terminated `Axis::Char` sequence.
 using String8 = String<Char, DefaultAllocator>;
 
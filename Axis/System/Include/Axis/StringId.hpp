@@ -0,0 +1,168 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#ifndef AXIS_SYSTEM_STRINGID_HPP
+#define AXIS_SYSTEM_STRINGID_HPP
+#pragma once
+
+#include "Hashing.hpp"
+#include "StringView.hpp"
+
+namespace Axis
+{
+
+namespace System
+{
+
+namespace Detail
+{
+
+/// Calculates the id of the string: FNV-1a over the code units followed by a finalizer.
+/// Every code unit is hashed as a whole, the id doesn't depend on the byte order.
+template <CharType T>
+constexpr Uint32 HashStringId(const T* string,
+                              Size     length) noexcept;
+
+/// Global interning tables of the strings, one per code unit size.
+struct AXIS_SYSTEM_API StringIdTable
+{
+    /// Copies the string into the table if it's not there yet, returns false if another string has the same id.
+    AXIS_NODISCARD static Bool Intern(const void* string,
+                                      Size        length,
+                                      Size        codeUnitSize,
+                                      Uint32      id);
+
+    /// Gets the interned string with the given id without locking, returns nullptr if there's none.
+    AXIS_NODISCARD static const void* Find(Uint32 id,
+                                           Size   codeUnitSize,
+                                           Size&  length) noexcept;
+
+    /// Gets the number of the strings interned in the table.
+    AXIS_NODISCARD static Size GetCount(Size codeUnitSize) noexcept;
+};
+
+} // namespace Detail
+
+/// \brief 32 bits handle of the interned string, compared and hashed in O(1).
+///
+/// The id is the hash of the characters, so it's the same in every run and can be
+/// calculated at compile time by \a `FromLiteral`. Constructing the id from the string
+/// interns it: the characters are copied into the global append-only table, which is
+/// looked up without locking, and can be retrieved back by \a `GetString` until the
+/// program exits.
+///
+/// The empty string has the id 0, which is also the id of the default constructed object.
+///
+/// The id isn't resolved when two different strings hash to the same value, so the ids computed
+/// at compile time stay valid; the odds are about 1% among 10,000 distinct strings. The constructor
+/// throws on such a collision, \a `TryIntern` reports it instead.
+///
+/// \tparam T Character type of the interned strings, each one has its own table.
+template <CharType T>
+class BasicStringId
+{
+public:
+    /// \brief Default constructor, the id of the empty string.
+    constexpr BasicStringId() noexcept = default;
+
+    /// \brief Interns the string and constructs its id.
+    ///
+    /// Thread-safe, only takes the lock the first time the string is interned.
+    ///
+    /// \param[in] string String to intern.
+    ///
+    /// \throws InvalidArgumentException if a different interned string has the same id.
+    explicit BasicStringId(const StringView<T>& string);
+
+    /// \brief Interns the string, reports the collision instead of throwing.
+    ///
+    /// \param[in] string String to intern.
+    /// \param[out] id Id of the interned string, left untouched if the string collides.
+    ///
+    /// \return False if a different interned string has the same id, the string isn't interned then.
+    AXIS_NODISCARD static Bool TryIntern(const StringView<T>& string,
+                                         BasicStringId&       id);
+
+    /// \brief Calculates the id of the string literal without interning it.
+    ///
+    /// The id is equal to the one of the interned string, but \a `GetString` doesn't
+    /// retrieve the characters until the string has been interned.
+    ///
+    /// \param[in] literal Null terminated string literal to calculate the id.
+    template <Size N>
+    AXIS_NODISCARD static constexpr BasicStringId FromLiteral(const T (&literal)[N]) noexcept;
+
+    /// \brief Calculates the id of the string without interning it.
+    ///
+    /// \param[in] string Pointer to the first character.
+    /// \param[in] length Number of characters.
+    AXIS_NODISCARD static constexpr BasicStringId Calculate(const T* string,
+                                                           Size     length) noexcept;
+
+    /// \brief Gets the number of the interned strings of this character type.
+    AXIS_NODISCARD static Size GetInternedCount() noexcept;
+
+    /// \brief Gets the numeric value of the id.
+    AXIS_NODISCARD constexpr Uint32 GetValue() const noexcept;
+
+    /// \brief Checks whether the id is the one of the empty string.
+    AXIS_NODISCARD constexpr Bool IsEmpty() const noexcept;
+
+    /// \brief Checks whether the string of this id has been interned.
+    AXIS_NODISCARD Bool IsInterned() const noexcept;
+
+    /// \brief Gets the interned string, its characters are followed by the null terminator and
+    ///        stay valid until the program exits.
+    ///
+    /// \return The interned string, null view if the string hasn't been interned.
+    AXIS_NODISCARD StringView<T> GetString() const noexcept;
+
+    /// \brief Checks whether the ids are equal.
+    ///
+    /// Equal ids imply equal strings only when both were interned, by the constructor or
+    /// \a `TryIntern`; the ids of \a `FromLiteral` and \a `Calculate` aren't checked against the
+    /// table and may equal the id of a different string with the same hash.
+    AXIS_NODISCARD constexpr Bool operator==(const BasicStringId& other) const noexcept = default;
+
+private:
+    /// \brief Constructs the object with the given id.
+    constexpr explicit BasicStringId(Uint32 value) noexcept;
+
+    Uint32 _value = 0; ///< Hash of the string, 0 for the empty one.
+};
+
+/// \brief Id of the interned \a `String8`.
+using StringId = BasicStringId<Char>;
+
+/// \brief Id of the interned \a `WString`.
+using WStringId = BasicStringId<WChar>;
+
+/// \brief String id hash, the id is already the hash of the string.
+template <CharType T>
+struct Hash<BasicStringId<T>> final
+{
+    /// \brief Calculates hash for the string id.
+    AXIS_NODISCARD Size operator()(const BasicStringId<T>& stringId) const noexcept { return (Size)Hashing::Mix(stringId.GetValue()); }
+};
+
+namespace Literals
+{
+
+/// \brief Calculates the id of the string literal at compile time, e.g. `"Diffuse"_sid`.
+AXIS_NODISCARD constexpr StringId operator""_sid(const Char* string,
+                                                 std::size_t length) noexcept;
+
+/// \brief Calculates the id of the wide string literal at compile time, e.g. `L"Diffuse"_sid`.
+AXIS_NODISCARD constexpr WStringId operator""_sid(const WChar* string,
+                                                  std::size_t  length) noexcept;
+
+} // namespace Literals
+
+} // namespace System
+
+} // namespace Axis
+
+#include "../../Private/Axis/StringIdImpl.inl"
+
+#endif // AXIS_SYSTEM_STRINGID_HPP
@@ -89,6 +89,16 @@ struct StringView
     Bool         _nullTerminatedView = false;   // Indicates whether the viewed string was taken from null terminated string sequence
 };
 
+/// \brief String view hash, calculated from the viewed characters.
+///
+/// Equals to the hash of the \a `String` containing the same characters.
+template <CharType T>
+struct Hash<StringView<T>> final
+{
+    /// \brief Calculates hash for the string view.
+    AXIS_NODISCARD Size operator()(const StringView<T>& stringView) const noexcept { return (Size)Hashing::HashBytes(stringView.GetCString(), stringView.GetLength() * sizeof(T)); }
+};
+
 } // namespace System
 
 } // namespace Axis
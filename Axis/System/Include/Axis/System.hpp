@@ -20,6 +20,15 @@ namespace System
 /// \param[in] period Period of time to sleep / block the time.
 void AXIS_SYSTEM_API Sleep(const TimePeriod& period) noexcept;
 
+/// \brief Blocks the current thread until the given \a `Timer::GetTimestamp` time.
+///
+/// \a `Sleep` may oversleep by the scheduler's granularity, so this function only sleeps until
+/// shortly before the deadline and yields the thread in a loop for the rest. Never returns before
+/// the deadline.
+///
+/// \param[in] deadline Timestamp to wake up at, returns immediately if it has already passed.
+void AXIS_SYSTEM_API PreciseSleepUntil(const TimePeriod& deadline) noexcept;
+
 /// \brief Creates new console window if haven't one yet.
 ///
 /// \return true if the new console is created, false if failed to create console
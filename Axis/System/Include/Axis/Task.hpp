@@ -0,0 +1,302 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#ifndef AXIS_SYSTEM_TASK_HPP
+#define AXIS_SYSTEM_TASK_HPP
+#pragma once
+
+#include "Config.hpp"
+#include "Function.hpp"
+#include "JobSystem.hpp"
+#include "List.hpp"
+#include "Nullable.hpp"
+#include "SystemExport.hpp"
+#include <coroutine>
+#include <exception>
+#include <mutex>
+
+namespace Axis
+{
+
+namespace System
+{
+
+template <class T = void>
+class Task;
+
+namespace Detail
+{
+
+/// Transfers to the awaiting coroutine once the task finishes.
+struct TaskFinalAwaiter
+{
+    AXIS_NODISCARD constexpr Bool await_ready() const noexcept { return false; }
+
+    template <class Promise>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept;
+
+    constexpr void await_resume() const noexcept {}
+};
+
+template <class T>
+class TaskPromise;
+
+/// Starts the awaited task, the awaiting coroutine resumes once the task finishes.
+template <class T>
+struct TaskAwaiter
+{
+    std::coroutine_handle<TaskPromise<T>> Handle = {}; ///< Awaited task.
+
+    AXIS_NODISCARD Bool await_ready() const noexcept { return Handle.done(); }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept;
+
+    T await_resume();
+};
+
+/// Parts of the task promise shared by all the result types.
+class TaskPromiseBase
+{
+public:
+    /// Tasks are lazy, they start when they are awaited or spawned.
+    AXIS_NODISCARD constexpr std::suspend_always initial_suspend() const noexcept { return {}; }
+
+    AXIS_NODISCARD constexpr TaskFinalAwaiter final_suspend() const noexcept { return {}; }
+
+    void unhandled_exception() noexcept { Exception = std::current_exception(); }
+
+    /// The coroutine frames come from the \a `PoolAllocator`, they are small and often freed on a
+    /// different thread than the one which allocated them.
+    AXIS_NODISCARD static PVoid operator new(Size size);
+
+    static void operator delete(PVoid pointer) noexcept;
+
+    std::coroutine_handle<> Continuation = {}; ///< Coroutine awaiting the task, resumed once it finishes.
+    std::exception_ptr      Exception    = {}; ///< Exception thrown out of the task body.
+};
+
+/// Promise of the tasks producing a value.
+template <class T>
+class TaskPromise final : public TaskPromiseBase
+{
+public:
+    AXIS_NODISCARD Task<T> get_return_object() noexcept;
+
+    template <class U>
+    void return_value(U&& value) requires(std::is_constructible_v<T, U&&>);
+
+    /// Moves the result out, or rethrows the exception of the task.
+    AXIS_NODISCARD T TakeResult();
+
+private:
+    Nullable<T> _result = nullptr; ///< Value returned by the task body.
+};
+
+/// Promise of the tasks producing no value.
+template <>
+class TaskPromise<void> final : public TaskPromiseBase
+{
+public:
+    AXIS_NODISCARD Task<void> get_return_object() noexcept;
+
+    constexpr void return_void() const noexcept {}
+
+    /// Rethrows the exception of the task, if any.
+    void TakeResult();
+};
+
+} // namespace Detail
+
+/// \brief Lazily started coroutine producing the value of type \a `T`.
+///
+/// The task starts when it's awaited (`co_await`) or spawned with \a `TaskScheduler::Spawn`.
+/// Awaiting a task suspends the awaiting coroutine until the task finishes, then resumes it with
+/// the returned value, or rethrows the exception thrown out of the task body.
+///
+/// The task owns the coroutine frame; destroying an unfinished task destroys the suspended
+/// coroutine, which mustn't be waiting for a job or a fence at the time.
+template <class T>
+class Task final
+{
+public:
+    using promise_type = Detail::TaskPromise<T>;
+
+    /// \brief Constructs the empty task.
+    Task() noexcept = default;
+
+    /// \brief Destroys the coroutine frame.
+    ~Task() noexcept;
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    /// \brief Move constructor, the other task becomes empty.
+    Task(Task&& other) noexcept;
+
+    /// \brief Move assignment, the other task becomes empty.
+    Task& operator=(Task&& other) noexcept;
+
+    /// \brief Checks whether the task refers to a coroutine.
+    AXIS_NODISCARD inline Bool IsValid() const noexcept { return (Bool)_handle; }
+
+    /// \brief Checks whether the coroutine has run to the end.
+    AXIS_NODISCARD inline Bool IsDone() const noexcept { return _handle && _handle.done(); }
+
+    /// \brief Moves the result out of the finished task, or rethrows its exception.
+    T TakeResult();
+
+    /// \brief Awaits the task, starts it and resumes the awaiting coroutine once it finishes.
+    AXIS_NODISCARD Detail::TaskAwaiter<T> operator co_await() && noexcept;
+
+private:
+    explicit Task(std::coroutine_handle<promise_type> handle) noexcept :
+        _handle(handle) {}
+
+    std::coroutine_handle<promise_type> _handle = {}; ///< Owned coroutine frame.
+
+    friend promise_type;
+    friend class TaskScheduler;
+};
+
+/// \brief Resumes the coroutines waiting for the next frame, the jobs, and the conditions, once per
+///        frame on the thread calling \a `RunFrame` (the main thread of the \a `Application`).
+///
+/// Lets the loading code be written sequentially: it awaits the work on the worker threads, the
+/// GPU fences and the next frames, and always continues on the frame thread.
+///
+/// Except for \a `Post`, the scheduler must only be used from the frame thread.
+class AXIS_SYSTEM_API TaskScheduler final
+{
+public:
+    /// \brief Awaiter suspending the coroutine until the next \a `RunFrame` call.
+    struct FrameAwaiter
+    {
+        TaskScheduler* Scheduler = nullptr; ///< Scheduler to resume the coroutine.
+
+        AXIS_NODISCARD constexpr Bool await_ready() const noexcept { return false; }
+
+        void await_suspend(std::coroutine_handle<> handle) { Scheduler->_nextFrame.Append(handle); }
+
+        constexpr void await_resume() const noexcept {}
+    };
+
+    /// \brief Awaiter suspending the coroutine until the condition holds, checked once per frame.
+    struct ConditionAwaiter
+    {
+        TaskScheduler*         Scheduler = nullptr; ///< Scheduler checking the condition.
+        UniqueFunction<Bool()> Condition = {};      ///< Condition to wait for.
+
+        AXIS_NODISCARD Bool await_ready() { return Condition(); }
+
+        void await_suspend(std::coroutine_handle<> handle);
+
+        constexpr void await_resume() const noexcept {}
+    };
+
+    /// \brief Awaiter running the function on a worker of the job system, the coroutine resumes on
+    ///        the frame thread with the returned value.
+    template <class Callable>
+    class JobAwaiter
+    {
+    public:
+        using ResultType = std::invoke_result_t<Callable&>;
+
+        JobAwaiter(TaskScheduler& scheduler,
+                   JobSystem&     jobSystem,
+                   Callable       function) :
+            _scheduler(scheduler),
+            _jobSystem(jobSystem),
+            _function(std::move(function)) {}
+
+        AXIS_NODISCARD constexpr Bool await_ready() const noexcept { return false; }
+
+        void await_suspend(std::coroutine_handle<> handle);
+
+        ResultType await_resume();
+
+    private:
+        using StoredType = std::conditional_t<std::is_void_v<ResultType>, Bool, ResultType>;
+
+        TaskScheduler&       _scheduler;           ///< Scheduler to post the coroutine back to.
+        JobSystem&           _jobSystem;           ///< Job system running the function.
+        Callable             _function;            ///< Function to run.
+        Nullable<StoredType> _result    = nullptr; ///< Value returned by the function.
+        std::exception_ptr   _exception = {};      ///< Exception thrown out of the function.
+    };
+
+    /// \brief Constructs the scheduler with no coroutines.
+    TaskScheduler() noexcept = default;
+
+    /// \brief Destroys the unfinished spawned tasks.
+    ~TaskScheduler() noexcept = default;
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    /// \brief Starts the task and keeps it alive until it finishes. The task runs on the calling
+    ///        thread until its first suspension.
+    ///
+    /// \param[in] task Task to start.
+    void Spawn(Task<void> task);
+
+    /// \brief Resumes the coroutines posted from the other threads, the coroutines whose conditions
+    ///        hold, and the coroutines waiting for this frame, then releases the finished spawned
+    ///        tasks.
+    ///
+    /// \throws The exception thrown out of a spawned task, once the task has finished.
+    /// \throws The exception thrown by a condition, the waiters stay queued and the coroutines
+    ///         already due are resumed on the next call.
+    void RunFrame();
+
+    /// \brief Queues the coroutine to resume on the next \a `RunFrame` call, can be called from any
+    ///        thread.
+    ///
+    /// \param[in] handle Suspended coroutine to resume.
+    void Post(std::coroutine_handle<> handle);
+
+    /// \brief Gets the number of the spawned tasks which haven't finished.
+    AXIS_NODISCARD inline Size GetPendingTaskCount() const noexcept { return _spawnedTasks.GetLength(); }
+
+    /// \brief Awaits the next frame.
+    AXIS_NODISCARD inline FrameAwaiter NextFrame() noexcept { return {this}; }
+
+    /// \brief Awaits the condition, checked right away and then once per frame.
+    ///
+    /// \param[in] condition Condition to wait for, `Bool()`.
+    AXIS_NODISCARD ConditionAwaiter WaitUntil(UniqueFunction<Bool()> condition) noexcept;
+
+    /// \brief Awaits the function running on a worker of the job system (the CPU-heavy or
+    ///        the blocking work, e.g. the file reads and the image decoding).
+    ///
+    /// \param[in] jobSystem Job system to run the function on.
+    /// \param[in] function Function to run, its result becomes the result of the `co_await`.
+    template <class Callable>
+    AXIS_NODISCARD JobAwaiter<std::decay_t<Callable>> Run(JobSystem& jobSystem,
+                                                          Callable&& function);
+
+private:
+    /// Condition and the coroutine waiting for it.
+    struct ConditionWaiter
+    {
+        UniqueFunction<Bool()>  Condition = {}; // Condition to wait for
+        std::coroutine_handle<> Handle    = {}; // Coroutine to resume once the condition holds
+    };
+
+    List<Task<void>>              _spawnedTasks = {}; ///< Spawned tasks, released once they finish.
+    List<std::coroutine_handle<>> _nextFrame    = {}; ///< Coroutines waiting for the next frame.
+    List<ConditionWaiter>         _conditions   = {}; ///< Coroutines waiting for the conditions.
+    std::mutex                    _postedMutex  = {}; ///< Guards `_posted`.
+    List<std::coroutine_handle<>> _posted       = {}; ///< Coroutines posted from the other threads.
+
+    List<std::coroutine_handle<>> _resuming           = {}; ///< Coroutines being resumed by `RunFrame`, reused every frame.
+    List<ConditionWaiter>         _checkingConditions = {}; ///< Conditions being checked by `RunFrame`, reused every frame.
+};
+
+} // namespace System
+
+} // namespace Axis
+
+#include "../../Private/Axis/TaskImpl.inl"
+
+#endif // AXIS_SYSTEM_TASK_HPP
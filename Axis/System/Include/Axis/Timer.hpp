@@ -12,4 +12,9 @@
 #    include "Platform/Win32/Win32Timer.hpp"
 #endif
 
+// Timer class for posix platforms
+#if defined(AXIS_PLATFORM_UNIX) || defined(AXIS_PLATFORM_MACOS)
+#    include "Platform/Posix/PosixTimer.hpp"
+#endif
+
 #endif // AXIS_SYSTEM_TIMER_HPP
\ No newline at end of file
@@ -0,0 +1,222 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#ifndef AXIS_SYSTEM_TRACKINGALLOCATOR_HPP
+#define AXIS_SYSTEM_TRACKINGALLOCATOR_HPP
+#pragma once
+
+#include "List.hpp"
+#include "Memory.hpp"
+#include "String.hpp"
+
+#ifdef _MSC_VER
+#    include <intrin.h>
+/// \brief Retrieves the return address of the current function.
+#    define AXIS_RETURN_ADDRESS() _ReturnAddress()
+#else
+/// \brief Retrieves the return address of the current function.
+#    define AXIS_RETURN_ADDRESS() __builtin_return_address(0)
+#endif
+
+namespace Axis
+{
+
+namespace System
+{
+
+/// \brief Concept for checking if a type can be used as an allocation tag in
+///        \a `TrackingAllocator`.
+///
+/// The type should have a public static `Name` which names the subsystem
+/// the allocations are attributed to.
+template <class T>
+concept AllocationTagType = requires
+{
+    {
+        T::Name
+        } -> std::convertible_to<const char*>;
+};
+
+/// \brief Counters of a single allocation tag, owned by \a `AllocationTracker`.
+struct AllocationCounter;
+
+/// \brief Snapshot of the allocations made from a single call site.
+struct AllocationCallSiteStatistics
+{
+    PVoid Address             = nullptr; ///< Return address of the function which allocated
+    Size  LiveBytes           = 0;       ///< Bytes allocated but not yet deallocated
+    Size  LiveAllocationCount = 0;       ///< Number of allocations not yet deallocated
+    Size  AllocationCount     = 0;       ///< Total number of allocations
+};
+
+/// \brief Snapshot of the counters of a single allocation tag.
+struct AllocationStatistics
+{
+    const char* Tag                      = nullptr; ///< Name of the tag
+    Size        LiveBytes                = 0;       ///< Bytes allocated but not yet deallocated
+    Size        PeakBytes                = 0;       ///< Highest value of `LiveBytes` since the last \a `AllocationTracker::ResetPeaks`
+    Size        LiveAllocationCount      = 0;       ///< Number of allocations not yet deallocated
+    Size        AllocationCount          = 0;       ///< Total number of allocations
+    Size        LastFrameAllocationCount = 0;       ///< Number of allocations made during the previous frame
+
+    /// \brief Call sites of the allocations, only filled when the call site
+    ///        capture is enabled.
+    List<AllocationCallSiteStatistics> CallSites = {};
+};
+
+/// \brief Global registry of the allocation counters, updated by
+///        \a `TrackingAllocator`.
+///
+/// All the functions are thread-safe. The counters are updated with relaxed
+/// atomics, so the snapshots taken while other threads allocate aren't
+/// guaranteed to be consistent between each other.
+struct AXIS_SYSTEM_API AllocationTracker
+{
+    /// \brief Maximum number of the distinct tags.
+    static constexpr Size MaxTagCount = 256;
+
+    /// \brief Gets the counters of the given tag, creates them if they don't
+    ///        exist yet.
+    ///
+    /// \param[in] tag Name of the tag, must have static storage duration.
+    ///
+    /// \return Counters of the tag, valid for the rest of the program.
+    AXIS_NODISCARD static AllocationCounter* RegisterTag(const char* tag);
+
+    /// \brief Records the allocation to the tag's counters.
+    ///
+    /// \param[in] counter Counters of the tag.
+    /// \param[in] size Size of the allocation in bytes.
+    /// \param[in] callSite Return address of the allocating function.
+    ///
+    /// \return The call site which was recorded (nullptr if the call site capture
+    ///         is disabled), must be passed to the matching \a `RecordDeallocation`.
+    static PVoid RecordAllocation(AllocationCounter* counter,
+                                  Size               size,
+                                  PVoid              callSite) noexcept;
+
+    /// \brief Records the deallocation to the tag's counters.
+    ///
+    /// \param[in] counter Counters of the tag.
+    /// \param[in] size Size of the allocation in bytes.
+    /// \param[in] callSite Call site returned by \a `RecordAllocation`.
+    static void RecordDeallocation(AllocationCounter* counter,
+                                   Size               size,
+                                   PVoid              callSite) noexcept;
+
+    /// \brief Enables or disables capturing the call sites of the allocations.
+    ///
+    /// Capturing takes a lock on every allocation, so it's disabled by default.
+    static void SetCallSiteCaptureEnabled(Bool enabled) noexcept;
+
+    /// \brief Checks whether the call sites of the allocations are captured.
+    AXIS_NODISCARD static Bool IsCallSiteCaptureEnabled() noexcept;
+
+    /// \brief Moves the per-frame counters to the next frame.
+    ///
+    /// \a `Axis::Core::Application` calls it at the beginning of every tick.
+    static void BeginFrame() noexcept;
+
+    /// \brief Sets the peak bytes of every tag to its current live bytes.
+    static void ResetPeaks() noexcept;
+
+    /// \brief Takes a snapshot of the counters of every registered tag.
+    AXIS_NODISCARD static List<AllocationStatistics> GetStatistics();
+
+    /// \brief Takes a snapshot of the counters of the given tag.
+    ///
+    /// \param[in] tag Name of the tag.
+    ///
+    /// \return Snapshot of the counters, all zeroes if the tag wasn't registered.
+    AXIS_NODISCARD static AllocationStatistics GetStatistics(const char* tag);
+
+    /// \brief Dumps the snapshot of the counters of every registered tag as
+    ///        JSON document.
+    AXIS_NODISCARD static String8 DumpToJson();
+};
+
+/// \brief Allocator class which satisfies the concept `AllocatorType`.
+///        Forwards the requests to the `Inner` allocator and records them
+///        to the \a `AllocationTracker` counters of the tag `Tag`.
+///
+/// Every allocation is prefixed with a small header which keeps its size, so
+/// the live bytes can be updated on the deallocation.
+///
+/// \code
+/// struct SpriteBatchAllocationTag
+/// {
+///     static constexpr const char* Name = "SpriteBatch";
+/// };
+///
+/// List<Vertex, TrackingAllocator<DefaultAllocator, SpriteBatchAllocationTag>> vertices;
+/// \endcode
+template <AllocatorType Inner, AllocationTagType Tag>
+class TrackingAllocator : private Detail::AllocatorStorage<Inner>
+{
+public:
+    /// \brief Default constructor, default constructs the inner allocator.
+    TrackingAllocator() noexcept(std::is_nothrow_default_constructible_v<Inner>) = default;
+
+    /// \brief Constructs the allocator with the given inner allocator instance.
+    ///
+    /// \param[in] inner Allocator to forward the requests to.
+    explicit TrackingAllocator(const Inner& inner) noexcept;
+
+    /// \brief Allocates memory with the given size and alignment
+    ///
+    /// \param[in] size The size of the memory to allocate
+    /// \param[in] alignment The alignment of the memory to allocate
+    AXIS_NODISCARD PVoid Allocate(Size size, Size alignment);
+
+    /// \brief Deallocates the given memory pointer
+    ///
+    /// \param[in] ptr The pointer to deallocate
+    void Deallocate(PVoid ptr) noexcept;
+
+    /// \brief Resizes the given memory block, available if the `Inner`
+    ///        allocator satisfies `ReallocatableAllocatorType`.
+    ///
+    /// \param[in] ptr The pointer to resize, can be nullptr
+    /// \param[in] oldSize The size the pointer was allocated with
+    /// \param[in] newSize The new size of the memory
+    /// \param[in] alignment The alignment the pointer was allocated with
+    AXIS_NODISCARD PVoid Reallocate(PVoid ptr, Size oldSize, Size newSize, Size alignment) requires(ReallocatableAllocatorType<Inner>);
+
+    /// \brief Gets the inner allocator instance.
+    AXIS_NODISCARD const Inner& GetInnerAllocator() const noexcept;
+
+    /// \brief Gets the counters of the tag `Tag`.
+    AXIS_NODISCARD static AllocationCounter* GetCounter();
+
+private:
+    /// Header placed right before every allocated block.
+    struct Header
+    {
+        PVoid OriginalPointer = nullptr; // Pointer returned by the inner allocator
+        Size  AllocationSize  = 0;       // Size requested by the user
+        PVoid CallSite        = nullptr; // Call site recorded by the tracker
+    };
+};
+
+#ifdef AXIS_ENABLE_ALLOCATION_TRACKING
+/// \brief Allocator used by the engine's subsystems, tracked by
+///        \a `TrackingAllocator` when `AXIS_ENABLE_ALLOCATION_TRACKING`
+///        is defined or plain `Inner` otherwise.
+template <AllocationTagType Tag, AllocatorType Inner = DefaultAllocator>
+using TaggedAllocator = TrackingAllocator<Inner, Tag>;
+#else
+/// \brief Allocator used by the engine's subsystems, tracked by
+///        \a `TrackingAllocator` when `AXIS_ENABLE_ALLOCATION_TRACKING`
+///        is defined or plain `Inner` otherwise.
+template <AllocationTagType Tag, AllocatorType Inner = DefaultAllocator>
+using TaggedAllocator = Inner;
+#endif
+
+} // namespace System
+
+} // namespace Axis
+
+#include "../../Private/Axis/TrackingAllocatorImpl.inl"
+
+#endif // AXIS_SYSTEM_TRACKINGALLOCATOR_HPP
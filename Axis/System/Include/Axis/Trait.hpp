@@ -41,10 +41,34 @@ concept Callable = requires(T t, Args&&... args)
 }
 &&RawType<T>&& std::is_nothrow_move_constructible_v<T>&& std::is_nothrow_copy_constructible_v<T>;
 
+/// \brief Concept for checking if a type is a callable object which is only required to be movable.
+template <class T, class ReturnType, class... Args>
+concept MovableCallable = requires(T t, Args&&... args)
+{
+    {
+        t(std::forward<Args>(args)...)
+        } -> SameAs<ReturnType>;
+}
+&&RawType<T>&& std::is_move_constructible_v<T>;
+
 /// \brief Checks if a type is POD (Plain Old Data).
 template <class T>
 concept PodType = std::is_standard_layout_v<T> && std::is_trivial_v<T>;
 
+/// \brief Specifies whether an object of the type can be moved to another address
+///        by copying its bytes and forgetting the old object (without invoking the
+///        move constructor and the destructor).
+///
+/// True for the trivially copyable types; specialize it for the types which don't
+/// keep any pointer to themselves (e.g. the containers and the smart pointers).
+template <class T>
+struct IsTriviallyRelocatable : std::bool_constant<std::is_trivially_copyable_v<T>>
+{};
+
+/// \brief Checks if a type is trivially relocatable, see \a `IsTriviallyRelocatable`.
+template <class T>
+concept TriviallyRelocatable = IsTriviallyRelocatable<std::remove_cv_t<T>>::value;
+
 } // namespace System
 
 } // namespace Axis
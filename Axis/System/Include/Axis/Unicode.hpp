@@ -0,0 +1,99 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#ifndef AXIS_SYSTEM_UNICODE_HPP
+#define AXIS_SYSTEM_UNICODE_HPP
+#pragma once
+
+#include "Config.hpp"
+#include "Trait.hpp"
+#include <type_traits>
+
+namespace Axis
+{
+
+namespace System
+{
+
+/// \brief Type of character with different size.
+///
+/// The encoding of the characters is given by their size: the 1 byte characters
+/// are UTF-8, the 2 bytes ones UTF-16 and the 4 bytes ones UTF-32. \a `WChar` is
+/// UTF-16 on Windows and UTF-32 on the other platforms.
+template <class T>
+concept CharType = std::is_same_v<T, Char> ||(std::is_same_v<T, WChar> || std::is_same_v<T, char8_t> || std::is_same_v<T, char16_t> || std::is_same_v<T, char32_t>);
+
+namespace Unicode
+{
+    /// \brief Code point substituted for the invalid sequences.
+    constexpr char32_t ReplacementCharacter = 0xFFFD;
+
+    /// \brief Largest valid code point.
+    constexpr char32_t MaxCodePoint = 0x10FFFF;
+
+    /// \brief Decodes the code point at the beginning of the string and advances past it.
+    ///
+    /// The invalid sequences (the truncated, overlong and surrogate UTF-8 sequences, the
+    /// unpaired UTF-16 surrogates and the UTF-32 values out of range) are decoded as
+    /// \a `ReplacementCharacter` one code unit at a time.
+    ///
+    /// \param[in,out] current Pointer to the code unit to decode, must be before \a `end`.
+    /// \param[in] end Pointer past the last code unit of the string.
+    ///
+    /// \return The decoded code point.
+    template <CharType T>
+    AXIS_NODISCARD constexpr char32_t DecodeNext(const T*& current,
+                                                 const T*  end) noexcept;
+
+    /// \brief Gets the number of code units the code point is encoded to.
+    ///
+    /// \param[in] codePoint Valid code point to encode.
+    template <CharType T>
+    AXIS_NODISCARD constexpr Size GetEncodedLength(char32_t codePoint) noexcept;
+
+    /// \brief Encodes the code point.
+    ///
+    /// \param[in] codePoint Valid code point to encode.
+    /// \param[out] destination Buffer with room for \a `GetEncodedLength` code units.
+    ///
+    /// \return Number of the code units written.
+    template <CharType T>
+    constexpr Size Encode(char32_t codePoint,
+                          T*       destination) noexcept;
+
+    /// \brief Gets the number of code units the string is transcoded to.
+    ///
+    /// The ASCII runs are scanned 16 bytes at a time with SSE2 where available.
+    ///
+    /// \param[in] source String to transcode.
+    /// \param[in] length Number of code units in the string.
+    template <CharType To, CharType From>
+    AXIS_NODISCARD Size GetTranscodedLength(const From* source,
+                                            Size        length) noexcept;
+
+    /// \brief Transcodes the string between UTF-8, UTF-16 and UTF-32.
+    ///
+    /// The ASCII runs are widened or narrowed 16 characters at a time with SSE2 where
+    /// available, the invalid sequences are replaced by \a `ReplacementCharacter`.
+    /// The null terminator is not written.
+    ///
+    /// \param[in] source String to transcode.
+    /// \param[in] length Number of code units in the string.
+    /// \param[out] destination Buffer with room for \a `GetTranscodedLength` code units.
+    ///
+    /// \return Number of the code units written.
+    template <CharType To, CharType From>
+    Size Transcode(const From* source,
+                   Size        length,
+                   To*         destination) noexcept;
+
+} // namespace Unicode
+
+} // namespace System
+
+} // namespace Axis
+
+#include "../../Private/Axis/UnicodeImpl.inl"
+
+#endif // AXIS_SYSTEM_UNICODE_HPP
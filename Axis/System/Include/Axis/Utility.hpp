@@ -7,6 +7,7 @@
 #pragma once
 
 #include "Config.hpp"
+#include "Trait.hpp"
 #include <type_traits>
 #include <utility>
 
@@ -27,6 +28,11 @@ struct Pair
     TSecond Second;
 };
 
+/// \brief `Pair` is trivially relocatable if both of its elements are.
+template <class TFirst, class TSecond>
+struct IsTriviallyRelocatable<Pair<TFirst, TSecond>> : std::bool_constant<TriviallyRelocatable<TFirst> && TriviallyRelocatable<TSecond>>
+{};
+
 /// \brief Iterating through variadic template arguments.
 ///
 /// \note Reference: https://gist.github.com/nabijaczleweli/37cdd8c28039ea41a999
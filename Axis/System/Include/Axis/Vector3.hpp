@@ -48,14 +48,22 @@ struct Vector3 final
     /// uses this following formula : \f$\sqrt{x^2 + y^2 + z^2}\f$
     AXIS_NODISCARD constexpr BigFloat GetMagnitude() const noexcept;
 
+    /// \brief Gets the magnitude of the vector in the precision of its components.
+    ///
+    /// Unlike \a `GetMagnitude`, doesn't go through \a `BigFloat`, the \a `Float32`
+    /// vectors use the SIMD instructions outside of the constant evaluation.
+    AXIS_NODISCARD constexpr T GetLength() const noexcept requires(FloatingPointType<T>);
+
     /// \brief Turns this vector into the unit vector.
     ///
-    /// has the magnitude of 1 but still having the same direction
+    /// has the magnitude of 1 but still having the same direction, computed in the
+    /// precision of the components.
     constexpr void Normalize() noexcept requires(FloatingPointType<T>);
 
     /// \brief Gets the copy of this normalized vector.
     ///
-    /// has the magnitude of 1 but still having the same direction
+    /// has the magnitude of 1 but still having the same direction, computed in the
+    /// precision of the components.
     AXIS_NODISCARD constexpr Vector3 NormalizeCopy() const noexcept requires(FloatingPointType<T>);
 
     /// \brief Returns the cross product of this vector and other vector.
@@ -0,0 +1,448 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#ifndef AXIS_SYSTEM_CONCURRENTHASHMAPIMPL_INL
+#define AXIS_SYSTEM_CONCURRENTHASHMAPIMPL_INL
+#pragma once
+
+#include "../../Include/Axis/ConcurrentHashMap.hpp"
+#include <bit>
+#include <thread>
+
+namespace Axis
+{
+
+namespace System
+{
+
+template <RawType TKey, RawType TValue, HasherType<TKey> Hasher, ComparerType<TKey> Comparer, AllocatorType Allocator>
+inline ConcurrentHashMap<TKey, TValue, Hasher, Comparer, Allocator>::ConcurrentHashMap(const Allocator& allocator) noexcept :
+    Detail::AllocatorStorage<Allocator>(allocator) {}
+
+template <RawType TKey, RawType TValue, HasherType<TKey> Hasher, ComparerType<TKey> Comparer, AllocatorType Allocator>
+inline ConcurrentHashMap<TKey, TValue, Hasher, Comparer, Allocator>::~ConcurrentHashMap() noexcept
+{
+    for (auto& shard : _shards)
+    {
+        BucketArray* bucketArray = shard.Buckets.load(std::memory_order_relaxed);
+
+        if (bucketArray == nullptr)
+            continue;
+
+        std::atomic<Node*>* buckets = bucketArray->GetBuckets();
+
+        for (Size i = 0; i <= bucketArray->Mask; ++i)
+        {
+            Node* node = buckets[i].load(std::memory_order_relaxed);
+
+            while (node != nullptr)
+            {
+                Node* next = node->Next.load(std::memory_order_relaxed);
+
+                DestroyNode(node);
+
+                node = next;
+            }
+        }
+
+        this->GetAllocatorInstance().Deallocate(bucketArray);
+    }
+
+    // The nodes removed earlier may still wait for the other threads to advance the epoch.
+    Detail::ReclaimObjects(this);
+}
+
+template <RawType TKey, RawType TValue, HasherType<TKey> Hasher, ComparerType<TKey> Comparer, AllocatorType Allocator>
+inline Size ConcurrentHashMap<TKey, TValue, Hasher, Comparer, Allocator>::GetLength() const noexcept
+{
+    Size length = 0;
+
+    for (const auto& shard : _shards)
+        length += shard.Length.load(std::memory_order_relaxed);
+
+    return length;
+}
+
+template <RawType TKey, RawType TValue, HasherType<TKey> Hasher, ComparerType<TKey> Comparer, AllocatorType Allocator>
+inline Size ConcurrentHashMap<TKey, TValue, Hasher, Comparer, Allocator>::GetShardIndex(Size hash) noexcept
+{
+    // The buckets use the low bits of the hash, the shards use the high bits of the mixed hash.
+    constexpr Size ShardBits = std::bit_width(ShardCount - 1);
+
+    return (Size)(Hashing::Mix((Uint64)hash) >> (64 - ShardBits));
+}
+
+template <RawType TKey, RawType TValue, HasherType<TKey> Hasher, ComparerType<TKey> Comparer, AllocatorType Allocator>
+inline typename ConcurrentHashMap<TKey, TValue, Hasher, Comparer, Allocator>::Shard& ConcurrentHashMap<TKey, TValue, Hasher, Comparer, Allocator>::GetShard(Size hash) const noexcept
+{
+    return _shards[GetShardIndex(hash)];
+}
+
+template <RawType TKey, RawType TValue, HasherType<TKey> Hasher, ComparerType<TKey> Comparer, AllocatorType Allocator>
+inline const typename ConcurrentHashMap<TKey, TValue, Hasher, Comparer, Allocator>::Node* ConcurrentHashMap<TKey, TValue, Hasher, Comparer, Allocator>::FindNode(const Shard& shard,
+                                                                                                                                                                 Size         hash,
+                                                                                                                                                                 const TKey&  key) const noexcept
+{
+    while (true)
+    {
+        const Size version = shard.Version.load(std::memory_order_acquire);
+
+        if (BucketArray* bucketArray = shard.Buckets.load(std::memory_order_acquire))
+        {
+            const Node* node = bucketArray->GetBuckets()[hash & bucketArray->Mask].load(std::memory_order_acquire);
+
+            for (; node != nullptr; node = node->Next.load(std::memory_order_acquire))
+            {
+                if (node->Hash == hash && Comparer()(node->Key, key))
+                    return node;
+            }
+        }
+
+        // The found node is always right, but a miss may come from following a chain being
+        // relinked by the growing shard.
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if ((version & 1) == 0 && shard.Version.load(std::memory_order_relaxed) == version)
+            return nullptr;
+
+        std::this_thread::yield();
+    }
+}
+
+template <RawType TKey, RawType TValue, HasherType<TKey> Hasher, ComparerType<TKey> Comparer, AllocatorType Allocator>
+inline Nullable<TValue> ConcurrentHashMap<TKey, TValue, Hasher, Comparer, Allocator>::Find(const TKey& key) const
+{
+    const Size hash = Hasher()(key);
+
+    Detail::EpochGuard guard;
+
+    if (const Node* node = FindNode(GetShard(hash), hash, key))
+        return node->Value;
+
+    return nullptr;
+}
+
+template <RawType TKey, RawType TValue, HasherType<TKey> Hasher, ComparerType<TKey> Comparer, AllocatorType Allocator>
+inline Bool ConcurrentHashMap<TKey, TValue, Hasher, Comparer, Allocator>::Contains(const TKey& key) const
+{
+    const Size hash = Hasher()(key);
+
+    Detail::EpochGuard guard;
+
+    return FindNode(GetShard(hash), hash, key) != nullptr;
+}
+
+template <RawType TKey, RawType TValue, HasherType<TKey> Hasher, ComparerType<TKey> Comparer, AllocatorType Allocator>
+template <class... Args>
+inline typename ConcurrentHashMap<TKey, TValue, Hasher, Comparer, Allocator>::Node* ConcurrentHashMap<TKey, TValue, Hasher, Comparer, Allocator>::CreateNode(Size        hash,
+                                                                                                                                                             const TKey& key,
+                                                                                                                                                             Args&&... args)
+{
+    PVoid memory = this->GetAllocatorInstance().Allocate(sizeof(Node), alignof(Node));
+
+    try
+    {
+        return new (memory) Node(hash, key, std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        this->GetAllocatorInstance().Deallocate(memory);
+        throw;
+    }
+}
+
+template <RawType TKey, RawType TValue, HasherType<TKey> Hasher, ComparerType<TKey> Comparer, AllocatorType Allocator>
+inline void ConcurrentHashMap<TKey, TValue, Hasher, Comparer, Allocator>::DestroyNode(Node* node) noexcept
+{
+    node->~Node();
+
+    this->GetAllocatorInstance().Deallocate(node);
+}
+
+template <RawType TKey, RawType TValue, HasherType<TKey> Hasher, ComparerType<TKey> Comparer, AllocatorType Allocator>
+inline void ConcurrentHashMap<TKey, TValue, Hasher, Comparer, Allocator>::DeleteRetiredNode(PVoid owner,
+                                                                                           PVoid object) noexcept
+{
+    ((ConcurrentHashMap*)owner)->DestroyNode((Node*)object);
+}
+
+template <RawType TKey, RawType TValue, HasherType<TKey> Hasher, ComparerType<TKey> Comparer, AllocatorType Allocator>
+inline void ConcurrentHashMap<TKey, TValue, Hasher, Comparer, Allocator>::DeleteRetiredBucketArray(PVoid owner,
+                                                                                                  PVoid object) noexcept
+{
+    ((ConcurrentHashMap*)owner)->GetAllocatorInstance().Deallocate(object);
+}
+
+template <RawType TKey, RawType TValue, HasherType<TKey> Hasher, ComparerType<TKey> Comparer, AllocatorType Allocator>
+inline void ConcurrentHashMap<TKey, TValue, Hasher, Comparer, Allocator>::GrowShard(Shard& shard)
+{
+    constexpr Size InitialBucketCount = 8;
+
+    BucketArray* oldArray    = shard.Buckets.load(std::memory_order_relaxed);
+    const Size   bucketCount = oldArray == nullptr ? InitialBucketCount : (oldArray->Mask + 1) * 2;
+
+    BucketArray* newArray = (BucketArray*)this->GetAllocatorInstance().Allocate(sizeof(BucketArray) + bucketCount * sizeof(std::atomic<Node*>), alignof(BucketArray));
+
+    newArray->Mask = bucketCount - 1;
+
+    std::atomic<Node*>* newBuckets = newArray->GetBuckets();
+
+    for (Size i = 0; i < bucketCount; ++i)
+        new (newBuckets + i) std::atomic<Node*>(nullptr);
+
+    if (oldArray == nullptr)
+    {
+        shard.Buckets.store(newArray, std::memory_order_release);
+        return;
+    }
+
+    // The readers walking the old chains may be led astray while the nodes are relinked, the odd
+    // version tells them to retry their misses.
+    shard.Version.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    std::atomic<Node*>* oldBuckets = oldArray->GetBuckets();
+
+    for (Size i = 0; i <= oldArray->Mask; ++i)
+    {
+        Node* node = oldBuckets[i].load(std::memory_order_relaxed);
+
+        while (node != nullptr)
+        {
+            Node*               next   = node->Next.load(std::memory_order_relaxed);
+            std::atomic<Node*>& bucket = newBuckets[node->Hash & newArray->Mask];
+
+            node->Next.store(bucket.load(std::memory_order_relaxed), std::memory_order_release);
+            bucket.store(node, std::memory_order_relaxed);
+
+            node = next;
+        }
+    }
+
+    shard.Buckets.store(newArray, std::memory_order_release);
+    shard.Version.fetch_add(1, std::memory_order_release);
+
+    Detail::RetireObject(this, oldArray, &DeleteRetiredBucketArray);
+}
+
+template <RawType TKey, RawType TValue, HasherType<TKey> Hasher, ComparerType<TKey> Comparer, AllocatorType Allocator>
+inline void ConcurrentHashMap<TKey, TValue, Hasher, Comparer, Allocator>::LinkNode(Shard& shard,
+                                                                                  Node*  node)
+{
+    BucketArray* bucketArray = shard.Buckets.load(std::memory_order_relaxed);
+
+    // Keeps the load factor at most one.
+    if (bucketArray == nullptr || shard.Length.load(std::memory_order_relaxed) > bucketArray->Mask)
+    {
+        GrowShard(shard);
+        bucketArray = shard.Buckets.load(std::memory_order_relaxed);
+    }
+
+    std::atomic<Node*>& bucket = bucketArray->GetBuckets()[node->Hash & bucketArray->Mask];
+
+    node->Next.store(bucket.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    bucket.store(node, std::memory_order_release);
+
+    shard.Length.fetch_add(1, std::memory_order_relaxed);
+}
+
+template <RawType TKey, RawType TValue, HasherType<TKey> Hasher, ComparerType<TKey> Comparer, AllocatorType Allocator>
+template <class... Args>
+inline Bool ConcurrentHashMap<TKey, TValue, Hasher, Comparer, Allocator>::TryInsert(const TKey& key,
+                                                                                   Args&&... args) requires(std::is_constructible_v<TValue, Args...>)
+{
+    const Size hash  = Hasher()(key);
+    Shard&     shard = GetShard(hash);
+
+    std::scoped_lock lock(shard.Mutex);
+
+    if (FindNode(shard, hash, key) != nullptr)
+        return false;
+
+    Node* node = CreateNode(hash, key, std::forward<Args>(args)...);
+
+    try
+    {
+        LinkNode(shard, node);
+    }
+    catch (...)
+    {
+        DestroyNode(node);
+        throw;
+    }
+
+    return true;
+}
+
+template <RawType TKey, RawType TValue, HasherType<TKey> Hasher, ComparerType<TKey> Comparer, AllocatorType Allocator>
+template <class Factory>
+inline TValue ConcurrentHashMap<TKey, TValue, Hasher, Comparer, Allocator>::GetOrCreate(const TKey& key,
+                                                                                       Factory&&   factory) requires(std::is_constructible_v<TValue, std::invoke_result_t<Factory&>>)
+{
+    const Size hash  = Hasher()(key);
+    Shard&     shard = GetShard(hash);
+
+    {
+        Detail::EpochGuard guard;
+
+        if (const Node* node = FindNode(shard, hash, key))
+            return node->Value;
+    }
+
+    Node* created = CreateNode(hash, key, factory());
+
+    std::scoped_lock lock(shard.Mutex);
+
+    // Another thread may have created the value meanwhile, its value wins.
+    if (const Node* node = FindNode(shard, hash, key))
+    {
+        TValue value = node->Value;
+
+        DestroyNode(created);
+
+        return value;
+    }
+
+    try
+    {
+        LinkNode(shard, created);
+    }
+    catch (...)
+    {
+        DestroyNode(created);
+        throw;
+    }
+
+    return created->Value;
+}
+
+template <RawType TKey, RawType TValue, HasherType<TKey> Hasher, ComparerType<TKey> Comparer, AllocatorType Allocator>
+template <class Predicate>
+inline Size ConcurrentHashMap<TKey, TValue, Hasher, Comparer, Allocator>::RemoveNodes(Shard&     shard,
+                                                                                     Predicate& predicate)
+{
+    BucketArray* bucketArray = shard.Buckets.load(std::memory_order_relaxed);
+
+    if (bucketArray == nullptr)
+        return 0;
+
+    std::atomic<Node*>* buckets = bucketArray->GetBuckets();
+    Size                removed = 0;
+
+    for (Size i = 0; i <= bucketArray->Mask; ++i)
+    {
+        std::atomic<Node*>* link = buckets + i;
+        Node*               node = link->load(std::memory_order_relaxed);
+
+        while (node != nullptr)
+        {
+            Node* next = node->Next.load(std::memory_order_relaxed);
+
+            if (!predicate(*node))
+            {
+                link = &node->Next;
+                node = next;
+                continue;
+            }
+
+            // The readers standing on the removed node still reach the rest of the chain through
+            // its unchanged next pointer.
+            link->store(next, std::memory_order_release);
+            shard.Length.fetch_sub(1, std::memory_order_relaxed);
+
+            Detail::RetireObject(this, node, &DeleteRetiredNode);
+
+            ++removed;
+            node = next;
+        }
+    }
+
+    return removed;
+}
+
+template <RawType TKey, RawType TValue, HasherType<TKey> Hasher, ComparerType<TKey> Comparer, AllocatorType Allocator>
+inline Bool ConcurrentHashMap<TKey, TValue, Hasher, Comparer, Allocator>::Remove(const TKey& key)
+{
+    const Size hash  = Hasher()(key);
+    Shard&     shard = GetShard(hash);
+
+    std::scoped_lock lock(shard.Mutex);
+
+    BucketArray* bucketArray = shard.Buckets.load(std::memory_order_relaxed);
+
+    if (bucketArray == nullptr)
+        return false;
+
+    std::atomic<Node*>* link = bucketArray->GetBuckets() + (hash & bucketArray->Mask);
+
+    for (Node* node = link->load(std::memory_order_relaxed); node != nullptr; node = link->load(std::memory_order_relaxed))
+    {
+        if (node->Hash == hash && Comparer()(node->Key, key))
+        {
+            link->store(node->Next.load(std::memory_order_relaxed), std::memory_order_release);
+            shard.Length.fetch_sub(1, std::memory_order_relaxed);
+
+            Detail::RetireObject(this, node, &DeleteRetiredNode);
+
+            return true;
+        }
+
+        link = &node->Next;
+    }
+
+    return false;
+}
+
+template <RawType TKey, RawType TValue, HasherType<TKey> Hasher, ComparerType<TKey> Comparer, AllocatorType Allocator>
+template <class Predicate>
+inline Size ConcurrentHashMap<TKey, TValue, Hasher, Comparer, Allocator>::RemoveIf(Predicate&& predicate)
+{
+    auto matches = [&](const Node& node) -> Bool { return predicate(node.Key, node.Value); };
+
+    Size removed = 0;
+
+    for (auto& shard : _shards)
+    {
+        std::scoped_lock lock(shard.Mutex);
+
+        removed += RemoveNodes(shard, matches);
+    }
+
+    return removed;
+}
+
+template <RawType TKey, RawType TValue, HasherType<TKey> Hasher, ComparerType<TKey> Comparer, AllocatorType Allocator>
+inline void ConcurrentHashMap<TKey, TValue, Hasher, Comparer, Allocator>::Clear()
+{
+    RemoveIf([](const TKey&, const TValue&) { return true; });
+}
+
+template <RawType TKey, RawType TValue, HasherType<TKey> Hasher, ComparerType<TKey> Comparer, AllocatorType Allocator>
+template <class Function>
+inline void ConcurrentHashMap<TKey, TValue, Hasher, Comparer, Allocator>::ForEach(Function&& function) const
+{
+    for (auto& shard : _shards)
+    {
+        std::scoped_lock lock(shard.Mutex);
+
+        BucketArray* bucketArray = shard.Buckets.load(std::memory_order_relaxed);
+
+        if (bucketArray == nullptr)
+            continue;
+
+        std::atomic<Node*>* buckets = bucketArray->GetBuckets();
+
+        for (Size i = 0; i <= bucketArray->Mask; ++i)
+        {
+            for (const Node* node = buckets[i].load(std::memory_order_relaxed); node != nullptr; node = node->Next.load(std::memory_order_relaxed))
+                function(node->Key, node->Value);
+        }
+    }
+}
+
+} // namespace System
+
+} // namespace Axis
+
+#endif // AXIS_SYSTEM_CONCURRENTHASHMAPIMPL_INL
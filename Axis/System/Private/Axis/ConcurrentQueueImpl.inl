@@ -0,0 +1,350 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#ifndef AXIS_SYSTEM_CONCURRENTQUEUEIMPL_INL
+#define AXIS_SYSTEM_CONCURRENTQUEUEIMPL_INL
+#pragma once
+
+#include "../../Include/Axis/ConcurrentQueue.hpp"
+#include "../../Include/Axis/Exception.hpp"
+#include "../../Include/Axis/Math.hpp"
+
+namespace Axis
+{
+
+namespace System
+{
+
+template <RawType T, AllocatorType Allocator>
+inline SpscQueue<T, Allocator>::SpscQueue(Size             capacity,
+                                          const Allocator& allocator) :
+    Detail::AllocatorStorage<Allocator>(allocator)
+{
+    if (capacity == 0)
+        throw InvalidArgumentException("`capacity` was zero!");
+
+    capacity = Math::RoundToNextPowerOfTwo(capacity);
+
+    _buffer = (T*)this->GetAllocatorInstance().Allocate(capacity * sizeof(T), alignof(T));
+    _mask   = capacity - 1;
+}
+
+template <RawType T, AllocatorType Allocator>
+inline SpscQueue<T, Allocator>::~SpscQueue() noexcept
+{
+    const Size tail = _tail.load(std::memory_order_acquire);
+
+    for (Size head = _head.load(std::memory_order_relaxed); head != tail; ++head)
+        _buffer[head & _mask].~T();
+
+    this->GetAllocatorInstance().Deallocate(_buffer);
+}
+
+template <RawType T, AllocatorType Allocator>
+inline Size SpscQueue<T, Allocator>::GetLength() const noexcept
+{
+    const Size head = _head.load(std::memory_order_acquire);
+    const Size tail = _tail.load(std::memory_order_acquire);
+
+    return tail - head <= _mask + 1 ? tail - head : 0;
+}
+
+template <RawType T, AllocatorType Allocator>
+template <class... Args>
+inline Bool SpscQueue<T, Allocator>::TryEmplace(Args&&... args) requires(std::is_constructible_v<T, Args...>)
+{
+    const Size tail = _tail.load(std::memory_order_relaxed);
+
+    // Only reads the consumer's index when the queue looks full.
+    if (tail - _cachedHead > _mask)
+    {
+        _cachedHead = _head.load(std::memory_order_acquire);
+
+        if (tail - _cachedHead > _mask)
+            return false;
+    }
+
+    new (_buffer + (tail & _mask)) T(std::forward<Args>(args)...);
+
+    _tail.store(tail + 1, std::memory_order_release);
+
+    return true;
+}
+
+template <RawType T, AllocatorType Allocator>
+inline Bool SpscQueue<T, Allocator>::TryPush(const T& element) requires(std::is_copy_constructible_v<T>)
+{
+    return TryEmplace(element);
+}
+
+template <RawType T, AllocatorType Allocator>
+inline Bool SpscQueue<T, Allocator>::TryPush(T&& element) requires(std::is_move_constructible_v<T>)
+{
+    return TryEmplace(std::move(element));
+}
+
+template <RawType T, AllocatorType Allocator>
+inline Size SpscQueue<T, Allocator>::TryPushRange(const T* elements,
+                                                  Size     count) requires(std::is_copy_constructible_v<T>)
+{
+    const Size tail = _tail.load(std::memory_order_relaxed);
+
+    if (_mask + 1 - (tail - _cachedHead) < count)
+        _cachedHead = _head.load(std::memory_order_acquire);
+
+    count = Math::Min(count, _mask + 1 - (tail - _cachedHead));
+
+    Size pushed = 0;
+
+    try
+    {
+        for (; pushed < count; ++pushed)
+            new (_buffer + ((tail + pushed) & _mask)) T(elements[pushed]);
+    }
+    catch (...)
+    {
+        // Publishes the elements copied before the throw.
+        _tail.store(tail + pushed, std::memory_order_release);
+        throw;
+    }
+
+    _tail.store(tail + count, std::memory_order_release);
+
+    return count;
+}
+
+template <RawType T, AllocatorType Allocator>
+inline Bool SpscQueue<T, Allocator>::TryPop(T& element) requires(std::is_move_assignable_v<T>)
+{
+    const Size head = _head.load(std::memory_order_relaxed);
+
+    // Only reads the producer's index when the queue looks empty.
+    if (head == _cachedTail)
+    {
+        _cachedTail = _tail.load(std::memory_order_acquire);
+
+        if (head == _cachedTail)
+            return false;
+    }
+
+    T* slot = _buffer + (head & _mask);
+
+    element = std::move(*slot);
+    slot->~T();
+
+    _head.store(head + 1, std::memory_order_release);
+
+    return true;
+}
+
+template <RawType T, AllocatorType Allocator>
+inline Size SpscQueue<T, Allocator>::TryPopRange(T*   elements,
+                                                 Size maxCount) requires(std::is_move_assignable_v<T>)
+{
+    const Size head = _head.load(std::memory_order_relaxed);
+
+    if (_cachedTail - head < maxCount)
+        _cachedTail = _tail.load(std::memory_order_acquire);
+
+    const Size count = Math::Min(maxCount, _cachedTail - head);
+
+    Size popped = 0;
+
+    try
+    {
+        for (; popped < count; ++popped)
+        {
+            T* slot = _buffer + ((head + popped) & _mask);
+
+            elements[popped] = std::move(*slot);
+            slot->~T();
+        }
+    }
+    catch (...)
+    {
+        // Releases the slots of the elements popped before the throw.
+        _head.store(head + popped, std::memory_order_release);
+        throw;
+    }
+
+    _head.store(head + count, std::memory_order_release);
+
+    return count;
+}
+
+template <RawType T, AllocatorType Allocator>
+inline MpmcQueue<T, Allocator>::MpmcQueue(Size             capacity,
+                                          const Allocator& allocator) :
+    Detail::AllocatorStorage<Allocator>(allocator)
+{
+    if (capacity == 0)
+        throw InvalidArgumentException("`capacity` was zero!");
+
+    // With a single cell the sequence of a filled slot equals the next push position, so the
+    // second push would overwrite the first; two cells are the minimum the scheme works with.
+    capacity = Math::RoundToNextPowerOfTwo(capacity < 2 ? 2 : capacity);
+
+    _cells = (Cell*)this->GetAllocatorInstance().Allocate(capacity * sizeof(Cell), alignof(Cell));
+    _mask  = capacity - 1;
+
+    // Every slot is free for the push of its own index on the first lap.
+    for (Size i = 0; i < capacity; ++i)
+    {
+        new (_cells + i) Cell();
+        _cells[i].Sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+template <RawType T, AllocatorType Allocator>
+inline MpmcQueue<T, Allocator>::~MpmcQueue() noexcept
+{
+    const Size pushPosition = _pushPosition.load(std::memory_order_acquire);
+
+    for (Size position = _popPosition.load(std::memory_order_relaxed); position != pushPosition; ++position)
+        _cells[position & _mask].GetElement()->~T();
+
+    this->GetAllocatorInstance().Deallocate(_cells);
+}
+
+template <RawType T, AllocatorType Allocator>
+inline Size MpmcQueue<T, Allocator>::GetLength() const noexcept
+{
+    const Size popPosition  = _popPosition.load(std::memory_order_acquire);
+    const Size pushPosition = _pushPosition.load(std::memory_order_acquire);
+
+    return pushPosition - popPosition <= _mask + 1 ? pushPosition - popPosition : 0;
+}
+
+template <RawType T, AllocatorType Allocator>
+template <Bool Push>
+inline Size MpmcQueue<T, Allocator>::ClaimSlots(std::atomic<Size>& position,
+                                                Size               maxCount,
+                                                Size&              first) noexcept
+{
+    // The slot is free for the push of the index equal to its sequence, and ready for the pop of
+    // the index one below it.
+    constexpr Size Offset = Push ? 0 : 1;
+
+    if (maxCount == 0)
+        return 0;
+
+    Size current = position.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        Size count = 0;
+
+        for (; count < maxCount; ++count)
+        {
+            const Size index    = current + count;
+            const Size sequence = _cells[index & _mask].Sequence.load(std::memory_order_acquire);
+
+            if (sequence != index + Offset)
+            {
+                // Behind: the slot is still used from the previous lap, the queue is full (push)
+                // or empty (pop). Ahead: the other thread has claimed it, `current` is stale.
+                if (count == 0 && (std::make_signed_t<Size>)(sequence - (index + Offset)) < 0)
+                    return 0;
+
+                break;
+            }
+        }
+
+        if (count == 0)
+        {
+            current = position.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        if (position.compare_exchange_weak(current, current + count, std::memory_order_relaxed, std::memory_order_relaxed))
+        {
+            first = current;
+            return count;
+        }
+    }
+}
+
+template <RawType T, AllocatorType Allocator>
+template <class... Args>
+inline Bool MpmcQueue<T, Allocator>::TryEmplace(Args&&... args) noexcept requires(std::is_nothrow_constructible_v<T, Args...>)
+{
+    Size first = 0;
+
+    if (ClaimSlots<true>(_pushPosition, 1, first) == 0)
+        return false;
+
+    Cell& cell = _cells[first & _mask];
+
+    new (cell.GetElement()) T(std::forward<Args>(args)...);
+
+    cell.Sequence.store(first + 1, std::memory_order_release);
+
+    return true;
+}
+
+template <RawType T, AllocatorType Allocator>
+inline Bool MpmcQueue<T, Allocator>::TryPush(const T& element) noexcept requires(std::is_nothrow_copy_constructible_v<T>)
+{
+    return TryEmplace(element);
+}
+
+template <RawType T, AllocatorType Allocator>
+inline Bool MpmcQueue<T, Allocator>::TryPush(T&& element) noexcept requires(std::is_nothrow_move_constructible_v<T>)
+{
+    return TryEmplace(std::move(element));
+}
+
+template <RawType T, AllocatorType Allocator>
+inline Size MpmcQueue<T, Allocator>::TryPushRange(const T* elements,
+                                                  Size     count) noexcept requires(std::is_nothrow_copy_constructible_v<T>)
+{
+    Size first = 0;
+
+    count = ClaimSlots<true>(_pushPosition, count, first);
+
+    for (Size i = 0; i < count; ++i)
+    {
+        Cell& cell = _cells[(first + i) & _mask];
+
+        new (cell.GetElement()) T(elements[i]);
+
+        cell.Sequence.store(first + i + 1, std::memory_order_release);
+    }
+
+    return count;
+}
+
+template <RawType T, AllocatorType Allocator>
+inline Bool MpmcQueue<T, Allocator>::TryPop(T& element) noexcept
+{
+    return TryPopRange(std::addressof(element), 1) == 1;
+}
+
+template <RawType T, AllocatorType Allocator>
+inline Size MpmcQueue<T, Allocator>::TryPopRange(T*   elements,
+                                                 Size maxCount) noexcept
+{
+    Size first = 0;
+
+    const Size count = ClaimSlots<false>(_popPosition, maxCount, first);
+
+    for (Size i = 0; i < count; ++i)
+    {
+        Cell& cell = _cells[(first + i) & _mask];
+
+        elements[i] = std::move(*cell.GetElement());
+        cell.GetElement()->~T();
+
+        // Frees the slot for the push of the next lap.
+        cell.Sequence.store(first + i + _mask + 1, std::memory_order_release);
+    }
+
+    return count;
+}
+
+} // namespace System
+
+} // namespace Axis
+
+#endif // AXIS_SYSTEM_CONCURRENTQUEUEIMPL_INL
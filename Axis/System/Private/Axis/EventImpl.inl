@@ -7,7 +7,6 @@
 #pragma once
 
 #include "../../Include/Axis/Event.hpp"
-#include "../../Include/Axis/Random.hpp"
 
 namespace Axis
 {
@@ -16,69 +15,287 @@ namespace System
 {
 
 template <class ReturnType, class... Args>
-inline void Event<ReturnType(Args...)>::operator()(Args&&... args)
+inline void Event<ReturnType(Args...)>::operator()(Args... args)
 {
-    for (auto& handler : EventRegister._handlers)
-        handler.Second(std::forward<Args>(args)...);
+    EventRegister.Invoke(args...);
 }
 
 template <class ReturnType, class... Args>
-inline void Event<ReturnType(Args...)>::Invoke(Args&&... args)
+inline void Event<ReturnType(Args...)>::Invoke(Args... args)
 {
-    for (auto& handler : EventRegister._handlers)
-        handler.Second(std::forward<Args>(args)...);
+    EventRegister.Invoke(args...);
 }
 
 template <class ReturnType, class... Args>
-inline Size Event<ReturnType(Args...)>::Register::Add(const Function<ReturnType(Args...)>& handler,
-                                                      Size                                 token)
+template <class Handler>
+inline Size Event<ReturnType(Args...)>::Register::Add(Handler&& handler) requires(std::is_convertible_v<Handler, FunctionPointer> || std::is_constructible_v<Function<ReturnType(Args...)>, Handler>)
 {
-    static Random s_Random = {};
+    const Bool isInvoking = _invokeDepth != 0;
 
-    // Generates a new token if the given token is collided with another handler.
-    auto it = _handlers.Find(token);
+    // The handlers added during the raise wait in the pending arrays, the arrays being iterated must not grow.
+    if constexpr (std::is_convertible_v<Handler, FunctionPointer>)
+    {
+        return AddHandler(isInvoking ? _pendingFunctionPointers : _functionPointers,
+                          isInvoking ? Detail::EventHandlerLocation::PendingFunctionPointers : Detail::EventHandlerLocation::FunctionPointers,
+                          static_cast<FunctionPointer>(handler));
+    }
+    else
+    {
+        return AddHandler(isInvoking ? _pendingFunctors : _functors,
+                          isInvoking ? Detail::EventHandlerLocation::PendingFunctors : Detail::EventHandlerLocation::Functors,
+                          Function<ReturnType(Args...)>(std::forward<Handler>(handler)));
+    }
+}
 
-    while (it != _handlers.end())
+template <class ReturnType, class... Args>
+inline Bool Event<ReturnType(Args...)>::Register::Remove(Size token) noexcept
+{
+    const Size slotIndex = FindSlot(token);
+
+    if (slotIndex == _slots.GetLength())
+        return false;
+
+    const auto& slot = _slots[slotIndex];
+
+    // Marks the handler, it's erased once no raise is in progress.
+    switch (slot.Location)
     {
-        token = s_Random.NextSize();
-        it    = _handlers.Find(token);
+        case Detail::EventHandlerLocation::FunctionPointers:
+            _functionPointers[slot.Index].Slot = FunctionPointerHandler::RemovedSlot;
+            break;
+        case Detail::EventHandlerLocation::Functors:
+            _functors[slot.Index].Slot = FunctorHandler::RemovedSlot;
+            break;
+        case Detail::EventHandlerLocation::PendingFunctionPointers:
+            _pendingFunctionPointers[slot.Index].Slot = FunctionPointerHandler::RemovedSlot;
+            break;
+        case Detail::EventHandlerLocation::PendingFunctors:
+            _pendingFunctors[slot.Index].Slot = FunctorHandler::RemovedSlot;
+            break;
+        default:
+            break;
     }
 
-    _handlers.Insert({token, handler});
+    ReleaseSlot((Uint32)slotIndex);
+
+    _hasRemovedHandlers = true;
+
+    if (_invokeDepth == 0)
+        EraseRemovedHandlers();
 
-    return token;
+    return true;
 }
 
 template <class ReturnType, class... Args>
-inline Bool Event<ReturnType(Args...)>::Register::Remove(Size token) noexcept
+inline Bool Event<ReturnType(Args...)>::Register::TokenExists(Size token) const noexcept
 {
-    auto result = _handlers.Remove(token);
+    return FindSlot(token) != _slots.GetLength();
+}
 
-    return result.First;
+template <class ReturnType, class... Args>
+inline Size Event<ReturnType(Args...)>::Register::GetHandlerCount() const noexcept
+{
+    return _slots.GetLength() - _freeSlots.GetLength();
 }
 
 template <class ReturnType, class... Args>
-inline Bool Event<ReturnType(Args...)>::Register::TokenExists(Size token) const noexcept
+template <class HandlerType, class Handler>
+inline Size Event<ReturnType(Args...)>::Register::AddHandler(HandlerList<HandlerType>&     handlers,
+                                                             Detail::EventHandlerLocation location,
+                                                             Handler&&                    handler)
 {
-    return _handlers.Find(token) != _handlers.end();
+    const Uint32 slotIndex = AcquireSlot();
+
+    try
+    {
+        handlers.Append(HandlerType{std::forward<Handler>(handler), slotIndex});
+    }
+    catch (...)
+    {
+        ReleaseSlot(slotIndex);
+        throw;
+    }
+
+    auto& slot    = _slots[slotIndex];
+    slot.Index    = (Uint32)(handlers.GetLength() - 1);
+    slot.Location = location;
+
+    return ((Size)slot.Generation << SlotIndexBits) | slotIndex;
 }
 
 template <class ReturnType, class... Args>
-inline EventToken<ReturnType(Args...)>::EventToken(typename Event<ReturnType(Args...)>::Register& event,
-                                                   const Function<ReturnType(Args...)>&           handler,
-                                                   Size                                           token) :
-    _event(std::addressof(event))
+inline Uint32 Event<ReturnType(Args...)>::Register::AcquireSlot()
+{
+    if (_freeSlots)
+    {
+        const Uint32 slotIndex = _freeSlots[_freeSlots.GetLength() - 1];
+        _freeSlots.PopBack();
+
+        return slotIndex;
+    }
+
+    // Every slot can be freed without allocating.
+    _freeSlots.ReserveFor(_slots.GetLength() + 1);
+    _slots.Append(Detail::EventSlot{});
+
+    return (Uint32)(_slots.GetLength() - 1);
+}
+
+template <class ReturnType, class... Args>
+inline void Event<ReturnType(Args...)>::Register::ReleaseSlot(Uint32 slotIndex) noexcept
 {
-    _token = _event->Add(handler, token);
+    constexpr Size GenerationMask = (Size(1) << (sizeof(Size) * 8 - SlotIndexBits)) - 1;
+
+    auto& slot = _slots[slotIndex];
+
+    // The generation is never 0, so is the token.
+    slot.Generation = (Uint32)((slot.Generation + 1) & GenerationMask);
+    slot.Generation = slot.Generation == 0 ? 1 : slot.Generation;
+    slot.Location   = Detail::EventHandlerLocation::None;
+
+    _freeSlots.Append(slotIndex);
+}
+
+template <class ReturnType, class... Args>
+inline Size Event<ReturnType(Args...)>::Register::FindSlot(Size token) const noexcept
+{
+    constexpr Size SlotIndexMask = (Size(1) << SlotIndexBits) - 1;
+
+    const Size slotIndex = token & SlotIndexMask;
+
+    if (slotIndex >= _slots.GetLength())
+        return _slots.GetLength();
+
+    const auto& slot = _slots[slotIndex];
+
+    if (slot.Location == Detail::EventHandlerLocation::None || slot.Generation != (token >> SlotIndexBits))
+        return _slots.GetLength();
+
+    return slotIndex;
+}
+
+template <class ReturnType, class... Args>
+inline void Event<ReturnType(Args...)>::Register::Invoke(Args&... args)
+{
+    // The arrays neither grow nor shrink until the outermost raise returns.
+    const FunctionPointerHandler* functionPointers     = _functionPointers.GetData();
+    const Size                    functionPointerCount = _functionPointers.GetLength();
+    FunctorHandler*               functors             = _functors.GetData();
+    const Size                    functorCount         = _functors.GetLength();
+
+    _invokeDepth++;
+
+    try
+    {
+        for (Size i = 0; i < functionPointerCount; ++i)
+        {
+            if (functionPointers[i].Slot != FunctionPointerHandler::RemovedSlot)
+                functionPointers[i].Handler(args...);
+        }
+
+        for (Size i = 0; i < functorCount; ++i)
+        {
+            if (functors[i].Slot != FunctorHandler::RemovedSlot)
+                functors[i].Handler(args...);
+        }
+    }
+    catch (...)
+    {
+        EndInvoke();
+        throw;
+    }
+
+    EndInvoke();
+}
+
+template <class ReturnType, class... Args>
+inline void Event<ReturnType(Args...)>::Register::EndInvoke()
+{
+    if (--_invokeDepth != 0)
+        return;
+
+    EraseRemovedHandlers();
+    AppendPendingHandlers();
+}
+
+template <class ReturnType, class... Args>
+inline void Event<ReturnType(Args...)>::Register::EraseRemovedHandlers() noexcept
+{
+    if (!_hasRemovedHandlers)
+        return;
+
+    EraseRemovedHandlers(_functionPointers);
+    EraseRemovedHandlers(_functors);
+
+    _hasRemovedHandlers = false;
+}
+
+template <class ReturnType, class... Args>
+inline void Event<ReturnType(Args...)>::Register::AppendPendingHandlers()
+{
+    AppendPendingHandlers(_functionPointers, _pendingFunctionPointers, Detail::EventHandlerLocation::FunctionPointers);
+    AppendPendingHandlers(_functors, _pendingFunctors, Detail::EventHandlerLocation::Functors);
+}
+
+template <class ReturnType, class... Args>
+template <class HandlerType>
+inline void Event<ReturnType(Args...)>::Register::EraseRemovedHandlers(HandlerList<HandlerType>& handlers) noexcept
+{
+    // Keeps the order of the remaining handlers.
+    auto*      data   = handlers.GetData();
+    const Size length = handlers.GetLength();
+    Size       kept   = 0;
+
+    for (Size i = 0; i < length; ++i)
+    {
+        if (data[i].Slot == HandlerType::RemovedSlot)
+            continue;
+
+        if (i != kept)
+            data[kept] = std::move(data[i]);
+
+        _slots[data[kept].Slot].Index = (Uint32)kept;
+        kept++;
+    }
+
+    while (handlers.GetLength() > kept)
+        handlers.PopBack();
+}
+
+template <class ReturnType, class... Args>
+template <class HandlerType>
+inline void Event<ReturnType(Args...)>::Register::AppendPendingHandlers(HandlerList<HandlerType>&     handlers,
+                                                                        HandlerList<HandlerType>&     pendingHandlers,
+                                                                        Detail::EventHandlerLocation location)
+{
+    if (!pendingHandlers)
+        return;
+
+    // Leaves the handlers pending if the memory can't be reserved, they're moved by the next raise.
+    handlers.ReserveFor(handlers.GetLength() + pendingHandlers.GetLength());
+
+    for (auto& handler : pendingHandlers)
+    {
+        if (handler.Slot == HandlerType::RemovedSlot)
+            continue;
+
+        auto& slot    = _slots[handler.Slot];
+        slot.Index    = (Uint32)handlers.GetLength();
+        slot.Location = location;
+
+        handlers.Append(std::move(handler));
+    }
+
+    pendingHandlers.Clear();
 }
 
 template <class ReturnType, class... Args>
+template <class Handler>
 inline EventToken<ReturnType(Args...)>::EventToken(typename Event<ReturnType(Args...)>::Register& event,
-                                                   Function<ReturnType(Args...)>&&                handler,
-                                                   Size                                           token) :
+                                                   Handler&&                                      handler) :
     _event(std::addressof(event))
 {
-    _token = _event->Add(std::move(handler), token);
+    _token = _event->Add(std::forward<Handler>(handler));
 }
 
 template <class ReturnType, class... Args>
@@ -132,4 +349,4 @@ inline Bool EventToken<ReturnType(Args...)>::IsSubscribed() const noexcept
 
 } // namespace Axis
 
-#endif // AXIS_SYSTEM_EVENTIMPL_INL
\ No newline at end of file
+#endif // AXIS_SYSTEM_EVENTIMPL_INL
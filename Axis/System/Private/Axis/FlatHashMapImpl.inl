@@ -0,0 +1,51 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#ifndef AXIS_SYSTEM_FLATHASHMAPIMPL_INL
+#define AXIS_SYSTEM_FLATHASHMAPIMPL_INL
+#pragma once
+
+#include "../../Include/Axis/FlatHashMap.hpp"
+
+namespace Axis
+{
+
+namespace System
+{
+
+template <RawType TKey, RawType TValue, HasherType<TKey> Hasher, ComparerType<TKey> Comparer, AllocatorType Allocator>
+inline typename FlatHashMap<TKey, TValue, Hasher, Comparer, Allocator>::HashSetBase::iterator FlatHashMap<TKey, TValue, Hasher, Comparer, Allocator>::Find(const TKey& key) noexcept
+{
+    return HashSetBase::template FindIndirect<TKey, typename FlatHashMap<TKey, TValue, Hasher, Comparer, Allocator>::HashSetBase::iterator>(key);
+}
+
+template <RawType TKey, RawType TValue, HasherType<TKey> Hasher, ComparerType<TKey> Comparer, AllocatorType Allocator>
+inline typename FlatHashMap<TKey, TValue, Hasher, Comparer, Allocator>::HashSetBase::const_iterator FlatHashMap<TKey, TValue, Hasher, Comparer, Allocator>::Find(const TKey& key) const noexcept
+{
+    return HashSetBase::template FindIndirect<TKey, typename FlatHashMap<TKey, TValue, Hasher, Comparer, Allocator>::HashSetBase::const_iterator>(key);
+}
+
+template <RawType TKey, RawType TValue, HasherType<TKey> Hasher, ComparerType<TKey> Comparer, AllocatorType Allocator>
+inline Pair<Bool, typename FlatHashMap<TKey, TValue, Hasher, Comparer, Allocator>::HashSetBase::iterator> FlatHashMap<TKey, TValue, Hasher, Comparer, Allocator>::Remove(const TKey& key) noexcept
+{
+    return HashSetBase::template RemoveIndirect<TKey, typename FlatHashMap<TKey, TValue, Hasher, Comparer, Allocator>::HashSetBase::iterator>(key);
+}
+
+template <RawType TKey, RawType TValue, HasherType<TKey> Hasher, ComparerType<TKey> Comparer, AllocatorType Allocator>
+inline typename FlatHashMap<TKey, TValue, Hasher, Comparer, Allocator>::HashSetBase::iterator FlatHashMap<TKey, TValue, Hasher, Comparer, Allocator>::begin() noexcept
+{
+    return HashSetBase::NonConstBegin();
+}
+
+template <RawType TKey, RawType TValue, HasherType<TKey> Hasher, ComparerType<TKey> Comparer, AllocatorType Allocator>
+inline typename FlatHashMap<TKey, TValue, Hasher, Comparer, Allocator>::HashSetBase::iterator FlatHashMap<TKey, TValue, Hasher, Comparer, Allocator>::end() noexcept
+{
+    return HashSetBase::NonConstEnd();
+}
+
+} // namespace System
+
+} // namespace Axis
+
+#endif // AXIS_SYSTEM_FLATHASHMAPIMPL_INL
\ No newline at end of file
@@ -0,0 +1,712 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#ifndef AXIS_SYSTEM_FLATHASHSETIMPL_INL
+#define AXIS_SYSTEM_FLATHASHSETIMPL_INL
+#pragma once
+
+#include "../../Include/Axis/FlatHashSet.hpp"
+#include "../../Include/Axis/Math.hpp"
+#include <bit>
+#include <cstring>
+
+namespace Axis
+{
+
+namespace System
+{
+
+namespace Detail
+{
+
+#ifdef AXIS_SIMD_SSE2
+
+inline FlatHashGroup::FlatHashGroup(const Uint8* controls) noexcept :
+    _controls(_mm_loadu_si128((const __m128i*)controls)) {}
+
+inline Uint32 FlatHashGroup::Match(Uint8 hash) const noexcept
+{
+    return (Uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8((char)hash), _controls));
+}
+
+inline Uint32 FlatHashGroup::MatchEmpty() const noexcept
+{
+    // Only the empty control byte has the highest bit set
+    return (Uint32)_mm_movemask_epi8(_controls);
+}
+
+#else
+
+// Packs the highest bit of every byte into the lowest 8 bits.
+inline Uint32 PackFlatHashGroupBits(Uint64 word) noexcept
+{
+    return (Uint32)(((word & 0x8080808080808080ull) * 0x0002040810204081ull) >> 56);
+}
+
+inline FlatHashGroup::FlatHashGroup(const Uint8* controls) noexcept
+{
+    std::memcpy(_controls, controls, Width);
+}
+
+inline Uint32 FlatHashGroup::Match(Uint8 hash) const noexcept
+{
+    constexpr Uint64 LowBits  = 0x0101010101010101ull;
+    constexpr Uint64 HighBits = 0x8080808080808080ull;
+
+    Uint64 pattern = LowBits * hash;
+    Uint64 first   = _controls[0] ^ pattern;
+    Uint64 second  = _controls[1] ^ pattern;
+
+    // Sets the highest bit of the zero bytes, the borrow may set a few more
+    return PackFlatHashGroupBits((first - LowBits) & ~first & HighBits) |
+           (PackFlatHashGroupBits((second - LowBits) & ~second & HighBits) << 8);
+}
+
+inline Uint32 FlatHashGroup::MatchEmpty() const noexcept
+{
+    // Only the empty control byte has the highest bit set
+    return PackFlatHashGroupBits(_controls[0]) | (PackFlatHashGroupBits(_controls[1]) << 8);
+}
+
+#endif
+
+inline Uint32 FlatHashGroup::MatchFull() const noexcept
+{
+    return ~MatchEmpty() & 0xFFFF;
+}
+
+// Finds the first occupied slot at or after the given index, returns `capacity` if there's none.
+inline Size FindFlatHashFullIndex(const Uint8* controls,
+                                  Size         capacity,
+                                  Size         index) noexcept
+{
+    while (index < capacity)
+    {
+        auto full = FlatHashGroup(controls + index).MatchFull();
+
+        // The group may extend to the cloned control bytes of the first slots
+        if (full)
+            return Math::Min(index + (Size)std::countr_zero(full), capacity);
+
+        index += FlatHashGroup::Width;
+    }
+
+    return capacity;
+}
+
+} // namespace Detail
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+template <class Reference, class Pointer>
+struct FlatHashSet<T, Hasher, Comparer, Allocator>::Iterator
+{
+public:
+    using reference  = Reference; ///< Reference type
+    using pointer    = Pointer;   ///< Pointer type
+    using value_type = T;         ///< Value type
+
+    // Converts the non-const iterator to the const iterator
+    template <class OtherReference, class OtherPointer>
+    Iterator(const Iterator<OtherReference, OtherPointer>& other) noexcept requires(std::is_convertible_v<OtherPointer, Pointer>) :
+        _slots(other._slots),
+        _controls(other._controls),
+        _capacity(other._capacity),
+        _index(other._index) {}
+
+    // Array operator
+    pointer operator->() const noexcept { return _slots + _index; }
+
+    // Dereference operator
+    reference operator*() const noexcept { return _slots[_index]; }
+
+    // Pre-increment operator
+    Iterator& operator++() noexcept
+    {
+        _index = Detail::FindFlatHashFullIndex(_controls, _capacity, _index + 1);
+
+        return *this;
+    }
+
+    // Post-increment operator
+    Iterator operator++(int) noexcept
+    {
+        Iterator temp = *this;
+        ++*this;
+        return temp;
+    }
+
+    // Equality operator
+    template <class OtherReference, class OtherPointer>
+    bool operator==(const Iterator<OtherReference, OtherPointer>& other) const noexcept
+    {
+        return _slots + _index == other._slots + other._index;
+    }
+
+    // Inequality operator
+    template <class OtherReference, class OtherPointer>
+    bool operator!=(const Iterator<OtherReference, OtherPointer>& other) const noexcept
+    {
+        return _slots + _index != other._slots + other._index;
+    }
+
+private:
+    // Private constructor
+    Iterator(T*           slots,
+             const Uint8* controls,
+             Size         capacity,
+             Size         index) noexcept :
+        _slots(slots),
+        _controls(controls),
+        _capacity(capacity),
+        _index(index) {}
+
+    T*           _slots    = nullptr; ///< Pointer to the slots
+    const Uint8* _controls = nullptr; ///< Pointer to the control bytes
+    Size         _capacity = 0;       ///< Number of slots
+    Size         _index    = 0;       ///< Index of the current slot
+
+    friend class FlatHashSet;
+
+    template <class, class>
+    friend struct Iterator;
+};
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline FlatHashSet<T, Hasher, Comparer, Allocator>::FlatHashSet(const Allocator& allocator) noexcept :
+    Detail::AllocatorStorage<Allocator>(allocator) {}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline FlatHashSet<T, Hasher, Comparer, Allocator>::~FlatHashSet() noexcept
+{
+    Destroy();
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline FlatHashSet<T, Hasher, Comparer, Allocator>::FlatHashSet(const FlatHashSet& other) requires(std::is_copy_constructible_v<T>) :
+    Detail::AllocatorStorage<Allocator>(other.GetAllocator()),
+    _maxLoadFactor(other._maxLoadFactor),
+    _hasher(other._hasher),
+    _comparer(other._comparer)
+{
+    CopyElements(other);
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline FlatHashSet<T, Hasher, Comparer, Allocator>::FlatHashSet(FlatHashSet&& other) noexcept :
+    Detail::AllocatorStorage<Allocator>(std::move(other.GetAllocatorInstance())),
+    _slots(other._slots),
+    _controls(other._controls),
+    _capacity(other._capacity),
+    _size(other._size),
+    _growthLimit(other._growthLimit),
+    _maxLoadFactor(other._maxLoadFactor),
+    _hasher(std::move(other._hasher)),
+    _comparer(std::move(other._comparer))
+{
+    other._slots       = nullptr;
+    other._controls    = nullptr;
+    other._capacity    = 0;
+    other._size        = 0;
+    other._growthLimit = 0;
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline FlatHashSet<T, Hasher, Comparer, Allocator>& FlatHashSet<T, Hasher, Comparer, Allocator>::operator=(const FlatHashSet& other) requires(std::is_copy_constructible_v<T>)
+{
+    if (this == &other)
+        return *this;
+
+    // Copies into the new table first, keeps this one intact if the copy throws.
+    FlatHashSet copy(this->GetAllocatorInstance());
+
+    copy._maxLoadFactor = other._maxLoadFactor;
+    copy._hasher        = other._hasher;
+    copy._comparer      = other._comparer;
+
+    copy.CopyElements(other);
+
+    return *this = std::move(copy);
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline FlatHashSet<T, Hasher, Comparer, Allocator>& FlatHashSet<T, Hasher, Comparer, Allocator>::operator=(FlatHashSet&& other) noexcept
+{
+    if (this == &other)
+        return *this;
+
+    Destroy();
+
+    // The table is owned by the other's allocator, takes it along.
+    this->GetAllocatorInstance() = std::move(other.GetAllocatorInstance());
+
+    _slots         = other._slots;
+    _controls      = other._controls;
+    _capacity      = other._capacity;
+    _size          = other._size;
+    _growthLimit   = other._growthLimit;
+    _maxLoadFactor = other._maxLoadFactor;
+    _hasher        = std::move(other._hasher);
+    _comparer      = std::move(other._comparer);
+
+    other._slots       = nullptr;
+    other._controls    = nullptr;
+    other._capacity    = 0;
+    other._size        = 0;
+    other._growthLimit = 0;
+
+    return *this;
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline Size FlatHashSet<T, Hasher, Comparer, Allocator>::GetSize() const noexcept
+{
+    return _size;
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline Size FlatHashSet<T, Hasher, Comparer, Allocator>::GetCapacity() const noexcept
+{
+    return _capacity;
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline const Allocator& FlatHashSet<T, Hasher, Comparer, Allocator>::GetAllocator() const noexcept
+{
+    return this->GetAllocatorInstance();
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline Float32 FlatHashSet<T, Hasher, Comparer, Allocator>::GetCurrentLoadFactor() const noexcept
+{
+    return _capacity == 0 ? 0.0f : (Float32)_size / _capacity;
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline Float32 FlatHashSet<T, Hasher, Comparer, Allocator>::GetMaxLoadFactor() const noexcept
+{
+    return _maxLoadFactor;
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline Bool FlatHashSet<T, Hasher, Comparer, Allocator>::SetMaxLoadFactor(Float32 maxLoadFactor) noexcept
+{
+    if (maxLoadFactor <= 0.0f || maxLoadFactor >= 1.0f)
+        return false;
+
+    _maxLoadFactor = maxLoadFactor;
+    _growthLimit   = GetGrowthLimit(_capacity, _maxLoadFactor);
+
+    return true;
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline typename FlatHashSet<T, Hasher, Comparer, Allocator>::const_iterator FlatHashSet<T, Hasher, Comparer, Allocator>::Find(const T& element) const noexcept
+{
+    return FindIndirect<T, const_iterator>(element);
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline Pair<Bool, typename FlatHashSet<T, Hasher, Comparer, Allocator>::iterator> FlatHashSet<T, Hasher, Comparer, Allocator>::Insert(const T& value) requires(std::is_copy_constructible_v<T>)
+{
+    return InsertPerfectForwarding<const T&>(value);
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline Pair<Bool, typename FlatHashSet<T, Hasher, Comparer, Allocator>::iterator> FlatHashSet<T, Hasher, Comparer, Allocator>::Insert(T&& value) requires(std::is_move_constructible_v<T>)
+{
+    return InsertPerfectForwarding<T&&>(std::move(value));
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline void FlatHashSet<T, Hasher, Comparer, Allocator>::Reserve(Size elementSize)
+{
+    if (elementSize <= _growthLimit)
+        return;
+
+    Size capacity = Math::RoundToNextPowerOfTwo(Math::Max(MinimumCapacity, (Size)((Float32)elementSize / _maxLoadFactor) + 1));
+
+    // Makes up for the rounding errors
+    while (GetGrowthLimit(capacity, _maxLoadFactor) < elementSize)
+        capacity *= 2;
+
+    Rehash(capacity);
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline Pair<Bool, typename FlatHashSet<T, Hasher, Comparer, Allocator>::const_iterator> FlatHashSet<T, Hasher, Comparer, Allocator>::Remove(const T& element) noexcept
+{
+    return RemoveIndirect<T, const_iterator>(element);
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline void FlatHashSet<T, Hasher, Comparer, Allocator>::Clear() noexcept
+{
+    if constexpr (!std::is_trivially_destructible_v<T>)
+    {
+        for (Size i = Detail::FindFlatHashFullIndex(_controls, _capacity, 0); i < _capacity; i = Detail::FindFlatHashFullIndex(_controls, _capacity, i + 1))
+            _slots[i].~T();
+    }
+
+    if (_controls)
+        std::memset(_controls, Detail::FlatHashGroup::EmptyControl, _capacity + Detail::FlatHashGroup::Width - 1);
+
+    _size = 0;
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline typename FlatHashSet<T, Hasher, Comparer, Allocator>::const_iterator FlatHashSet<T, Hasher, Comparer, Allocator>::begin() const noexcept
+{
+    return MakeIterator<const_iterator>(Detail::FindFlatHashFullIndex(_controls, _capacity, 0));
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline typename FlatHashSet<T, Hasher, Comparer, Allocator>::const_iterator FlatHashSet<T, Hasher, Comparer, Allocator>::end() const noexcept
+{
+    return MakeIterator<const_iterator>(_capacity);
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline typename FlatHashSet<T, Hasher, Comparer, Allocator>::iterator FlatHashSet<T, Hasher, Comparer, Allocator>::NonConstBegin() noexcept
+{
+    return MakeIterator<iterator>(Detail::FindFlatHashFullIndex(_controls, _capacity, 0));
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline typename FlatHashSet<T, Hasher, Comparer, Allocator>::iterator FlatHashSet<T, Hasher, Comparer, Allocator>::NonConstEnd() noexcept
+{
+    return MakeIterator<iterator>(_capacity);
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+template <class IndirectType, class IteratorVariant>
+inline IteratorVariant FlatHashSet<T, Hasher, Comparer, Allocator>::FindIndirect(const IndirectType& element) const noexcept
+{
+    if (_size == 0)
+        return MakeIterator<IteratorVariant>(_capacity);
+
+    return MakeIterator<IteratorVariant>(FindIndex(element, MixHash(_hasher(element))));
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+template <class IndirectType, class IteratorVariant>
+inline Pair<Bool, IteratorVariant> FlatHashSet<T, Hasher, Comparer, Allocator>::RemoveIndirect(const IndirectType& element) noexcept
+{
+    if (_size == 0)
+        return {false, MakeIterator<IteratorVariant>(_capacity)};
+
+    Size index = FindIndex(element, MixHash(_hasher(element)));
+
+    if (index == _capacity)
+        return {false, MakeIterator<IteratorVariant>(_capacity)};
+
+    RemoveAtIndex(index);
+
+    // The following element may have been shifted into the removed slot
+    return {true, MakeIterator<IteratorVariant>(Detail::FindFlatHashFullIndex(_controls, _capacity, index))};
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+template <class IndirectType>
+inline Size FlatHashSet<T, Hasher, Comparer, Allocator>::FindIndex(const IndirectType& element,
+                                                                    Size                hash) const noexcept
+{
+    Size  mask    = _capacity - 1;
+    Size  index   = (hash >> 7) & mask;
+    Uint8 control = (Uint8)(hash & 0x7F);
+
+    while (true)
+    {
+        Detail::FlatHashGroup group(_controls + index);
+
+        auto match = group.Match(control);
+        auto empty = group.MatchEmpty();
+
+        // Linear probing never leaves an empty slot between the element and its home slot
+        if (empty)
+            match &= (empty & (0u - empty)) - 1;
+
+        while (match)
+        {
+            Size slot = (index + (Size)std::countr_zero(match)) & mask;
+
+            if (_comparer(_slots[slot], element))
+                return slot;
+
+            match &= match - 1;
+        }
+
+        if (empty)
+            return _capacity;
+
+        index = (index + Detail::FlatHashGroup::Width) & mask;
+    }
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+template <class... Args>
+inline Pair<Bool, typename FlatHashSet<T, Hasher, Comparer, Allocator>::iterator> FlatHashSet<T, Hasher, Comparer, Allocator>::InsertPerfectForwarding(Args&&... args)
+{
+    Size hash = MixHash(_hasher(args...));
+
+    if (_size != 0)
+    {
+        Size index = FindIndex(args..., hash);
+
+        if (index != _capacity)
+            return {false, MakeIterator<iterator>(index)};
+    }
+
+    // The element isn't in the table, so the arguments can't refer to the elements being moved
+    if (_size >= _growthLimit)
+        Rehash(_capacity == 0 ? MinimumCapacity : _capacity * 2);
+
+    Size index = FindEmptyIndex(hash);
+
+    new (_slots + index) T(std::forward<Args>(args)...);
+
+    SetControl(index, (Uint8)(hash & 0x7F));
+
+    ++_size;
+
+    return {true, MakeIterator<iterator>(index)};
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline Size FlatHashSet<T, Hasher, Comparer, Allocator>::FindEmptyIndex(Size hash) const noexcept
+{
+    Size mask  = _capacity - 1;
+    Size index = (hash >> 7) & mask;
+
+    while (true)
+    {
+        auto empty = Detail::FlatHashGroup(_controls + index).MatchEmpty();
+
+        if (empty)
+            return (index + (Size)std::countr_zero(empty)) & mask;
+
+        index = (index + Detail::FlatHashGroup::Width) & mask;
+    }
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline void FlatHashSet<T, Hasher, Comparer, Allocator>::Rehash(Size capacity)
+{
+    auto memory = (Byte*)this->GetAllocatorInstance().Allocate(capacity * sizeof(T) + capacity + Detail::FlatHashGroup::Width - 1, alignof(T));
+
+    T*     oldSlots    = _slots;
+    Uint8* oldControls = _controls;
+    Size   oldCapacity = _capacity;
+
+    _slots       = (T*)memory;
+    _controls    = memory + capacity * sizeof(T);
+    _capacity    = capacity;
+    _growthLimit = GetGrowthLimit(capacity, _maxLoadFactor);
+
+    std::memset(_controls, Detail::FlatHashGroup::EmptyControl, capacity + Detail::FlatHashGroup::Width - 1);
+
+    if constexpr (TriviallyRelocatable<T> || std::is_nothrow_move_constructible_v<T>)
+    {
+        for (Size i = Detail::FindFlatHashFullIndex(oldControls, oldCapacity, 0); i < oldCapacity; i = Detail::FindFlatHashFullIndex(oldControls, oldCapacity, i + 1))
+        {
+            Size hash  = MixHash(_hasher(oldSlots[i]));
+            Size index = FindEmptyIndex(hash);
+
+            if constexpr (TriviallyRelocatable<T>)
+                std::memcpy((PVoid)(_slots + index), oldSlots + i, sizeof(T));
+            else
+            {
+                new (_slots + index) T(std::move(oldSlots[i]));
+                oldSlots[i].~T();
+            }
+
+            SetControl(index, (Uint8)(hash & 0x7F));
+        }
+    }
+    else
+    {
+        // Copies the elements, keeps the old table intact if the copy throws.
+        try
+        {
+            for (Size i = Detail::FindFlatHashFullIndex(oldControls, oldCapacity, 0); i < oldCapacity; i = Detail::FindFlatHashFullIndex(oldControls, oldCapacity, i + 1))
+            {
+                Size hash  = MixHash(_hasher(oldSlots[i]));
+                Size index = FindEmptyIndex(hash);
+
+                new (_slots + index) T(oldSlots[i]);
+
+                SetControl(index, (Uint8)(hash & 0x7F));
+            }
+        }
+        catch (...)
+        {
+            for (Size i = Detail::FindFlatHashFullIndex(_controls, _capacity, 0); i < _capacity; i = Detail::FindFlatHashFullIndex(_controls, _capacity, i + 1))
+                _slots[i].~T();
+
+            this->GetAllocatorInstance().Deallocate(memory);
+
+            _slots       = oldSlots;
+            _controls    = oldControls;
+            _capacity    = oldCapacity;
+            _growthLimit = GetGrowthLimit(oldCapacity, _maxLoadFactor);
+
+            throw;
+        }
+
+        for (Size i = Detail::FindFlatHashFullIndex(oldControls, oldCapacity, 0); i < oldCapacity; i = Detail::FindFlatHashFullIndex(oldControls, oldCapacity, i + 1))
+            oldSlots[i].~T();
+    }
+
+    if (oldSlots)
+        this->GetAllocatorInstance().Deallocate(oldSlots);
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline void FlatHashSet<T, Hasher, Comparer, Allocator>::RemoveAtIndex(Size index) noexcept
+{
+    _slots[index].~T();
+
+    Size mask = _capacity - 1;
+    Size hole = index;
+    Size next = (hole + 1) & mask;
+
+    // Shifts the following elements of the probe sequence backward, no tombstone is left behind.
+    while (_controls[next] != Detail::FlatHashGroup::EmptyControl)
+    {
+        Size home = (MixHash(_hasher(_slots[next])) >> 7) & mask;
+
+        // The element can't move before its home slot
+        if (((next - home) & mask) >= ((next - hole) & mask))
+        {
+            RelocateSlot(next, hole);
+
+            hole = next;
+        }
+
+        next = (next + 1) & mask;
+    }
+
+    SetControl(hole, Detail::FlatHashGroup::EmptyControl);
+
+    --_size;
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline void FlatHashSet<T, Hasher, Comparer, Allocator>::SetControl(Size  index,
+                                                                     Uint8 control) noexcept
+{
+    _controls[index] = control;
+
+    // Clones the control bytes of the first slots after the end, so the group can be loaded at any slot.
+    if (index < Detail::FlatHashGroup::Width - 1)
+        _controls[_capacity + index] = control;
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline void FlatHashSet<T, Hasher, Comparer, Allocator>::RelocateSlot(Size from,
+                                                                       Size to) noexcept
+{
+    if constexpr (TriviallyRelocatable<T>)
+        std::memcpy((PVoid)(_slots + to), _slots + from, sizeof(T));
+    else
+    {
+        new (_slots + to) T(std::move(_slots[from]));
+        _slots[from].~T();
+    }
+
+    SetControl(to, _controls[from]);
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline void FlatHashSet<T, Hasher, Comparer, Allocator>::CopyElements(const FlatHashSet& other) requires(std::is_copy_constructible_v<T>)
+{
+    if (other._size == 0)
+        return;
+
+    // Keeps the same layout, the elements don't have to be rehashed.
+    auto memory   = (Byte*)this->GetAllocatorInstance().Allocate(other._capacity * sizeof(T) + other._capacity + Detail::FlatHashGroup::Width - 1, alignof(T));
+    auto slots    = (T*)memory;
+    auto controls = memory + other._capacity * sizeof(T);
+
+    std::memcpy(controls, other._controls, other._capacity + Detail::FlatHashGroup::Width - 1);
+
+    if constexpr (std::is_trivially_copy_constructible_v<T>)
+        std::memcpy((PVoid)slots, other._slots, other._capacity * sizeof(T));
+    else
+    {
+        Size i = Detail::FindFlatHashFullIndex(other._controls, other._capacity, 0);
+
+        try
+        {
+            for (; i < other._capacity; i = Detail::FindFlatHashFullIndex(other._controls, other._capacity, i + 1))
+                new (slots + i) T(other._slots[i]);
+        }
+        catch (...)
+        {
+            for (Size j = Detail::FindFlatHashFullIndex(other._controls, other._capacity, 0); j < i; j = Detail::FindFlatHashFullIndex(other._controls, other._capacity, j + 1))
+                slots[j].~T();
+
+            this->GetAllocatorInstance().Deallocate(memory);
+
+            throw;
+        }
+    }
+
+    _slots       = slots;
+    _controls    = controls;
+    _capacity    = other._capacity;
+    _size        = other._size;
+    _growthLimit = GetGrowthLimit(other._capacity, _maxLoadFactor);
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline void FlatHashSet<T, Hasher, Comparer, Allocator>::Destroy() noexcept
+{
+    if (!_slots)
+        return;
+
+    if constexpr (!std::is_trivially_destructible_v<T>)
+    {
+        for (Size i = Detail::FindFlatHashFullIndex(_controls, _capacity, 0); i < _capacity; i = Detail::FindFlatHashFullIndex(_controls, _capacity, i + 1))
+            _slots[i].~T();
+    }
+
+    this->GetAllocatorInstance().Deallocate(_slots);
+
+    _slots       = nullptr;
+    _controls    = nullptr;
+    _capacity    = 0;
+    _size        = 0;
+    _growthLimit = 0;
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+template <class IteratorVariant>
+inline IteratorVariant FlatHashSet<T, Hasher, Comparer, Allocator>::MakeIterator(Size index) const noexcept
+{
+    return IteratorVariant(_slots, _controls, _capacity, index);
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline Size FlatHashSet<T, Hasher, Comparer, Allocator>::MixHash(Size hash) noexcept
+{
+    // Spreads the bits of the weak hashes (e.g. the integers' identity hash) over the whole word,
+    // the lowest 7 bits go to the control byte and the rest selects the home slot.
+    Uint64 mixed = (Uint64)hash * 0x9E3779B97F4A7C15ull;
+
+    return (Size)(mixed ^ (mixed >> 32));
+}
+
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline Size FlatHashSet<T, Hasher, Comparer, Allocator>::GetGrowthLimit(Size    capacity,
+                                                                         Float32 maxLoadFactor) noexcept
+{
+    // At least one slot is always left empty to terminate the probing
+    return capacity == 0 ? 0 : Math::Min((Size)((Float32)capacity * maxLoadFactor), capacity - 1);
+}
+
+} // namespace System
+
+} // namespace Axis
+
+#endif // AXIS_SYSTEM_FLATHASHSETIMPL_INL
@@ -8,6 +8,7 @@
 
 #include "../../Include/Axis/Exception.hpp"
 #include "../../Include/Axis/Function.hpp"
+#include <cstring>
 
 namespace Axis
 {
@@ -15,272 +16,326 @@ namespace Axis
 namespace System
 {
 
-namespace Private
+namespace Detail
 {
 
-template <class Functor, class ReturnType, class... Args>
-inline constexpr ReturnType InvokeFunction(Functor* functor, Args&&... args)
+// Functor stored in the inline buffer of the function object.
+template <class Functor, AllocatorType Allocator>
+struct InlineFunctor
 {
-    return (*functor)(std::forward<Args>(args)...);
-}
+    static Functor& Get(PVoid storage) noexcept { return *static_cast<Functor*>(storage); }
 
-template <class Functor>
-inline constexpr void DestructFunction(Functor* functor)
-{
-    functor->~Functor();
-}
+    static void Copy(PVoid destination, CPVoid source, Allocator&) { new (destination) Functor(*static_cast<const Functor*>(source)); }
 
-template <class Functor>
-inline constexpr void CopyConstructFunction(Functor* dest, const Functor* source)
-{
-    new (dest) Functor(*source);
-}
+    static void Relocate(PVoid destination, PVoid source) noexcept
+    {
+        new (destination) Functor(std::move(Get(source)));
+        Get(source).~Functor();
+    }
 
-template <class Functor>
-inline constexpr void MoveConstructFunction(Functor* dest, Functor* source)
-{
-    new (dest) Functor(std::move(*source));
-}
+    static void Destroy(PVoid storage, Allocator&) noexcept { Get(storage).~Functor(); }
 
-template <class Functor, class ReturnType, class... Args>
-struct VTableImpl
-{
-    using InvokePtr        = ReturnType (*)(Functor*, Args&&...);
-    using DestructorPtr    = void (*)(Functor*);
-    using CopyConstructPtr = void (*)(Functor*, const Functor*);
-    using MoveConstructPtr = void (*)(Functor*, Functor*);
-
-    InvokePtr        Invoke        = nullptr; // Invokes the functor's operator()
-    DestructorPtr    Destruct      = nullptr; // Invokes the functor's destructor
-    CopyConstructPtr CopyConstruct = nullptr; // Invokes copy constructor
-    MoveConstructPtr MoveConstruct = nullptr; // Invokes copy constructor
+    // The bytes of the trivial functors are copied, and there's nothing to destroy.
+    static constexpr Bool IsRelocatedByBytes = std::is_trivially_copyable_v<Functor>;
+    static constexpr Bool IsDestroyed        = !std::is_trivially_destructible_v<Functor>;
 };
 
-template <class Functor, class ReturnType, class... Args>
-inline constexpr auto CreateVTable() noexcept
+// Functor allocated from the allocator, the storage holds the pointer to it.
+template <class Functor, AllocatorType Allocator>
+struct AllocatedFunctor
 {
-    VTableImpl<Functor, ReturnType, Args...> table = {};
-    table.Invoke                                   = InvokeFunction<Functor, ReturnType, Args...>;
-    table.Destruct                                 = DestructFunction<Functor>;
-    table.CopyConstruct                            = CopyConstructFunction<Functor>;
-    table.MoveConstruct                            = MoveConstructFunction<Functor>;
-    return table;
-}
-
-template <class Functor, class ReturnType, class... Args>
-inline constexpr auto VTable = CreateVTable<Functor, ReturnType, Args...>();
-
-} // namespace Private
+    static Functor& Get(PVoid storage) noexcept { return **static_cast<Functor**>(storage); }
 
-template <AllocatorType Allocator, class ReturnType, class... Args>
-Function<ReturnType(Args...), Allocator>::Function() noexcept {}
-
-template <AllocatorType Allocator, class ReturnType, class... Args>
-Function<ReturnType(Args...), Allocator>::Function(decltype(nullptr)) noexcept {}
-
-template <AllocatorType Allocator, class ReturnType, class... Args>
-template <Callable<ReturnType, Args...> Functor, typename>
-Function<ReturnType(Args...), Allocator>::Function(const Functor& f) :
-    _pVtable(reinterpret_cast<const typename Function<ReturnType(Args...), Allocator>::VTable*>(&Private::VTable<Functor, ReturnType, Args...>)),
-    _dynamicBufferSize(sizeof(Functor) > SmallBufferOptimizationSize ? sizeof(Functor) : 0)
-{
-    if (_pVtable)
+    static void Copy(PVoid destination, CPVoid source, Allocator& allocator)
     {
-        if (_dynamicBufferSize)
-        {
-            DynamicBuffer = Allocator::Allocate(_dynamicBufferSize, alignof(std::max_align_t));
+        PVoid buffer = allocator.Allocate(sizeof(Functor), alignof(Functor));
 
-            _pVtable->CopyConstruct(DynamicBuffer, std::addressof(f));
+        try
+        {
+            new (buffer) Functor(**static_cast<Functor* const*>(source));
         }
-        else
+        catch (...)
         {
-            _pVtable->CopyConstruct(Storage.GetStoragePtr(), std::addressof(f));
+            allocator.Deallocate(buffer);
+            throw;
         }
+
+        *static_cast<Functor**>(destination) = static_cast<Functor*>(buffer);
+    }
+
+    static void Destroy(PVoid storage, Allocator& allocator) noexcept
+    {
+        Get(storage).~Functor();
+        allocator.Deallocate(*static_cast<Functor**>(storage));
     }
+
+    // Only the pointer is moved along.
+    static constexpr Bool IsRelocatedByBytes = true;
+    static constexpr Bool IsDestroyed        = true;
+};
+
+template <class Storage, class Functor, class ReturnType, class... Args>
+inline ReturnType InvokeFunctor(PVoid storage, Args&&... args)
+{
+    return Storage::Get(storage)(std::forward<Args>(args)...);
 }
 
-template <AllocatorType Allocator, class ReturnType, class... Args>
-template <Callable<ReturnType, Args...> Functor, typename>
-Function<ReturnType(Args...), Allocator>::Function(Functor&& f) :
-    _pVtable(reinterpret_cast<const typename Function<ReturnType(Args...), Allocator>::VTable*>(&Private::VTable<Functor, ReturnType, Args...>)),
-    _dynamicBufferSize(sizeof(Functor) > SmallBufferOptimizationSize ? sizeof(Functor) : 0)
+template <class Storage, class Functor, AllocatorType Allocator, Bool Copyable, class ReturnType, class... Args>
+inline constexpr auto CreateFunctorVTable() noexcept
 {
-    if (_pVtable)
-    {
-        if (_dynamicBufferSize)
-        {
-            DynamicBuffer = Allocator::Allocate(_dynamicBufferSize, alignof(std::max_align_t));
+    FunctionVTable<Allocator, ReturnType, Args...> table = {};
+    table.Invoke = InvokeFunctor<Storage, Functor, ReturnType, Args...>;
 
-            _pVtable->MoveConstruct(DynamicBuffer, std::addressof(f));
-        }
-        else
-        {
-            _pVtable->MoveConstruct(Storage.GetStoragePtr(), std::addressof(f));
-        }
-    }
+    if constexpr (Copyable)
+        table.Copy = Storage::Copy;
+
+    if constexpr (!Storage::IsRelocatedByBytes)
+        table.Relocate = Storage::Relocate;
+
+    if constexpr (Storage::IsDestroyed)
+        table.Destroy = Storage::Destroy;
+
+    table.IsInline = std::is_same_v<Storage, InlineFunctor<Functor, Allocator>>;
+
+    return table;
 }
 
-template <AllocatorType Allocator, class ReturnType, class... Args>
-Function<ReturnType(Args...), Allocator>::Function(const Function& other) :
-    _pVtable(other._pVtable),
-    _dynamicBufferSize(other._dynamicBufferSize)
+template <class Storage, class Functor, AllocatorType Allocator, Bool Copyable, class ReturnType, class... Args>
+inline constexpr auto FunctorVTable = CreateFunctorVTable<Storage, Functor, Allocator, Copyable, ReturnType, Args...>();
+
+template <AllocatorType Allocator, Size InlineSize, Bool Copyable, class ReturnType, class... Args>
+inline BasicFunction<ReturnType(Args...), Allocator, InlineSize, Copyable>::BasicFunction(NullptrType) noexcept(std::is_nothrow_default_constructible_v<Allocator>) {}
+
+template <AllocatorType Allocator, Size InlineSize, Bool Copyable, class ReturnType, class... Args>
+template <class Functor>
+inline BasicFunction<ReturnType(Args...), Allocator, InlineSize, Copyable>::BasicFunction(Functor&& f) requires(StorableFunctor<std::decay_t<Functor>, Copyable, ReturnType, Args...> && !std::is_same_v<std::decay_t<Functor>, BasicFunction>)
 {
-    if (_pVtable)
-    {
-        if (_dynamicBufferSize)
-        {
-            DynamicBuffer = Allocator::Allocate(_dynamicBufferSize, alignof(std::max_align_t));
+    Construct(std::forward<Functor>(f));
+}
 
-            _pVtable->CopyConstruct(DynamicBuffer, other.DynamicBuffer);
-        }
-        else
-        {
-            _pVtable->CopyConstruct(Storage.GetStoragePtr(), other.Storage.GetStoragePtr());
-        }
-    }
+template <AllocatorType Allocator, Size InlineSize, Bool Copyable, class ReturnType, class... Args>
+template <class Functor>
+inline BasicFunction<ReturnType(Args...), Allocator, InlineSize, Copyable>::BasicFunction(Functor&&        f,
+                                                                                        const Allocator& allocator) requires(StorableFunctor<std::decay_t<Functor>, Copyable, ReturnType, Args...> && !std::is_same_v<std::decay_t<Functor>, BasicFunction>) :
+    Detail::AllocatorStorage<Allocator>(allocator)
+{
+    Construct(std::forward<Functor>(f));
 }
 
-template <AllocatorType Allocator, class ReturnType, class... Args>
-Function<ReturnType(Args...), Allocator>::Function(Function&& other) noexcept :
-    _pVtable(other._pVtable),
-    _dynamicBufferSize(other._dynamicBufferSize)
+template <AllocatorType Allocator, Size InlineSize, Bool Copyable, class ReturnType, class... Args>
+inline BasicFunction<ReturnType(Args...), Allocator, InlineSize, Copyable>::BasicFunction(const BasicFunction& other) requires(Copyable) :
+    Detail::AllocatorStorage<Allocator>(other.GetAllocator())
 {
-    if (_pVtable)
+    if (other._pVtable)
     {
-        if (_dynamicBufferSize)
-            DynamicBuffer = other.DynamicBuffer;
-        else
-        {
-            _pVtable->MoveConstruct(Storage.GetStoragePtr(), other.Storage.GetStoragePtr());
-            _pVtable->Destruct(other.Storage.GetStoragePtr());
-        }
+        other._pVtable->Copy(_storage.GetStoragePtr(), other._storage.GetStoragePtr(), this->GetAllocatorInstance());
+
+        _pVtable = other._pVtable;
     }
+}
 
-    other._pVtable           = nullptr;
-    other._dynamicBufferSize = 0;
+template <AllocatorType Allocator, Size InlineSize, Bool Copyable, class ReturnType, class... Args>
+inline BasicFunction<ReturnType(Args...), Allocator, InlineSize, Copyable>::BasicFunction(BasicFunction&& other) noexcept :
+    Detail::AllocatorStorage<Allocator>(std::move(other.GetAllocatorInstance()))
+{
+    Take(other);
 }
 
-template <AllocatorType Allocator, class ReturnType, class... Args>
-Function<ReturnType(Args...), Allocator>::~Function() noexcept
+template <AllocatorType Allocator, Size InlineSize, Bool Copyable, class ReturnType, class... Args>
+inline BasicFunction<ReturnType(Args...), Allocator, InlineSize, Copyable>::~BasicFunction() noexcept
 {
     Destroy();
 }
 
-template <AllocatorType Allocator, class ReturnType, class... Args>
-ReturnType Function<ReturnType(Args...), Allocator>::operator()(Args&&... args)
+template <AllocatorType Allocator, Size InlineSize, Bool Copyable, class ReturnType, class... Args>
+inline ReturnType BasicFunction<ReturnType(Args...), Allocator, InlineSize, Copyable>::operator()(Args... args)
 {
     if (!_pVtable)
         throw InvalidOperationException("Attempted to call a null function");
 
-    return _pVtable->Invoke(_dynamicBufferSize ? DynamicBuffer : Storage.GetStoragePtr(), std::forward<Args>(args)...);
+    return _pVtable->Invoke(_storage.GetStoragePtr(), std::forward<Args>(args)...);
 }
 
-template <AllocatorType Allocator, class ReturnType, class... Args>
-Function<ReturnType(Args...), Allocator>& Function<ReturnType(Args...), Allocator>::operator=(const Function& other)
+template <AllocatorType Allocator, Size InlineSize, Bool Copyable, class ReturnType, class... Args>
+inline BasicFunction<ReturnType(Args...), Allocator, InlineSize, Copyable>& BasicFunction<ReturnType(Args...), Allocator, InlineSize, Copyable>::operator=(const BasicFunction& other) requires(Copyable)
 {
     if (this == std::addressof(other))
         return *this;
 
-    if (other._pVtable)
+    if (!other._pVtable)
     {
-        // Allocates a new buffer if necessary
-        if (other._dynamicBufferSize)
-        {
-            auto newBuffer = Allocator::Allocate(other._dynamicBufferSize, alignof(std::max_align_t));
-
-            other._pVtable->CopyConstruct(newBuffer, other.DynamicBuffer);
+        Destroy();
+        return *this;
+    }
 
-            Destroy();
+    // Copies to the temporary storage first, leaves this object untouched if the copy throws.
+    Storage copiedFunctor;
+    other._pVtable->Copy(copiedFunctor.GetStoragePtr(), other._storage.GetStoragePtr(), this->GetAllocatorInstance());
 
-            DynamicBuffer = newBuffer;
-        }
-        else
-        {
-            Destroy();
+    Destroy();
 
-            other._pVtable->CopyConstruct(Storage.GetStoragePtr(), other.Storage.GetStoragePtr());
-        }
-    }
-    else
-        Destroy();
+    Relocate(other._pVtable, _storage, copiedFunctor);
 
-    _pVtable           = other._pVtable;
-    _dynamicBufferSize = other._dynamicBufferSize;
+    _pVtable = other._pVtable;
 
     return *this;
 }
 
-template <AllocatorType Allocator, class ReturnType, class... Args>
-Function<ReturnType(Args...), Allocator>& Function<ReturnType(Args...), Allocator>::operator=(Function&& other) noexcept
+template <AllocatorType Allocator, Size InlineSize, Bool Copyable, class ReturnType, class... Args>
+inline BasicFunction<ReturnType(Args...), Allocator, InlineSize, Copyable>& BasicFunction<ReturnType(Args...), Allocator, InlineSize, Copyable>::operator=(BasicFunction&& other) noexcept
 {
     if (this == std::addressof(other))
         return *this;
 
     Destroy();
 
-    _pVtable           = other._pVtable;
-    _dynamicBufferSize = other._dynamicBufferSize;
+    // The allocated functor is owned by the other's allocator, takes it along.
+    this->GetAllocatorInstance() = std::move(other.GetAllocatorInstance());
 
-    other._pVtable           = nullptr;
-    other._dynamicBufferSize = 0;
-
-    if (_pVtable)
-    {
-        if (_dynamicBufferSize)
-            DynamicBuffer = other.DynamicBuffer;
-        else
-        {
-            _pVtable->MoveConstruct(Storage.GetStoragePtr(), other.Storage.GetStoragePtr());
-
-            _pVtable->Destruct(other.Storage.GetStoragePtr());
-        }
-    }
+    Take(other);
 
     return *this;
 }
 
-template <AllocatorType Allocator, class ReturnType, class... Args>
-Bool Function<ReturnType(Args...), Allocator>::operator==(decltype(nullptr)) const noexcept
+template <AllocatorType Allocator, Size InlineSize, Bool Copyable, class ReturnType, class... Args>
+inline Bool BasicFunction<ReturnType(Args...), Allocator, InlineSize, Copyable>::operator==(NullptrType) const noexcept
 {
     return _pVtable == nullptr;
 }
 
-template <AllocatorType Allocator, class ReturnType, class... Args>
-Bool Function<ReturnType(Args...), Allocator>::operator!=(decltype(nullptr)) const noexcept
+template <AllocatorType Allocator, Size InlineSize, Bool Copyable, class ReturnType, class... Args>
+inline Bool BasicFunction<ReturnType(Args...), Allocator, InlineSize, Copyable>::operator!=(NullptrType) const noexcept
 {
     return _pVtable != nullptr;
 }
 
-template <AllocatorType Allocator, class ReturnType, class... Args>
-Function<ReturnType(Args...), Allocator>& Function<ReturnType(Args...), Allocator>::operator=(decltype(nullptr)) noexcept
+template <AllocatorType Allocator, Size InlineSize, Bool Copyable, class ReturnType, class... Args>
+inline BasicFunction<ReturnType(Args...), Allocator, InlineSize, Copyable>& BasicFunction<ReturnType(Args...), Allocator, InlineSize, Copyable>::operator=(NullptrType) noexcept
 {
     Destroy();
 
-    _pVtable = nullptr;
-
     return *this;
 }
 
-template <AllocatorType Allocator, class ReturnType, class... Args>
-Function<ReturnType(Args...), Allocator>::operator Bool() const noexcept
+template <AllocatorType Allocator, Size InlineSize, Bool Copyable, class ReturnType, class... Args>
+inline BasicFunction<ReturnType(Args...), Allocator, InlineSize, Copyable>::operator Bool() const noexcept
 {
     return _pVtable != nullptr;
 }
 
-template <AllocatorType Allocator, class ReturnType, class... Args>
-void Function<ReturnType(Args...), Allocator>::Destroy() noexcept
+template <AllocatorType Allocator, Size InlineSize, Bool Copyable, class ReturnType, class... Args>
+inline Bool BasicFunction<ReturnType(Args...), Allocator, InlineSize, Copyable>::IsInline() const noexcept
 {
-    if (_pVtable)
+    return _pVtable && _pVtable->IsInline;
+}
+
+template <AllocatorType Allocator, Size InlineSize, Bool Copyable, class ReturnType, class... Args>
+inline const Allocator& BasicFunction<ReturnType(Args...), Allocator, InlineSize, Copyable>::GetAllocator() const noexcept
+{
+    return this->GetAllocatorInstance();
+}
+
+template <AllocatorType Allocator, Size InlineSize, Bool Copyable, class ReturnType, class... Args>
+template <class Functor>
+inline void BasicFunction<ReturnType(Args...), Allocator, InlineSize, Copyable>::Construct(Functor&& f)
+{
+    using FunctorType = std::decay_t<Functor>;
+
+    constexpr Bool IsInline = sizeof(FunctorType) <= StorageSize && alignof(FunctorType) <= StorageAlignment && std::is_nothrow_move_constructible_v<FunctorType>;
+
+    if constexpr (IsInline)
     {
-        _pVtable->Destruct(_dynamicBufferSize ? DynamicBuffer : Storage.GetStoragePtr());
+        new (_storage.GetStoragePtr()) FunctorType(std::forward<Functor>(f));
 
-        if (_dynamicBufferSize)
-            Allocator::Deallocate(DynamicBuffer);
+        _pVtable = &FunctorVTable<InlineFunctor<FunctorType, Allocator>, FunctorType, Allocator, Copyable, ReturnType, Args...>;
     }
+    else
+    {
+        PVoid buffer = this->GetAllocatorInstance().Allocate(sizeof(FunctorType), alignof(FunctorType));
+
+        try
+        {
+            new (buffer) FunctorType(std::forward<Functor>(f));
+        }
+        catch (...)
+        {
+            this->GetAllocatorInstance().Deallocate(buffer);
+            throw;
+        }
+
+        *static_cast<FunctorType**>(_storage.GetStoragePtr()) = static_cast<FunctorType*>(buffer);
+
+        _pVtable = &FunctorVTable<AllocatedFunctor<FunctorType, Allocator>, FunctorType, Allocator, Copyable, ReturnType, Args...>;
+    }
+}
+
+template <AllocatorType Allocator, Size InlineSize, Bool Copyable, class ReturnType, class... Args>
+inline void BasicFunction<ReturnType(Args...), Allocator, InlineSize, Copyable>::Take(BasicFunction& other) noexcept
+{
+    if (other._pVtable)
+    {
+        Relocate(other._pVtable, _storage, other._storage);
+
+        _pVtable       = other._pVtable;
+        other._pVtable = nullptr;
+    }
+}
+
+template <AllocatorType Allocator, Size InlineSize, Bool Copyable, class ReturnType, class... Args>
+inline void BasicFunction<ReturnType(Args...), Allocator, InlineSize, Copyable>::Destroy() noexcept
+{
+    if (_pVtable && _pVtable->Destroy)
+        _pVtable->Destroy(_storage.GetStoragePtr(), this->GetAllocatorInstance());
+
+    _pVtable = nullptr;
+}
+
+template <AllocatorType Allocator, Size InlineSize, Bool Copyable, class ReturnType, class... Args>
+inline void BasicFunction<ReturnType(Args...), Allocator, InlineSize, Copyable>::Relocate(const VTable* vtable,
+                                                                                        Storage&      destination,
+                                                                                        Storage&      source) noexcept
+{
+    if (vtable->Relocate)
+        vtable->Relocate(destination.GetStoragePtr(), source.GetStoragePtr());
+    else
+        std::memcpy(destination.GetStoragePtr(), source.GetStoragePtr(), StorageSize);
+}
+
+} // namespace Detail
+
+template <class ReturnType, class... Args>
+template <class Functor>
+inline FunctionRef<ReturnType(Args...)>::FunctionRef(Functor&& f) noexcept requires(std::is_invocable_r_v<ReturnType, Functor&, Args...> && !std::is_same_v<std::decay_t<Functor>, FunctionRef>)
+{
+    using FunctorType = std::remove_reference_t<Functor>;
+
+    if constexpr (std::is_function_v<std::remove_pointer_t<std::decay_t<Functor>>>)
+    {
+        // Stores the function pointer itself, nothing to outlive.
+        using FunctionPtr = std::decay_t<Functor>;
+
+        _target.Function = reinterpret_cast<void (*)()>(static_cast<FunctionPtr>(f));
+        _pInvoke         = [](Target target, Args&&... args) -> ReturnType {
+            return static_cast<ReturnType>(reinterpret_cast<FunctionPtr>(target.Function)(std::forward<Args>(args)...));
+        };
+    }
+    else
+    {
+        _target.Object = const_cast<PVoid>(static_cast<CPVoid>(std::addressof(f)));
+        _pInvoke       = [](Target target, Args&&... args) -> ReturnType {
+            return static_cast<ReturnType>((*static_cast<FunctorType*>(target.Object))(std::forward<Args>(args)...));
+        };
+    }
+}
+
+template <class ReturnType, class... Args>
+inline ReturnType FunctionRef<ReturnType(Args...)>::operator()(Args... args) const
+{
+    return _pInvoke(_target, std::forward<Args>(args)...);
 }
 
 } // namespace System
 
 } // namespace Axis
 
-#endif // AXIS_SYSTEM_FUNCTIONIMPL_INL
\ No newline at end of file
+#endif // AXIS_SYSTEM_FUNCTIONIMPL_INL
@@ -22,8 +22,13 @@ inline HashSet<T, Hasher, Comparer, Allocator>::~HashSet() noexcept
         ClearInternal<true>(_pTable, _capacity);
 }
 
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline HashSet<T, Hasher, Comparer, Allocator>::HashSet(const Allocator& allocator) noexcept :
+    Detail::AllocatorStorage<Allocator>(allocator) {}
+
 template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
 inline HashSet<T, Hasher, Comparer, Allocator>::HashSet(const HashSet<T, Hasher, Comparer, Allocator>& other) requires(std::is_copy_constructible_v<T>) :
+    Detail::AllocatorStorage<Allocator>(other.GetAllocator()),
     _maxLoadFactor(other._maxLoadFactor),
     _hasher(other._hasher),
     _comparer(other._comparer)
@@ -74,6 +79,7 @@ inline HashSet<T, Hasher, Comparer, Allocator>::HashSet(const HashSet<T, Hasher,
 
 template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
 inline HashSet<T, Hasher, Comparer, Allocator>::HashSet(HashSet<T, Hasher, Comparer, Allocator>&& other) noexcept :
+    Detail::AllocatorStorage<Allocator>(std::move(other.GetAllocatorInstance())),
     _maxLoadFactor(other._maxLoadFactor),
     _hasher(std::move(other._hasher)),
     _comparer(std::move(other._comparer))
@@ -189,6 +195,9 @@ inline HashSet<T, Hasher, Comparer, Allocator>& HashSet<T, Hasher, Comparer, All
 
     ClearInternal<true>(_pTable, _capacity);
 
+    // The nodes are owned by the other's allocator, takes it along.
+    this->GetAllocatorInstance() = std::move(other.GetAllocatorInstance());
+
     _pTable    = other._pTable;
     _capacity  = other._capacity;
     _nodeCount = other._nodeCount;
@@ -295,6 +304,12 @@ inline Size HashSet<T, Hasher, Comparer, Allocator>::GetSize() const noexcept
     return _nodeCount;
 }
 
+template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
+inline const Allocator& HashSet<T, Hasher, Comparer, Allocator>::GetAllocator() const noexcept
+{
+    return this->GetAllocatorInstance();
+}
+
 template <RawType T, HasherType<T> Hasher, ComparerType<T> Comparer, AllocatorType Allocator>
 inline Float32 HashSet<T, Hasher, Comparer, Allocator>::GetCurrentLoadFactor() const noexcept
 {
@@ -347,7 +362,7 @@ inline void HashSet<T, Hasher, Comparer, Allocator>::Reserve(Size newSize)
     newSize = Math::RoundToNextPowerOfTwo(newSize);
 
     // Allocate the new memory
-    auto newTable = (Node**)Allocator::Allocate(newSize * Axis::PointerSize, 1);
+    auto newTable = (Node**)this->GetAllocatorInstance().Allocate(newSize * Axis::PointerSize, 1);
 
     for (Size i = 0; i < newSize; ++i)
         newTable[i] = nullptr;
@@ -495,7 +510,7 @@ inline Pair<Bool, IteratorVariant> HashSet<T, Hasher, Comparer, Allocator>::Remo
             node->Data.~T();
 
             // Deallocate the node
-            Allocator::Deallocate(node);
+            this->GetAllocatorInstance().Deallocate(node);
 
             // Checks if the next node is nullptr and if so, looks for the next non-nullptr node
             if (nextNode == nullptr)
@@ -544,7 +559,7 @@ inline Pair<Bool, IteratorVariant> HashSet<T, Hasher, Comparer, Allocator>::Inse
     }
 
     // Create the node
-    node = (Node*)Allocator::Allocate(sizeof(Node), alignof(Node));
+    node = (Node*)this->GetAllocatorInstance().Allocate(sizeof(Node), alignof(Node));
 
     if constexpr (std::is_nothrow_constructible_v<T, Args...>)
         new (&node->Data) T(std::forward<Args>(args)...);
@@ -556,7 +571,7 @@ inline Pair<Bool, IteratorVariant> HashSet<T, Hasher, Comparer, Allocator>::Inse
         }
         catch (...)
         {
-            Allocator::Deallocate(node);
+            this->GetAllocatorInstance().Deallocate(node);
             throw;
         }
     }
@@ -602,7 +617,7 @@ inline void HashSet<T, Hasher, Comparer, Allocator>::ClearInternal(Node** pTable
             if constexpr (!PodType<T>)
                 currentNode->Data.~T();
 
-            Allocator::Deallocate(currentNode);
+            this->GetAllocatorInstance().Deallocate(currentNode);
 
             currentNode = nextNode;
         }
@@ -613,7 +628,7 @@ inline void HashSet<T, Hasher, Comparer, Allocator>::ClearInternal(Node** pTable
     if constexpr (ClearTable)
     {
         if (pTable)
-            Allocator::Deallocate(pTable);
+            this->GetAllocatorInstance().Deallocate(pTable);
     }
 }
 
@@ -0,0 +1,208 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#ifndef AXIS_SYSTEM_HASHINGIMPL_INL
+#define AXIS_SYSTEM_HASHINGIMPL_INL
+#pragma once
+
+#include "../../Include/Axis/Hashing.hpp"
+#include <cstring>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#    include <intrin.h>
+#endif
+
+namespace Axis
+{
+
+namespace System
+{
+
+namespace Detail
+{
+
+inline constexpr Uint64 HashSecrets[] = {0x2D358DCCAA6C78A5ull,
+                                         0x8BB84B93962EACC9ull,
+                                         0x4B33A62ED433D4A3ull,
+                                         0x4D5A2DA51DE1AA47ull};
+
+// Multiplies two 64 bits integers, the low half of the product is stored in `a`
+// and the high half in `b`.
+inline void HashMultiply(Uint64& a, Uint64& b) noexcept
+{
+#if defined(__SIZEOF_INT128__)
+    __uint128_t product = (__uint128_t)a * b;
+
+    a = (Uint64)product;
+    b = (Uint64)(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    a = _umul128(a, b, &b);
+#else
+    const Uint64 aHigh = a >> 32, aLow = (Uint32)a;
+    const Uint64 bHigh = b >> 32, bLow = (Uint32)b;
+
+    const Uint64 high    = aHigh * bHigh;
+    const Uint64 middle  = aHigh * bLow;
+    const Uint64 middle2 = aLow * bHigh;
+    const Uint64 low     = aLow * bLow;
+
+    const Uint64 term  = low + (middle << 32);
+    const Uint64 carry = (term < low);
+    const Uint64 lo    = term + (middle2 << 32);
+
+    b = high + (middle >> 32) + (middle2 >> 32) + carry + (lo < term);
+    a = lo;
+#endif
+}
+
+// Multiplies two 64 bits integers and folds the 128 bits product.
+inline Uint64 HashMultiplyFold(Uint64 a,
+                               Uint64 b) noexcept
+{
+    HashMultiply(a, b);
+
+    return a ^ b;
+}
+
+inline Uint64 HashRead64(const Byte* bytes) noexcept
+{
+    Uint64 value;
+    std::memcpy(&value, bytes, sizeof(value));
+    return value;
+}
+
+inline Uint64 HashRead32(const Byte* bytes) noexcept
+{
+    Uint32 value;
+    std::memcpy(&value, bytes, sizeof(value));
+    return value;
+}
+
+// Writes the bytes of the value into the hash buffer.
+template <class T>
+inline void WriteHashValue(Byte*& cursor, const T& value) noexcept
+{
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        // Negative zero compares equal to zero
+        const T normalized = value == T(0) ? T(0) : value;
+
+        std::memcpy(cursor, &normalized, sizeof(T));
+    }
+    else
+        std::memcpy(cursor, &value, sizeof(T));
+
+    cursor += sizeof(T);
+}
+
+} // namespace Detail
+
+namespace Hashing
+{
+
+inline Uint64 HashBytes(const void* data,
+                        Size        size,
+                        Uint64      seed) noexcept
+{
+    const Byte* bytes = static_cast<const Byte*>(data);
+
+    seed ^= Detail::HashMultiplyFold(seed ^ Detail::HashSecrets[0], Detail::HashSecrets[1]);
+
+    Uint64 a = 0;
+    Uint64 b = 0;
+
+    if (size <= 16)
+    {
+        if (size >= 4)
+        {
+            // Two overlapping reads from each end cover the sizes 4 to 16
+            const Size offset = (size >> 3) << 2;
+
+            a = (Detail::HashRead32(bytes) << 32) | Detail::HashRead32(bytes + offset);
+            b = (Detail::HashRead32(bytes + size - 4) << 32) | Detail::HashRead32(bytes + size - 4 - offset);
+        }
+        else if (size > 0)
+        {
+            a = ((Uint64)bytes[0] << 16) | ((Uint64)bytes[size >> 1] << 8) | bytes[size - 1];
+        }
+    }
+    else
+    {
+        Size remaining = size;
+
+        if (remaining > 48)
+        {
+            Uint64 seed1 = seed;
+            Uint64 seed2 = seed;
+
+            // Three independent lanes keep the multipliers busy
+            do
+            {
+                seed  = Detail::HashMultiplyFold(Detail::HashRead64(bytes) ^ Detail::HashSecrets[1], Detail::HashRead64(bytes + 8) ^ seed);
+                seed1 = Detail::HashMultiplyFold(Detail::HashRead64(bytes + 16) ^ Detail::HashSecrets[2], Detail::HashRead64(bytes + 24) ^ seed1);
+                seed2 = Detail::HashMultiplyFold(Detail::HashRead64(bytes + 32) ^ Detail::HashSecrets[3], Detail::HashRead64(bytes + 40) ^ seed2);
+
+                bytes += 48;
+                remaining -= 48;
+            } while (remaining > 48);
+
+            seed ^= seed1 ^ seed2;
+        }
+
+        while (remaining > 16)
+        {
+            seed = Detail::HashMultiplyFold(Detail::HashRead64(bytes) ^ Detail::HashSecrets[1], Detail::HashRead64(bytes + 8) ^ seed);
+
+            bytes += 16;
+            remaining -= 16;
+        }
+
+        // The last 16 bytes, overlapping with the already hashed ones
+        a = Detail::HashRead64(bytes + remaining - 16);
+        b = Detail::HashRead64(bytes + remaining - 8);
+    }
+
+    a ^= Detail::HashSecrets[1];
+    b ^= seed;
+
+    Detail::HashMultiply(a, b);
+
+    return Detail::HashMultiplyFold(a ^ Detail::HashSecrets[0] ^ size, b ^ Detail::HashSecrets[1]);
+}
+
+inline Uint64 Mix(Uint64 value) noexcept
+{
+    return Detail::HashMultiplyFold(value ^ Detail::HashSecrets[0], Detail::HashSecrets[1]);
+}
+
+inline Size Combine(Size hash,
+                    Size anotherHash) noexcept
+{
+    return (Size)Detail::HashMultiplyFold((Uint64)hash ^ Detail::HashSecrets[0], (Uint64)anotherHash ^ Detail::HashSecrets[1]);
+}
+
+template <class T>
+inline Size HashPod(const T& object) noexcept requires(std::has_unique_object_representations_v<T>)
+{
+    return (Size)HashBytes(&object, sizeof(T));
+}
+
+template <HashableValueType... Args>
+inline Size HashValues(const Args&... values) noexcept requires(sizeof...(Args) > 0)
+{
+    Byte  buffer[(sizeof(Args) + ...)];
+    Byte* cursor = buffer;
+
+    (Detail::WriteHashValue(cursor, values), ...);
+
+    return (Size)HashBytes(buffer, sizeof(buffer));
+}
+
+} // namespace Hashing
+
+} // namespace System
+
+} // namespace Axis
+
+#endif // AXIS_SYSTEM_HASHINGIMPL_INL
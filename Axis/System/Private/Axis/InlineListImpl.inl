@@ -0,0 +1,733 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#ifndef AXIS_SYSTEM_INLINELISTIMPL_INL
+#define AXIS_SYSTEM_INLINELISTIMPL_INL
+#pragma once
+
+#include "../../Include/Axis/Exception.hpp"
+#include "../../Include/Axis/InlineList.hpp"
+#include "../../Include/Axis/Math.hpp"
+
+namespace Axis
+{
+
+namespace System
+{
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline InlineList<T, N, Allocator>::InlineList(const Allocator& allocator) noexcept :
+    Detail::AllocatorStorage<Allocator>(allocator) {}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline InlineList<T, N, Allocator>::InlineList(const InlineList<T, N, Allocator>& other) requires(std::is_copy_constructible_v<T>) :
+    InlineList(other, other.GetAllocator()) {}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline InlineList<T, N, Allocator>::InlineList(const InlineList<T, N, Allocator>& other,
+                                               const Allocator&                   allocator) requires(std::is_copy_constructible_v<T>) :
+    Detail::AllocatorStorage<Allocator>(allocator)
+{
+    ReserveFor(other._length);
+
+    try
+    {
+        ConstructRange(_buffer, other._buffer, other._length);
+    }
+    catch (...)
+    {
+        // The destructor isn't invoked when the constructor throws.
+        AdoptBuffer(GetInlineBuffer(), N);
+        throw;
+    }
+
+    _length = other._length;
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline InlineList<T, N, Allocator>::InlineList(InlineList<T, N, Allocator>&& other) noexcept(std::is_nothrow_move_constructible_v<T>) :
+    Detail::AllocatorStorage<Allocator>(std::move(other.GetAllocatorInstance()))
+{
+    TakeElements(other);
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline InlineList<T, N, Allocator>::InlineList(NullptrType) noexcept(std::is_nothrow_default_constructible_v<Allocator>) {}
+
+template <RawType T, Size N, AllocatorType Allocator>
+template <class... Args>
+inline InlineList<T, N, Allocator>::InlineList(Size length, Args... args) requires(std::is_constructible_v<T, Args...>)
+{
+    ReserveFor(length);
+
+    Size constructedCount = 0;
+
+    try
+    {
+        for (; constructedCount < length; constructedCount++)
+            new (_buffer + constructedCount) T(args...);
+    }
+    catch (...)
+    {
+        // The destructor isn't invoked when the constructor throws.
+        DestroyRange(_buffer, constructedCount);
+        AdoptBuffer(GetInlineBuffer(), N);
+        throw;
+    }
+
+    _length = length;
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline InlineList<T, N, Allocator>::InlineList(const std::initializer_list<T>& init) requires(std::is_copy_constructible_v<T>) :
+    InlineList(init, Allocator()) {}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline InlineList<T, N, Allocator>::InlineList(const std::initializer_list<T>& init,
+                                               const Allocator&                allocator) requires(std::is_copy_constructible_v<T>) :
+    Detail::AllocatorStorage<Allocator>(allocator)
+{
+    ReserveFor(init.size());
+
+    try
+    {
+        ConstructRange(_buffer, init.begin(), init.size());
+    }
+    catch (...)
+    {
+        // The destructor isn't invoked when the constructor throws.
+        AdoptBuffer(GetInlineBuffer(), N);
+        throw;
+    }
+
+    _length = init.size();
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline InlineList<T, N, Allocator>::~InlineList() noexcept
+{
+    DestroyRange(_buffer, _length);
+
+    if (!IsInline())
+        this->GetAllocatorInstance().Deallocate(_buffer);
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline InlineList<T, N, Allocator>& InlineList<T, N, Allocator>::operator=(const InlineList<T, N, Allocator>& other) requires(std::is_copy_constructible_v<T>)
+{
+    if (this == std::addressof(other))
+        return *this;
+
+    if constexpr (std::is_nothrow_copy_constructible_v<T>)
+    {
+        DestroyRange(_buffer, _length);
+
+        _length = 0;
+
+        if (other._length > _capacity)
+        {
+            const Size capacity = GetGrowthCapacity(other._length);
+
+            AdoptBuffer(AllocateBuffer(capacity), capacity);
+        }
+
+        ConstructRange(_buffer, other._buffer, other._length);
+
+        _length = other._length;
+    }
+    else
+    {
+        if (other._length == 0)
+        {
+            Clear();
+            return *this;
+        }
+
+        if constexpr (TriviallyRelocatable<T> || std::is_nothrow_move_constructible_v<T>)
+        {
+            if (other._length <= N)
+            {
+                // Copies into the temporary inline storage first to provide strong exception
+                // guarantee, moving the copies into place can't throw.
+                alignas(T) Byte temporary[sizeof(T) * N];
+
+                ConstructRange(reinterpret_cast<T*>(temporary), other._buffer, other._length);
+
+                DestroyRange(_buffer, _length);
+                AdoptBuffer(GetInlineBuffer(), N);
+
+                TransferRange(_buffer, reinterpret_cast<T*>(temporary), other._length);
+                ReleaseRange(reinterpret_cast<T*>(temporary), other._length);
+
+                _length = other._length;
+
+                return *this;
+            }
+        }
+
+        // Copies into the new buffer first to provide strong exception guarantee.
+        const Size capacity  = GetGrowthCapacity(other._length);
+        T*         newBuffer = AllocateBuffer(capacity);
+
+        try
+        {
+            ConstructRange(newBuffer, other._buffer, other._length);
+        }
+        catch (...)
+        {
+            this->GetAllocatorInstance().Deallocate(newBuffer);
+            throw;
+        }
+
+        DestroyRange(_buffer, _length);
+        AdoptBuffer(newBuffer, capacity);
+
+        _length = other._length;
+    }
+
+    return *this;
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline InlineList<T, N, Allocator>& InlineList<T, N, Allocator>::operator=(InlineList<T, N, Allocator>&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+    if (this == std::addressof(other))
+        return *this;
+
+    DestroyRange(_buffer, _length);
+    AdoptBuffer(GetInlineBuffer(), N);
+
+    _length = 0;
+
+    // The memory is owned by the other's allocator, takes it along.
+    this->GetAllocatorInstance() = std::move(other.GetAllocatorInstance());
+
+    TakeElements(other);
+
+    return *this;
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline Size InlineList<T, N, Allocator>::GetLength() const noexcept
+{
+    return _length;
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline Size InlineList<T, N, Allocator>::GetCapacity() const noexcept
+{
+    return _capacity;
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline Bool InlineList<T, N, Allocator>::IsInline() const noexcept
+{
+    return _buffer == reinterpret_cast<const T*>(_inlineStorage);
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline const Allocator& InlineList<T, N, Allocator>::GetAllocator() const noexcept
+{
+    return this->GetAllocatorInstance();
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline void InlineList<T, N, Allocator>::ReserveFor(Size length)
+{
+    if (length > _capacity)
+        Grow(GetGrowthCapacity(length));
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline void InlineList<T, N, Allocator>::Clear() noexcept
+{
+    DestroyRange(_buffer, _length);
+
+    _length = 0;
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+template <class... Args>
+inline void InlineList<T, N, Allocator>::Reset(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>) requires(std::is_constructible_v<T, Args...>)
+{
+    if constexpr (std::is_nothrow_constructible_v<T, Args...>)
+    {
+        for (Size i = 0; i < _length; i++)
+        {
+            _buffer[i].~T();
+            new (_buffer + i) T(args...);
+        }
+    }
+    else
+    {
+        if (_length == 0)
+            return;
+
+        // Constructs the elements in the new buffer first to provide strong exception guarantee.
+        const Size capacity         = GetGrowthCapacity(_length);
+        T*         newBuffer        = AllocateBuffer(capacity);
+        Size       constructedCount = 0;
+
+        try
+        {
+            for (; constructedCount < _length; constructedCount++)
+                new (newBuffer + constructedCount) T(args...);
+        }
+        catch (...)
+        {
+            DestroyRange(newBuffer, constructedCount);
+            this->GetAllocatorInstance().Deallocate(newBuffer);
+            throw;
+        }
+
+        DestroyRange(_buffer, _length);
+        AdoptBuffer(newBuffer, capacity);
+    }
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+template <class... Args>
+inline T* InlineList<T, N, Allocator>::EmplaceBack(Args&&... args) requires(std::is_constructible_v<T, Args...> && (std::is_copy_constructible_v<T> || std::is_nothrow_move_constructible_v<T>))
+{
+    if (_length == _capacity)
+    {
+        const Size capacity  = GetGrowthCapacity(_length + 1);
+        T*         newBuffer = AllocateBuffer(capacity);
+
+        // Constructs the element first, the arguments may refer to the elements being moved.
+        try
+        {
+            new (newBuffer + _length) T(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            this->GetAllocatorInstance().Deallocate(newBuffer);
+            throw;
+        }
+
+        try
+        {
+            TransferRange(newBuffer, _buffer, _length);
+        }
+        catch (...)
+        {
+            newBuffer[_length].~T();
+            this->GetAllocatorInstance().Deallocate(newBuffer);
+            throw;
+        }
+
+        ReleaseRange(_buffer, _length);
+        AdoptBuffer(newBuffer, capacity);
+    }
+    else
+        new (_buffer + _length) T(std::forward<Args>(args)...);
+
+    _length++;
+
+    return _buffer + _length - 1;
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline T* InlineList<T, N, Allocator>::Append(const T& element) requires(std::is_copy_constructible_v<T>)
+{
+    return EmplaceBack<const T&>(element);
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline T* InlineList<T, N, Allocator>::Append(T&& element) requires(std::is_move_constructible_v<T>)
+{
+    return EmplaceBack<T&&>(std::move(element));
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+template <class... Args>
+inline T* InlineList<T, N, Allocator>::Emplace(Size index, Args&&... args) requires(std::is_constructible_v<T, Args...> && (std::is_copy_constructible_v<T> || std::is_nothrow_move_constructible_v<T>))
+{
+    if (index > _length)
+        throw ArgumentOutOfRangeException("`index` was out of range!");
+
+    // Checks if the index is the end.
+    if (index == _length) return EmplaceBack(std::forward<Args>(args)...);
+
+    if constexpr (TriviallyRelocatable<T> || std::is_nothrow_move_constructible_v<T>)
+    {
+        if (_length < _capacity)
+        {
+            if constexpr (TriviallyRelocatable<T>)
+            {
+                // Constructs the element first, the arguments may refer to the elements being shifted.
+                alignas(T) Byte element[sizeof(T)];
+
+                new (element) T(std::forward<Args>(args)...);
+
+                // Shifts the elements bytewise to create space for the new element.
+                std::memmove((PVoid)(_buffer + index + 1), _buffer + index, (_length - index) * sizeof(T));
+
+                // Relocates the element to the list, the temporary storage is simply forgotten.
+                std::memcpy((PVoid)(_buffer + index), element, sizeof(T));
+            }
+            else
+            {
+                T element(std::forward<Args>(args)...);
+
+                // Moves the elements to the right of the index.
+                for (Size i = _length; i > index; i--)
+                {
+                    new (_buffer + i) T(std::move(_buffer[i - 1]));
+                    _buffer[i - 1].~T();
+                }
+
+                new (_buffer + index) T(std::move(element));
+            }
+
+            _length++;
+
+            return _buffer + index;
+        }
+    }
+
+    // Builds the new buffer around the new element, the old one is untouched if anything throws.
+    const Size capacity  = GetGrowthCapacity(_length + 1);
+    T*         newBuffer = AllocateBuffer(capacity);
+
+    try
+    {
+        new (newBuffer + index) T(std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        this->GetAllocatorInstance().Deallocate(newBuffer);
+        throw;
+    }
+
+    try
+    {
+        TransferRange(newBuffer, _buffer, index);
+
+        try
+        {
+            TransferRange(newBuffer + index + 1, _buffer + index, _length - index);
+        }
+        catch (...)
+        {
+            // Only the copies can throw, the first half are the copies as well.
+            DestroyRange(newBuffer, index);
+            throw;
+        }
+    }
+    catch (...)
+    {
+        newBuffer[index].~T();
+        this->GetAllocatorInstance().Deallocate(newBuffer);
+        throw;
+    }
+
+    ReleaseRange(_buffer, _length);
+    AdoptBuffer(newBuffer, capacity);
+
+    _length++;
+
+    return _buffer + index;
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline void InlineList<T, N, Allocator>::PopBack() noexcept
+{
+    // Checks if the array is empty, if so, does nothing.
+    if (_length == 0)
+        return;
+
+    DestroyRange(_buffer + _length - 1, 1);
+
+    _length--;
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline void InlineList<T, N, Allocator>::RemoveAt(Size index) requires(std::is_move_constructible_v<T> || std::is_copy_constructible_v<T>)
+{
+    // Checks if the index is valid.
+    if (index >= _length)
+        throw ArgumentOutOfRangeException("`index` was out of range!");
+
+    if constexpr (TriviallyRelocatable<T>)
+    {
+        DestroyRange(_buffer + index, 1);
+
+        // Simply uses memmove to move the elements.
+        std::memmove((PVoid)(_buffer + index), _buffer + index + 1, (_length - index - 1) * sizeof(T));
+    }
+    else if constexpr (std::is_nothrow_move_constructible_v<T> || std::is_nothrow_copy_constructible_v<T>)
+    {
+        _buffer[index].~T();
+
+        // Moves the elements to the left of the index.
+        for (Size i = index; i < _length - 1; i++)
+        {
+            // Uses any constructor with noexcept.
+            if constexpr (std::is_nothrow_move_constructible_v<T>)
+                new (_buffer + i) T(std::move(_buffer[i + 1]));
+            else
+                new (_buffer + i) T(_buffer[i + 1]);
+
+            _buffer[i + 1].~T();
+        }
+    }
+    else
+    {
+        // Creates new buffer to ensure strong exception safety.
+        const Size capacity  = GetGrowthCapacity(_length);
+        T*         newBuffer = AllocateBuffer(capacity);
+
+        try
+        {
+            TransferRange(newBuffer, _buffer, index);
+
+            try
+            {
+                TransferRange(newBuffer + index, _buffer + index + 1, _length - index - 1);
+            }
+            catch (...)
+            {
+                DestroyRange(newBuffer, index);
+                throw;
+            }
+        }
+        catch (...)
+        {
+            this->GetAllocatorInstance().Deallocate(newBuffer);
+            throw;
+        }
+
+        ReleaseRange(_buffer, index);
+        DestroyRange(_buffer + index, 1);
+        ReleaseRange(_buffer + index + 1, _length - index - 1);
+        AdoptBuffer(newBuffer, capacity);
+    }
+
+    // Decreases the length.
+    _length--;
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline T* InlineList<T, N, Allocator>::GetData() noexcept
+{
+    return _buffer;
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline const T* InlineList<T, N, Allocator>::GetData() const noexcept
+{
+    return _buffer;
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline void InlineList<T, N, Allocator>::Resize(Size length) requires(std::is_default_constructible_v<T> && (std::is_copy_constructible_v<T> || std::is_nothrow_move_constructible_v<T>))
+{
+    if (length <= _length)
+    {
+        DestroyRange(_buffer + length, _length - length);
+
+        _length = length;
+
+        return;
+    }
+
+    ReserveFor(length);
+
+    Size constructedCount = _length;
+
+    try
+    {
+        for (; constructedCount < length; constructedCount++)
+            new (_buffer + constructedCount) T();
+    }
+    catch (...)
+    {
+        DestroyRange(_buffer + _length, constructedCount - _length);
+        throw;
+    }
+
+    _length = length;
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline T& InlineList<T, N, Allocator>::operator[](Size index)
+{
+    // Checks if the index is valid.
+    if (index >= _length)
+        throw ArgumentOutOfRangeException("`index` was out of range!");
+
+    return _buffer[index];
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline const T& InlineList<T, N, Allocator>::operator[](Size index) const
+{
+    // Checks if the index is valid.
+    if (index >= _length)
+        throw ArgumentOutOfRangeException("`index` was out of range!");
+
+    return _buffer[index];
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline T* InlineList<T, N, Allocator>::begin() noexcept { return _buffer; }
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline const T* InlineList<T, N, Allocator>::begin() const noexcept { return _buffer; }
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline T* InlineList<T, N, Allocator>::end() noexcept { return _buffer + _length; }
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline const T* InlineList<T, N, Allocator>::end() const noexcept { return _buffer + _length; }
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline InlineList<T, N, Allocator>::operator Bool() const noexcept
+{
+    return _length > 0;
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline T* InlineList<T, N, Allocator>::GetInlineBuffer() noexcept
+{
+    return reinterpret_cast<T*>(_inlineStorage);
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline T* InlineList<T, N, Allocator>::AllocateBuffer(Size capacity)
+{
+    return (T*)this->GetAllocatorInstance().Allocate(capacity * sizeof(T), alignof(T));
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline void InlineList<T, N, Allocator>::AdoptBuffer(T* buffer, Size capacity) noexcept
+{
+    if (!IsInline())
+        this->GetAllocatorInstance().Deallocate(_buffer);
+
+    _buffer   = buffer;
+    _capacity = capacity;
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline void InlineList<T, N, Allocator>::TakeElements(InlineList<T, N, Allocator>& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+    if (!other.IsInline())
+    {
+        // Takes the allocated memory along.
+        _buffer   = other._buffer;
+        _capacity = other._capacity;
+    }
+    else
+    {
+        TransferRange(_buffer, other._buffer, other._length);
+        ReleaseRange(other._buffer, other._length);
+    }
+
+    _length = other._length;
+
+    // Turns other into an empty list.
+    other._buffer   = other.GetInlineBuffer();
+    other._capacity = N;
+    other._length   = 0;
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline void InlineList<T, N, Allocator>::Grow(Size capacity)
+{
+    T* newBuffer = AllocateBuffer(capacity);
+
+    try
+    {
+        TransferRange(newBuffer, _buffer, _length);
+    }
+    catch (...)
+    {
+        this->GetAllocatorInstance().Deallocate(newBuffer);
+        throw;
+    }
+
+    ReleaseRange(_buffer, _length);
+    AdoptBuffer(newBuffer, capacity);
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline void InlineList<T, N, Allocator>::ConstructRange(T*       destination,
+                                                        const T* source,
+                                                        Size     count)
+{
+    if constexpr (PodType<T>)
+    {
+        // The source is null when empty, which isn't allowed to be passed to memcpy.
+        if (count)
+            std::memcpy(destination, source, count * sizeof(T));
+    }
+    else
+    {
+        Size constructedCount = 0;
+
+        try
+        {
+            for (; constructedCount < count; constructedCount++)
+                new (destination + constructedCount) T(source[constructedCount]);
+        }
+        catch (...)
+        {
+            DestroyRange(destination, constructedCount);
+            throw;
+        }
+    }
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline void InlineList<T, N, Allocator>::TransferRange(T*   destination,
+                                                       T*   source,
+                                                       Size count)
+{
+    if constexpr (TriviallyRelocatable<T>)
+    {
+        // Copies the elements bytewise, `ReleaseRange` simply forgets the source.
+        if (count)
+            std::memcpy((PVoid)destination, source, count * sizeof(T));
+    }
+    else if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
+    {
+        for (Size i = 0; i < count; i++)
+            new (destination + i) T(std::move(source[i]));
+    }
+    else
+        ConstructRange(destination, source, count);
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline void InlineList<T, N, Allocator>::ReleaseRange(T*   source,
+                                                      Size count) noexcept
+{
+    if constexpr (!TriviallyRelocatable<T>)
+        DestroyRange(source, count);
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline void InlineList<T, N, Allocator>::DestroyRange(T*   buffer,
+                                                      Size count) noexcept
+{
+    if constexpr (!std::is_trivially_destructible_v<T>)
+    {
+        for (Size i = 0; i < count; i++)
+            buffer[i].~T();
+    }
+}
+
+template <RawType T, Size N, AllocatorType Allocator>
+inline Size InlineList<T, N, Allocator>::GetGrowthCapacity(Size length) noexcept
+{
+    return Math::Max(Math::RoundToNextPowerOfTwo(length), N * 2);
+}
+
+} // namespace System
+
+} // namespace Axis
+
+#endif // AXIS_SYSTEM_INLINELISTIMPL_INL
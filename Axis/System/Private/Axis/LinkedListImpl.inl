@@ -15,7 +15,17 @@ namespace System
 
 // Default constructor
 template <RawType T, AllocatorType Allocator>
-inline LinkedList<T, Allocator>::LinkedList() noexcept {}
+inline LinkedList<T, Allocator>::LinkedList() noexcept(std::is_nothrow_default_constructible_v<Allocator>) {}
+
+template <RawType T, AllocatorType Allocator>
+inline LinkedList<T, Allocator>::LinkedList(const Allocator& allocator) noexcept :
+    Detail::AllocatorStorage<Allocator>(allocator) {}
+
+template <RawType T, AllocatorType Allocator>
+inline const Allocator& LinkedList<T, Allocator>::GetAllocator() const noexcept
+{
+    return this->GetAllocatorInstance();
+}
 
 template <RawType T, AllocatorType Allocator>
 inline LinkedList<T, Allocator>::~LinkedList() noexcept
@@ -24,7 +34,8 @@ inline LinkedList<T, Allocator>::~LinkedList() noexcept
 }
 
 template <RawType T, AllocatorType Allocator>
-inline LinkedList<T, Allocator>::LinkedList(const LinkedList<T, Allocator>& other) requires(std::is_copy_constructible_v<T>)
+inline LinkedList<T, Allocator>::LinkedList(const LinkedList<T, Allocator>& other) requires(std::is_copy_constructible_v<T>) :
+    Detail::AllocatorStorage<Allocator>(other.GetAllocator())
 {
     if (other._size == 0)
         return;
@@ -54,6 +65,7 @@ inline LinkedList<T, Allocator>::LinkedList(const LinkedList<T, Allocator>& othe
 
 template <RawType T, AllocatorType Allocator>
 inline LinkedList<T, Allocator>::LinkedList(LinkedList<T, Allocator>&& other) noexcept :
+    Detail::AllocatorStorage<Allocator>(std::move(other.GetAllocatorInstance())),
     _size(other._size),
     _head(other._head),
     _tail(other._tail)
@@ -118,7 +130,7 @@ LinkedList<T, Allocator>& LinkedList<T, Allocator>::operator=(const LinkedList<T
                 auto next = thisNode->Next;
 
                 // Frees the memory
-                Allocator::Deallocate(thisNode);
+                this->GetAllocatorInstance().Deallocate(thisNode);
 
                 thisNode = next;
             }
@@ -132,7 +144,7 @@ LinkedList<T, Allocator>& LinkedList<T, Allocator>::operator=(const LinkedList<T
             while (otherNode != nullptr)
             {
                 // Creates a new node
-                Node* newNode = (Node*)Allocator::Allocate(sizeof(Node), alignof(Node));
+                Node* newNode = (Node*)this->GetAllocatorInstance().Allocate(sizeof(Node), alignof(Node));
 
                 // Invokes copy constructor
                 new (&newNode->Value) T(otherNode->Value);
@@ -211,6 +223,9 @@ LinkedList<T, Allocator>& LinkedList<T, Allocator>::operator=(LinkedList<T, Allo
     // Clears the current list.
     Clear(_head);
 
+    // The nodes are owned by the other's allocator, takes it along.
+    this->GetAllocatorInstance() = std::move(other.GetAllocatorInstance());
+
     // Copies all variables.
     _size = other._size;
     _head = other._head;
@@ -341,7 +356,7 @@ template <class IteratorVariant, class... Args>
 inline IteratorVariant LinkedList<T, Allocator>::Emplace(const IteratorVariant& position, Args&&... args) requires(std::is_constructible_v<T, Args...> && (std::is_same_v<IteratorVariant, iterator> || std::is_same_v<IteratorVariant, const_iterator>))
 {
     // Allocates a new node.
-    Node* node = (Node*)Allocator::Allocate(sizeof(Node), alignof(Node));
+    Node* node = (Node*)this->GetAllocatorInstance().Allocate(sizeof(Node), alignof(Node));
 
     // Checks if the allocation failed.
     if (node == nullptr)
@@ -366,7 +381,7 @@ inline IteratorVariant LinkedList<T, Allocator>::Emplace(const IteratorVariant&
         catch (...)
         {
             // Deallocates the node.
-            Allocator::Deallocate(node);
+            this->GetAllocatorInstance().Deallocate(node);
 
             // Throws the exception.
             throw;
@@ -469,7 +484,7 @@ inline IteratorVariant LinkedList<T, Allocator>::Remove(const IteratorVariant& p
     position._node->Value.~T();
 
     // Deallocates the node.
-    Allocator::Deallocate(position._node);
+    this->GetAllocatorInstance().Deallocate(position._node);
 
     // Decrements the size.
     --_size;
@@ -514,7 +529,7 @@ inline void LinkedList<T, Allocator>::Clear(Node* nodeHead) noexcept
         nodeHead->Value.~T();
 
         // Deallocates the node.
-        Allocator::Deallocate(nodeHead);
+        this->GetAllocatorInstance().Deallocate(nodeHead);
 
         // Sets the node to the next node.
         nodeHead = next;
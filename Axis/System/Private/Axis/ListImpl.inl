@@ -19,7 +19,7 @@ namespace System
 template <RawType T, AllocatorType Allocator>
 template <Bool FreeMemory>
 inline void List<T, Allocator>::ClearInternal(T*   buffer,
-                                              Size length)
+                                              Size length) noexcept
 {
     if (buffer)
     {
@@ -30,12 +30,22 @@ inline void List<T, Allocator>::ClearInternal(T*   buffer,
         }
 
         if constexpr (FreeMemory)
-            Allocator::Deallocate(buffer);
+            this->GetAllocatorInstance().Deallocate(buffer);
     }
 }
 
 template <RawType T, AllocatorType Allocator>
-inline List<T, Allocator>::List(const List<T, Allocator>& other) requires(std::is_copy_constructible_v<T>)
+inline List<T, Allocator>::List(const Allocator& allocator) noexcept :
+    Detail::AllocatorStorage<Allocator>(allocator) {}
+
+template <RawType T, AllocatorType Allocator>
+inline List<T, Allocator>::List(const List<T, Allocator>& other) requires(std::is_copy_constructible_v<T>) :
+    List(other, other.GetAllocator()) {}
+
+template <RawType T, AllocatorType Allocator>
+inline List<T, Allocator>::List(const List<T, Allocator>& other,
+                                const Allocator&          allocator) requires(std::is_copy_constructible_v<T>) :
+    Detail::AllocatorStorage<Allocator>(allocator)
 {
     if (other._length > 0)
     {
@@ -48,8 +58,9 @@ inline List<T, Allocator>::List(const List<T, Allocator>& other) requires(std::i
 
 template <RawType T, AllocatorType Allocator>
 inline List<T, Allocator>::List(List<T, Allocator>&& other) noexcept :
+    Detail::AllocatorStorage<Allocator>(std::move(other.GetAllocatorInstance())),
     _buffer(other._buffer),
-    _allocatedLength(other._length),
+    _allocatedLength(other._allocatedLength),
     _length(other._length)
 {
     // Turns other into an empty array.
@@ -75,7 +86,13 @@ inline List<T, Allocator>::List(Size length, Args... args) requires(std::is_cons
 }
 
 template <RawType T, AllocatorType Allocator>
-inline List<T, Allocator>::List(const std::initializer_list<T>& other) requires(std::is_copy_constructible_v<T>)
+inline List<T, Allocator>::List(const std::initializer_list<T>& other) requires(std::is_copy_constructible_v<T>) :
+    List(other, Allocator()) {}
+
+template <RawType T, AllocatorType Allocator>
+inline List<T, Allocator>::List(const std::initializer_list<T>& other,
+                                const Allocator&                allocator) requires(std::is_copy_constructible_v<T>) :
+    Detail::AllocatorStorage<Allocator>(allocator)
 {
     if (other.size() > 0)
     {
@@ -107,7 +124,7 @@ inline List<T, Allocator>& List<T, Allocator>::operator=(const List<T, Allocator
 
             ClearInternal<true>(_buffer, _length);
 
-            _buffer          = (T*)Allocator::Allocate(allocatedLength * sizeof(T), alignof(T));
+            _buffer          = (T*)this->GetAllocatorInstance().Allocate(allocatedLength * sizeof(T), alignof(T));
             _allocatedLength = allocatedLength;
         }
         else
@@ -117,7 +134,9 @@ inline List<T, Allocator>& List<T, Allocator>::operator=(const List<T, Allocator
 
         if constexpr (PodType<T>)
         {
-            std::memcpy(_buffer, other._buffer, _length * sizeof(T));
+            // The buffers are null when empty, which isn't allowed to be passed to memcpy.
+            if (_length)
+                std::memcpy(_buffer, other._buffer, _length * sizeof(T));
         }
         else
         {
@@ -149,6 +168,9 @@ inline List<T, Allocator>& List<T, Allocator>::operator=(List<T, Allocator>&& ot
 
     ClearInternal<true>(_buffer, _length);
 
+    // The memory is owned by the other's allocator, takes it along.
+    this->GetAllocatorInstance() = std::move(other.GetAllocatorInstance());
+
     _buffer          = other._buffer;
     _length          = other._length;
     _allocatedLength = other._allocatedLength;
@@ -167,18 +189,31 @@ inline Size List<T, Allocator>::GetLength() const noexcept
     return _length;
 }
 
+template <RawType T, AllocatorType Allocator>
+inline const Allocator& List<T, Allocator>::GetAllocator() const noexcept
+{
+    return this->GetAllocatorInstance();
+}
+
 template <RawType T, AllocatorType Allocator>
 inline void List<T, Allocator>::ReserveFor(Size length)
 {
     if (length > _allocatedLength)
     {
-        auto newMemory = ConstructsNewList<false, true, !std::is_nothrow_move_constructible_v<T>>(_length, Math::RoundToNextPowerOfTwo(length), _buffer);
+        if constexpr (TriviallyRelocatable<T>)
+        {
+            Relocate(Math::RoundToNextPowerOfTwo(length));
+        }
+        else
+        {
+            auto newMemory = ConstructsNewList<false, true, !std::is_nothrow_move_constructible_v<T>>(_length, Math::RoundToNextPowerOfTwo(length), _buffer);
 
-        // Destructs the old array.
-        ClearInternal<true>(_buffer, _length);
+            // Destructs the old array.
+            ClearInternal<true>(_buffer, _length);
 
-        _allocatedLength = GetTuple<1>(newMemory);
-        _buffer          = GetTuple<0>(newMemory);
+            _allocatedLength = GetTuple<1>(newMemory);
+            _buffer          = GetTuple<0>(newMemory);
+        }
     }
 }
 
@@ -226,13 +261,40 @@ inline T* List<T, Allocator>::EmplaceBack(Args&&... args) requires(std::is_const
 {
     if (_length == _allocatedLength)
     {
-        auto newMemory = ConstructsNewList<false, true, !std::is_nothrow_move_constructible_v<T>>(_length, Math::RoundToNextPowerOfTwo(_length + 1), _buffer);
+        if constexpr (TriviallyRelocatable<T>)
+        {
+            // Constructs the element first, the arguments may refer to the elements being relocated.
+            alignas(T) Byte element[sizeof(T)];
 
-        // Destructs the old array.
-        ClearInternal<true>(_buffer, _length);
+            new (element) T(std::forward<Args>(args)...);
 
-        _allocatedLength = GetTuple<1>(newMemory);
-        _buffer          = GetTuple<0>(newMemory);
+            try
+            {
+                Relocate(Math::RoundToNextPowerOfTwo(_length + 1));
+            }
+            catch (...)
+            {
+                ((T*)element)->~T();
+                throw;
+            }
+
+            // Relocates the element to the list, the temporary storage is simply forgotten.
+            std::memcpy((PVoid)(_buffer + _length), element, sizeof(T));
+
+            _length++;
+
+            return _buffer + _length - 1;
+        }
+        else
+        {
+            auto newMemory = ConstructsNewList<false, true, !std::is_nothrow_move_constructible_v<T>>(_length, Math::RoundToNextPowerOfTwo(_length + 1), _buffer);
+
+            // Destructs the old array.
+            ClearInternal<true>(_buffer, _length);
+
+            _allocatedLength = GetTuple<1>(newMemory);
+            _buffer          = GetTuple<0>(newMemory);
+        }
     }
 
     // Invokes new placement constructor
@@ -240,7 +302,7 @@ inline T* List<T, Allocator>::EmplaceBack(Args&&... args) requires(std::is_const
 
     _length++;
 
-    return _buffer + _length;
+    return _buffer + _length - 1;
 }
 
 template <RawType T, AllocatorType Allocator>
@@ -265,7 +327,37 @@ inline T* List<T, Allocator>::Emplace(Size index, Args&&... args) requires(std::
     // Checks if the index is the end.
     if (index == _length) return EmplaceBack(std::forward<Args>(args)...);
 
-    if (_length < _allocatedLength && (std::is_nothrow_move_constructible_v<T> || std::is_nothrow_copy_constructible_v<T>)&&std::is_nothrow_constructible_v<T, Args...>)
+    if constexpr (TriviallyRelocatable<T>)
+    {
+        // Constructs the element first, the arguments may refer to the elements being shifted.
+        alignas(T) Byte element[sizeof(T)];
+
+        new (element) T(std::forward<Args>(args)...);
+
+        if (_length == _allocatedLength)
+        {
+            try
+            {
+                Relocate(Math::RoundToNextPowerOfTwo(_length + 1));
+            }
+            catch (...)
+            {
+                ((T*)element)->~T();
+                throw;
+            }
+        }
+
+        // Shifts the elements bytewise to create space for the new element.
+        std::memmove((PVoid)(_buffer + index + 1), _buffer + index, (_length - index) * sizeof(T));
+
+        // Relocates the element to the list, the temporary storage is simply forgotten.
+        std::memcpy((PVoid)(_buffer + index), element, sizeof(T));
+
+        _length++;
+
+        return _buffer + index;
+    }
+    else if (_length < _allocatedLength && (std::is_nothrow_move_constructible_v<T> || std::is_nothrow_copy_constructible_v<T>)&&std::is_nothrow_constructible_v<T, Args...>)
     {
         if constexpr (PodType<T>)
         {
@@ -291,6 +383,8 @@ inline T* List<T, Allocator>::Emplace(Size index, Args&&... args) requires(std::
         // Invokes placement new at the index.
         new (_buffer + index) T(std::forward<Args>(args)...);
 
+        _length++;
+
         return _buffer + index;
     }
     else
@@ -298,18 +392,22 @@ inline T* List<T, Allocator>::Emplace(Size index, Args&&... args) requires(std::
         auto newAllocatedLength = Math::RoundToNextPowerOfTwo(_length + 1);
 
         // Allocates new memory.
-        auto newMemory = (T*)Allocator::Allocate(newAllocatedLength * sizeof(T), alignof(T));
+        auto newMemory = (T*)this->GetAllocatorInstance().Allocate(newAllocatedLength * sizeof(T), alignof(T));
 
         if constexpr (PodType<T>)
         {
-            // Uses memcpy for the first lefthand side.
-            std::memcpy(newMemory, _buffer, index * sizeof(T));
-
             // Placement new
             new (newMemory + index) T(std::forward<Args>(args)...);
 
-            // Uses memcpy for the second righthand side.
-            std::memcpy(newMemory + index + 1, _buffer + index, (_length - index) * sizeof(T));
+            // The buffer is null when empty, which isn't allowed to be passed to memcpy.
+            if (_length)
+            {
+                // Uses memcpy for the first lefthand side.
+                std::memcpy(newMemory, _buffer, index * sizeof(T));
+
+                // Uses memcpy for the second righthand side.
+                std::memcpy(newMemory + index + 1, _buffer + index, (_length - index) * sizeof(T));
+            }
         }
         else
         {
@@ -415,10 +513,14 @@ inline void List<T, Allocator>::RemoveAt(Size index) requires(std::is_move_const
     if (index >= _length)
         throw ArgumentOutOfRangeException("`index` was out of range!");
 
-    if constexpr (PodType<T>)
+    if constexpr (TriviallyRelocatable<T>)
     {
+        // Destructs the element at the index.
+        if constexpr (!PodType<T>)
+            _buffer[index].~T();
+
         // Simply uses memmove to move the elements.
-        std::memmove(_buffer + index, _buffer + index + 1, (_length - index - 1) * sizeof(T));
+        std::memmove((PVoid)(_buffer + index), _buffer + index + 1, (_length - index - 1) * sizeof(T));
     }
     // No need to allocate new memory if
     else if constexpr (std::is_nothrow_move_constructible_v<T> || std::is_nothrow_copy_constructible_v<T>)
@@ -442,7 +544,7 @@ inline void List<T, Allocator>::RemoveAt(Size index) requires(std::is_move_const
     else
     {
         // Creates new buffer to ensure strong exception safety.
-        auto newBuffer = (T*)Allocator::Allocate((_length - 1) * sizeof(T), alignof(T));
+        auto newBuffer = (T*)this->GetAllocatorInstance().Allocate((_length - 1) * sizeof(T), alignof(T));
 
         // Keeps track of allocated elements in case of exception.
         Size allocated = 0;
@@ -475,7 +577,8 @@ inline void List<T, Allocator>::RemoveAt(Size index) requires(std::is_move_const
         ClearInternal<true>(_buffer, _length);
 
         // Assigns the new memory.
-        _buffer = newBuffer;
+        _buffer          = newBuffer;
+        _allocatedLength = _length - 1;
     }
 
     // Decreases the length.
@@ -570,7 +673,7 @@ inline Tuple<T*, Size> List<T, Allocator>::ConstructsNewList(Size elementCount,
         return {{nullptr}, {{Size(0)}}};
 
     // Allocates memory for the array.
-    T* array = (T*)Allocator::Allocate(sizeof(T) * allocationSize, alignof(T));
+    T* array = (T*)this->GetAllocatorInstance().Allocate(sizeof(T) * allocationSize, alignof(T));
 
     // Initializes the array.
     // If T can be constructed with noexcept, then we don't need to check for exceptions.
@@ -588,8 +691,9 @@ inline Tuple<T*, Size> List<T, Allocator>::ConstructsNewList(Size elementCount,
     // Uses memcpy if T is POD.
     if constexpr (PodType<T> && ListInitialize)
     {
-        // Simply use memcpy to initialize the array.
-        std::memcpy(array, begin, sizeof(T) * elementCount);
+        // Simply use memcpy to initialize the array, `begin` is null when there's nothing to copy.
+        if (elementCount)
+            std::memcpy(array, begin, sizeof(T) * elementCount);
     }
     else if constexpr (NoException)
     {
@@ -641,6 +745,33 @@ inline Tuple<T*, Size> List<T, Allocator>::ConstructsNewList(Size elementCount,
     return {{array}, {{Size(allocationSize)}}};
 }
 
+template <RawType T, AllocatorType Allocator>
+inline void List<T, Allocator>::Relocate(Size allocatedLength) requires(TriviallyRelocatable<T>)
+{
+    if constexpr (ReallocatableAllocatorType<Allocator>)
+    {
+        // The allocator may resize the buffer in place.
+        _buffer = (T*)this->GetAllocatorInstance().Reallocate(_buffer, _allocatedLength * sizeof(T), allocatedLength * sizeof(T), alignof(T));
+    }
+    else
+    {
+        auto newBuffer = (T*)this->GetAllocatorInstance().Allocate(allocatedLength * sizeof(T), alignof(T));
+
+        if (_buffer)
+        {
+            // Copies the elements bytewise, the old objects are simply forgotten.
+            if (_length)
+                std::memcpy((PVoid)newBuffer, _buffer, _length * sizeof(T));
+
+            this->GetAllocatorInstance().Deallocate(_buffer);
+        }
+
+        _buffer = newBuffer;
+    }
+
+    _allocatedLength = allocatedLength;
+}
+
 template <RawType T, AllocatorType Allocator>
 inline List<T, Allocator>::operator Bool() const noexcept
 {
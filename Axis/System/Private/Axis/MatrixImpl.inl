@@ -6,17 +6,418 @@
 #define AXIS_MATH_MATRIXIMPL_INL
 #pragma once
 
+#include "../../Include/Axis/Assert.hpp"
 #include "../../Include/Axis/Math.hpp"
 #include "../../Include/Axis/Matrix.hpp"
 #include "../../Include/Axis/Utility.hpp"
 #include <cmath>
 
+#if defined(AXIS_SIMD_AVX2)
+#    include <immintrin.h>
+#elif defined(AXIS_SIMD_SSE2)
+#    include <emmintrin.h>
+#elif defined(AXIS_SIMD_NEON)
+#    include <arm_neon.h>
+#endif
+
 namespace Axis
 {
 
 namespace System
 {
 
+namespace Detail
+{
+
+// The kernels below work on the column-major element arrays, the row-major
+// matrices are the transposed column-major ones and swap the operands instead.
+
+/// Multiplies the `RowSize` by `CommonSize` matrix with the `CommonSize` by `ColumnSize` matrix.
+template <ArithmeticType T, Size RowSize, Size CommonSize, Size ColumnSize>
+inline constexpr void MultiplyMatrixScalar(const T* left,
+                                           const T* right,
+                                           T*       result) noexcept
+{
+    for (Size column = 0; column < ColumnSize; column++)
+    {
+        for (Size row = 0; row < RowSize; row++)
+        {
+            T sum = 0;
+
+            for (Size common = 0; common < CommonSize; common++)
+                sum += left[common * RowSize + row] * right[column * CommonSize + common];
+
+            result[column * RowSize + row] = sum;
+        }
+    }
+}
+
+/// Transposes the `RowSize` by `ColumnSize` matrix.
+template <ArithmeticType T, Size RowSize, Size ColumnSize>
+inline constexpr void TransposeMatrixScalar(const T* matrix,
+                                            T*       result) noexcept
+{
+    for (Size column = 0; column < ColumnSize; column++)
+    {
+        for (Size row = 0; row < RowSize; row++)
+            result[row * ColumnSize + column] = matrix[column * RowSize + row];
+    }
+}
+
+/// Inverts the 4 by 4 matrix using the 2 by 2 sub-determinants, the inverse of the transposed matrix
+/// is the transposed inverse, so the layout of the elements doesn't matter.
+template <FloatingPointType T>
+inline constexpr void InverseMatrix4x4Scalar(const T* m,
+                                             T*       result) noexcept
+{
+    const T s0 = m[0] * m[5] - m[4] * m[1];
+    const T s1 = m[0] * m[6] - m[4] * m[2];
+    const T s2 = m[0] * m[7] - m[4] * m[3];
+    const T s3 = m[1] * m[6] - m[5] * m[2];
+    const T s4 = m[1] * m[7] - m[5] * m[3];
+    const T s5 = m[2] * m[7] - m[6] * m[3];
+
+    const T c5 = m[10] * m[15] - m[14] * m[11];
+    const T c4 = m[9] * m[15] - m[13] * m[11];
+    const T c3 = m[9] * m[14] - m[13] * m[10];
+    const T c2 = m[8] * m[15] - m[12] * m[11];
+    const T c1 = m[8] * m[14] - m[12] * m[10];
+    const T c0 = m[8] * m[13] - m[12] * m[9];
+
+    const T inverseDeterminant = T(1) / (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
+
+    result[0]  = (m[5] * c5 - m[6] * c4 + m[7] * c3) * inverseDeterminant;
+    result[1]  = (-m[1] * c5 + m[2] * c4 - m[3] * c3) * inverseDeterminant;
+    result[2]  = (m[13] * s5 - m[14] * s4 + m[15] * s3) * inverseDeterminant;
+    result[3]  = (-m[9] * s5 + m[10] * s4 - m[11] * s3) * inverseDeterminant;
+    result[4]  = (-m[4] * c5 + m[6] * c2 - m[7] * c1) * inverseDeterminant;
+    result[5]  = (m[0] * c5 - m[2] * c2 + m[3] * c1) * inverseDeterminant;
+    result[6]  = (-m[12] * s5 + m[14] * s2 - m[15] * s1) * inverseDeterminant;
+    result[7]  = (m[8] * s5 - m[10] * s2 + m[11] * s1) * inverseDeterminant;
+    result[8]  = (m[4] * c4 - m[5] * c2 + m[7] * c0) * inverseDeterminant;
+    result[9]  = (-m[0] * c4 + m[1] * c2 - m[3] * c0) * inverseDeterminant;
+    result[10] = (m[12] * s4 - m[13] * s2 + m[15] * s0) * inverseDeterminant;
+    result[11] = (-m[8] * s4 + m[9] * s2 - m[11] * s0) * inverseDeterminant;
+    result[12] = (-m[4] * c3 + m[5] * c1 - m[6] * c0) * inverseDeterminant;
+    result[13] = (m[0] * c3 - m[1] * c1 + m[2] * c0) * inverseDeterminant;
+    result[14] = (-m[12] * s3 + m[13] * s1 - m[14] * s0) * inverseDeterminant;
+    result[15] = (m[8] * s3 - m[9] * s1 + m[10] * s0) * inverseDeterminant;
+}
+
+/// Transforms the vector by the 4 by 4 matrix.
+template <ArithmeticType T>
+inline constexpr void TransformVector4Scalar(const T* matrix,
+                                             const T* vector,
+                                             T*       result) noexcept
+{
+    for (Size row = 0; row < 4; row++)
+    {
+        result[row] = matrix[row] * vector[0] +
+                      matrix[4 + row] * vector[1] +
+                      matrix[8 + row] * vector[2] +
+                      matrix[12 + row] * vector[3];
+    }
+}
+
+#if defined(AXIS_SIMD_SSE2)
+
+/// The SIMD kernels for the 4 by 4 `Float32` matrices are available.
+constexpr Bool IsMatrix4x4SimdAvailable = true;
+
+/// Multiplies the 4 by 4 matrices, each column of the result is the sum of the left columns scaled by the right column.
+inline void MultiplyMatrix4x4Simd(const Float32* left,
+                                  const Float32* right,
+                                  Float32*       result) noexcept
+{
+#    if defined(AXIS_SIMD_AVX2)
+    // Both halves of the registers hold the same left column, two result columns are computed at once.
+    const __m256 left0 = _mm256_broadcast_ps((const __m128*)left);
+    const __m256 left1 = _mm256_broadcast_ps((const __m128*)(left + 4));
+    const __m256 left2 = _mm256_broadcast_ps((const __m128*)(left + 8));
+    const __m256 left3 = _mm256_broadcast_ps((const __m128*)(left + 12));
+
+    for (Size column = 0; column < 4; column += 2)
+    {
+        const __m256 rightColumns = _mm256_loadu_ps(right + column * 4);
+
+        __m256 sum = _mm256_mul_ps(left0, _mm256_permute_ps(rightColumns, _MM_SHUFFLE(0, 0, 0, 0)));
+        sum        = _mm256_add_ps(sum, _mm256_mul_ps(left1, _mm256_permute_ps(rightColumns, _MM_SHUFFLE(1, 1, 1, 1))));
+        sum        = _mm256_add_ps(sum, _mm256_mul_ps(left2, _mm256_permute_ps(rightColumns, _MM_SHUFFLE(2, 2, 2, 2))));
+        sum        = _mm256_add_ps(sum, _mm256_mul_ps(left3, _mm256_permute_ps(rightColumns, _MM_SHUFFLE(3, 3, 3, 3))));
+
+        _mm256_storeu_ps(result + column * 4, sum);
+    }
+#    else
+    const __m128 left0 = _mm_loadu_ps(left);
+    const __m128 left1 = _mm_loadu_ps(left + 4);
+    const __m128 left2 = _mm_loadu_ps(left + 8);
+    const __m128 left3 = _mm_loadu_ps(left + 12);
+
+    for (Size column = 0; column < 4; column++)
+    {
+        const __m128 rightColumn = _mm_loadu_ps(right + column * 4);
+
+        __m128 sum = _mm_mul_ps(left0, _mm_shuffle_ps(rightColumn, rightColumn, _MM_SHUFFLE(0, 0, 0, 0)));
+        sum        = _mm_add_ps(sum, _mm_mul_ps(left1, _mm_shuffle_ps(rightColumn, rightColumn, _MM_SHUFFLE(1, 1, 1, 1))));
+        sum        = _mm_add_ps(sum, _mm_mul_ps(left2, _mm_shuffle_ps(rightColumn, rightColumn, _MM_SHUFFLE(2, 2, 2, 2))));
+        sum        = _mm_add_ps(sum, _mm_mul_ps(left3, _mm_shuffle_ps(rightColumn, rightColumn, _MM_SHUFFLE(3, 3, 3, 3))));
+
+        _mm_storeu_ps(result + column * 4, sum);
+    }
+#    endif
+}
+
+/// Transposes the 4 by 4 matrix.
+inline void TransposeMatrix4x4Simd(const Float32* matrix,
+                                   Float32*       result) noexcept
+{
+    __m128 column0 = _mm_loadu_ps(matrix);
+    __m128 column1 = _mm_loadu_ps(matrix + 4);
+    __m128 column2 = _mm_loadu_ps(matrix + 8);
+    __m128 column3 = _mm_loadu_ps(matrix + 12);
+
+    _MM_TRANSPOSE4_PS(column0, column1, column2, column3);
+
+    _mm_storeu_ps(result, column0);
+    _mm_storeu_ps(result + 4, column1);
+    _mm_storeu_ps(result + 8, column2);
+    _mm_storeu_ps(result + 12, column3);
+}
+
+/// Multiplies the 2 by 2 matrices packed as (m00, m01, m10, m11).
+inline __m128 MultiplyMatrix2x2(__m128 left,
+                                __m128 right) noexcept
+{
+    return _mm_add_ps(_mm_mul_ps(left, _mm_shuffle_ps(right, right, _MM_SHUFFLE(3, 0, 3, 0))),
+                      _mm_mul_ps(_mm_shuffle_ps(left, left, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(right, right, _MM_SHUFFLE(1, 2, 1, 2))));
+}
+
+/// Multiplies the adjugate of the left 2 by 2 matrix with the right one.
+inline __m128 MultiplyAdjugateMatrix2x2(__m128 left,
+                                        __m128 right) noexcept
+{
+    return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(left, left, _MM_SHUFFLE(0, 0, 3, 3)), right),
+                      _mm_mul_ps(_mm_shuffle_ps(left, left, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(right, right, _MM_SHUFFLE(1, 0, 3, 2))));
+}
+
+/// Multiplies the left 2 by 2 matrix with the adjugate of the right one.
+inline __m128 MultiplyMatrix2x2Adjugate(__m128 left,
+                                        __m128 right) noexcept
+{
+    return _mm_sub_ps(_mm_mul_ps(left, _mm_shuffle_ps(right, right, _MM_SHUFFLE(0, 3, 0, 3))),
+                      _mm_mul_ps(_mm_shuffle_ps(left, left, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(right, right, _MM_SHUFFLE(1, 2, 1, 2))));
+}
+
+/// Inverts the 4 by 4 matrix by the blockwise inversion of its 2 by 2 sub-matrices:
+///
+///     | A B |^-1                | (|D|A - B(D#C))#   (|B|C - D(A#B)#)# |
+///     | C D |     = 1 / |M| *   | (|C|B - A(D#C)#)#  (|A|D - C(A#B))#  |
+///
+/// where X# is the adjugate and |M| = |A||D| + |B||C| - tr((A#B)(D#C)).
+inline void InverseMatrix4x4Simd(const Float32* matrix,
+                                 Float32*       result) noexcept
+{
+    const __m128 row0 = _mm_loadu_ps(matrix);
+    const __m128 row1 = _mm_loadu_ps(matrix + 4);
+    const __m128 row2 = _mm_loadu_ps(matrix + 8);
+    const __m128 row3 = _mm_loadu_ps(matrix + 12);
+
+    const __m128 a = _mm_movelh_ps(row0, row1);
+    const __m128 b = _mm_movehl_ps(row1, row0);
+    const __m128 c = _mm_movelh_ps(row2, row3);
+    const __m128 d = _mm_movehl_ps(row3, row2);
+
+    // (|A|, |B|, |C|, |D|)
+    const __m128 subDeterminants = _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(row0, row2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(row1, row3, _MM_SHUFFLE(3, 1, 3, 1))),
+                                              _mm_mul_ps(_mm_shuffle_ps(row0, row2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(row1, row3, _MM_SHUFFLE(2, 0, 2, 0))));
+
+    const __m128 determinantA = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(0, 0, 0, 0));
+    const __m128 determinantB = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(1, 1, 1, 1));
+    const __m128 determinantC = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(2, 2, 2, 2));
+    const __m128 determinantD = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(3, 3, 3, 3));
+
+    const __m128 adjugateDC = MultiplyAdjugateMatrix2x2(d, c);
+    const __m128 adjugateAB = MultiplyAdjugateMatrix2x2(a, b);
+
+    __m128 x = _mm_sub_ps(_mm_mul_ps(determinantD, a), MultiplyMatrix2x2(b, adjugateDC));
+    __m128 w = _mm_sub_ps(_mm_mul_ps(determinantA, d), MultiplyMatrix2x2(c, adjugateAB));
+    __m128 y = _mm_sub_ps(_mm_mul_ps(determinantB, c), MultiplyMatrix2x2Adjugate(d, adjugateAB));
+    __m128 z = _mm_sub_ps(_mm_mul_ps(determinantC, b), MultiplyMatrix2x2Adjugate(a, adjugateDC));
+
+    // tr((A#B)(D#C)) broadcasted to every lane
+    __m128 trace = _mm_mul_ps(adjugateAB, _mm_shuffle_ps(adjugateDC, adjugateDC, _MM_SHUFFLE(3, 1, 2, 0)));
+    trace        = _mm_add_ps(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(1, 0, 3, 2)));
+    trace        = _mm_add_ps(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(2, 3, 0, 1)));
+
+    const __m128 determinant = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(determinantA, determinantD), _mm_mul_ps(determinantB, determinantC)), trace);
+
+    // (1/|M|, -1/|M|, -1/|M|, 1/|M|), the signs of the adjugate
+    const __m128 inverseDeterminant = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), determinant);
+
+    x = _mm_mul_ps(x, inverseDeterminant);
+    y = _mm_mul_ps(y, inverseDeterminant);
+    z = _mm_mul_ps(z, inverseDeterminant);
+    w = _mm_mul_ps(w, inverseDeterminant);
+
+    // Swaps the diagonals of the adjugates while storing the blocks
+    _mm_storeu_ps(result, _mm_shuffle_ps(x, y, _MM_SHUFFLE(1, 3, 1, 3)));
+    _mm_storeu_ps(result + 4, _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 2, 0, 2)));
+    _mm_storeu_ps(result + 8, _mm_shuffle_ps(z, w, _MM_SHUFFLE(1, 3, 1, 3)));
+    _mm_storeu_ps(result + 12, _mm_shuffle_ps(z, w, _MM_SHUFFLE(0, 2, 0, 2)));
+}
+
+/// Transforms the vector by the 4 by 4 matrix.
+inline void TransformVector4Simd(const Float32* matrix,
+                                 const Float32* vector,
+                                 Float32*       result) noexcept
+{
+    __m128 sum = _mm_mul_ps(_mm_loadu_ps(matrix), _mm_set1_ps(vector[0]));
+    sum        = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(matrix + 4), _mm_set1_ps(vector[1])));
+    sum        = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(matrix + 8), _mm_set1_ps(vector[2])));
+    sum        = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(matrix + 12), _mm_set1_ps(vector[3])));
+
+    _mm_storeu_ps(result, sum);
+}
+
+#elif defined(AXIS_SIMD_NEON)
+
+/// The SIMD kernels for the 4 by 4 `Float32` matrices are available.
+constexpr Bool IsMatrix4x4SimdAvailable = true;
+
+/// Multiplies the 4 by 4 matrices, each column of the result is the sum of the left columns scaled by the right column.
+inline void MultiplyMatrix4x4Simd(const Float32* left,
+                                  const Float32* right,
+                                  Float32*       result) noexcept
+{
+    const float32x4_t left0 = vld1q_f32(left);
+    const float32x4_t left1 = vld1q_f32(left + 4);
+    const float32x4_t left2 = vld1q_f32(left + 8);
+    const float32x4_t left3 = vld1q_f32(left + 12);
+
+    for (Size column = 0; column < 4; column++)
+    {
+        const Float32* rightColumn = right + column * 4;
+
+        float32x4_t sum = vmulq_n_f32(left0, rightColumn[0]);
+        sum             = vmlaq_n_f32(sum, left1, rightColumn[1]);
+        sum             = vmlaq_n_f32(sum, left2, rightColumn[2]);
+        sum             = vmlaq_n_f32(sum, left3, rightColumn[3]);
+
+        vst1q_f32(result + column * 4, sum);
+    }
+}
+
+/// Transposes the 4 by 4 matrix, the de-interleaving load gathers the rows.
+inline void TransposeMatrix4x4Simd(const Float32* matrix,
+                                   Float32*       result) noexcept
+{
+    const float32x4x4_t rows = vld4q_f32(matrix);
+
+    vst1q_f32(result, rows.val[0]);
+    vst1q_f32(result + 4, rows.val[1]);
+    vst1q_f32(result + 8, rows.val[2]);
+    vst1q_f32(result + 12, rows.val[3]);
+}
+
+/// NEON doesn't have the blockwise inversion kernel.
+inline void InverseMatrix4x4Simd(const Float32* matrix,
+                                 Float32*       result) noexcept
+{
+    InverseMatrix4x4Scalar(matrix, result);
+}
+
+/// Transforms the vector by the 4 by 4 matrix.
+inline void TransformVector4Simd(const Float32* matrix,
+                                 const Float32* vector,
+                                 Float32*       result) noexcept
+{
+    float32x4_t sum = vmulq_n_f32(vld1q_f32(matrix), vector[0]);
+    sum             = vmlaq_n_f32(sum, vld1q_f32(matrix + 4), vector[1]);
+    sum             = vmlaq_n_f32(sum, vld1q_f32(matrix + 8), vector[2]);
+    sum             = vmlaq_n_f32(sum, vld1q_f32(matrix + 12), vector[3]);
+
+    vst1q_f32(result, sum);
+}
+
+#else
+
+/// The SIMD kernels for the 4 by 4 `Float32` matrices aren't available, the scalar ones are used.
+constexpr Bool IsMatrix4x4SimdAvailable = false;
+
+#endif
+
+/// Selects the SIMD kernel for the 4 by 4 `Float32` matrices at run time.
+template <ArithmeticType T, Size RowSize, Size CommonSize, Size ColumnSize>
+inline constexpr void MultiplyMatrix(const T* left,
+                                     const T* right,
+                                     T*       result) noexcept
+{
+    if constexpr (IsMatrix4x4SimdAvailable && std::is_same_v<T, Float32> && RowSize == 4 && CommonSize == 4 && ColumnSize == 4)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            MultiplyMatrix4x4Simd(left, right, result);
+            return;
+        }
+    }
+
+    MultiplyMatrixScalar<T, RowSize, CommonSize, ColumnSize>(left, right, result);
+}
+
+/// Selects the SIMD kernel for the 4 by 4 `Float32` matrices at run time.
+template <ArithmeticType T, Size RowSize, Size ColumnSize>
+inline constexpr void TransposeMatrix(const T* matrix,
+                                      T*       result) noexcept
+{
+    if constexpr (IsMatrix4x4SimdAvailable && std::is_same_v<T, Float32> && RowSize == 4 && ColumnSize == 4)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            TransposeMatrix4x4Simd(matrix, result);
+            return;
+        }
+    }
+
+    TransposeMatrixScalar<T, RowSize, ColumnSize>(matrix, result);
+}
+
+/// Selects the SIMD kernel for the `Float32` matrices at run time.
+template <FloatingPointType T>
+inline constexpr void InverseMatrix4x4(const T* matrix,
+                                       T*       result) noexcept
+{
+    if constexpr (IsMatrix4x4SimdAvailable && std::is_same_v<T, Float32>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            InverseMatrix4x4Simd(matrix, result);
+            return;
+        }
+    }
+
+    InverseMatrix4x4Scalar(matrix, result);
+}
+
+/// Selects the SIMD kernel for the `Float32` matrices at run time.
+template <ArithmeticType T>
+inline constexpr void TransformVector4(const T* matrix,
+                                       const T* vector,
+                                       T*       result) noexcept
+{
+    if constexpr (IsMatrix4x4SimdAvailable && std::is_same_v<T, Float32>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            TransformVector4Simd(matrix, vector, result);
+            return;
+        }
+    }
+
+    TransformVector4Scalar(matrix, vector, result);
+}
+
+} // namespace Detail
+
 template <ArithmeticType T, Size RowSize, Size ColumnSize, Bool IsColumnMajor>
 inline constexpr Matrix<T, RowSize, ColumnSize, IsColumnMajor>::Matrix() noexcept {}
 
@@ -33,67 +434,52 @@ inline constexpr Matrix<T, RowSize, ColumnSize, IsColumnMajor>::Matrix(const T (
 }
 
 template <ArithmeticType T, Size RowSize, Size ColumnSize, Bool IsColumnMajor>
-inline constexpr const T& Matrix<T, RowSize, ColumnSize, IsColumnMajor>::operator()(Size row, Size column) const noexcept
+inline constexpr Size Matrix<T, RowSize, ColumnSize, IsColumnMajor>::GetIndex(Size row, Size column) noexcept
 {
-    AXIS_VALIDATE(row < RowSize, "`row` index was out of range!");
-    AXIS_VALIDATE(row < RowSize, "`column` index was out of range!");
-
     if constexpr (IsColumnMajor)
     {
-        return _matrices[column * RowSize + row];
+        return column * RowSize + row;
     }
     else
     {
-        return _matrices[row * ColumnSize + column];
+        return row * ColumnSize + column;
     }
 }
 
+template <ArithmeticType T, Size RowSize, Size ColumnSize, Bool IsColumnMajor>
+inline constexpr const T& Matrix<T, RowSize, ColumnSize, IsColumnMajor>::operator()(Size row, Size column) const noexcept
+{
+    AXIS_VALIDATE(row < RowSize, "`row` index was out of range!");
+    AXIS_VALIDATE(column < ColumnSize, "`column` index was out of range!");
+
+    return _matrices[GetIndex(row, column)];
+}
+
 template <ArithmeticType T, Size RowSize, Size ColumnSize, Bool IsColumnMajor>
 inline constexpr T& Matrix<T, RowSize, ColumnSize, IsColumnMajor>::operator()(Size row, Size column) noexcept
 {
     AXIS_VALIDATE(row < RowSize, "`row` index was out of range!");
-    AXIS_VALIDATE(row < RowSize, "`column` index was out of range!");
+    AXIS_VALIDATE(column < ColumnSize, "`column` index was out of range!");
 
-    if constexpr (IsColumnMajor)
-    {
-        return _matrices[column * RowSize + row];
-    }
-    else
-    {
-        return _matrices[row * ColumnSize + column];
-    }
+    return _matrices[GetIndex(row, column)];
 }
 
 template <ArithmeticType T, Size RowSize, Size ColumnSize, Bool IsColumnMajor>
 inline constexpr const T& Matrix<T, RowSize, ColumnSize, IsColumnMajor>::At(Size row, Size column) const noexcept
 {
     AXIS_VALIDATE(row < RowSize, "`row` index was out of range!");
-    AXIS_VALIDATE(row < RowSize, "`column` index was out of range!");
+    AXIS_VALIDATE(column < ColumnSize, "`column` index was out of range!");
 
-    if constexpr (IsColumnMajor)
-    {
-        return _matrices[column * RowSize + row];
-    }
-    else
-    {
-        return _matrices[row * ColumnSize + column];
-    }
+    return _matrices[GetIndex(row, column)];
 }
 
 template <ArithmeticType T, Size RowSize, Size ColumnSize, Bool IsColumnMajor>
 inline constexpr T& Matrix<T, RowSize, ColumnSize, IsColumnMajor>::At(Size row, Size column) noexcept
 {
     AXIS_VALIDATE(row < RowSize, "`row` index was out of range!");
-    AXIS_VALIDATE(row < RowSize, "`column` index was out of range!");
+    AXIS_VALIDATE(column < ColumnSize, "`column` index was out of range!");
 
-    if constexpr (IsColumnMajor)
-    {
-        return _matrices[column * RowSize + row];
-    }
-    else
-    {
-        return _matrices[row * ColumnSize + column];
-    }
+    return _matrices[GetIndex(row, column)];
 }
 
 template <ArithmeticType T, Size RowSize, Size ColumnSize, Bool IsColumnMajor>
@@ -104,17 +490,11 @@ inline constexpr Matrix<T, RowSize, OtherColumnSize, IsColumnMajor> Matrix<T, Ro
 
     Matrix<T, RowSize, OtherColumnSize, IsColumnMajor> matrixToReturn = {};
 
-    for (Size row = 0; row < RowSize; row++)
-    {
-        for (Size column = 0; column < OtherColumnSize; column++)
-        {
-            T result = 0;
-            for (Size commonSize = 0; commonSize < ColumnSize; commonSize++)
-                result += At(row, commonSize) * other(commonSize, column);
-
-            matrixToReturn(row, column) = result;
-        }
-    }
+    // The row-major product is the transposed column-major product of the swapped operands.
+    if constexpr (IsColumnMajor)
+        Detail::MultiplyMatrix<T, RowSize, ColumnSize, OtherColumnSize>(_matrices, other._matrices, matrixToReturn._matrices);
+    else
+        Detail::MultiplyMatrix<T, OtherColumnSize, ColumnSize, RowSize>(other._matrices, _matrices, matrixToReturn._matrices);
 
     return matrixToReturn;
 }
@@ -142,6 +522,62 @@ inline constexpr Matrix<T, RowSize, ColumnSize, IsColumnMajor> Matrix<T, RowSize
     return matrixToReturn;
 }
 
+template <ArithmeticType T, Size RowSize, Size ColumnSize, Bool IsColumnMajor>
+inline constexpr Matrix<T, ColumnSize, RowSize, IsColumnMajor> Matrix<T, RowSize, ColumnSize, IsColumnMajor>::GetTransposed() const noexcept
+{
+    Matrix<T, ColumnSize, RowSize, IsColumnMajor> matrixToReturn = {};
+
+    if constexpr (IsColumnMajor)
+        Detail::TransposeMatrix<T, RowSize, ColumnSize>(_matrices, matrixToReturn._matrices);
+    else
+        Detail::TransposeMatrix<T, ColumnSize, RowSize>(_matrices, matrixToReturn._matrices);
+
+    return matrixToReturn;
+}
+
+template <ArithmeticType T, Size RowSize, Size ColumnSize, Bool IsColumnMajor>
+inline constexpr Matrix<T, RowSize, ColumnSize, IsColumnMajor> Matrix<T, RowSize, ColumnSize, IsColumnMajor>::GetInverse() const noexcept requires(RowSize == 4 && ColumnSize == 4 && FloatingPointType<T>)
+{
+    Matrix matrixToReturn = {};
+
+    Detail::InverseMatrix4x4(_matrices, matrixToReturn._matrices);
+
+    return matrixToReturn;
+}
+
+template <ArithmeticType T, Size RowSize, Size ColumnSize, Bool IsColumnMajor>
+inline constexpr Vector3<T> Matrix<T, RowSize, ColumnSize, IsColumnMajor>::TransformPoint(const Vector3<T>& point) const noexcept requires(RowSize == 4 && ColumnSize == 4)
+{
+    return Transform(point, T(1));
+}
+
+template <ArithmeticType T, Size RowSize, Size ColumnSize, Bool IsColumnMajor>
+inline constexpr Vector3<T> Matrix<T, RowSize, ColumnSize, IsColumnMajor>::TransformDirection(const Vector3<T>& direction) const noexcept requires(RowSize == 4 && ColumnSize == 4)
+{
+    return Transform(direction, T(0));
+}
+
+template <ArithmeticType T, Size RowSize, Size ColumnSize, Bool IsColumnMajor>
+inline constexpr Vector3<T> Matrix<T, RowSize, ColumnSize, IsColumnMajor>::Transform(const Vector3<T>& vector, T w) const noexcept requires(RowSize == 4 && ColumnSize == 4)
+{
+    const T vectorElements[4] = {vector.X, vector.Y, vector.Z, w};
+    T       result[4]         = {};
+
+    if constexpr (IsColumnMajor)
+    {
+        Detail::TransformVector4(_matrices, vectorElements, result);
+    }
+    else
+    {
+        T columnMajor[16] = {};
+
+        Detail::TransposeMatrix<T, 4, 4>(_matrices, columnMajor);
+        Detail::TransformVector4(columnMajor, vectorElements, result);
+    }
+
+    return Vector3<T>(result[0], result[1], result[2]);
+}
+
 template <ArithmeticType T, Size RowSize, Size ColumnSize, Bool IsColumnMajor>
 inline constexpr Matrix<T, RowSize, ColumnSize, IsColumnMajor> Matrix<T, RowSize, ColumnSize, IsColumnMajor>::GetTranslationMatrix(const Vector3<T>& translation) noexcept requires(RowSize == 4 && ColumnSize == 4)
 {
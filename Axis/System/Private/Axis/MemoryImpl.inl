@@ -25,13 +25,54 @@ struct ArrayMemoryHeader
     PVoid OriginalPtr;
 };
 
+// The stateful allocators are kept along with the memory, so the memory is freed through the same
+// instance (e.g. the memory resource selected at the allocation time).
+template <class Allocator>
+inline constexpr Bool StoresAllocator = !std::is_empty_v<Allocator>;
+
+// Placed right before the object allocated by a stateful allocator.
+template <class Allocator>
+struct AllocatedObjectHeader
+{
+    Allocator AllocatorInstance;
+    PVoid     OriginalPtr;
+};
+
+// Offset of the object from the start of the memory block, keeps both the object and the header aligned.
+template <class Allocator, class T>
+inline constexpr Size AllocatedObjectOffset = (sizeof(AllocatedObjectHeader<Allocator>) + alignof(T) - 1) / alignof(T) * alignof(T);
+
+// Offset of the allocator stored at the start of the array memory block.
+template <class Allocator>
+inline constexpr Size ArrayAllocatorSize = StoresAllocator<Allocator> ? sizeof(Allocator) : 0;
+
 } // namespace Detail
 
 template <AllocatorType AllocatorType, RawType T, class... Args>
 inline T* AllocatedNew(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>) requires(std::is_constructible_v<T, Args...>)
 {
-    // Allocates memory of the specified size
-    PVoid memoryPtr = AllocatorType::Allocate(sizeof(T), alignof(T));
+    AllocatorType allocator = AllocatorType();
+
+    PVoid originalMemory = nullptr;
+    PVoid memoryPtr      = nullptr;
+
+    if constexpr (Detail::StoresAllocator<AllocatorType>)
+    {
+        using Header = Detail::AllocatedObjectHeader<AllocatorType>;
+
+        constexpr Size Offset    = Detail::AllocatedObjectOffset<AllocatorType, T>;
+        constexpr Size Alignment = alignof(T) > alignof(Header) ? alignof(T) : alignof(Header);
+
+        // Allocates memory of the specified size, the header goes in front of the object
+        originalMemory = allocator.Allocate(Offset + sizeof(T), Alignment);
+        memoryPtr      = (PVoid)((Size)originalMemory + Offset);
+    }
+    else
+    {
+        // Allocates memory of the specified size
+        originalMemory = allocator.Allocate(sizeof(T), alignof(T));
+        memoryPtr      = originalMemory;
+    }
 
     if constexpr (::std::is_nothrow_constructible_v<T, Args...>)
     {
@@ -48,13 +89,16 @@ inline T* AllocatedNew(Args&&... args) noexcept(std::is_nothrow_constructible_v<
         catch (...)
         {
             // Frees the memory
-            AllocatorType::Deallocate(memoryPtr);
+            allocator.Deallocate(originalMemory);
 
             // Rethrows the exception
             throw;
         }
     }
 
+    if constexpr (Detail::StoresAllocator<AllocatorType>)
+        new ((Detail::AllocatedObjectHeader<AllocatorType>*)memoryPtr - 1) Detail::AllocatedObjectHeader<AllocatorType>{std::move(allocator), originalMemory};
+
     // Returns the pointer to the allocated memory
     return (T*)memoryPtr;
 }
@@ -65,14 +109,16 @@ inline T* AllocatedNewArray(Size elementCount) noexcept(std::is_nothrow_default_
     constexpr auto ElementSize  = sizeof(T);
     constexpr auto ElementAlign = alignof(T);
 
-    // Calculates the padding size.
-    Int64 offset = alignof(T) - 1 + sizeof(Detail::ArrayMemoryHeader);
+    AllocatorType allocator = AllocatorType();
+
+    // Calculates the padding size, the stateful allocator is stored at the start of the memory.
+    Int64 offset = alignof(T) - 1 + sizeof(Detail::ArrayMemoryHeader) + Detail::ArrayAllocatorSize<AllocatorType>;
 
     // Size of memory to allocate for the array
     auto memorySize = (elementCount * sizeof(T)) + offset;
 
     // Malloc'ed memory
-    PVoid originalMemory = AllocatorType::Allocate(memorySize, 1);
+    PVoid originalMemory = allocator.Allocate(memorySize, Detail::StoresAllocator<AllocatorType> ? alignof(AllocatorType) : 1);
 
     // Calculates the aligned memory address.
     PVoid* alignedMemory = (PVoid*)(((Size)(originalMemory) + offset) & ~(alignof(T) - 1)); // Aligned block
@@ -116,13 +162,16 @@ inline T* AllocatedNewArray(Size elementCount) noexcept(std::is_nothrow_default_
                 objectArray[i - 1].~T();
 
             // Frees the memory
-            AllocatorType::Deallocate(originalMemory);
+            allocator.Deallocate(originalMemory);
 
             // Rethrows the exception
             throw;
         }
     }
 
+    if constexpr (Detail::StoresAllocator<AllocatorType>)
+        new (originalMemory) AllocatorType(std::move(allocator));
+
     // Returns the pointer to the allocated memory
     return objectArray;
 }
@@ -130,11 +179,28 @@ inline T* AllocatedNewArray(Size elementCount) noexcept(std::is_nothrow_default_
 template <AllocatorType AllocatorType, RawConstableType T>
 void AllocatedDelete(T* instance) noexcept
 {
+    PVoid memoryPtr = (PVoid) const_cast<std::remove_const_t<T*>>(instance);
+
     // Invokes the destructor
     instance->~T();
 
-    // Frees the memory
-    AllocatorType::Deallocate((PVoid) const_cast<std::remove_const_t<T*>>(instance));
+    if constexpr (Detail::StoresAllocator<AllocatorType>)
+    {
+        auto header = (Detail::AllocatedObjectHeader<AllocatorType>*)memoryPtr - 1;
+
+        // Frees the memory through the allocator which allocated it
+        AllocatorType allocator      = std::move(header->AllocatorInstance);
+        PVoid         originalMemory = header->OriginalPtr;
+
+        header->~AllocatedObjectHeader();
+
+        allocator.Deallocate(originalMemory);
+    }
+    else
+    {
+        // Frees the memory
+        AllocatorType().Deallocate(memoryPtr);
+    }
 }
 
 template <AllocatorType AllocatorType, RawConstableType T>
@@ -155,8 +221,58 @@ void AllocatedDeleteArray(T* array) noexcept
     for (Size i = elementCount; i > 0; --i)
         array[i - 1].~T();
 
-    // Frees the memory
-    AllocatorType::Deallocate(originalMemory);
+    if constexpr (Detail::StoresAllocator<AllocatorType>)
+    {
+        // Frees the memory through the allocator which allocated it
+        AllocatorType allocator = std::move(*(AllocatorType*)originalMemory);
+
+        ((AllocatorType*)originalMemory)->~AllocatorType();
+
+        allocator.Deallocate(originalMemory);
+    }
+    else
+    {
+        // Frees the memory
+        AllocatorType().Deallocate(originalMemory);
+    }
+}
+
+template <AllocatorType Allocator>
+inline PVoid AllocatorMemoryResource<Allocator>::Allocate(Size size, Size alignment)
+{
+    return _allocator.Allocate(size, alignment);
+}
+
+template <AllocatorType Allocator>
+inline void AllocatorMemoryResource<Allocator>::Deallocate(PVoid ptr) noexcept
+{
+    _allocator.Deallocate(ptr);
+}
+
+inline PolymorphicAllocator::PolymorphicAllocator() noexcept :
+    _memoryResource(GetDefaultMemoryResource()) {}
+
+inline PolymorphicAllocator::PolymorphicAllocator(MemoryResource* memoryResource) noexcept :
+    _memoryResource(memoryResource ? memoryResource : GetDefaultMemoryResource()) {}
+
+inline PVoid PolymorphicAllocator::Allocate(Size size, Size alignment) const
+{
+    return _memoryResource->Allocate(size, alignment);
+}
+
+inline void PolymorphicAllocator::Deallocate(PVoid ptr) const noexcept
+{
+    _memoryResource->Deallocate(ptr);
+}
+
+inline MemoryResource* PolymorphicAllocator::GetMemoryResource() const noexcept
+{
+    return _memoryResource;
+}
+
+inline Bool PolymorphicAllocator::operator==(const PolymorphicAllocator& other) const noexcept
+{
+    return _memoryResource == other._memoryResource;
 }
 
 } // namespace System
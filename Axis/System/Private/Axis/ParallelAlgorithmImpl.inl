@@ -0,0 +1,288 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#ifndef AXIS_SYSTEM_PARALLELALGORITHMIMPL_INL
+#define AXIS_SYSTEM_PARALLELALGORITHMIMPL_INL
+#pragma once
+
+#include "../../Include/Axis/ParallelAlgorithm.hpp"
+#include <algorithm>
+#include <iterator>
+
+namespace Axis
+{
+
+namespace System
+{
+
+namespace Detail
+{
+
+/// Finds how many elements of the \a `first` range are among the first \a `outputIndex` elements of
+/// the merged ranges (the merge path), the elements of the \a `first` range go first on ties.
+template <class T, class Compare>
+inline Size FindMergeSplit(const T*       first,
+                           Size           firstLength,
+                           const T*       second,
+                           Size           secondLength,
+                           Size           outputIndex,
+                           const Compare& compare)
+{
+    Size low  = outputIndex > secondLength ? outputIndex - secondLength : 0;
+    Size high = outputIndex < firstLength ? outputIndex : firstLength;
+
+    while (low < high)
+    {
+        const Size middle = low + (high - low) / 2;
+
+        // The element `first[middle]` belongs before the split if it doesn't go after the last
+        // element of the second range taken.
+        if (!compare(second[outputIndex - middle - 1], first[middle]))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    return low;
+}
+
+/// Merges the sorted runs of the \a `runLength` elements in pairs from the \a `source` to the
+/// \a `destination`, every chunk merges its own part of the output.
+template <class T, class Compare>
+inline void MergeParallelRuns(JobSystem&     jobSystem,
+                              T*             source,
+                              T*             destination,
+                              Size           count,
+                              Size           runLength,
+                              Size           chunkSize,
+                              const Compare& compare)
+{
+    ParallelForChunks(jobSystem, count, chunkSize, [&](Size begin, Size end) {
+        // The pairs start at the multiples of the chunk size, the chunk never crosses them.
+        const Size pairBegin  = begin - begin % (runLength * 2);
+        const Size pairMiddle = std::min(pairBegin + runLength, count);
+        const Size pairEnd    = std::min(pairBegin + runLength * 2, count);
+
+        const T*   first        = source + pairBegin;
+        const T*   second       = source + pairMiddle;
+        const Size firstLength  = pairMiddle - pairBegin;
+        const Size secondLength = pairEnd - pairMiddle;
+
+        const Size firstBegin = FindMergeSplit(first, firstLength, second, secondLength, begin - pairBegin, compare);
+        const Size firstEnd   = FindMergeSplit(first, firstLength, second, secondLength, end - pairBegin, compare);
+
+        std::merge(std::make_move_iterator(source + pairBegin + firstBegin),
+                   std::make_move_iterator(source + pairBegin + firstEnd),
+                   std::make_move_iterator(source + pairMiddle + (begin - pairBegin - firstBegin)),
+                   std::make_move_iterator(source + pairMiddle + (end - pairBegin - firstEnd)),
+                   destination + begin,
+                   compare);
+    });
+}
+
+} // namespace Detail
+
+template <class Function>
+inline void ParallelFor(JobSystem&      jobSystem,
+                        Size            begin,
+                        Size            end,
+                        Size            grainSize,
+                        const Function& function) requires(std::is_invocable_v<const Function&, Size>)
+{
+    if (begin >= end)
+        return;
+
+    const Size count = end - begin;
+
+    Detail::ParallelForChunks(jobSystem, count, Detail::GetParallelChunkSize(jobSystem, count, grainSize), [&](Size chunkBegin, Size chunkEnd) {
+        for (Size i = begin + chunkBegin; i < begin + chunkEnd; ++i)
+            function(i);
+    });
+}
+
+template <class T, AllocatorType Allocator, class Function>
+inline void ParallelFor(JobSystem&          jobSystem,
+                        List<T, Allocator>& list,
+                        Size                grainSize,
+                        const Function&     function) requires(std::is_invocable_v<const Function&, T&>)
+{
+    T* const data = list.GetData();
+
+    ParallelFor(jobSystem, 0, list.GetLength(), grainSize, [&](Size index) { function(data[index]); });
+}
+
+template <class T, class Reduce>
+inline T ParallelReduce(JobSystem&     jobSystem,
+                        const Span<T>& span,
+                        Size           grainSize,
+                        const T&       identity,
+                        const Reduce&  reduce)
+{
+    const T* const data = span.GetData();
+
+    return ParallelReduce(
+        jobSystem, 0, span.GetLength(), grainSize, identity, [&](Size index) -> const T& { return data[index]; }, reduce);
+}
+
+template <class R, class Map, class Reduce>
+inline R ParallelReduce(JobSystem&    jobSystem,
+                        Size          begin,
+                        Size          end,
+                        Size          grainSize,
+                        const R&      identity,
+                        const Map&    map,
+                        const Reduce& reduce)
+{
+    if (begin >= end)
+        return identity;
+
+    const Size count      = end - begin;
+    const Size chunkSize  = Detail::GetParallelChunkSize(jobSystem, count, grainSize);
+    const Size chunkCount = (count + chunkSize - 1) / chunkSize;
+
+    // Every chunk stores its own partial result, so the partial results are combined in order.
+    List<R> partials(chunkCount, identity);
+
+    Detail::ParallelForChunks(jobSystem, count, chunkSize, [&](Size chunkBegin, Size chunkEnd) {
+        R partial = map(begin + chunkBegin);
+
+        for (Size i = begin + chunkBegin + 1; i < begin + chunkEnd; ++i)
+            partial = reduce(partial, map(i));
+
+        partials[chunkBegin / chunkSize] = std::move(partial);
+    });
+
+    R result = std::move(partials[0]);
+
+    for (Size i = 1; i < chunkCount; ++i)
+        result = reduce(result, partials[i]);
+
+    return result;
+}
+
+template <class T, class U, class Function>
+inline void ParallelTransform(JobSystem&      jobSystem,
+                              const Span<T>&  span,
+                              U*              destination,
+                              Size            grainSize,
+                              const Function& function)
+{
+    const T* const source = span.GetData();
+
+    ParallelFor(jobSystem, 0, span.GetLength(), grainSize, [&](Size index) { destination[index] = function(source[index]); });
+}
+
+template <class T, class Operation>
+inline void ParallelScan(JobSystem&       jobSystem,
+                         const Span<T>&   span,
+                         T*               destination,
+                         Size             grainSize,
+                         const T&         identity,
+                         const Operation& operation)
+{
+    const Size count = span.GetLength();
+
+    if (count == 0)
+        return;
+
+    const T* const source     = span.GetData();
+    const Size     chunkSize  = Detail::GetParallelChunkSize(jobSystem, count, grainSize);
+    const Size     chunkCount = (count + chunkSize - 1) / chunkSize;
+
+    const auto scanChunk = [&](Size chunkBegin, Size chunkEnd, T running) {
+        for (Size i = chunkBegin; i < chunkEnd; ++i)
+        {
+            running        = operation(running, source[i]);
+            destination[i] = running;
+        }
+    };
+
+    if (chunkCount == 1)
+    {
+        scanChunk(0, count, identity);
+        return;
+    }
+
+    // Reduces the chunks, scans the chunk totals serially, then scans the chunks starting from the
+    // totals of the chunks before them.
+    List<T> offsets(chunkCount, identity);
+
+    Detail::ParallelForChunks(jobSystem, count, chunkSize, [&](Size chunkBegin, Size chunkEnd) {
+        T total = source[chunkBegin];
+
+        for (Size i = chunkBegin + 1; i < chunkEnd; ++i)
+            total = operation(total, source[i]);
+
+        offsets[chunkBegin / chunkSize] = std::move(total);
+    });
+
+    T running = identity;
+
+    for (Size i = 0; i < chunkCount; ++i)
+    {
+        T total    = operation(running, offsets[i]);
+        offsets[i] = std::move(running);
+        running    = std::move(total);
+    }
+
+    Detail::ParallelForChunks(jobSystem, count, chunkSize, [&](Size chunkBegin, Size chunkEnd) {
+        scanChunk(chunkBegin, chunkEnd, offsets[chunkBegin / chunkSize]);
+    });
+}
+
+template <class T, class Compare>
+inline void ParallelSort(JobSystem&     jobSystem,
+                         T*             begin,
+                         T*             end,
+                         const Compare& compare,
+                         Size           grainSize) requires(std::is_default_constructible_v<T> && std::is_move_assignable_v<T>)
+{
+    const Size count     = (Size)(end - begin);
+    const Size chunkSize = Detail::GetParallelChunkSize(jobSystem, count, grainSize);
+
+    if (count <= chunkSize)
+    {
+        std::sort(begin, end, compare);
+        return;
+    }
+
+    Detail::ParallelForChunks(jobSystem, count, chunkSize, [&](Size chunkBegin, Size chunkEnd) {
+        std::sort(begin + chunkBegin, begin + chunkEnd, compare);
+    });
+
+    // Merges the sorted runs back and forth between the range and the buffer, doubling the run
+    // length every pass.
+    List<T> buffer(count);
+
+    T* source      = begin;
+    T* destination = buffer.GetData();
+
+    for (Size runLength = chunkSize; runLength < count; runLength *= 2)
+    {
+        Detail::MergeParallelRuns(jobSystem, source, destination, count, runLength, chunkSize, compare);
+        std::swap(source, destination);
+    }
+
+    if (source != begin)
+    {
+        Detail::ParallelForChunks(jobSystem, count, chunkSize, [&](Size chunkBegin, Size chunkEnd) {
+            std::move(source + chunkBegin, source + chunkEnd, begin + chunkBegin);
+        });
+    }
+}
+
+template <class T, AllocatorType Allocator, class Compare>
+inline void ParallelSort(JobSystem&          jobSystem,
+                         List<T, Allocator>& list,
+                         const Compare&      compare,
+                         Size                grainSize) requires(std::is_default_constructible_v<T> && std::is_move_assignable_v<T>)
+{
+    ParallelSort(jobSystem, list.GetData(), list.GetData() + list.GetLength(), compare, grainSize);
+}
+
+} // namespace System
+
+} // namespace Axis
+
+#endif // AXIS_SYSTEM_PARALLELALGORITHMIMPL_INL
@@ -141,6 +141,123 @@ inline constexpr Float64 Random::GetSampleForLargeRange() noexcept
     return d;
 }
 
+namespace Detail
+{
+
+/// Gets the next value of the SplitMix64 sequence, expands the seeds into the generator states.
+inline constexpr Uint64 SplitMix64(Uint64& state) noexcept
+{
+    Uint64 result = (state += 0x9e3779b97f4a7c15ull);
+
+    result = (result ^ (result >> 30)) * 0xbf58476d1ce4e5b9ull;
+    result = (result ^ (result >> 27)) * 0x94d049bb133111ebull;
+
+    return result ^ (result >> 31);
+}
+
+/// Rotates the bits of the value to the left.
+inline constexpr Uint64 RotateLeft(Uint64 value,
+                                   Int32  count) noexcept
+{
+    return (value << count) | (value >> (64 - count));
+}
+
+/// Maps the random \a `Uint32` to [0, \a `range`) with the multiplication, the bias is below
+/// \a `range` / 2^32.
+inline constexpr Uint32 ScaleToRange(Uint32 value,
+                                     Uint32 range) noexcept
+{
+    return (Uint32)(((Uint64)value * range) >> 32);
+}
+
+} // namespace Detail
+
+inline constexpr FastRandom::FastRandom(Uint64 seed) noexcept
+{
+    // SplitMix64 never gives four zeros in a row, so the state is always valid.
+    for (auto& word : _state)
+        word = Detail::SplitMix64(seed);
+}
+
+inline constexpr Uint64 FastRandom::NextUint64() noexcept
+{
+    const Uint64 result = Detail::RotateLeft(_state[0] + _state[3], 23) + _state[0];
+    const Uint64 shifted = _state[1] << 17;
+
+    _state[2] ^= _state[0];
+    _state[3] ^= _state[1];
+    _state[1] ^= _state[2];
+    _state[0] ^= _state[3];
+
+    _state[2] ^= shifted;
+    _state[3] = Detail::RotateLeft(_state[3], 45);
+
+    return result;
+}
+
+inline constexpr Uint32 FastRandom::NextUint32() noexcept
+{
+    return (Uint32)(NextUint64() >> 32);
+}
+
+inline constexpr Int32 FastRandom::Next(Int32 minValue, Int32 maxValue)
+{
+    if (minValue > maxValue)
+        throw InvalidArgumentException("`minValue` was greater than `maxValue`!");
+
+    const Uint32 range = (Uint32)((Int64)maxValue - minValue);
+
+    return (Int32)((Int64)minValue + Detail::ScaleToRange(NextUint32(), range));
+}
+
+inline constexpr Float32 FastRandom::NextFloat() noexcept
+{
+    // The upper 24 bits fill the mantissa exactly.
+    return (Float32)(NextUint64() >> 40) * (1.0f / 16777216.0f);
+}
+
+inline constexpr Float64 FastRandom::NextDouble() noexcept
+{
+    // The upper 53 bits fill the mantissa exactly.
+    return (Float64)(NextUint64() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+inline constexpr void FastRandom::Jump() noexcept
+{
+    constexpr Uint64 JumpPolynomial[4] = {0x180ec6d33cfd0abaull, 0xd5a61266f0c9392cull, 0xa9582618e03fc9aaull, 0x39abdc4529b1661cull};
+
+    Jump(JumpPolynomial);
+}
+
+inline constexpr void FastRandom::LongJump() noexcept
+{
+    constexpr Uint64 LongJumpPolynomial[4] = {0x76e15d3efefdcbbfull, 0xc5004e441c522fb3ull, 0x77710069854ee241ull, 0x39109bb02acbe635ull};
+
+    Jump(LongJumpPolynomial);
+}
+
+inline constexpr void FastRandom::Jump(const Uint64 (&polynomial)[4]) noexcept
+{
+    Uint64 result[4] = {};
+
+    for (const Uint64 word : polynomial)
+    {
+        for (Int32 bit = 0; bit < 64; ++bit)
+        {
+            if (word & (1ull << bit))
+            {
+                for (Size i = 0; i < 4; ++i)
+                    result[i] ^= _state[i];
+            }
+
+            (void)NextUint64();
+        }
+    }
+
+    for (Size i = 0; i < 4; ++i)
+        _state[i] = result[i];
+}
+
 } // namespace System
 
 } // namespace Axis
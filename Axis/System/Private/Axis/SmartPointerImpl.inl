@@ -173,17 +173,36 @@ public:
     // Gets the weak reference counter
     inline const ReferenceCounter& GetWeakCount() const noexcept { return _weakCount; }
 
-    // Increments the strong reference count
-    inline void AddStrongCount() noexcept { _strongCount += 1; }
+    // Increments the strong reference count. The caller already holds a reference, so
+    // nothing has to be ordered with the increment.
+    inline void AddStrongCount() noexcept { _strongCount.fetch_add(1, std::memory_order_relaxed); }
 
-    // Increments the strong reference count
-    inline void AddWeakCount() noexcept { _weakCount += 1; }
+    // Increments the weak reference count
+    inline void AddWeakCount() noexcept { _weakCount.fetch_add(1, std::memory_order_relaxed); }
 
-    // Decrements the strong reference count
+    // Increments the strong reference count unless it already dropped to zero
+    inline Bool TryAddStrongCount() noexcept
+    {
+        Size strongCount = _strongCount.load(std::memory_order_relaxed);
+
+        while (strongCount != 0)
+        {
+            if (_strongCount.compare_exchange_weak(strongCount, strongCount + 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+                return true;
+        }
+
+        return false;
+    }
+
+    // Decrements the strong reference count. The release publishes the writes made through this
+    // reference, the acquire load of the released count makes all of them visible to the thread
+    // which deletes the object (a load rather than a fence, which the thread sanitizer understands).
     inline const ReferenceCounter& DeleteStrongCount() noexcept
     {
-        if ((_strongCount -= 1) == 0)
+        if (_strongCount.fetch_sub(1, std::memory_order_release) == 1)
         {
+            (void)_strongCount.load(std::memory_order_acquire);
+
             DeleteObject();
             DeleteWeakCount();
         }
@@ -193,8 +212,10 @@ public:
     // Decrements the weak reference count
     inline const ReferenceCounter& DeleteWeakCount() noexcept
     {
-        if ((_weakCount -= 1) == 0)
+        if (_weakCount.fetch_sub(1, std::memory_order_release) == 1)
         {
+            (void)_weakCount.load(std::memory_order_acquire);
+
             DeleteThisCounter();
         }
         return _weakCount;
@@ -262,11 +283,11 @@ public:
         {
             MakeSharedHeaderArray* header = (MakeSharedHeaderArray*)(((PVoid)_objectPointer)) - 1;
 
-            Allocator::Deallocate(header->OriginalMemory);
+            Allocator().Deallocate(header->OriginalMemory);
         }
         else
         {
-            Allocator::Deallocate(_objectPointer);
+            Allocator().Deallocate(_objectPointer);
         }
     }
 
@@ -745,12 +766,12 @@ SharedPointer<T> WeakPointer<T>::Generate() const noexcept
 {
     if (_objectPointer && _referenceCounter)
     {
-        if (_referenceCounter->GetStrongCount() > 0)
+        // The object might be released by the other thread in the meantime
+        if (_referenceCounter->TryAddStrongCount())
         {
             SharedPointer<T> sharedPointer;
             sharedPointer._objectPointer    = _objectPointer;
             sharedPointer._referenceCounter = _referenceCounter;
-            sharedPointer._referenceCounter->AddStrongCount();
             return sharedPointer;
         }
         else
@@ -760,6 +781,97 @@ SharedPointer<T> WeakPointer<T>::Generate() const noexcept
         return nullptr;
 }
 
+// ===> SharedRef vvv
+
+template <SmartPointerType T>
+inline SharedRef<T>::SharedRef(NullptrType) noexcept {}
+
+template <SmartPointerType T>
+template <SmartPointerType U>
+inline SharedRef<T>::SharedRef(const SharedPointer<U>& pointer) noexcept requires(ConvertibleFrom<U>) :
+    _objectPointer(pointer._objectPointer),
+    _referenceCounter(pointer._referenceCounter) {}
+
+template <SmartPointerType T>
+template <SmartPointerType U>
+inline SharedRef<T>::SharedRef(const SharedRef<U>& other) noexcept requires(ConvertibleFrom<U>) :
+    _objectPointer(other._objectPointer),
+    _referenceCounter(other._referenceCounter) {}
+
+template <SmartPointerType T>
+template <SmartPointerType U, typename>
+inline std::add_lvalue_reference_t<std::remove_all_extents_t<T>> SharedRef<T>::operator*() const noexcept
+{
+    return *_objectPointer;
+}
+
+template <SmartPointerType T>
+template <SmartPointerType U, typename>
+inline typename SharedRef<T>::PointerType SharedRef<T>::operator->() const noexcept
+{
+    return _objectPointer;
+}
+
+template <SmartPointerType T>
+inline Bool SharedRef<T>::operator==(NullptrType) const noexcept
+{
+    return _objectPointer == nullptr;
+}
+
+template <SmartPointerType T>
+inline Bool SharedRef<T>::operator!=(NullptrType) const noexcept
+{
+    return _objectPointer != nullptr;
+}
+
+template <SmartPointerType T>
+inline SharedRef<T>::operator Bool() const noexcept
+{
+    return _objectPointer != nullptr;
+}
+
+template <SmartPointerType T>
+inline typename SharedRef<T>::PointerType SharedRef<T>::GetPointer() const noexcept
+{
+    return _objectPointer;
+}
+
+template <SmartPointerType T>
+inline Bool SharedRef<T>::operator==(const SharedRef<T>& other) const noexcept
+{
+    return _objectPointer == other._objectPointer;
+}
+
+template <SmartPointerType T>
+inline Bool SharedRef<T>::operator!=(const SharedRef<T>& other) const noexcept
+{
+    return _objectPointer != other._objectPointer;
+}
+
+template <SmartPointerType T>
+template <SmartPointerType U>
+inline SharedRef<T>::operator SharedPointer<U>() const noexcept requires(std::is_unbounded_array_v<T> == std::is_unbounded_array_v<U>)
+{
+    SharedPointer<U> sharedPointer = {};
+
+    if (_referenceCounter)
+    {
+        sharedPointer._objectPointer    = (Pointer<U>)_objectPointer;
+        sharedPointer._referenceCounter = _referenceCounter;
+
+        _referenceCounter->AddStrongCount();
+    }
+
+    return sharedPointer;
+}
+
+template <SmartPointerType T>
+template <SmartPointerType U>
+inline SharedRef<T>::operator U*() const noexcept requires(!std::is_unbounded_array_v<T> && !std::is_unbounded_array_v<U>)
+{
+    return (U*)_objectPointer;
+}
+
 // ===> MakeShared vvv
 
 template <SmartPointerType T, class... Args, typename>
@@ -778,7 +890,7 @@ template <SmartPointerType T, AllocatorType Allocator, class... Args, typename>
 inline SharedPointer<T> AllocatedMakeShared(Args&&... args) requires(std::is_constructible_v<T, Args...>)
 {
     // Allocates the memory to accommodate the object and reference counter in the same allocation
-    PVoid memory = Allocator::Allocate(sizeof(T) + sizeof(Detail::ReferenceCounterMakeShared<T, Allocator>), alignof(T));
+    PVoid memory = Allocator().Allocate(sizeof(T) + sizeof(Detail::ReferenceCounterMakeShared<T, Allocator>), alignof(T));
 
     // Constructs the object
     if constexpr (std::is_nothrow_constructible_v<T, Args...>)
@@ -793,7 +905,7 @@ inline SharedPointer<T> AllocatedMakeShared(Args&&... args) requires(std::is_con
         }
         catch (...)
         {
-            Allocator::Deallocate(memory);
+            Allocator().Deallocate(memory);
             throw;
         }
     }
@@ -834,7 +946,7 @@ inline SharedPointer<T> AllocatedMakeShared(Size elementCount) requires(std::is_
     auto memorySize = (elementCount * ElementSize) + offset + sizeof(Detail::ReferenceCounterMakeShared<T, Allocator>);
 
     // Malloc'ed memory
-    PVoid originalMemory = Allocator::Allocate(memorySize, 1);
+    PVoid originalMemory = Allocator().Allocate(memorySize, 1);
 
     // Calculates the aligned memory address.
     PVoid* alignedMemory = (PVoid*)(((Size)(originalMemory) + offset) & ~(alignof(T) - 1)); // Aligned block
@@ -878,7 +990,7 @@ inline SharedPointer<T> AllocatedMakeShared(Size elementCount) requires(std::is_
                 objectArray[i].~Type();
 
             // Frees the memory
-            Allocator::Deallocate(originalMemory);
+            Allocator().Deallocate(originalMemory);
 
             // Rethrows the exception
             throw;
@@ -31,7 +31,7 @@ inline constexpr Span<T>::Span(const T* begin,
     _begin(begin),
     _end(end)
 {
-    if (end > begin)
+    if (begin > end)
         throw InvalidArgumentException("`begin` was greater than `end`!");
 }
 
@@ -0,0 +1,145 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#ifndef AXIS_SYSTEM_STRINGIDIMPL_INL
+#define AXIS_SYSTEM_STRINGIDIMPL_INL
+#pragma once
+
+#include "../../Include/Axis/Exception.hpp"
+#include "../../Include/Axis/StringId.hpp"
+
+namespace Axis
+{
+
+namespace System
+{
+
+namespace Detail
+{
+
+template <CharType T>
+inline constexpr Uint32 HashStringId(const T* string,
+                                     Size     length) noexcept
+{
+    if (length == 0)
+        return 0;
+
+    Uint64 hash = 0xCBF29CE484222325ull;
+
+    for (Size i = 0; i < length; ++i)
+        hash = (hash ^ (Uint64)(std::make_unsigned_t<T>)string[i]) * 0x100000001B3ull;
+
+    // FNV-1a alone leaves the high bits of the short strings poorly mixed.
+    hash = (hash ^ (hash >> 32)) * 0xD6E8FEB86659FD93ull;
+    hash = hash ^ (hash >> 32);
+
+    // 0 is reserved for the empty string.
+    return (Uint32)hash == 0 ? 1 : (Uint32)hash;
+}
+
+} // namespace Detail
+
+template <CharType T>
+inline BasicStringId<T>::BasicStringId(const StringView<T>& string) :
+    _value(Detail::HashStringId(string.GetCString(), string.GetLength()))
+{
+    if (_value != 0 && !Detail::StringIdTable::Intern(string.GetCString(), string.GetLength(), sizeof(T), _value))
+        throw InvalidArgumentException("The id of the string collides with another interned string!");
+}
+
+template <CharType T>
+inline Bool BasicStringId<T>::TryIntern(const StringView<T>& string,
+                                        BasicStringId&       id)
+{
+    const Uint32 value = Detail::HashStringId(string.GetCString(), string.GetLength());
+
+    if (value != 0 && !Detail::StringIdTable::Intern(string.GetCString(), string.GetLength(), sizeof(T), value))
+        return false;
+
+    id._value = value;
+
+    return true;
+}
+
+template <CharType T>
+template <Size N>
+inline constexpr BasicStringId<T> BasicStringId<T>::FromLiteral(const T (&literal)[N]) noexcept
+{
+    return BasicStringId(Detail::HashStringId(literal, N - 1));
+}
+
+template <CharType T>
+inline constexpr BasicStringId<T> BasicStringId<T>::Calculate(const T* string,
+                                                              Size     length) noexcept
+{
+    return BasicStringId(Detail::HashStringId(string, length));
+}
+
+template <CharType T>
+inline Size BasicStringId<T>::GetInternedCount() noexcept
+{
+    return Detail::StringIdTable::GetCount(sizeof(T));
+}
+
+template <CharType T>
+inline constexpr Uint32 BasicStringId<T>::GetValue() const noexcept
+{
+    return _value;
+}
+
+template <CharType T>
+inline constexpr Bool BasicStringId<T>::IsEmpty() const noexcept
+{
+    return _value == 0;
+}
+
+template <CharType T>
+inline Bool BasicStringId<T>::IsInterned() const noexcept
+{
+    Size length = 0;
+
+    return _value == 0 || Detail::StringIdTable::Find(_value, sizeof(T), length) != nullptr;
+}
+
+template <CharType T>
+inline StringView<T> BasicStringId<T>::GetString() const noexcept
+{
+    static constexpr T emptyString[1] = {};
+
+    if (_value == 0)
+        return StringView<T>(emptyString, Size(0));
+
+    Size length = 0;
+
+    const void* string = Detail::StringIdTable::Find(_value, sizeof(T), length);
+
+    return string ? StringView<T>((const T*)string, length) : StringView<T>(nullptr);
+}
+
+template <CharType T>
+inline constexpr BasicStringId<T>::BasicStringId(Uint32 value) noexcept :
+    _value(value) {}
+
+namespace Literals
+{
+
+inline constexpr StringId operator""_sid(const Char* string,
+                                         std::size_t length) noexcept
+{
+    return StringId::Calculate(string, (Size)length);
+}
+
+inline constexpr WStringId operator""_sid(const WChar* string,
+                                          std::size_t  length) noexcept
+{
+    return WStringId::Calculate(string, (Size)length);
+}
+
+} // namespace Literals
+
+} // namespace System
+
+} // namespace Axis
+
+#endif // AXIS_SYSTEM_STRINGIDIMPL_INL
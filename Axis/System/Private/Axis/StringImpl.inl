@@ -18,36 +18,6 @@ namespace System
 namespace Detail
 {
 
-template <Bool NullTerminated, CharType T, CharType U>
-inline void CopyElement(const T* source,
-                        U*       destination,
-                        Size     sourceSize) noexcept;
-
-template <Bool NullTerminated, CharType T, CharType U>
-inline void CopyElement(const T* source,
-                        U*       destination,
-                        Size     sourceSize) noexcept requires(std::is_same_v<T, U>)
-{
-    // use memcpy directly
-    std::memcpy(destination, source, sourceSize * sizeof(T));
-
-    if constexpr (NullTerminated)
-        destination[sourceSize] = U(0);
-}
-
-template <Bool NullTerminated, CharType T, CharType U>
-inline void CopyElement(const T* source,
-                        U*       destination,
-                        Size     sourceSize) noexcept requires(!std::is_same_v<T, U>)
-{
-    // Convert each element
-    for (Size i = 0; i < sourceSize; ++i)
-        destination[i] = U(source[i]);
-
-    if constexpr (NullTerminated)
-        destination[sourceSize] = U(0);
-}
-
 template <ArithmeticType U, CharType T, AllocatorType Allocator>
 inline void AppendNumerics(String<T, Allocator>& str,
                            U                     value) noexcept
@@ -79,74 +49,64 @@ constexpr Size String<T, Allocator>::GetStringLength(const T* strPtr) noexcept
 template <CharType T, AllocatorType Allocator>
 inline String<T, Allocator>::String(NullptrType) noexcept {}
 
+template <CharType T, AllocatorType Allocator>
+inline String<T, Allocator>::String(const Allocator& allocator) noexcept :
+    Detail::AllocatorStorage<Allocator>(allocator) {}
+
 template <CharType T, AllocatorType Allocator>
 template <CharType U>
 inline String<T, Allocator>::String(const U* str) :
-    _stringLength(String<U, Allocator>::GetStringLength(str))
-{
-    auto pointer = Reserve(_stringLength);
+    String(str, Allocator()) {}
 
-    Detail::CopyElement<true>(str, pointer, _stringLength);
+template <CharType T, AllocatorType Allocator>
+template <CharType U>
+inline String<T, Allocator>::String(const U*         str,
+                                    const Allocator& allocator) :
+    Detail::AllocatorStorage<Allocator>(allocator)
+{
+    Assign(str, String<U, Allocator>::GetStringLength(str));
 }
 
-
 template <CharType T, AllocatorType Allocator>
 template <CharType U>
 inline String<T, Allocator>::String(const U* begin,
-                                    const U* end) :
-    _stringLength(end - begin)
+                                    const U* end)
 {
     if (begin > end)
         throw InvalidArgumentException("`begin` was greater than `end`!");
 
-    auto pointer = Reserve(_stringLength);
-
-    Detail::CopyElement<true>(begin, pointer, _stringLength);
+    Assign(begin, (Size)(end - begin));
 }
 
 template <CharType T, AllocatorType Allocator>
 inline String<T, Allocator>::String(const String<T, Allocator>& other) :
-    _stringLength(other._stringLength)
+    Detail::AllocatorStorage<Allocator>(other.GetAllocator())
 {
-    auto pointer = Reserve(_stringLength);
-
-    Detail::CopyElement<true>(other.GetCString(), pointer, _stringLength);
+    Assign(other.GetCString(), other.GetLength());
 }
 
 template <CharType T, AllocatorType Allocator>
 inline String<T, Allocator>::String(String<T, Allocator>&& other) noexcept :
-    _stringLength(other._stringLength),
-    _isSmallString(other._isSmallString)
+    Detail::AllocatorStorage<Allocator>(std::move(other.GetAllocatorInstance()))
 {
-    if (_isSmallString)
-    {
-        Detail::CopyElement<true>(other.SmallStringBuffer, SmallStringBuffer, _stringLength);
-    }
-    else
-    {
-        DynamicStringBuffer        = other.DynamicStringBuffer;
-        DynamicMemoryAllocatedSize = other.DynamicMemoryAllocatedSize;
-    }
+    // Either the small string or the dynamic buffer's pointer, length and capacity
+    std::memcpy(StorageBytes, other.StorageBytes, StorageSize);
 
-    other._stringLength  = 0;
-    other._isSmallString = true;
+    other.ResetToSmallString();
 }
 
 template <CharType T, AllocatorType Allocator>
 template <CharType U, AllocatorType OtherAllocator>
-inline String<T, Allocator>::String(const String<U, OtherAllocator>& other) :
-    _stringLength(other._stringLength)
+inline String<T, Allocator>::String(const String<U, OtherAllocator>& other)
 {
-    auto pointer = Reserve(_stringLength);
-
-    Detail::CopyElement<true>(other.GetCString(), pointer, _stringLength);
+    Assign(other.GetCString(), other.GetLength());
 }
 
 template <CharType T, AllocatorType Allocator>
 inline String<T, Allocator>::~String() noexcept
 {
-    if (!_isSmallString)
-        Allocator::Deallocate(DynamicStringBuffer);
+    if (!IsSmallString())
+        this->GetAllocatorInstance().Deallocate(DynamicStringBuffer);
 }
 
 template <CharType T, AllocatorType Allocator>
@@ -155,11 +115,7 @@ String<T, Allocator>& String<T, Allocator>::operator=(const String<T, Allocator>
     if (this == std::addressof(other))
         return *this;
 
-    auto pointer = Reserve(other._stringLength);
-
-    Detail::CopyElement<true>(other.GetCString(), pointer, other._stringLength);
-
-    _stringLength = other._stringLength;
+    Assign(other.GetCString(), other.GetLength());
 
     return *this;
 }
@@ -171,55 +127,39 @@ String<T, Allocator>& String<T, Allocator>::operator=(String<T, Allocator>&& oth
         return *this;
 
     // Deallocates the current string
-    if (!_isSmallString)
-    {
-        Allocator::Deallocate(DynamicStringBuffer);
-        _isSmallString = true;
-    }
+    if (!IsSmallString())
+        this->GetAllocatorInstance().Deallocate(DynamicStringBuffer);
 
-    _stringLength  = other._stringLength;
-    _isSmallString = other._isSmallString;
+    // The dynamic buffer is owned by the other's allocator, takes it along.
+    this->GetAllocatorInstance() = std::move(other.GetAllocatorInstance());
 
-    if (_isSmallString)
-    {
-        Detail::CopyElement<true>(other.SmallStringBuffer, SmallStringBuffer, _stringLength);
-    }
-    else
-    {
-        DynamicStringBuffer        = other.DynamicStringBuffer;
-        DynamicMemoryAllocatedSize = other.DynamicMemoryAllocatedSize;
-    }
+    std::memcpy(StorageBytes, other.StorageBytes, StorageSize);
 
-    other._stringLength  = 0;
-    other._isSmallString = true;
+    other.ResetToSmallString();
 
     return *this;
 }
 
+template <CharType T, AllocatorType Allocator>
+inline const Allocator& String<T, Allocator>::GetAllocator() const noexcept
+{
+    return this->GetAllocatorInstance();
+}
+
 template <CharType T, AllocatorType Allocator>
 inline T* String<T, Allocator>::GetCString() noexcept
 {
-    // if _stringLength is zero, returns nullptr
-    if (_stringLength == 0)
+    // if the string is empty, returns nullptr
+    if (GetLength() == 0)
         return nullptr;
 
-    if (_isSmallString)
-        return SmallStringBuffer;
-    else
-        return DynamicStringBuffer;
+    return GetBuffer();
 }
 
 template <CharType T, AllocatorType Allocator>
 inline const T* String<T, Allocator>::GetCString() const noexcept
 {
-    // if _stringLength is zero, returns nullptr
-    if (_stringLength == 0)
-        return nullptr;
-
-    if (_isSmallString)
-        return SmallStringBuffer;
-    else
-        return DynamicStringBuffer;
+    return const_cast<String*>(this)->GetCString();
 }
 
 template <CharType T, AllocatorType Allocator>
@@ -227,21 +167,20 @@ inline void String<T, Allocator>::RemoveAt(Size index,
                                            Size count)
 
 {
-    if (index + count > _stringLength || index >= _stringLength)
+    const Size length = GetLength();
+
+    if (index + count > length || index >= length)
         throw ArgumentOutOfRangeException("`index` and `count` were out of range!");
 
     if (count == 0)
         return;
 
-    auto pointer = GetCString();
+    auto pointer = GetBuffer();
 
     // Uses std::memmove to move the elements
-    std::memmove(pointer + index, pointer + index + count, (_stringLength - index - count) * sizeof(T));
+    std::memmove(pointer + index, pointer + index + count, (length - index - count) * sizeof(T));
 
-    _stringLength -= count;
-
-    // inserts the null terminator
-    pointer[_stringLength] = T(0);
+    SetLength(length - count);
 }
 
 template <CharType T, AllocatorType Allocator>
@@ -251,59 +190,122 @@ inline void String<T, Allocator>::ReserveFor(Size count)
 }
 
 template <CharType T, AllocatorType Allocator>
-template <Bool Move>
+template <Bool Keep>
 inline T* String<T, Allocator>::Reserve(Size size)
 {
-    if (size <= SmallStringSize && _isSmallString)
-    {
-        return SmallStringBuffer;
-    }
-    /// Checks if the string is currently using dynamic memory allocation.
-    /// If it is, and the new size is smaller than the current size, then
-    /// the string is not reallocated.
-    else if (!_isSmallString && size <= DynamicMemoryAllocatedSize)
+    if (size <= GetCapacity())
+        return GetBuffer();
+
+    // Grows geometrically, the capacity plus the null terminator is a power of two.
+    const Size capacity = Math::RoundToNextPowerOfTwo(size + 1) - 1;
+
+    // Allocates the new memory
+    auto newDynamicMemory = (T*)this->GetAllocatorInstance().Allocate((capacity + 1) * sizeof(T), alignof(T));
+
+    Size length = 0;
+
+    // Copies the old string to the new one
+    if constexpr (Keep)
     {
-        return DynamicStringBuffer;
+        length = GetLength();
+        std::memcpy(newDynamicMemory, GetBuffer(), length * sizeof(T));
     }
-    /// Once allocated dynamic memory, the string is always using dynamic
-    else
-    {
-        auto actualDynamicMemoryAllocatedSize = (Math::RoundToNextPowerOfTwo(size + 1)) * sizeof(T);
-        auto dynamicMemoryAllocatedSize       = size - 1;
 
-        // Allocates the new memory
-        auto newDynamicMemory = (T*)Allocator::Allocate(actualDynamicMemoryAllocatedSize, alignof(T));
+    // No exception thrown, so we can deallocate the old memory
+    if (!IsSmallString())
+        this->GetAllocatorInstance().Deallocate(DynamicStringBuffer);
 
-        // Copies the old string to the new one
-        if constexpr (Move)
-        {
-            const T* source = GetCString();
-            Detail::CopyElement<true>(source, newDynamicMemory, _stringLength);
-        }
+    DynamicStringBuffer        = newDynamicMemory;
+    DynamicMemoryAllocatedSize = capacity | DynamicStringFlag;
+
+    SetLength(length);
+
+    return DynamicStringBuffer;
+}
+
+template <CharType T, AllocatorType Allocator>
+inline T* String<T, Allocator>::MakeRoom(Size index,
+                                         Size count)
+{
+    const Size length = GetLength();
+
+    auto pointer = Reserve<true>(length + count);
+
+    // Moves the string starting from the index to the right by the size of the gap
+    std::memmove(pointer + index + count, pointer + index, (length - index) * sizeof(T));
+
+    SetLength(length + count);
+
+    return pointer;
+}
+
+template <CharType T, AllocatorType Allocator>
+template <CharType U>
+inline void String<T, Allocator>::Assign(const U* string,
+                                         Size     length)
+{
+    const Size transcodedLength = Unicode::GetTranscodedLength<T>(string, length);
+
+    auto pointer = Reserve<false>(transcodedLength);
+
+    if (transcodedLength != 0)
+        Unicode::Transcode(string, length, pointer);
+
+    SetLength(transcodedLength);
+}
+
+template <CharType T, AllocatorType Allocator>
+inline Bool String<T, Allocator>::IsSmallString() const noexcept
+{
+    return (StorageBytes[StorageSize - 1] & ~SmallStringLengthMask) == 0;
+}
+
+template <CharType T, AllocatorType Allocator>
+inline T* String<T, Allocator>::GetBuffer() noexcept
+{
+    return IsSmallString() ? SmallStringBuffer : DynamicStringBuffer;
+}
 
-        // No exception thrown, so we can deallocate the old memory
-        // Deallocate the old dynamic memory
-        if (!_isSmallString) Allocator::Deallocate(DynamicStringBuffer);
+template <CharType T, AllocatorType Allocator>
+inline Size String<T, Allocator>::GetCapacity() const noexcept
+{
+    return IsSmallString() ? SmallStringSize : DynamicMemoryAllocatedSize & ~DynamicStringFlag;
+}
 
-        _isSmallString             = false;
-        DynamicMemoryAllocatedSize = dynamicMemoryAllocatedSize;
-        DynamicStringBuffer        = newDynamicMemory;
-        return DynamicStringBuffer;
+template <CharType T, AllocatorType Allocator>
+inline void String<T, Allocator>::SetLength(Size length) noexcept
+{
+    if (IsSmallString())
+    {
+        SmallStringBuffer[length]         = T(0);
+        StorageBytes[StorageSize - 1] = (Uint8)length;
+    }
+    else
+    {
+        DynamicStringBuffer[length] = T(0);
+        DynamicStringLength         = length;
     }
 }
 
+template <CharType T, AllocatorType Allocator>
+inline void String<T, Allocator>::ResetToSmallString() noexcept
+{
+    StorageBytes[StorageSize - 1] = 0;
+    SmallStringBuffer[0]          = T(0);
+}
+
 template <CharType T, AllocatorType Allocator>
 template <CharType U>
 inline Bool String<T, Allocator>::operator==(const U* str) const noexcept
 {
-    auto stringLength = GetStringLength(str);
+    auto stringLength = String<U>::GetStringLength(str);
 
-    if (_stringLength != stringLength)
+    if (GetLength() != stringLength)
         return false;
 
     auto cString = GetCString();
 
-    for (Size i = 0; i < _stringLength; ++i)
+    for (Size i = 0; i < stringLength; ++i)
         if (str[i] != cString[i])
             return false;
 
@@ -320,28 +322,31 @@ inline Bool String<T, Allocator>::operator!=(const U* str) const noexcept
 template <CharType T, AllocatorType Allocator>
 inline Bool String<T, Allocator>::operator==(NullptrType) const noexcept
 {
-    return _stringLength == 0;
+    return GetLength() == 0;
 }
 
 template <CharType T, AllocatorType Allocator>
 inline Bool String<T, Allocator>::operator!=(NullptrType) const noexcept
 {
-    return _stringLength != 0;
+    return GetLength() != 0;
 }
 
 template <CharType T, AllocatorType Allocator>
 template <CharType U, AllocatorType OtherAllocator>
 inline Bool String<T, Allocator>::operator==(const String<U, OtherAllocator>& str) const noexcept
 {
-    auto stringLength = str._stringLength;
+    const Size stringLength = GetLength();
 
-    if (_stringLength != stringLength)
+    if (str.GetLength() != stringLength)
         return false;
 
+    if constexpr (std::is_same_v<T, U>)
+        return stringLength == 0 || std::memcmp(GetCString(), str.GetCString(), stringLength * sizeof(T)) == 0;
+
     auto cString      = GetCString();
     auto otherCString = str.GetCString();
 
-    for (Size i = 0; i < _stringLength; ++i)
+    for (Size i = 0; i < stringLength; ++i)
         if (otherCString[i] != cString[i])
             return false;
 
@@ -358,16 +363,16 @@ inline Bool String<T, Allocator>::operator!=(const String<U, OtherAllocator>& st
 template <CharType T, AllocatorType Allocator>
 inline T& String<T, Allocator>::operator[](Size index)
 {
-    if (index >= _stringLength)
+    if (index >= GetLength())
         throw ArgumentOutOfRangeException("`index` was out of range!");
 
-    return GetCString()[index];
+    return GetBuffer()[index];
 }
 
 template <CharType T, AllocatorType Allocator>
 inline const T& String<T, Allocator>::operator[](Size index) const
 {
-    if (index >= _stringLength)
+    if (index >= GetLength())
         throw ArgumentOutOfRangeException("`index` was out of range!");
 
     return GetCString()[index];
@@ -382,7 +387,7 @@ inline const T* String<T, Allocator>::begin() const noexcept
 template <CharType T, AllocatorType Allocator>
 inline const T* String<T, Allocator>::end() const noexcept
 {
-    return GetCString() + _stringLength;
+    return GetCString() + GetLength();
 }
 
 
@@ -395,7 +400,7 @@ inline T* String<T, Allocator>::begin() noexcept
 template <CharType T, AllocatorType Allocator>
 inline T* String<T, Allocator>::end() noexcept
 {
-    return GetCString() + _stringLength;
+    return GetCString() + GetLength();
 }
 
 template <CharType T, AllocatorType Allocator>
@@ -431,7 +436,7 @@ inline void String<T, Allocator>::Insert(const U* begin,
                                          const U* end,
                                          Size     index)
 {
-    if (index > _stringLength)
+    if (index > GetLength())
         throw ArgumentOutOfRangeException("`index` was out of range!");
 
     if (begin > end)
@@ -440,65 +445,12 @@ inline void String<T, Allocator>::Insert(const U* begin,
     if (begin == end)
         return;
 
-    if (index == _stringLength)
-    {
-        // Redirects the insertion to the append function
-        Append(begin, end);
-        return;
-    }
-
-    Size insertSize = end - begin;
-
-    Size newSize = _stringLength + insertSize;
-
-    auto useSmallString   = newSize <= SmallStringSize && _isSmallString;
-    auto useDynamicString = !_isSmallString && newSize <= DynamicMemoryAllocatedSize;
-
-    if (useSmallString || useDynamicString)
-    {
-        T* pointer = useSmallString ? SmallStringBuffer : DynamicStringBuffer;
-
-        // Moves the string starting from the index to the right by the size of the inserted string
-        Detail::CopyElement<false>(pointer + index, pointer + index + insertSize, _stringLength - index);
-
-        // Copies the inserted string to the string
-        Detail::CopyElement<false>(begin, pointer + index, insertSize);
-
-        pointer[newSize] = 0;
-    }
-    /// Once allocated dynamic memory, the string is always using dynamic
-    else
-    {
-        auto actualDynamicMemoryAllocatedSize = (Math::RoundToNextPowerOfTwo(newSize + 1)) * sizeof(T);
-        auto dynamicMemoryAllocatedSize       = newSize - 1;
-
-        // Allocates the new memory
-        auto newDynamicMemory = (T*)Allocator::Allocate(actualDynamicMemoryAllocatedSize, alignof(T));
-
-        // Copies the old string to the new one
-        {
-            const T* source = GetCString();
-
-            Detail::CopyElement<false>(source, newDynamicMemory, index);
-
-            Detail::CopyElement<false>(begin, newDynamicMemory + index, insertSize);
-
-            Detail::CopyElement<false>(source + index, newDynamicMemory + index + insertSize, _stringLength - index);
+    const Size insertSize = Unicode::GetTranscodedLength<T>(begin, (Size)(end - begin));
 
-            newDynamicMemory[newSize] = 0;
-        }
-
-        // No exception thrown, so we can deallocate the old memory
-        // Deallocate the old dynamic memory
-        if (!_isSmallString)
-            Allocator::Deallocate(DynamicStringBuffer);
-
-        _isSmallString             = false;
-        DynamicMemoryAllocatedSize = dynamicMemoryAllocatedSize;
-        DynamicStringBuffer        = newDynamicMemory;
-    }
+    auto pointer = MakeRoom(index, insertSize);
 
-    _stringLength += insertSize;
+    // Copies the inserted string into the gap
+    Unicode::Transcode(begin, (Size)(end - begin), pointer + index);
 }
 
 template <CharType T, AllocatorType Allocator>
@@ -513,35 +465,43 @@ inline void String<T, Allocator>::Append(const U* begin,
     if (begin == end)
         return;
 
-    // Calculates the size of the string
-    Size size = end - begin;
+    const Size length     = GetLength();
+    const Size appendSize = Unicode::GetTranscodedLength<T>(begin, (Size)(end - begin));
 
     // Reserves the memory for the string
-    auto pointer = Reserve(_stringLength + size);
+    auto pointer = Reserve<true>(length + appendSize);
 
     // Copies the string to the string
-    Detail::CopyElement<true>(begin, pointer + _stringLength, size);
+    Unicode::Transcode(begin, (Size)(end - begin), pointer + length);
 
-    _stringLength += size;
+    SetLength(length + appendSize);
 }
 
 template <CharType T, AllocatorType Allocator>
 template <CharType U>
 inline void String<T, Allocator>::Append(const U& character)
 {
-    // Reserves the memory for the string
-    auto pointer = Reserve(_stringLength + 1);
+    if constexpr (sizeof(U) == sizeof(T))
+    {
+        const Size length = GetLength();
 
-    // Copies the string to the string
-    Detail::CopyElement<true>(std::addressof(character), pointer + _stringLength, 1);
+        // Reserves the memory for the string
+        auto pointer = Reserve<true>(length + 1);
+
+        pointer[length] = (T)character;
 
-    _stringLength += 1;
+        SetLength(length + 1);
+    }
+    else
+    {
+        Append(std::addressof(character), std::addressof(character) + 1);
+    }
 }
 
 template <CharType T, AllocatorType Allocator>
 inline Size String<T, Allocator>::GetLength() const noexcept
 {
-    return _stringLength;
+    return IsSmallString() ? StorageBytes[StorageSize - 1] : DynamicStringLength;
 }
 
 template <CharType T, AllocatorType Allocator>
@@ -0,0 +1,190 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#ifndef AXIS_SYSTEM_TASKIMPL_INL
+#define AXIS_SYSTEM_TASKIMPL_INL
+#pragma once
+
+#include "../../Include/Axis/Assert.hpp"
+#include "../../Include/Axis/Task.hpp"
+
+namespace Axis
+{
+
+namespace System
+{
+
+namespace Detail
+{
+
+template <class Promise>
+inline std::coroutine_handle<> TaskFinalAwaiter::await_suspend(std::coroutine_handle<Promise> handle) noexcept
+{
+    if (std::coroutine_handle<> continuation = handle.promise().Continuation)
+        return continuation;
+
+    return std::noop_coroutine();
+}
+
+template <class T>
+inline std::coroutine_handle<> TaskAwaiter<T>::await_suspend(std::coroutine_handle<> awaiting) noexcept
+{
+    Handle.promise().Continuation = awaiting;
+
+    // Symmetric transfer, the chains of the tasks don't grow the stack.
+    return Handle;
+}
+
+template <class T>
+inline T TaskAwaiter<T>::await_resume()
+{
+    return Handle.promise().TakeResult();
+}
+
+inline PVoid TaskPromiseBase::operator new(Size size)
+{
+    return PoolAllocator::Allocate(size, alignof(std::max_align_t));
+}
+
+inline void TaskPromiseBase::operator delete(PVoid pointer) noexcept
+{
+    PoolAllocator::Deallocate(pointer);
+}
+
+template <class T>
+inline Task<T> TaskPromise<T>::get_return_object() noexcept
+{
+    return Task<T>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+}
+
+template <class T>
+template <class U>
+inline void TaskPromise<T>::return_value(U&& value) requires(std::is_constructible_v<T, U&&>)
+{
+    _result.EmplaceConstruct(std::forward<U>(value));
+}
+
+template <class T>
+inline T TaskPromise<T>::TakeResult()
+{
+    if (Exception)
+        std::rethrow_exception(Exception);
+
+    return std::move(*_result);
+}
+
+inline Task<void> TaskPromise<void>::get_return_object() noexcept
+{
+    return Task<void>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+}
+
+inline void TaskPromise<void>::TakeResult()
+{
+    if (Exception)
+        std::rethrow_exception(Exception);
+}
+
+} // namespace Detail
+
+template <class T>
+inline Task<T>::~Task() noexcept
+{
+    if (_handle)
+        _handle.destroy();
+}
+
+template <class T>
+inline Task<T>::Task(Task&& other) noexcept :
+    _handle(other._handle)
+{
+    other._handle = nullptr;
+}
+
+template <class T>
+inline Task<T>& Task<T>::operator=(Task&& other) noexcept
+{
+    if (this == std::addressof(other))
+        return *this;
+
+    if (_handle)
+        _handle.destroy();
+
+    _handle       = other._handle;
+    other._handle = nullptr;
+
+    return *this;
+}
+
+template <class T>
+inline T Task<T>::TakeResult()
+{
+    AXIS_VALIDATE(IsDone(), "The task hasn't finished!");
+
+    return _handle.promise().TakeResult();
+}
+
+template <class T>
+inline Detail::TaskAwaiter<T> Task<T>::operator co_await() && noexcept
+{
+    AXIS_ASSERT(_handle, "Awaited the empty task!");
+
+    return {_handle};
+}
+
+inline TaskScheduler::ConditionAwaiter TaskScheduler::WaitUntil(UniqueFunction<Bool()> condition) noexcept
+{
+    return {this, std::move(condition)};
+}
+
+inline void TaskScheduler::ConditionAwaiter::await_suspend(std::coroutine_handle<> handle)
+{
+    Scheduler->_conditions.Append({std::move(Condition), handle});
+}
+
+template <class Callable>
+inline void TaskScheduler::JobAwaiter<Callable>::await_suspend(std::coroutine_handle<> handle)
+{
+    _jobSystem.Submit([this, handle]() {
+        try
+        {
+            if constexpr (std::is_void_v<ResultType>)
+            {
+                _function();
+                _result.EmplaceConstruct(true);
+            }
+            else
+                _result.EmplaceConstruct(_function());
+        }
+        catch (...)
+        {
+            _exception = std::current_exception();
+        }
+
+        // The coroutine may resume and destroy the awaiter as soon as it's posted.
+        _scheduler.Post(handle);
+    });
+}
+
+template <class Callable>
+inline typename TaskScheduler::JobAwaiter<Callable>::ResultType TaskScheduler::JobAwaiter<Callable>::await_resume()
+{
+    if (_exception)
+        std::rethrow_exception(_exception);
+
+    if constexpr (!std::is_void_v<ResultType>)
+        return std::move(*_result);
+}
+
+template <class Callable>
+inline TaskScheduler::JobAwaiter<std::decay_t<Callable>> TaskScheduler::Run(JobSystem& jobSystem,
+                                                                            Callable&& function)
+{
+    return JobAwaiter<std::decay_t<Callable>>(*this, jobSystem, std::forward<Callable>(function));
+}
+
+} // namespace System
+
+} // namespace Axis
+
+#endif // AXIS_SYSTEM_TASKIMPL_INL
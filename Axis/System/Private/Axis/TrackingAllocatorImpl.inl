@@ -0,0 +1,109 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#ifndef AXIS_SYSTEM_TRACKINGALLOCATORIMPL_INL
+#define AXIS_SYSTEM_TRACKINGALLOCATORIMPL_INL
+#pragma once
+
+#include "../../Include/Axis/Assert.hpp"
+#include "../../Include/Axis/Math.hpp"
+#include "../../Include/Axis/TrackingAllocator.hpp"
+
+namespace Axis
+{
+
+namespace System
+{
+
+template <AllocatorType Inner, AllocationTagType Tag>
+inline TrackingAllocator<Inner, Tag>::TrackingAllocator(const Inner& inner) noexcept :
+    Detail::AllocatorStorage<Inner>(inner) {}
+
+template <AllocatorType Inner, AllocationTagType Tag>
+inline PVoid TrackingAllocator<Inner, Tag>::Allocate(Size size, Size alignment)
+{
+    alignment = Math::Max(alignment, alignof(Header));
+
+    // The header is placed right before the returned pointer, keeps the pointer aligned.
+    Size headerSize = Math::RoundUp(sizeof(Header), alignment);
+
+    PVoid originalPointer = this->GetAllocatorInstance().Allocate(size + headerSize, alignment);
+
+    auto pointer = (PVoid)((Size)originalPointer + headerSize);
+    auto header  = (Header*)pointer - 1;
+
+    header->OriginalPointer = originalPointer;
+    header->AllocationSize  = size;
+    header->CallSite        = AllocationTracker::RecordAllocation(GetCounter(), size, AXIS_RETURN_ADDRESS());
+
+    return pointer;
+}
+
+template <AllocatorType Inner, AllocationTagType Tag>
+inline void TrackingAllocator<Inner, Tag>::Deallocate(PVoid ptr) noexcept
+{
+    if (!ptr)
+        return;
+
+    auto header = (Header*)ptr - 1;
+
+    AllocationTracker::RecordDeallocation(GetCounter(), header->AllocationSize, header->CallSite);
+
+    this->GetAllocatorInstance().Deallocate(header->OriginalPointer);
+}
+
+template <AllocatorType Inner, AllocationTagType Tag>
+inline PVoid TrackingAllocator<Inner, Tag>::Reallocate(PVoid ptr,
+                                                      Size  oldSize,
+                                                      Size  newSize,
+                                                      Size  alignment) requires(ReallocatableAllocatorType<Inner>)
+{
+    if (!ptr)
+        return Allocate(newSize, alignment);
+
+    alignment = Math::Max(alignment, alignof(Header));
+
+    auto header = (Header*)ptr - 1;
+
+    AXIS_VALIDATE(oldSize == header->AllocationSize, "`oldSize` doesn't match the size of the allocation!");
+
+    // The header moves together with the block, its offset from the original pointer stays the same.
+    Size  offset          = (Size)ptr - (Size)header->OriginalPointer;
+    Size  allocationSize  = header->AllocationSize;
+    PVoid callSite        = header->CallSite;
+    PVoid originalPointer = this->GetAllocatorInstance().Reallocate(header->OriginalPointer, offset + allocationSize, offset + newSize, alignment);
+
+    AllocationTracker::RecordDeallocation(GetCounter(), allocationSize, callSite);
+
+    auto pointer = (PVoid)((Size)originalPointer + offset);
+
+    header = (Header*)pointer - 1;
+
+    header->OriginalPointer = originalPointer;
+    header->AllocationSize  = newSize;
+    header->CallSite        = AllocationTracker::RecordAllocation(GetCounter(), newSize, AXIS_RETURN_ADDRESS());
+
+    return pointer;
+}
+
+template <AllocatorType Inner, AllocationTagType Tag>
+inline const Inner& TrackingAllocator<Inner, Tag>::GetInnerAllocator() const noexcept
+{
+    return this->GetAllocatorInstance();
+}
+
+template <AllocatorType Inner, AllocationTagType Tag>
+inline AllocationCounter* TrackingAllocator<Inner, Tag>::GetCounter()
+{
+    // Registered once per tag on the first use
+    static AllocationCounter* const s_counter = AllocationTracker::RegisterTag(Tag::Name);
+
+    return s_counter;
+}
+
+} // namespace System
+
+} // namespace Axis
+
+#endif // AXIS_SYSTEM_TRACKINGALLOCATORIMPL_INL
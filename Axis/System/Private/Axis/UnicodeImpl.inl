@@ -0,0 +1,372 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#ifndef AXIS_SYSTEM_UNICODEIMPL_INL
+#define AXIS_SYSTEM_UNICODEIMPL_INL
+#pragma once
+
+#include "../../Include/Axis/Unicode.hpp"
+#include <cstring>
+
+#ifdef AXIS_SIMD_SSE2
+#    include <emmintrin.h>
+#endif
+
+namespace Axis
+{
+
+namespace System
+{
+
+namespace Detail
+{
+
+/// Reads the code unit as unsigned value, `WChar` is signed on some platforms.
+template <CharType T>
+inline constexpr char32_t ReadCodeUnit(const T* codeUnit) noexcept
+{
+    return (char32_t)(std::make_unsigned_t<T>)*codeUnit;
+}
+
+/// Number of the code units converted by one step of `TranscodeAscii`.
+constexpr Size AsciiBlockSize = 16;
+
+#ifdef AXIS_SIMD_SSE2
+
+/// Loads 16 code units narrowed to bytes, returns false if some of them aren't ASCII.
+template <CharType T>
+inline Bool LoadAsciiBlock(const T* source,
+                           __m128i& bytes) noexcept
+{
+    const __m128i* blocks = (const __m128i*)source;
+
+    if constexpr (sizeof(T) == 1)
+    {
+        bytes = _mm_loadu_si128(blocks);
+
+        return _mm_movemask_epi8(bytes) == 0;
+    }
+    else if constexpr (sizeof(T) == 2)
+    {
+        const __m128i first  = _mm_loadu_si128(blocks);
+        const __m128i second = _mm_loadu_si128(blocks + 1);
+        const __m128i high   = _mm_and_si128(_mm_or_si128(first, second), _mm_set1_epi16((short)0xFF80));
+
+        bytes = _mm_packus_epi16(first, second);
+
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(high, _mm_setzero_si128())) == 0xFFFF;
+    }
+    else
+    {
+        const __m128i first  = _mm_loadu_si128(blocks);
+        const __m128i second = _mm_loadu_si128(blocks + 1);
+        const __m128i third  = _mm_loadu_si128(blocks + 2);
+        const __m128i fourth = _mm_loadu_si128(blocks + 3);
+        const __m128i all    = _mm_or_si128(_mm_or_si128(first, second), _mm_or_si128(third, fourth));
+        const __m128i high   = _mm_and_si128(all, _mm_set1_epi32((int)0xFFFFFF80));
+
+        // The values are below 0x80, the signed saturation keeps them.
+        bytes = _mm_packus_epi16(_mm_packs_epi32(first, second), _mm_packs_epi32(third, fourth));
+
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(high, _mm_setzero_si128())) == 0xFFFF;
+    }
+}
+
+/// Stores 16 ASCII bytes widened to the code units.
+template <CharType T>
+inline void StoreAsciiBlock(__m128i bytes,
+                            T*      destination) noexcept
+{
+    __m128i*      blocks = (__m128i*)destination;
+    const __m128i zero   = _mm_setzero_si128();
+
+    if constexpr (sizeof(T) == 1)
+    {
+        _mm_storeu_si128(blocks, bytes);
+    }
+    else if constexpr (sizeof(T) == 2)
+    {
+        _mm_storeu_si128(blocks, _mm_unpacklo_epi8(bytes, zero));
+        _mm_storeu_si128(blocks + 1, _mm_unpackhi_epi8(bytes, zero));
+    }
+    else
+    {
+        const __m128i low  = _mm_unpacklo_epi8(bytes, zero);
+        const __m128i high = _mm_unpackhi_epi8(bytes, zero);
+
+        _mm_storeu_si128(blocks, _mm_unpacklo_epi16(low, zero));
+        _mm_storeu_si128(blocks + 1, _mm_unpackhi_epi16(low, zero));
+        _mm_storeu_si128(blocks + 2, _mm_unpacklo_epi16(high, zero));
+        _mm_storeu_si128(blocks + 3, _mm_unpackhi_epi16(high, zero));
+    }
+}
+
+#endif
+
+/// Skips the leading ASCII code units a block at a time, returns the number of the skipped ones.
+template <CharType T>
+inline Size CountAsciiBlocks(const T* source,
+                             Size     length) noexcept
+{
+    Size count = 0;
+
+#ifdef AXIS_SIMD_SSE2
+    __m128i bytes;
+
+    while (count + AsciiBlockSize <= length && LoadAsciiBlock(source + count, bytes))
+        count += AsciiBlockSize;
+#endif
+
+    return count;
+}
+
+/// Converts the leading ASCII code units a block at a time, returns the number of the converted ones.
+template <CharType To, CharType From>
+inline Size TranscodeAsciiBlocks(const From* source,
+                                 Size        length,
+                                 To*         destination) noexcept
+{
+    Size count = 0;
+
+#ifdef AXIS_SIMD_SSE2
+    __m128i bytes;
+
+    while (count + AsciiBlockSize <= length && LoadAsciiBlock(source + count, bytes))
+    {
+        StoreAsciiBlock(bytes, destination + count);
+        count += AsciiBlockSize;
+    }
+#endif
+
+    return count;
+}
+
+} // namespace Detail
+
+namespace Unicode
+{
+    template <CharType T>
+    inline constexpr char32_t DecodeNext(const T*& current,
+                                         const T*  end) noexcept
+    {
+        const char32_t unit = Detail::ReadCodeUnit(current++);
+
+        if constexpr (sizeof(T) == 1)
+        {
+            if (unit < 0x80)
+                return unit;
+
+            Size     continuationCount = 0;
+            char32_t codePoint         = 0;
+            char32_t minCodePoint      = 0;
+
+            if ((unit & 0xE0) == 0xC0)
+            {
+                continuationCount = 1;
+                codePoint         = unit & 0x1F;
+                minCodePoint      = 0x80;
+            }
+            else if ((unit & 0xF0) == 0xE0)
+            {
+                continuationCount = 2;
+                codePoint         = unit & 0x0F;
+                minCodePoint      = 0x800;
+            }
+            else if ((unit & 0xF8) == 0xF0)
+            {
+                continuationCount = 3;
+                codePoint         = unit & 0x07;
+                minCodePoint      = 0x10000;
+            }
+            else
+            {
+                return ReplacementCharacter;
+            }
+
+            if ((Size)(end - current) < continuationCount)
+                return ReplacementCharacter;
+
+            for (Size i = 0; i < continuationCount; ++i)
+            {
+                const char32_t continuation = Detail::ReadCodeUnit(current + i);
+
+                if ((continuation & 0xC0) != 0x80)
+                    return ReplacementCharacter;
+
+                codePoint = (codePoint << 6) | (continuation & 0x3F);
+            }
+
+            // Overlong encodings, surrogates and the values out of range
+            if (codePoint < minCodePoint || codePoint > MaxCodePoint || (codePoint >= 0xD800 && codePoint <= 0xDFFF))
+                return ReplacementCharacter;
+
+            current += continuationCount;
+
+            return codePoint;
+        }
+        else if constexpr (sizeof(T) == 2)
+        {
+            if (unit < 0xD800 || unit > 0xDFFF)
+                return unit;
+
+            // Only the high surrogate followed by the low one forms the code point.
+            if (unit <= 0xDBFF && current != end)
+            {
+                const char32_t low = Detail::ReadCodeUnit(current);
+
+                if (low >= 0xDC00 && low <= 0xDFFF)
+                {
+                    ++current;
+
+                    return 0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00);
+                }
+            }
+
+            return ReplacementCharacter;
+        }
+        else
+        {
+            return (unit > MaxCodePoint || (unit >= 0xD800 && unit <= 0xDFFF)) ? ReplacementCharacter : unit;
+        }
+    }
+
+    template <CharType T>
+    inline constexpr Size GetEncodedLength(char32_t codePoint) noexcept
+    {
+        if constexpr (sizeof(T) == 1)
+            return codePoint < 0x80 ? 1 : (codePoint < 0x800 ? 2 : (codePoint < 0x10000 ? 3 : 4));
+        else if constexpr (sizeof(T) == 2)
+            return codePoint < 0x10000 ? 1 : 2;
+        else
+            return 1;
+    }
+
+    template <CharType T>
+    inline constexpr Size Encode(char32_t codePoint,
+                                 T*       destination) noexcept
+    {
+        if constexpr (sizeof(T) == 1)
+        {
+            if (codePoint < 0x80)
+            {
+                destination[0] = (T)codePoint;
+                return 1;
+            }
+
+            if (codePoint < 0x800)
+            {
+                destination[0] = (T)(0xC0 | (codePoint >> 6));
+                destination[1] = (T)(0x80 | (codePoint & 0x3F));
+                return 2;
+            }
+
+            if (codePoint < 0x10000)
+            {
+                destination[0] = (T)(0xE0 | (codePoint >> 12));
+                destination[1] = (T)(0x80 | ((codePoint >> 6) & 0x3F));
+                destination[2] = (T)(0x80 | (codePoint & 0x3F));
+                return 3;
+            }
+
+            destination[0] = (T)(0xF0 | (codePoint >> 18));
+            destination[1] = (T)(0x80 | ((codePoint >> 12) & 0x3F));
+            destination[2] = (T)(0x80 | ((codePoint >> 6) & 0x3F));
+            destination[3] = (T)(0x80 | (codePoint & 0x3F));
+            return 4;
+        }
+        else if constexpr (sizeof(T) == 2)
+        {
+            if (codePoint < 0x10000)
+            {
+                destination[0] = (T)codePoint;
+                return 1;
+            }
+
+            destination[0] = (T)(0xD800 + ((codePoint - 0x10000) >> 10));
+            destination[1] = (T)(0xDC00 + ((codePoint - 0x10000) & 0x3FF));
+            return 2;
+        }
+        else
+        {
+            destination[0] = (T)codePoint;
+            return 1;
+        }
+    }
+
+    template <CharType To, CharType From>
+    inline Size GetTranscodedLength(const From* source,
+                                    Size        length) noexcept
+    {
+        // The strings of the same encoding are copied as they are.
+        if constexpr (sizeof(To) == sizeof(From))
+            return length;
+
+        const From* current = source;
+        const From* end     = source + length;
+        Size        result  = 0;
+
+        while (current != end)
+        {
+            const Size asciiCount = Detail::CountAsciiBlocks(current, (Size)(end - current));
+
+            current += asciiCount;
+            result += asciiCount;
+
+            if (current == end)
+                break;
+
+            result += GetEncodedLength<To>(DecodeNext(current, end));
+        }
+
+        return result;
+    }
+
+    template <CharType To, CharType From>
+    inline Size Transcode(const From* source,
+                          Size        length,
+                          To*         destination) noexcept
+    {
+        if constexpr (std::is_same_v<To, From>)
+        {
+            std::memcpy(destination, source, length * sizeof(From));
+
+            return length;
+        }
+        else if constexpr (sizeof(To) == sizeof(From))
+        {
+            for (Size i = 0; i < length; ++i)
+                destination[i] = (To)source[i];
+
+            return length;
+        }
+        else
+        {
+            const From* current = source;
+            const From* end     = source + length;
+            To*         output  = destination;
+
+            while (current != end)
+            {
+                const Size asciiCount = Detail::TranscodeAsciiBlocks(current, (Size)(end - current), output);
+
+                current += asciiCount;
+                output += asciiCount;
+
+                if (current == end)
+                    break;
+
+                output += Encode(DecodeNext(current, end), output);
+            }
+
+            return (Size)(output - destination);
+        }
+    }
+
+} // namespace Unicode
+
+} // namespace System
+
+} // namespace Axis
+
+#endif // AXIS_SYSTEM_UNICODEIMPL_INL
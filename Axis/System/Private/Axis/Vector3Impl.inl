@@ -7,6 +7,13 @@
 #pragma once
 
 #include "../../Include/Axis/Vector3.hpp"
+#include <cmath>
+
+#if defined(AXIS_SIMD_SSE41)
+#    include <smmintrin.h>
+#elif defined(AXIS_SIMD_SSE2)
+#    include <emmintrin.h>
+#endif
 
 namespace Axis
 {
@@ -14,6 +21,46 @@ namespace Axis
 namespace System
 {
 
+namespace Detail
+{
+
+#if defined(AXIS_SIMD_SSE2)
+
+/// Loads the vector with the zero w component.
+inline __m128 LoadVector3(const Vector3<Float32>& vector) noexcept
+{
+    return _mm_setr_ps(vector.X, vector.Y, vector.Z, 0.0f);
+}
+
+/// Gets the magnitude of the vector broadcasted to every lane.
+inline __m128 GetVector3Length(__m128 vector) noexcept
+{
+#    if defined(AXIS_SIMD_SSE41)
+    return _mm_sqrt_ps(_mm_dp_ps(vector, vector, 0x7F));
+#    else
+    __m128 sum = _mm_mul_ps(vector, vector);
+    sum        = _mm_add_ps(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(2, 3, 0, 1)));
+    sum        = _mm_add_ps(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 0, 3, 2)));
+
+    return _mm_sqrt_ps(sum);
+#    endif
+}
+
+/// Normalizes the vector with a single division.
+inline Vector3<Float32> NormalizeVector3Simd(const Vector3<Float32>& vector) noexcept
+{
+    const __m128 elements = LoadVector3(vector);
+
+    alignas(16) Float32 result[4];
+    _mm_store_ps(result, _mm_div_ps(elements, GetVector3Length(elements)));
+
+    return Vector3<Float32>(result[0], result[1], result[2]);
+}
+
+#endif
+
+} // namespace Detail
+
 template <ArithmeticType T>
 template <ArithmeticType U, ArithmeticType V, ArithmeticType W>
 inline constexpr Vector3<T>::Vector3(U x,
@@ -43,21 +90,39 @@ inline constexpr BigFloat Vector3<T>::GetMagnitude() const noexcept
 }
 
 template <ArithmeticType T>
-inline constexpr void Vector3<T>::Normalize() noexcept requires(FloatingPointType<T>)
+inline constexpr T Vector3<T>::GetLength() const noexcept requires(FloatingPointType<T>)
 {
-    T magnitude = (T)GetMagnitude();
+#if defined(AXIS_SIMD_SSE2)
+    if constexpr (std::is_same_v<T, Float32>)
+    {
+        if (!std::is_constant_evaluated())
+            return _mm_cvtss_f32(Detail::GetVector3Length(Detail::LoadVector3(*this)));
+    }
+#endif
+
+    return std::sqrt((X * X) + (Y * Y) + (Z * Z));
+}
 
-    X /= magnitude;
-    Y /= magnitude;
-    Z /= magnitude;
+template <ArithmeticType T>
+inline constexpr void Vector3<T>::Normalize() noexcept requires(FloatingPointType<T>)
+{
+    *this = NormalizeCopy();
 }
 
 template <ArithmeticType T>
 inline constexpr Vector3<T> Vector3<T>::NormalizeCopy() const noexcept requires(FloatingPointType<T>)
 {
-    T magnitude = (T)GetMagnitude();
+#if defined(AXIS_SIMD_SSE2)
+    if constexpr (std::is_same_v<T, Float32>)
+    {
+        if (!std::is_constant_evaluated())
+            return Detail::NormalizeVector3Simd(*this);
+    }
+#endif
+
+    T magnitude = GetLength();
 
-    return Vector3((T)(X / magnitude), (T)(Y / magnitude), (T)(Z / magnitude));
+    return Vector3(X / magnitude, Y / magnitude, Z / magnitude);
 }
 
 template <ArithmeticType T>
@@ -0,0 +1,429 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#include <Axis/SystemPch.hpp>
+
+#include <Axis/BatchTransform.hpp>
+#include <cmath>
+#include <cstring>
+
+#if defined(AXIS_SIMD_AVX2)
+#    include <immintrin.h>
+#elif defined(AXIS_SIMD_SSE2)
+#    include <emmintrin.h>
+#endif
+
+namespace Axis
+{
+
+namespace System
+{
+
+static_assert(sizeof(Vector3F) == sizeof(Float32) * 3, "`Vector3F` must be tightly packed!");
+static_assert(sizeof(Vector2F) == sizeof(Float32) * 2, "`Vector2F` must be tightly packed!");
+
+#if defined(AXIS_SIMD_SSE2)
+
+// Splits 4 interleaved 3D points into their components.
+static inline void DeinterleaveVector3(const Float32* points,
+                                       __m128&        x,
+                                       __m128&        y,
+                                       __m128&        z) noexcept
+{
+    const __m128 first  = _mm_loadu_ps(points);     // x0 y0 z0 x1
+    const __m128 second = _mm_loadu_ps(points + 4); // y1 z1 x2 y2
+    const __m128 third  = _mm_loadu_ps(points + 8); // z2 x3 y3 z3
+
+    x = _mm_shuffle_ps(first, _mm_shuffle_ps(second, third, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+    y = _mm_shuffle_ps(_mm_shuffle_ps(first, second, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(second, third, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+    z = _mm_shuffle_ps(_mm_shuffle_ps(first, second, _MM_SHUFFLE(1, 1, 2, 2)), third, _MM_SHUFFLE(3, 0, 2, 0));
+}
+
+// Stores the components of 4 3D points interleaved.
+static inline void InterleaveVector3(__m128   x,
+                                     __m128   y,
+                                     __m128   z,
+                                     Float32* points) noexcept
+{
+    _mm_storeu_ps(points, _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)));
+    _mm_storeu_ps(points + 4, _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)));
+    _mm_storeu_ps(points + 8, _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+}
+
+// Splits 4 interleaved 2D points into their components.
+static inline void DeinterleaveVector2(const Float32* points,
+                                       __m128&        x,
+                                       __m128&        y) noexcept
+{
+    const __m128 first  = _mm_loadu_ps(points);     // x0 y0 x1 y1
+    const __m128 second = _mm_loadu_ps(points + 4); // x2 y2 x3 y3
+
+    x = _mm_shuffle_ps(first, second, _MM_SHUFFLE(2, 0, 2, 0));
+    y = _mm_shuffle_ps(first, second, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+// Stores the components of 4 2D points interleaved.
+static inline void InterleaveVector2(__m128   x,
+                                     __m128   y,
+                                     Float32* points) noexcept
+{
+    _mm_storeu_ps(points, _mm_unpacklo_ps(x, y));
+    _mm_storeu_ps(points + 4, _mm_unpackhi_ps(x, y));
+}
+
+#endif
+
+// Lanes of the `Float32`s processed by one step of the kernels, 8 with AVX2, 4 with SSE2 and 1 otherwise.
+struct FloatBatch
+{
+#if defined(AXIS_SIMD_AVX2)
+    static constexpr Size Width = 8;
+
+    __m256 Value; // <-- Lanes of the batch
+
+    static FloatBatch Broadcast(Float32 value) noexcept { return {_mm256_set1_ps(value)}; }
+
+    static FloatBatch Load(const Float32* source) noexcept { return {_mm256_loadu_ps(source)}; }
+
+    void Store(Float32* destination) const noexcept { _mm256_storeu_ps(destination, Value); }
+
+    // The points 0-3 go to the lower lanes and the points 4-7 to the upper lanes, so the shuffles of
+    // the SSE2 kernel work on both halves at once.
+    static void LoadVector3(const Float32* points,
+                            FloatBatch&    x,
+                            FloatBatch&    y,
+                            FloatBatch&    z) noexcept
+    {
+        const __m256 first  = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(points)), _mm_loadu_ps(points + 12), 1);
+        const __m256 second = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(points + 4)), _mm_loadu_ps(points + 16), 1);
+        const __m256 third  = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(points + 8)), _mm_loadu_ps(points + 20), 1);
+
+        x.Value = _mm256_shuffle_ps(first, _mm256_shuffle_ps(second, third, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+        y.Value = _mm256_shuffle_ps(_mm256_shuffle_ps(first, second, _MM_SHUFFLE(0, 0, 1, 1)), _mm256_shuffle_ps(second, third, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        z.Value = _mm256_shuffle_ps(_mm256_shuffle_ps(first, second, _MM_SHUFFLE(1, 1, 2, 2)), third, _MM_SHUFFLE(3, 0, 2, 0));
+    }
+
+    static void StoreVector3(const FloatBatch& x,
+                             const FloatBatch& y,
+                             const FloatBatch& z,
+                             Float32*          points) noexcept
+    {
+        const __m256 first  = _mm256_shuffle_ps(_mm256_shuffle_ps(x.Value, y.Value, _MM_SHUFFLE(0, 0, 0, 0)), _mm256_shuffle_ps(z.Value, x.Value, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+        const __m256 second = _mm256_shuffle_ps(_mm256_shuffle_ps(y.Value, z.Value, _MM_SHUFFLE(1, 1, 1, 1)), _mm256_shuffle_ps(x.Value, y.Value, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+        const __m256 third  = _mm256_shuffle_ps(_mm256_shuffle_ps(z.Value, x.Value, _MM_SHUFFLE(3, 3, 2, 2)), _mm256_shuffle_ps(y.Value, z.Value, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+
+        _mm_storeu_ps(points, _mm256_castps256_ps128(first));
+        _mm_storeu_ps(points + 4, _mm256_castps256_ps128(second));
+        _mm_storeu_ps(points + 8, _mm256_castps256_ps128(third));
+        _mm_storeu_ps(points + 12, _mm256_extractf128_ps(first, 1));
+        _mm_storeu_ps(points + 16, _mm256_extractf128_ps(second, 1));
+        _mm_storeu_ps(points + 20, _mm256_extractf128_ps(third, 1));
+    }
+
+    static void LoadVector2(const Float32* points,
+                            FloatBatch&    x,
+                            FloatBatch&    y) noexcept
+    {
+        __m128 lowX, lowY, highX, highY;
+
+        DeinterleaveVector2(points, lowX, lowY);
+        DeinterleaveVector2(points + 8, highX, highY);
+
+        x.Value = _mm256_insertf128_ps(_mm256_castps128_ps256(lowX), highX, 1);
+        y.Value = _mm256_insertf128_ps(_mm256_castps128_ps256(lowY), highY, 1);
+    }
+
+    static void StoreVector2(const FloatBatch& x,
+                             const FloatBatch& y,
+                             Float32*          points) noexcept
+    {
+        InterleaveVector2(_mm256_castps256_ps128(x.Value), _mm256_castps256_ps128(y.Value), points);
+        InterleaveVector2(_mm256_extractf128_ps(x.Value, 1), _mm256_extractf128_ps(y.Value, 1), points + 8);
+    }
+
+    friend FloatBatch operator+(FloatBatch left, FloatBatch right) noexcept { return {_mm256_add_ps(left.Value, right.Value)}; }
+
+    friend FloatBatch operator-(FloatBatch left, FloatBatch right) noexcept { return {_mm256_sub_ps(left.Value, right.Value)}; }
+
+    friend FloatBatch operator*(FloatBatch left, FloatBatch right) noexcept { return {_mm256_mul_ps(left.Value, right.Value)}; }
+#elif defined(AXIS_SIMD_SSE2)
+    static constexpr Size Width = 4;
+
+    __m128 Value; // <-- Lanes of the batch
+
+    static FloatBatch Broadcast(Float32 value) noexcept { return {_mm_set1_ps(value)}; }
+
+    static FloatBatch Load(const Float32* source) noexcept { return {_mm_loadu_ps(source)}; }
+
+    void Store(Float32* destination) const noexcept { _mm_storeu_ps(destination, Value); }
+
+    static void LoadVector3(const Float32* points,
+                            FloatBatch&    x,
+                            FloatBatch&    y,
+                            FloatBatch&    z) noexcept
+    {
+        DeinterleaveVector3(points, x.Value, y.Value, z.Value);
+    }
+
+    static void StoreVector3(const FloatBatch& x,
+                             const FloatBatch& y,
+                             const FloatBatch& z,
+                             Float32*          points) noexcept
+    {
+        InterleaveVector3(x.Value, y.Value, z.Value, points);
+    }
+
+    static void LoadVector2(const Float32* points,
+                            FloatBatch&    x,
+                            FloatBatch&    y) noexcept
+    {
+        DeinterleaveVector2(points, x.Value, y.Value);
+    }
+
+    static void StoreVector2(const FloatBatch& x,
+                             const FloatBatch& y,
+                             Float32*          points) noexcept
+    {
+        InterleaveVector2(x.Value, y.Value, points);
+    }
+
+    friend FloatBatch operator+(FloatBatch left, FloatBatch right) noexcept { return {_mm_add_ps(left.Value, right.Value)}; }
+
+    friend FloatBatch operator-(FloatBatch left, FloatBatch right) noexcept { return {_mm_sub_ps(left.Value, right.Value)}; }
+
+    friend FloatBatch operator*(FloatBatch left, FloatBatch right) noexcept { return {_mm_mul_ps(left.Value, right.Value)}; }
+#else
+    static constexpr Size Width = 1;
+
+    Float32 Value; // <-- Lanes of the batch
+
+    static FloatBatch Broadcast(Float32 value) noexcept { return {value}; }
+
+    static FloatBatch Load(const Float32* source) noexcept { return {*source}; }
+
+    void Store(Float32* destination) const noexcept { *destination = Value; }
+
+    static void LoadVector3(const Float32* points,
+                            FloatBatch&    x,
+                            FloatBatch&    y,
+                            FloatBatch&    z) noexcept
+    {
+        x.Value = points[0];
+        y.Value = points[1];
+        z.Value = points[2];
+    }
+
+    static void StoreVector3(const FloatBatch& x,
+                             const FloatBatch& y,
+                             const FloatBatch& z,
+                             Float32*          points) noexcept
+    {
+        points[0] = x.Value;
+        points[1] = y.Value;
+        points[2] = z.Value;
+    }
+
+    static void LoadVector2(const Float32* points,
+                            FloatBatch&    x,
+                            FloatBatch&    y) noexcept
+    {
+        x.Value = points[0];
+        y.Value = points[1];
+    }
+
+    static void StoreVector2(const FloatBatch& x,
+                             const FloatBatch& y,
+                             Float32*          points) noexcept
+    {
+        points[0] = x.Value;
+        points[1] = y.Value;
+    }
+
+    friend FloatBatch operator+(FloatBatch left, FloatBatch right) noexcept { return {left.Value + right.Value}; }
+
+    friend FloatBatch operator-(FloatBatch left, FloatBatch right) noexcept { return {left.Value - right.Value}; }
+
+    friend FloatBatch operator*(FloatBatch left, FloatBatch right) noexcept { return {left.Value * right.Value}; }
+#endif
+};
+
+// Rows of the affine part of the matrix, each element broadcasted to the lanes.
+struct MatrixBatch
+{
+    FloatBatch Elements[12]; // <-- Column-major elements of the upper 3 rows
+
+    explicit MatrixBatch(const FloatMatrix4x4& matrix) noexcept
+    {
+        for (Size column = 0; column < 4; ++column)
+        {
+            for (Size row = 0; row < 3; ++row)
+                Elements[column * 3 + row] = FloatBatch::Broadcast(matrix(row, column));
+        }
+    }
+
+    // Transforms the points, in the same order of the operations as `FloatMatrix4x4::TransformPoint`.
+    void TransformPoints(FloatBatch& x,
+                         FloatBatch& y,
+                         FloatBatch& z) const noexcept
+    {
+        const FloatBatch resultX = Elements[0] * x + Elements[3] * y + Elements[6] * z + Elements[9];
+        const FloatBatch resultY = Elements[1] * x + Elements[4] * y + Elements[7] * z + Elements[10];
+        const FloatBatch resultZ = Elements[2] * x + Elements[5] * y + Elements[8] * z + Elements[11];
+
+        x = resultX;
+        y = resultY;
+        z = resultZ;
+    }
+};
+
+// Sine, cosine and translation of the rotation broadcasted to the lanes.
+struct RotationBatch
+{
+    FloatBatch Sin;          // <-- Sine of the rotation
+    FloatBatch Cos;          // <-- Cosine of the rotation
+    FloatBatch TranslationX; // <-- Translation along the X axis
+    FloatBatch TranslationY; // <-- Translation along the Y axis
+
+    RotationBatch(Float32         rotation,
+                  const Vector2F& translation) noexcept :
+        Sin(FloatBatch::Broadcast(std::sin(rotation))),
+        Cos(FloatBatch::Broadcast(std::cos(rotation))),
+        TranslationX(FloatBatch::Broadcast(translation.X)),
+        TranslationY(FloatBatch::Broadcast(translation.Y)) {}
+
+    void RotateTranslate(FloatBatch& x,
+                         FloatBatch& y) const noexcept
+    {
+        const FloatBatch resultX = x * Cos - y * Sin + TranslationX;
+        const FloatBatch resultY = x * Sin + y * Cos + TranslationY;
+
+        x = resultX;
+        y = resultY;
+    }
+};
+
+// Runs the kernel over the `count` elements of the streams, each element has `ComponentCount` floats
+// in every stream. The kernel receives the base pointers of the streams and the offset of the batch
+// in floats. The remaining elements are copied to the padded buffers, so the kernel always processes
+// the whole batches.
+template <Size StreamCount, Size ComponentCount, class Kernel>
+static void ForEachBatch(const Float32* const (&sources)[StreamCount],
+                         Float32* const (&destinations)[StreamCount],
+                         Size          count,
+                         const Kernel& kernel) noexcept
+{
+    constexpr Size BatchSize = FloatBatch::Width * ComponentCount;
+
+    const Size wholeSize = (count - count % FloatBatch::Width) * ComponentCount;
+
+    for (Size offset = 0; offset < wholeSize; offset += BatchSize)
+        kernel(sources, destinations, offset);
+
+    if (wholeSize != count * ComponentCount)
+    {
+        alignas(32) Float32 buffers[StreamCount][BatchSize] = {};
+
+        const Float32* bufferSources[StreamCount];
+        Float32*       bufferDestinations[StreamCount];
+
+        const Size remainingSize = (count * ComponentCount - wholeSize) * sizeof(Float32);
+
+        for (Size stream = 0; stream < StreamCount; ++stream)
+        {
+            std::memcpy(buffers[stream], sources[stream] + wholeSize, remainingSize);
+
+            bufferSources[stream]      = buffers[stream];
+            bufferDestinations[stream] = buffers[stream];
+        }
+
+        kernel(bufferSources, bufferDestinations, 0);
+
+        for (Size stream = 0; stream < StreamCount; ++stream)
+            std::memcpy(destinations[stream] + wholeSize, buffers[stream], remainingSize);
+    }
+}
+
+namespace Math
+{
+    void TransformPoints(const Span<Vector3F>& points,
+                         const FloatMatrix4x4& matrix,
+                         Vector3F*             destination) noexcept
+    {
+        const MatrixBatch matrixBatch(matrix);
+
+        ForEachBatch<1, 3>({(const Float32*)points.GetData()}, {(Float32*)destination}, points.GetLength(), [&](const Float32* const* sources, Float32* const* destinations, Size offset) {
+            FloatBatch x, y, z;
+
+            FloatBatch::LoadVector3(sources[0] + offset, x, y, z);
+            matrixBatch.TransformPoints(x, y, z);
+            FloatBatch::StoreVector3(x, y, z, destinations[0] + offset);
+        });
+    }
+
+    void TransformPoints(const Float32*        x,
+                         const Float32*        y,
+                         const Float32*        z,
+                         Size                  count,
+                         const FloatMatrix4x4& matrix,
+                         Float32*              destinationX,
+                         Float32*              destinationY,
+                         Float32*              destinationZ) noexcept
+    {
+        const MatrixBatch matrixBatch(matrix);
+
+        ForEachBatch<3, 1>({x, y, z}, {destinationX, destinationY, destinationZ}, count, [&](const Float32* const* sources, Float32* const* destinations, Size offset) {
+            FloatBatch batchX = FloatBatch::Load(sources[0] + offset);
+            FloatBatch batchY = FloatBatch::Load(sources[1] + offset);
+            FloatBatch batchZ = FloatBatch::Load(sources[2] + offset);
+
+            matrixBatch.TransformPoints(batchX, batchY, batchZ);
+
+            batchX.Store(destinations[0] + offset);
+            batchY.Store(destinations[1] + offset);
+            batchZ.Store(destinations[2] + offset);
+        });
+    }
+
+    void RotateTranslate2D(const Span<Vector2F>& points,
+                           Float32               rotation,
+                           const Vector2F&       translation,
+                           Vector2F*             destination) noexcept
+    {
+        const RotationBatch rotationBatch(rotation, translation);
+
+        ForEachBatch<1, 2>({(const Float32*)points.GetData()}, {(Float32*)destination}, points.GetLength(), [&](const Float32* const* sources, Float32* const* destinations, Size offset) {
+            FloatBatch x, y;
+
+            FloatBatch::LoadVector2(sources[0] + offset, x, y);
+            rotationBatch.RotateTranslate(x, y);
+            FloatBatch::StoreVector2(x, y, destinations[0] + offset);
+        });
+    }
+
+    void RotateTranslate2D(const Float32*  x,
+                           const Float32*  y,
+                           Size            count,
+                           Float32         rotation,
+                           const Vector2F& translation,
+                           Float32*        destinationX,
+                           Float32*        destinationY) noexcept
+    {
+        const RotationBatch rotationBatch(rotation, translation);
+
+        ForEachBatch<2, 1>({x, y}, {destinationX, destinationY}, count, [&](const Float32* const* sources, Float32* const* destinations, Size offset) {
+            FloatBatch batchX = FloatBatch::Load(sources[0] + offset);
+            FloatBatch batchY = FloatBatch::Load(sources[1] + offset);
+
+            rotationBatch.RotateTranslate(batchX, batchY);
+
+            batchX.Store(destinations[0] + offset);
+            batchY.Store(destinations[1] + offset);
+        });
+    }
+
+} // namespace Math
+
+} // namespace System
+
+} // namespace Axis
@@ -0,0 +1,273 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#include <Axis/SystemPch.hpp>
+
+#include <Axis/ConcurrentHashMap.hpp>
+#include <Axis/List.hpp>
+
+namespace Axis
+{
+
+namespace System
+{
+
+namespace Detail
+{
+
+// Number of the retired objects collected before the writer tries to advance the epoch.
+static constexpr Size ReclaimThreshold = 64;
+
+// Epoch announced by one thread, zero while the thread isn't inside a guard.
+struct alignas(CacheLineSize) EpochRecord
+{
+    std::atomic<Uint64> Epoch   = 0;     // <-- Global epoch observed by the thread, zero if outside the guards
+    Size                Nesting = 0;     // <-- Number of the nested guards, only touched by the owner thread
+    std::atomic<Bool>   InUse   = false; // <-- Whether a thread owns the record
+};
+
+// Object waiting for the epoch to advance past its retirement.
+struct RetiredObject
+{
+    PVoid          Owner   = nullptr; // <-- Container of the object
+    PVoid          Object  = nullptr; // <-- Unlinked object
+    RetiredDeleter Deleter = nullptr; // <-- Function freeing the object
+    Uint64         Epoch   = 0;       // <-- Global epoch at the retirement
+};
+
+// Epochs of all the threads and the retired objects, shared by all the containers.
+class EpochDomain
+{
+public:
+    // Gets the record of the calling thread, registers the thread on its first call.
+    EpochRecord& GetThreadRecord()
+    {
+        // Releases the record to the threads started later once the thread exits.
+        struct ThreadRecord
+        {
+            EpochRecord* Record = nullptr;
+
+            ~ThreadRecord() noexcept
+            {
+                if (Record != nullptr)
+                    Record->InUse.store(false, std::memory_order_release);
+            }
+        };
+
+        thread_local ThreadRecord threadRecord;
+
+        if (threadRecord.Record == nullptr)
+            threadRecord.Record = &AcquireRecord();
+
+        return *threadRecord.Record;
+    }
+
+    // Announces the current epoch, the loads made after it can't see the objects retired two
+    // epochs earlier.
+    void Enter(EpochRecord& record) noexcept
+    {
+        if (record.Nesting++ != 0)
+            return;
+
+        Uint64 epoch = _globalEpoch.load(std::memory_order_seq_cst);
+
+        while (true)
+        {
+            record.Epoch.store(epoch, std::memory_order_seq_cst);
+
+            const Uint64 current = _globalEpoch.load(std::memory_order_seq_cst);
+
+            if (current == epoch)
+                return;
+
+            epoch = current;
+        }
+    }
+
+    void Leave(EpochRecord& record) noexcept
+    {
+        if (--record.Nesting == 0)
+            record.Epoch.store(0, std::memory_order_release);
+    }
+
+    void Retire(PVoid          owner,
+                PVoid          object,
+                RetiredDeleter deleter)
+    {
+        List<RetiredObject> reclaimed;
+
+        {
+            std::scoped_lock lock(_mutex);
+
+            _retired.Append({owner, object, deleter, _globalEpoch.load(std::memory_order_seq_cst)});
+
+            if (_retired.GetLength() < ReclaimThreshold)
+                return;
+
+            TryAdvance();
+            TakeReclaimable(reclaimed);
+        }
+
+        // The deleters run outside the lock, the destroyed values may retire the objects too.
+        for (const auto& retired : reclaimed)
+            retired.Deleter(retired.Owner, retired.Object);
+    }
+
+    void Collect()
+    {
+        List<RetiredObject> reclaimed;
+
+        {
+            std::scoped_lock lock(_mutex);
+
+            if (_retired.GetLength() == 0)
+                return;
+
+            // Advancing twice frees the objects retired in the current epoch as well, as long as no
+            // thread is inside a guard.
+            TryAdvance();
+            TryAdvance();
+            TakeReclaimable(reclaimed);
+        }
+
+        for (const auto& retired : reclaimed)
+            retired.Deleter(retired.Owner, retired.Object);
+    }
+
+    void Reclaim(PVoid owner) noexcept
+    {
+        // Takes the objects one at a time so nothing is allocated, the deleters run outside the lock.
+        while (true)
+        {
+            RetiredObject retired = {};
+
+            {
+                std::scoped_lock lock(_mutex);
+
+                Size index = 0;
+
+                while (index < _retired.GetLength() && _retired[index].Owner != owner)
+                    ++index;
+
+                if (index == _retired.GetLength())
+                    return;
+
+                retired         = _retired[index];
+                _retired[index] = _retired[_retired.GetLength() - 1];
+                _retired.PopBack();
+            }
+
+            retired.Deleter(retired.Owner, retired.Object);
+        }
+    }
+
+private:
+    EpochRecord& AcquireRecord()
+    {
+        std::scoped_lock lock(_mutex);
+
+        for (auto* record : _records)
+        {
+            Bool inUse = false;
+
+            if (record->InUse.compare_exchange_strong(inUse, true, std::memory_order_acquire))
+                return *record;
+        }
+
+        // The records are never freed, the other threads may be scanning them.
+        EpochRecord* record = New<EpochRecord>();
+
+        record->InUse.store(true, std::memory_order_relaxed);
+
+        _records.Append(record);
+
+        return *record;
+    }
+
+    // Advances the epoch if every thread inside a guard has observed the current one, the mutex
+    // must be locked.
+    void TryAdvance() noexcept
+    {
+        const Uint64 epoch = _globalEpoch.load(std::memory_order_seq_cst);
+
+        for (const auto* record : _records)
+        {
+            const Uint64 recordEpoch = record->Epoch.load(std::memory_order_seq_cst);
+
+            if (recordEpoch != 0 && recordEpoch != epoch)
+                return;
+        }
+
+        _globalEpoch.store(epoch + 1, std::memory_order_seq_cst);
+    }
+
+    // Moves the objects retired at least two epochs ago to the list, the mutex must be locked.
+    void TakeReclaimable(List<RetiredObject>& reclaimed)
+    {
+        const Uint64 epoch = _globalEpoch.load(std::memory_order_relaxed);
+
+        Size kept = 0;
+
+        for (Size i = 0; i < _retired.GetLength(); ++i)
+        {
+            if (_retired[i].Epoch + 2 <= epoch)
+                reclaimed.Append(_retired[i]);
+            else
+                _retired[kept++] = _retired[i];
+        }
+
+        while (_retired.GetLength() > kept)
+            _retired.PopBack();
+    }
+
+    std::atomic<Uint64> _globalEpoch = 1;  // <-- Current epoch, starts at one since zero marks the idle records
+    std::mutex          _mutex       = {}; // <-- Guards the records list and the retired objects
+    List<EpochRecord*>  _records     = {}; // <-- Records of all the threads which have entered a guard
+    List<RetiredObject> _retired     = {}; // <-- Objects waiting for the epoch to advance
+};
+
+static EpochDomain& GetEpochDomain()
+{
+    // Never destroyed, the threads may still exit after the static destructors have run.
+    static EpochDomain* domain = New<EpochDomain>();
+
+    return *domain;
+}
+
+EpochGuard::EpochGuard()
+{
+    EpochDomain& domain = GetEpochDomain();
+
+    domain.Enter(domain.GetThreadRecord());
+}
+
+EpochGuard::~EpochGuard() noexcept
+{
+    EpochDomain& domain = GetEpochDomain();
+
+    domain.Leave(domain.GetThreadRecord());
+}
+
+void RetireObject(PVoid          owner,
+                  PVoid          object,
+                  RetiredDeleter deleter)
+{
+    GetEpochDomain().Retire(owner, object, deleter);
+}
+
+void ReclaimObjects(PVoid owner) noexcept
+{
+    GetEpochDomain().Reclaim(owner);
+}
+
+} // namespace Detail
+
+void ReclaimRemovedNodes()
+{
+    Detail::GetEpochDomain().Collect();
+}
+
+} // namespace System
+
+} // namespace Axis
@@ -291,6 +291,23 @@ Size FileStream::Seek(Int64      offset,
     return GetPosition();
 }
 
+Task<List<Uint8>> ReadFileAsync(TaskScheduler& scheduler,
+                                JobSystem&     jobSystem,
+                                WString        filePath)
+{
+    // The path stays in the coroutine frame until the read finishes.
+    co_return co_await scheduler.Run(jobSystem, [&filePath]() {
+        FileStream fileStream(filePath, FileMode::Read | FileMode::Binary);
+
+        List<Uint8> bytes(fileStream.GetLength());
+
+        if (fileStream.Read(bytes.GetData(), 0, bytes.GetLength()) != bytes.GetLength())
+            throw IOException("Failed to read the whole file!");
+
+        return bytes;
+    });
+}
+
 } // namespace System
 
 } // namespace Axis
@@ -0,0 +1,511 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#include <Axis/SystemPch.hpp>
+
+#include <Axis/Assert.hpp>
+#include <Axis/ConcurrentQueue.hpp>
+#include <Axis/JobSystem.hpp>
+#include <Axis/Profiler.hpp>
+#include <thread>
+
+#if defined(AXIS_SIMD_SSE2)
+#    include <emmintrin.h>
+#endif
+
+namespace Axis
+{
+
+namespace System
+{
+
+namespace Detail
+{
+
+struct Job
+{
+    JobSystem::JobFunction Function = {};      // <-- Job body
+    JobCounter*            Counter  = nullptr; // <-- Counter decremented when the job finishes, can be null
+    Job*                   Next     = nullptr; // <-- Next job of the shared queue or the continuation list
+};
+
+} // namespace Detail
+
+using Detail::Job;
+
+// Number of the failed attempts to find a job before the worker goes to sleep, or the waiting
+// thread starts yielding.
+static constexpr Size SpinCount = 64;
+
+// Hints the processor that the thread is spinning.
+static inline void Pause() noexcept
+{
+#if defined(AXIS_SIMD_SSE2)
+    _mm_pause();
+#else
+    std::this_thread::yield();
+#endif
+}
+
+// Circular array of the jobs, the deque replaces it with a larger one when it's full. The replaced
+// rings stay alive until the deque is destroyed, the thieves may still be reading them.
+struct JobRing
+{
+    Int64              Mask     = 0;       // <-- Capacity - 1, the capacity is always power of two
+    std::atomic<Job*>* Slots    = nullptr; // <-- Jobs of the ring
+    JobRing*           Previous = nullptr; // <-- Replaced smaller ring
+
+    JobRing(Int64     capacity,
+            JobRing* previous) :
+        Mask(capacity - 1),
+        Slots(NewArray<std::atomic<Job*>>((Size)capacity)),
+        Previous(previous) {}
+
+    ~JobRing() noexcept { DeleteArray(Slots); }
+};
+
+// Chase-Lev work-stealing deque, "Correct and Efficient Work-Stealing for Weak Memory Models"
+// (Lê et al., 2013). The owner pushes and pops at the bottom, the thieves steal from the top.
+class JobDeque
+{
+public:
+    JobDeque() :
+        _pRing(New<JobRing>(InitialCapacity, nullptr)) {}
+
+    ~JobDeque() noexcept
+    {
+        JobRing* ring = _pRing.load(std::memory_order_relaxed);
+
+        while (ring != nullptr)
+        {
+            JobRing* previous = ring->Previous;
+            Delete(ring);
+            ring = previous;
+        }
+    }
+
+    // Pushes the job at the bottom, only called by the owner.
+    void Push(Job* job) noexcept
+    {
+        const Int64 bottom = _bottom.load(std::memory_order_relaxed);
+        const Int64 top    = _top.load(std::memory_order_acquire);
+
+        JobRing* ring = _pRing.load(std::memory_order_relaxed);
+
+        if (bottom - top > ring->Mask)
+            ring = Grow(ring, top, bottom);
+
+        ring->Slots[bottom & ring->Mask].store(job, std::memory_order_relaxed);
+
+        // Publishes the job to the thieves.
+        _bottom.store(bottom + 1, std::memory_order_release);
+    }
+
+    // Pops the newest job, only called by the owner.
+    Job* Pop() noexcept
+    {
+        const Int64 bottom = _bottom.load(std::memory_order_relaxed) - 1;
+        JobRing*    ring   = _pRing.load(std::memory_order_relaxed);
+
+        _bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        Int64 top = _top.load(std::memory_order_relaxed);
+
+        if (top > bottom)
+        {
+            _bottom.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        Job* job = ring->Slots[bottom & ring->Mask].load(std::memory_order_relaxed);
+
+        // The last job, races with the thieves.
+        if (top == bottom)
+        {
+            if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                job = nullptr;
+
+            _bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+
+        return job;
+    }
+
+    // Steals the oldest job, called by any thread. Returns null if the deque is empty or another
+    // thread took the job first.
+    Job* Steal() noexcept
+    {
+        Int64 top = _top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const Int64 bottom = _bottom.load(std::memory_order_acquire);
+
+        if (top >= bottom)
+            return nullptr;
+
+        JobRing* ring = _pRing.load(std::memory_order_acquire);
+        Job*     job  = ring->Slots[top & ring->Mask].load(std::memory_order_relaxed);
+
+        if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            return nullptr;
+
+        return job;
+    }
+
+private:
+    static constexpr Int64 InitialCapacity = 256;
+
+    JobRing* Grow(JobRing* ring,
+                  Int64    top,
+                  Int64    bottom)
+    {
+        JobRing* newRing = New<JobRing>((ring->Mask + 1) * 2, ring);
+
+        for (Int64 i = top; i < bottom; ++i)
+            newRing->Slots[i & newRing->Mask].store(ring->Slots[i & ring->Mask].load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+        _pRing.store(newRing, std::memory_order_release);
+
+        return newRing;
+    }
+
+    alignas(CacheLineSize) std::atomic<Int64> _top    = 0;       // <-- Index of the oldest job, advanced by the thieves
+    alignas(CacheLineSize) std::atomic<Int64> _bottom = 0;       // <-- Index past the newest job, only written by the owner
+    std::atomic<JobRing*>                     _pRing  = nullptr; // <-- Current ring
+};
+
+namespace Detail
+{
+
+struct alignas(CacheLineSize) JobWorker
+{
+    JobDeque    Deque       = {};      // <-- Jobs submitted from the worker
+    std::thread Thread      = {};      // <-- Worker thread
+    Uint64      RandomState = 0;       // <-- Picks the victims to steal from
+    JobSystem*  Owner       = nullptr; // <-- Job system the worker belongs to
+};
+
+} // namespace Detail
+
+using Detail::JobWorker;
+
+static thread_local JobWorker* s_pCurrentWorker = nullptr; // Worker running on the calling thread, null for the other threads
+
+JobCounter::~JobCounter() noexcept
+{
+    AXIS_ASSERT(_count.load(std::memory_order_relaxed) == 0, "The counter was destroyed with unfinished jobs!");
+}
+
+JobSystem::JobSystem(Size workerCount)
+{
+    if (workerCount == 0)
+        throw InvalidArgumentException("`workerCount` was zero!");
+
+    _workerCount = workerCount;
+    _pWorkers    = NewArray<JobWorker>(workerCount);
+
+    for (Size i = 0; i < workerCount; ++i)
+    {
+        _pWorkers[i].RandomState = i + 1;
+        _pWorkers[i].Owner       = this;
+    }
+
+    for (Size i = 0; i < workerCount; ++i)
+        _pWorkers[i].Thread = std::thread([this, i]() { RunWorker(i); });
+}
+
+JobSystem::~JobSystem() noexcept
+{
+    _stopping.store(true, std::memory_order_seq_cst);
+
+    _wakeSignal.fetch_add(1, std::memory_order_seq_cst);
+    _wakeSignal.notify_all();
+
+    for (Size i = 0; i < _workerCount; ++i)
+        _pWorkers[i].Thread.join();
+
+    DeleteArray(_pWorkers);
+}
+
+Size JobSystem::GetDefaultWorkerCount() noexcept
+{
+    const Size hardwareThreadCount = std::thread::hardware_concurrency();
+
+    return hardwareThreadCount > 1 ? hardwareThreadCount - 1 : 1;
+}
+
+Bool JobSystem::IsWorkerThread() const noexcept
+{
+    return s_pCurrentWorker != nullptr && s_pCurrentWorker->Owner == this;
+}
+
+void JobSystem::Submit(JobFunction function,
+                       JobCounter* counter)
+{
+    Job* job = AllocatedNew<PoolAllocator, Job>();
+
+    job->Function = std::move(function);
+    job->Counter  = counter;
+
+    if (counter != nullptr)
+        counter->_count.fetch_add(1, std::memory_order_relaxed);
+
+    Push(job);
+}
+
+void JobSystem::Submit(JobFunction function,
+                       JobCounter& dependency,
+                       JobCounter* counter)
+{
+    Job* job = AllocatedNew<PoolAllocator, Job>();
+
+    job->Function = std::move(function);
+    job->Counter  = counter;
+
+    if (counter != nullptr)
+        counter->_count.fetch_add(1, std::memory_order_relaxed);
+
+    // Locks the continuations unless the dependency has already finished, the last job of the
+    // dependency waits for the lock before it takes the continuations.
+    Size value = dependency._count.load(std::memory_order_acquire);
+
+    while (true)
+    {
+        if (value == 0)
+        {
+            Push(job);
+            return;
+        }
+
+        if (value & JobCounter::LockBit)
+        {
+            Pause();
+            value = dependency._count.load(std::memory_order_acquire);
+        }
+        else if (dependency._count.compare_exchange_weak(value, value | JobCounter::LockBit, std::memory_order_acquire, std::memory_order_acquire))
+            break;
+    }
+
+    job->Next                  = dependency._pContinuations;
+    dependency._pContinuations = job;
+
+    dependency._count.fetch_and(~JobCounter::LockBit, std::memory_order_release);
+}
+
+void JobSystem::WaitFor(JobCounter& counter) noexcept
+{
+    JobWorker* worker = IsWorkerThread() ? s_pCurrentWorker : nullptr;
+
+    Size failedCount = 0;
+
+    while (!counter.IsDone())
+    {
+        if (Job* job = FindJob(worker))
+        {
+            Execute(job);
+            failedCount = 0;
+        }
+        else if (++failedCount < SpinCount)
+            Pause();
+        else
+        {
+            // The remaining jobs are running on the other threads, gives them the core.
+            std::this_thread::yield();
+        }
+    }
+}
+
+Job* JobSystem::FindJob(JobWorker* worker) noexcept
+{
+    if (worker != nullptr)
+    {
+        if (Job* job = worker->Deque.Pop())
+            return job;
+    }
+
+    if (_queueCount.load(std::memory_order_relaxed) != 0)
+    {
+        std::scoped_lock lock(_queueMutex);
+
+        if (Job* job = _pQueueHead)
+        {
+            _pQueueHead = job->Next;
+
+            if (_pQueueHead == nullptr)
+                _pQueueTail = nullptr;
+
+            _queueCount.fetch_sub(1, std::memory_order_relaxed);
+
+            return job;
+        }
+    }
+
+    // Steals from the workers starting at a random one, so the thieves spread over the victims.
+    Size start = 0;
+
+    if (worker != nullptr)
+    {
+        worker->RandomState ^= worker->RandomState << 13;
+        worker->RandomState ^= worker->RandomState >> 7;
+        worker->RandomState ^= worker->RandomState << 17;
+
+        start = (Size)(worker->RandomState % _workerCount);
+    }
+
+    for (Size i = 0; i < _workerCount; ++i)
+    {
+        JobWorker& victim = _pWorkers[(start + i) % _workerCount];
+
+        if (&victim == worker)
+            continue;
+
+        if (Job* job = victim.Deque.Steal())
+            return job;
+    }
+
+    return nullptr;
+}
+
+void JobSystem::Push(Job* job) noexcept
+{
+    if (IsWorkerThread())
+        s_pCurrentWorker->Deque.Push(job);
+    else
+    {
+        std::scoped_lock lock(_queueMutex);
+
+        job->Next = nullptr;
+
+        if (_pQueueTail != nullptr)
+            _pQueueTail->Next = job;
+        else
+            _pQueueHead = job;
+
+        _pQueueTail = job;
+
+        _queueCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    WakeWorker();
+}
+
+void JobSystem::Execute(Job* job) noexcept
+{
+    job->Function();
+
+    JobCounter* counter = job->Counter;
+
+    // Destroys the job first, so its captures are gone once the waiters see the counter reach zero.
+    AllocatedDelete<PoolAllocator>(job);
+
+    if (counter != nullptr)
+        Finish(*counter);
+}
+
+void JobSystem::Finish(JobCounter& counter) noexcept
+{
+    Size value = counter._count.load(std::memory_order_relaxed);
+
+    // Decrements the count, or locks the continuations if this is the last job.
+    while (true)
+    {
+        if ((value & ~JobCounter::LockBit) > 1)
+        {
+            if (counter._count.compare_exchange_weak(value, value - 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+                return;
+        }
+        else if (value & JobCounter::LockBit)
+        {
+            Pause();
+            value = counter._count.load(std::memory_order_relaxed);
+        }
+        else if (counter._count.compare_exchange_weak(value, value | JobCounter::LockBit, std::memory_order_acquire, std::memory_order_relaxed))
+            break;
+    }
+
+    Job* continuations      = counter._pContinuations;
+    counter._pContinuations = nullptr;
+
+    // Unlocks and reaches zero at once, the counter mustn't be touched after this.
+    counter._count.fetch_sub(JobCounter::LockBit | 1, std::memory_order_acq_rel);
+
+    while (continuations != nullptr)
+    {
+        Job* next = continuations->Next;
+        Push(continuations);
+        continuations = next;
+    }
+}
+
+void JobSystem::WakeWorker() noexcept
+{
+    // Pairs with the fence of the sleeping worker: either the worker finds the job, or this sees
+    // the worker and wakes it.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (_sleepingCount.load(std::memory_order_relaxed) == 0)
+        return;
+
+    _wakeSignal.fetch_add(1, std::memory_order_seq_cst);
+    _wakeSignal.notify_one();
+}
+
+void JobSystem::RunWorker(Size index) noexcept
+{
+    JobWorker& worker = _pWorkers[index];
+
+    s_pCurrentWorker = &worker;
+
+    AXIS_PROFILE_THREAD_NAME("JobSystem Worker");
+
+    Size failedCount = 0;
+
+    while (true)
+    {
+        if (Job* job = FindJob(&worker))
+        {
+            Execute(job);
+            failedCount = 0;
+
+            continue;
+        }
+
+        if (++failedCount < SpinCount)
+        {
+            Pause();
+            continue;
+        }
+
+        failedCount = 0;
+
+        const Size signal = _wakeSignal.load(std::memory_order_seq_cst);
+
+        _sleepingCount.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // Checks for the jobs pushed before the workers could see this one sleeping.
+        if (Job* job = FindJob(&worker))
+        {
+            _sleepingCount.fetch_sub(1, std::memory_order_relaxed);
+            Execute(job);
+
+            continue;
+        }
+
+        if (_stopping.load(std::memory_order_seq_cst))
+        {
+            _sleepingCount.fetch_sub(1, std::memory_order_relaxed);
+            break;
+        }
+
+        _wakeSignal.wait(signal, std::memory_order_seq_cst);
+        _sleepingCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    s_pCurrentWorker = nullptr;
+}
+
+} // namespace System
+
+} // namespace Axis
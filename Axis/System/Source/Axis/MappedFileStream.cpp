@@ -0,0 +1,334 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file `LICENSE`, which is part of this source code package.
+
+#include <Axis/SystemPch.hpp>
+
+#include <Axis/Exception.hpp>
+#include <Axis/MappedFileStream.hpp>
+#include <Axis/Math.hpp>
+#include <Axis/String.hpp>
+#include <cstring>
+#include <errno.h>
+
+#ifdef AXIS_PLATFORM_WINDOWS
+#    include <Windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace Axis
+{
+
+namespace System
+{
+
+#ifdef AXIS_PLATFORM_WINDOWS
+
+// Maps the whole file, the file and the mapping handles can be closed once the view exists.
+static const Byte* MapFile(const WString&    filePath,
+                           FileAccessPattern accessPattern,
+                           Size&             length)
+{
+    const DWORD flags = accessPattern == FileAccessPattern::Sequential ? FILE_FLAG_SEQUENTIAL_SCAN :
+                        accessPattern == FileAccessPattern::Random     ? FILE_FLAG_RANDOM_ACCESS :
+                                                                         FILE_ATTRIBUTE_NORMAL;
+
+    HANDLE file = CreateFileW(filePath.GetCString(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags, nullptr);
+
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        const DWORD error = GetLastError();
+
+        if (error == ERROR_ACCESS_DENIED)
+            throw UnauthorizedAccessException("Access denied!");
+        else if (error == ERROR_FILE_NOT_FOUND || error == ERROR_PATH_NOT_FOUND)
+            throw FileNotFoundException("File not found!");
+        else
+            throw IOException("Failed to open file!");
+    }
+
+    LARGE_INTEGER fileSize = {};
+
+    if (!GetFileSizeEx(file, &fileSize))
+    {
+        CloseHandle(file);
+        throw IOException("Failed to get file length!");
+    }
+
+    length = (Size)fileSize.QuadPart;
+
+    // The empty files can't be mapped, the stream is simply empty.
+    if (length == 0)
+    {
+        CloseHandle(file);
+        return nullptr;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+    CloseHandle(file);
+
+    if (!mapping)
+        throw IOException("Failed to map file!");
+
+    PVoid view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+    CloseHandle(mapping);
+
+    if (!view)
+        throw IOException("Failed to map file!");
+
+    return (const Byte*)view;
+}
+
+static void UnmapFile(const Byte* data,
+                      Size) noexcept
+{
+    UnmapViewOfFile(data);
+}
+
+static void PrefetchRange(const Byte* data,
+                          Size        length) noexcept
+{
+    WIN32_MEMORY_RANGE_ENTRY range = {(PVoid)data, length};
+
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+}
+
+#else
+
+// Maps the whole file, the descriptor can be closed once the mapping exists.
+static const Byte* MapFile(const WString&    filePath,
+                           FileAccessPattern accessPattern,
+                           Size&             length)
+{
+    const String8 nativePath = filePath.GetCString();
+
+    const int file = open(nativePath.GetCString(), O_RDONLY | O_CLOEXEC);
+
+    if (file == -1)
+    {
+        if (errno == EACCES)
+            throw UnauthorizedAccessException("Access denied!");
+        else if (errno == ENOENT)
+            throw FileNotFoundException("File not found!");
+        else
+            throw IOException("Failed to open file!");
+    }
+
+    struct stat status = {};
+
+    if (fstat(file, &status) != 0)
+    {
+        close(file);
+        throw IOException("Failed to get file length!");
+    }
+
+    length = (Size)status.st_size;
+
+    // The empty files can't be mapped, the stream is simply empty.
+    if (length == 0)
+    {
+        close(file);
+        return nullptr;
+    }
+
+    PVoid view = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, file, 0);
+
+    close(file);
+
+    if (view == MAP_FAILED)
+        throw IOException("Failed to map file!");
+
+    const int advice = accessPattern == FileAccessPattern::Sequential ? MADV_SEQUENTIAL :
+                       accessPattern == FileAccessPattern::Random     ? MADV_RANDOM :
+                                                                        MADV_NORMAL;
+
+    // Only a hint, the mapping works the same when it's refused.
+    madvise(view, length, advice);
+
+    return (const Byte*)view;
+}
+
+static void UnmapFile(const Byte* data,
+                      Size        length) noexcept
+{
+    munmap((PVoid)data, length);
+}
+
+static void PrefetchRange(const Byte* data,
+                          Size        length) noexcept
+{
+    static const Size s_pageSize = (Size)sysconf(_SC_PAGESIZE);
+
+    // `madvise` only takes the page aligned addresses.
+    const Size alignedBegin = (Size)data & ~(s_pageSize - 1);
+
+    madvise((PVoid)alignedBegin, (Size)data + length - alignedBegin, MADV_WILLNEED);
+}
+
+#endif
+
+MappedFileStream::MappedFileStream(const StringView<WChar>& filePath,
+                                   FileAccessPattern        accessPattern)
+{
+    // Checks if the file path is valid.
+    if (filePath == nullptr)
+        throw InvalidArgumentException("`filePath` was nullptr!");
+
+    _data   = MapFile(WString(filePath), accessPattern, _length);
+    _isOpen = true;
+}
+
+MappedFileStream::~MappedFileStream() noexcept
+{
+    if (_data != nullptr)
+        UnmapFile(_data, _length);
+}
+
+MappedFileStream::MappedFileStream(MappedFileStream&& other) noexcept :
+    _data(other._data),
+    _length(other._length),
+    _position(other._position),
+    _isOpen(other._isOpen)
+{
+    other._data     = nullptr;
+    other._length   = 0;
+    other._position = 0;
+    other._isOpen   = false;
+}
+
+MappedFileStream& MappedFileStream::operator=(MappedFileStream&& other) noexcept
+{
+    if (this == &other)
+        return *this;
+
+    if (_data != nullptr)
+        UnmapFile(_data, _length);
+
+    _data     = other._data;
+    _length   = other._length;
+    _position = other._position;
+    _isOpen   = other._isOpen;
+
+    other._data     = nullptr;
+    other._length   = 0;
+    other._position = 0;
+    other._isOpen   = false;
+
+    return *this;
+}
+
+Bool MappedFileStream::CanRead() const
+{
+    if (!_isOpen)
+        throw InvalidOperationException("MappedFileStream was not opened!");
+
+    return true;
+}
+
+Bool MappedFileStream::CanWrite() const
+{
+    if (!_isOpen)
+        throw InvalidOperationException("MappedFileStream was not opened!");
+
+    return false;
+}
+
+Bool MappedFileStream::CanSeek() const
+{
+    if (!_isOpen)
+        throw InvalidOperationException("MappedFileStream was not opened!");
+
+    return true;
+}
+
+Size MappedFileStream::GetPosition() const
+{
+    if (!_isOpen)
+        throw InvalidOperationException("MappedFileStream was not opened!");
+
+    return _position;
+}
+
+Size MappedFileStream::GetLength() const
+{
+    if (!_isOpen)
+        throw InvalidOperationException("MappedFileStream was not opened!");
+
+    return _length;
+}
+
+Size MappedFileStream::Read(PVoid buffer,
+                            Size  offset,
+                            Size  count)
+{
+    if (!_isOpen)
+        throw InvalidOperationException("MappedFileStream was not opened!");
+
+    const Size readCount = Math::Min(count, _length - _position);
+
+    if (readCount != 0)
+        std::memcpy((Byte*)buffer + offset, _data + _position, readCount);
+
+    _position += readCount;
+
+    return readCount;
+}
+
+Size MappedFileStream::Write(PVoid,
+                             Size,
+                             Size)
+{
+    throw InvalidOperationException("MappedFileStream is read-only!");
+}
+
+Size MappedFileStream::Seek(Int64      offset,
+                            SeekOrigin origin)
+{
+    if (!_isOpen)
+        throw InvalidOperationException("MappedFileStream was not opened!");
+
+    Int64 base = 0;
+
+    switch (origin)
+    {
+        case SeekOrigin::Begin:
+            base = 0;
+            break;
+
+        case SeekOrigin::Current:
+            base = (Int64)_position;
+            break;
+
+        case SeekOrigin::End:
+            base = (Int64)_length;
+            break;
+    }
+
+    const Int64 position = base + offset;
+
+    if (position < 0 || position > (Int64)_length)
+        throw ArgumentOutOfRangeException("Seeked out of the file!");
+
+    _position = (Size)position;
+
+    return _position;
+}
+
+void MappedFileStream::Prefetch(Size offset,
+                                Size length) const noexcept
+{
+    if (_data == nullptr || offset >= _length)
+        return;
+
+    PrefetchRange(_data + offset, Math::Min(length, _length - offset));
+}
+
+} // namespace System
+
+} // namespace Axis
@@ -7,6 +7,9 @@
 #include <Axis/Assert.hpp>
 #include <Axis/Exception.hpp>
 #include <Axis/Memory.hpp>
+#include <atomic>
+#include <bit>
+#include <cstring>
 
 namespace Axis
 {
@@ -39,6 +42,44 @@ PVoid MallocAllocator::Allocate(Size size, Size alignment)
     return (PVoid)alignedMemory;
 }
 
+PVoid MallocAllocator::Reallocate(PVoid ptr,
+                                  Size  oldSize,
+                                  Size  newSize,
+                                  Size  alignment)
+{
+    if (ptr == nullptr)
+        return Allocate(newSize, alignment);
+
+    // Arguments validation
+    if ((alignment & (alignment - 1)) != 0)
+        throw InvalidArgumentException("`alignment` was not a power of two!");
+
+    // Calculates the padding size.
+    Size offset = alignment - 1 + sizeof(PVoid);
+
+    PVoid originalMemory = ((PVoid*)ptr)[-1];
+    Size  oldPadding     = (Size)ptr - (Size)originalMemory;
+
+    // Realloc'ed memory, the old memory is left untouched on failure
+    PVoid newOriginalMemory = std::realloc(originalMemory, newSize + offset);
+
+    // Failed to allocate memory
+    if (newOriginalMemory == nullptr)
+        throw OutOfMemoryException();
+
+    // Calculates the aligned memory address.
+    PVoid* alignedMemory = (PVoid*)(((Size)(newOriginalMemory) + offset) & ~(alignment - 1)); // Aligned block
+
+    // The new block may have a different alignment padding, shifts the contents accordingly
+    if ((Size)alignedMemory - (Size)newOriginalMemory != oldPadding)
+        std::memmove(alignedMemory, (PVoid)((Size)newOriginalMemory + oldPadding), oldSize < newSize ? oldSize : newSize);
+
+    // Stores the original memory address before the aligned memory address.
+    alignedMemory[-1] = newOriginalMemory;
+
+    return (PVoid)alignedMemory;
+}
+
 void MallocAllocator::Deallocate(PVoid ptr) noexcept
 {
     std::free(((PVoid*)ptr)[-1]);
@@ -50,15 +91,18 @@ class FixedPoolAllocator
 public:
     // Constructor
     FixedPoolAllocator(Size size,
-                       Size alignment) noexcept :
+                       Size alignment,
+                       Size cacheIndex) noexcept :
         _size(size),
-        _alignment(alignment) {}
+        _alignment(alignment),
+        _cacheIndex(cacheIndex) {}
 
     FixedPoolAllocator(const FixedPoolAllocator&) = delete;
 
     FixedPoolAllocator(FixedPoolAllocator&& other) noexcept :
         _size(other._size),
         _alignment(other._alignment),
+        _cacheIndex(other._cacheIndex),
         _memoryBlockHeader(other._memoryBlockHeader)
     {
         other._memoryBlockHeader = nullptr;
@@ -129,6 +173,23 @@ class FixedPoolAllocator
         _memoryBlockHeader = block;
     }
 
+    // Returns the chain of memory blocks (linked through `MemoryBlockHeader::Next`) to the pool
+    void ReturnChain(PVoid firstUserPtr, PVoid lastUserPtr) noexcept
+    {
+        auto firstBlock = (MemoryBlockHeader*)((Size)firstUserPtr - sizeof(MemoryBlockHeader));
+        auto lastBlock  = (MemoryBlockHeader*)((Size)lastUserPtr - sizeof(MemoryBlockHeader));
+
+        // Splices the whole chain in front of the free list
+        lastBlock->Next    = _memoryBlockHeader;
+        _memoryBlockHeader = firstBlock;
+    }
+
+    // Gets the index of the thread local cache bin which serves this pool
+    inline Size GetCacheIndex() const noexcept { return _cacheIndex; }
+
+    // Gets the size of the memory blocks including the header and the alignment padding
+    inline Size GetSize() const noexcept { return _size; }
+
     struct MemoryBlockHeader
     {
         MemoryBlockHeader*  Next                     = nullptr; // <- Points to the next memory block in the pool
@@ -139,6 +200,7 @@ class FixedPoolAllocator
 private:
     Size               _size              = 0;       // <-- Size of the memory block
     Size               _alignment         = 0;       // <-- Alignment of the memory block
+    Size               _cacheIndex        = 0;       // <-- Index of the thread local cache bin (`NoCacheIndex` if not cached)
     MemoryBlockHeader* _memoryBlockHeader = nullptr; // <-- Memory block header
 };
 
@@ -173,6 +235,179 @@ using PoolAllocatorMap = std::unordered_map<PoolAllocatorKey, std::unique_ptr<Fi
 static PoolAllocatorMap s_poolAllocatorMap      = {}; // Global pool allocator map
 static std::mutex       s_poolAllocatorMapMutex = {}; // Mutex for accessing the pool allocator map
 
+// Size classes (log2 of the block size) served by the thread local cache
+static constexpr Size ThreadCacheSizeClassCount = 17; // <-- Up to 64 KiB blocks
+
+// Alignment classes (log2 of the alignment) served by the thread local cache
+static constexpr Size ThreadCacheAlignmentClassCount = 8; // <-- Up to 128 bytes alignment
+
+// Number of blocks moved between the thread local cache and the shared pool at once
+static constexpr Size ThreadCacheBatchSize = 32;
+
+// Maximum number of blocks kept in a single thread local cache bin before draining
+static constexpr Size ThreadCacheMaxBinLength = ThreadCacheBatchSize * 2;
+
+// Index used by the pools which aren't served by the thread local cache
+static constexpr Size NoCacheIndex = ThreadCacheSizeClassCount * ThreadCacheAlignmentClassCount;
+
+// Gets the pool for the given block size and alignment, creates one if it doesn't exist.
+//
+// `s_poolAllocatorMapMutex` must be held by the caller.
+static FixedPoolAllocator* GetOrCreateFixedPoolAllocator(Size actualSize,
+                                                         Size alignment,
+                                                         Size cacheIndex)
+{
+    // Gets the key
+    PoolAllocatorKey key = {actualSize, alignment};
+
+    auto it = s_poolAllocatorMap.find(key);
+
+    // Allocator not found
+    if (it == s_poolAllocatorMap.end())
+    {
+        // Inserts the allocator
+        it = s_poolAllocatorMap.insert({key, std::make_unique<FixedPoolAllocator>(actualSize, alignment, cacheIndex)}).first;
+    }
+
+    return it->second.get();
+}
+
+// Per-thread front-end cache of free blocks, one bin for each (size class, alignment class).
+//
+// Allocation and deallocation only touch the calling thread's bins; the shared pools are
+// only locked when a bin has to be refilled or drained, and that is done in batches.
+// Set once the calling thread's cache has been destroyed, the later requests (e.g. from the static
+// destructors) go to the shared pools. Trivially destructible, so it outlives the cache.
+static thread_local Bool s_threadLocalPoolCacheDestroyed = false;
+
+class ThreadLocalPoolCache
+{
+public:
+    // Destructor, gives all the cached blocks back to the shared pools.
+    ~ThreadLocalPoolCache() noexcept
+    {
+        Release();
+
+        s_threadLocalPoolCacheDestroyed = true;
+    }
+
+    // Gets a block from the bin, refills the bin from the shared pool if it's empty.
+    inline PVoid Allocate(Size actualSize,
+                          Size alignment,
+                          Size cacheIndex)
+    {
+        auto& bin = _bins[cacheIndex];
+
+        if (!bin.FreeList)
+            Refill(bin, actualSize, alignment, cacheIndex);
+
+        auto block = bin.FreeList;
+
+        // Pops the block from the bin
+        bin.FreeList = block->Next;
+        bin.Length--;
+
+        // Forwards the block
+        return (PVoid)((Size)block + sizeof(FixedPoolAllocator::MemoryBlockHeader));
+    }
+
+    // Puts the block into the bin, drains the bin into the shared pool if it grows too long.
+    inline void Deallocate(FixedPoolAllocator::MemoryBlockHeader* block,
+                           Size                                   cacheIndex) noexcept
+    {
+        auto& bin = _bins[cacheIndex];
+
+        // The bin might not have been touched by this thread yet
+        bin.Pool = block->Pool;
+
+        // Pushes the block to the bin
+        block->Next  = bin.FreeList;
+        bin.FreeList = block;
+        bin.Length++;
+
+        if (bin.Length > ThreadCacheMaxBinLength)
+            Drain(bin, ThreadCacheBatchSize);
+    }
+
+    // Gives all the cached blocks back to the shared pools.
+    void Release() noexcept
+    {
+        for (auto& bin : _bins)
+        {
+            if (bin.Length)
+                Drain(bin, bin.Length);
+        }
+    }
+
+private:
+    struct Bin
+    {
+        FixedPoolAllocator::MemoryBlockHeader* FreeList = nullptr; // <-- Free blocks owned by this thread
+        FixedPoolAllocator*                    Pool     = nullptr; // <-- Shared pool of this size class
+        Size                                   Length   = 0;       // <-- Number of blocks in the free list
+    };
+
+    // Takes `ThreadCacheBatchSize` blocks from the shared pool.
+    void Refill(Bin& bin,
+                Size actualSize,
+                Size alignment,
+                Size cacheIndex)
+    {
+        std::lock_guard<std::mutex> lock(s_poolAllocatorMapMutex);
+
+        if (!bin.Pool)
+            bin.Pool = GetOrCreateFixedPoolAllocator(actualSize, alignment, cacheIndex);
+
+        for (Size i = 0; i < ThreadCacheBatchSize; ++i)
+        {
+            PVoid userPtr = nullptr;
+
+            try
+            {
+                userPtr = bin.Pool->Allocate();
+            }
+            catch (...)
+            {
+                // Serves whatever we've already got, otherwise propagates the exception
+                if (bin.FreeList)
+                    return;
+
+                throw;
+            }
+
+            auto block = (FixedPoolAllocator::MemoryBlockHeader*)((Size)userPtr - sizeof(FixedPoolAllocator::MemoryBlockHeader));
+
+            block->Next  = bin.FreeList;
+            bin.FreeList = block;
+            bin.Length++;
+        }
+    }
+
+    // Gives the given number of blocks from the front of the bin back to the shared pool.
+    void Drain(Bin& bin,
+               Size count) noexcept
+    {
+        auto first = bin.FreeList;
+        auto last  = first;
+
+        // Finds the last block of the chain to give back
+        for (Size i = 1; i < count; ++i)
+            last = last->Next;
+
+        bin.FreeList = last->Next;
+        bin.Length -= count;
+
+        std::lock_guard<std::mutex> lock(s_poolAllocatorMapMutex);
+
+        bin.Pool->ReturnChain((PVoid)((Size)first + sizeof(FixedPoolAllocator::MemoryBlockHeader)),
+                              (PVoid)((Size)last + sizeof(FixedPoolAllocator::MemoryBlockHeader)));
+    }
+
+    Bin _bins[ThreadCacheSizeClassCount * ThreadCacheAlignmentClassCount] = {}; // <-- Bins indexed by `cacheIndex`
+};
+
+static thread_local ThreadLocalPoolCache s_threadLocalPoolCache = {}; // Calling thread's front-end cache
+
 PVoid PoolAllocator::Allocate(Size size,
                               Size alignment)
 {
@@ -184,36 +419,66 @@ PVoid PoolAllocator::Allocate(Size size,
     Size actualSize = size + sizeof(FixedPoolAllocator::MemoryBlockHeader) + alignment - 1;
 
     // Round to the next nearest power of 2
-    actualSize--;
-
-    for (Size i = 1; i < sizeof(Size) * CHAR_BIT; i <<= 1)
-        actualSize |= (actualSize >> i);
+    actualSize = std::bit_ceil(actualSize);
 
-    actualSize = actualSize + 1;
+    // Both are powers of two, so the trailing zero count is their log2
+    Size sizeClass      = (Size)std::countr_zero(actualSize);
+    Size alignmentClass = (Size)std::countr_zero(alignment);
 
-    // Gets the key
-    PoolAllocatorKey key = {actualSize, alignment};
+    // Common path: served by the thread local cache without locking
+    if (sizeClass < ThreadCacheSizeClassCount && alignmentClass < ThreadCacheAlignmentClassCount)
+    {
+        const Size cacheIndex = (sizeClass * ThreadCacheAlignmentClassCount) + alignmentClass;
 
-    // Gets the allocator
-    std::lock_guard<std::mutex> lock(s_poolAllocatorMapMutex);
+        if (!s_threadLocalPoolCacheDestroyed)
+        {
+            // Resolves the thread local address only once
+            auto& threadLocalPoolCache = s_threadLocalPoolCache;
 
-    auto it = s_poolAllocatorMap.find(key);
+            return threadLocalPoolCache.Allocate(actualSize, alignment, cacheIndex);
+        }
 
-    // Allocator not found
-    if (it == s_poolAllocatorMap.end())
-    {
-        // Inserts the allocator
-        s_poolAllocatorMap.insert({key, std::make_unique<FixedPoolAllocator>(actualSize, alignment)});
+        std::lock_guard<std::mutex> lock(s_poolAllocatorMapMutex);
 
-        // Gets the allocator
-        it = s_poolAllocatorMap.find(key);
+        return GetOrCreateFixedPoolAllocator(actualSize, alignment, cacheIndex)->Allocate();
     }
 
     // Gets the allocator
-    auto& allocator = it->second;
+    std::lock_guard<std::mutex> lock(s_poolAllocatorMapMutex);
 
     // Allocates memory
-    return allocator->Allocate();
+    return GetOrCreateFixedPoolAllocator(actualSize, alignment, NoCacheIndex)->Allocate();
+}
+
+PVoid PoolAllocator::Reallocate(PVoid ptr,
+                                Size  oldSize,
+                                Size  newSize,
+                                Size  alignment)
+{
+    if (ptr == nullptr)
+        return Allocate(newSize, alignment);
+
+    // Arguments validation
+    if ((alignment & (alignment - 1)) != 0)
+        throw InvalidArgumentException("`alignment` was not a power of two!");
+
+    // Backwards the userPtr to the memory block header
+    auto block = (FixedPoolAllocator::MemoryBlockHeader*)((Size)ptr - sizeof(FixedPoolAllocator::MemoryBlockHeader));
+
+    // Number of usable bytes from the user pointer to the end of the pooled block
+    Size capacity = (Size)block->AllocatedOriginalPointer + block->Pool->GetSize() - (Size)ptr;
+
+    // Still fits in the same block
+    if (newSize <= capacity)
+        return ptr;
+
+    PVoid newMemory = Allocate(newSize, alignment);
+
+    std::memcpy(newMemory, ptr, oldSize < newSize ? oldSize : newSize);
+
+    Deallocate(ptr);
+
+    return newMemory;
 }
 
 void PoolAllocator::Deallocate(PVoid ptr) noexcept
@@ -225,7 +490,15 @@ void PoolAllocator::Deallocate(PVoid ptr) noexcept
     auto block = (FixedPoolAllocator::MemoryBlockHeader*)((Size)ptr - sizeof(FixedPoolAllocator::MemoryBlockHeader));
 
     // Gets the allocator
-    auto allocator = block->Pool;
+    auto allocator  = block->Pool;
+    auto cacheIndex = allocator->GetCacheIndex();
+
+    // Common path: goes to the calling thread's cache regardless of which thread allocated it
+    if (cacheIndex != NoCacheIndex && !s_threadLocalPoolCacheDestroyed)
+    {
+        s_threadLocalPoolCache.Deallocate(block, cacheIndex);
+        return;
+    }
 
     std::lock_guard<std::mutex> lock(s_poolAllocatorMapMutex);
 
@@ -233,6 +506,295 @@ void PoolAllocator::Deallocate(PVoid ptr) noexcept
     allocator->Return(ptr);
 }
 
+void PoolAllocator::ReleaseThreadCache() noexcept
+{
+    if (!s_threadLocalPoolCacheDestroyed)
+        s_threadLocalPoolCache.Release();
+}
+
+// Chunk of memory which the frame arena bump-allocates from, the usable memory follows the header.
+struct FrameArenaChunk
+{
+    FrameArenaChunk* Next     = nullptr; // <-- Next chunk in the list
+    Size             Capacity = 0;       // <-- Number of usable bytes after the header
+};
+
+// Chunk lists of the frame arena shared by all threads.
+class FrameArenaChunkLists
+{
+public:
+    // Destructor, frees all the chunks.
+    ~FrameArenaChunkLists() noexcept
+    {
+        for (auto& usedChunks : UsedChunks)
+            FreeChunks(usedChunks);
+
+        FreeChunks(AvailableChunks);
+    }
+
+    std::mutex       Mutex                                        = {};      // <-- Mutex for accessing the lists
+    FrameArenaChunk* UsedChunks[FrameArenaAllocator::BufferCount] = {};      // <-- Chunks handed out in each of the buffered frames
+    FrameArenaChunk* AvailableChunks                              = nullptr; // <-- Recycled chunks ready to be handed out again
+
+private:
+    // Frees all the chunks in the list
+    static void FreeChunks(FrameArenaChunk* chunk) noexcept
+    {
+        while (chunk)
+        {
+            auto next = chunk->Next;
+
+            std::free(chunk);
+
+            chunk = next;
+        }
+    }
+};
+
+// Per-thread bump pointer into the chunk currently owned by the thread.
+struct FrameArenaThreadState
+{
+    Size Current     = 0;        // <-- Address of the next free byte
+    Size End         = 0;        // <-- Address past the end of the chunk
+    Size FrameNumber = ~(Size)0; // <-- Frame number in which the chunk was acquired
+};
+
+static FrameArenaChunkLists s_frameArenaChunkLists  = {}; // Global frame arena chunk lists
+static std::atomic<Size>    s_frameArenaFrameNumber = 0;  // Current frame number of the frame arena
+
+static thread_local FrameArenaThreadState s_frameArenaThreadState = {}; // Calling thread's bump pointer
+
+// Acquires a new chunk for the calling thread which is large enough for the given request and allocates from it.
+static PVoid AcquireFrameArenaChunkAndAllocate(FrameArenaThreadState& threadState,
+                                               Size                   size,
+                                               Size                   alignment,
+                                               Size                   frameNumber)
+{
+    // Worst case size including the alignment padding
+    Size requiredSize = size + alignment - 1;
+
+    FrameArenaChunk* chunk = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(s_frameArenaChunkLists.Mutex);
+
+        // Looks for the first recycled chunk which fits the request
+        FrameArenaChunk** indirect = &s_frameArenaChunkLists.AvailableChunks;
+
+        while (*indirect && (*indirect)->Capacity < requiredSize)
+            indirect = &(*indirect)->Next;
+
+        if (*indirect)
+        {
+            chunk     = *indirect;
+            *indirect = chunk->Next;
+        }
+        else
+        {
+            Size capacity = requiredSize > FrameArenaAllocator::ChunkSize ? requiredSize : FrameArenaAllocator::ChunkSize;
+
+            chunk = (FrameArenaChunk*)std::malloc(sizeof(FrameArenaChunk) + capacity);
+
+            // Failed to allocate memory
+            if (chunk == nullptr)
+                throw OutOfMemoryException();
+
+            chunk->Capacity = capacity;
+        }
+
+        // The chunk belongs to the current frame from now on
+        auto& usedChunks = s_frameArenaChunkLists.UsedChunks[frameNumber % FrameArenaAllocator::BufferCount];
+
+        chunk->Next = usedChunks;
+        usedChunks  = chunk;
+    }
+
+    Size begin   = (Size)(chunk + 1);
+    Size aligned = (begin + alignment - 1) & ~(alignment - 1);
+
+    threadState.Current     = aligned + size;
+    threadState.End         = begin + chunk->Capacity;
+    threadState.FrameNumber = frameNumber;
+
+    return (PVoid)aligned;
+}
+
+PVoid FrameArenaAllocator::Allocate(Size size,
+                                    Size alignment)
+{
+    // Arguments validation
+    if ((alignment & (alignment - 1)) != 0)
+        throw InvalidArgumentException("`alignment` was not a power of two!");
+
+    auto& threadState = s_frameArenaThreadState;
+    Size  frameNumber = s_frameArenaFrameNumber.load(std::memory_order_relaxed);
+
+    // Common path: bumps the pointer of the chunk the thread already owns in this frame
+    if (threadState.FrameNumber == frameNumber)
+    {
+        Size aligned = (threadState.Current + alignment - 1) & ~(alignment - 1);
+
+        if (aligned + size <= threadState.End)
+        {
+            threadState.Current = aligned + size;
+
+            return (PVoid)aligned;
+        }
+    }
+
+    return AcquireFrameArenaChunkAndAllocate(threadState, size, alignment, frameNumber);
+}
+
+PVoid FrameArenaAllocator::Reallocate(PVoid ptr,
+                                      Size  oldSize,
+                                      Size  newSize,
+                                      Size  alignment)
+{
+    if (ptr == nullptr)
+        return Allocate(newSize, alignment);
+
+    // Arguments validation
+    if ((alignment & (alignment - 1)) != 0)
+        throw InvalidArgumentException("`alignment` was not a power of two!");
+
+    auto& threadState = s_frameArenaThreadState;
+    Size  frameNumber = s_frameArenaFrameNumber.load(std::memory_order_relaxed);
+
+    // The last allocation of the thread's chunk, moves the bump pointer
+    if (threadState.FrameNumber == frameNumber && (Size)ptr + oldSize == threadState.Current && (Size)ptr + newSize <= threadState.End)
+    {
+        threadState.Current = (Size)ptr + newSize;
+
+        return ptr;
+    }
+
+    // Shrinking never needs to move
+    if (newSize <= oldSize)
+        return ptr;
+
+    PVoid newMemory = Allocate(newSize, alignment);
+
+    std::memcpy(newMemory, ptr, oldSize);
+
+    return newMemory;
+}
+
+void FrameArenaAllocator::Deallocate(PVoid) noexcept
+{
+    // The memory is released in bulk when the frame gets recycled.
+}
+
+void FrameArenaAllocator::Reset() noexcept
+{
+    std::lock_guard<std::mutex> lock(s_frameArenaChunkLists.Mutex);
+
+    Size nextFrameNumber = s_frameArenaFrameNumber.load(std::memory_order_relaxed) + 1;
+
+    // The chunks in this slot were handed out `BufferCount` frames ago and aren't in use anymore
+    auto& recycledChunks = s_frameArenaChunkLists.UsedChunks[nextFrameNumber % BufferCount];
+
+    while (recycledChunks)
+    {
+        auto next = recycledChunks->Next;
+
+        recycledChunks->Next                   = s_frameArenaChunkLists.AvailableChunks;
+        s_frameArenaChunkLists.AvailableChunks = recycledChunks;
+
+        recycledChunks = next;
+    }
+
+    s_frameArenaFrameNumber.store(nextFrameNumber, std::memory_order_release);
+}
+
+Size FrameArenaAllocator::GetFrameNumber() noexcept
+{
+    return s_frameArenaFrameNumber.load(std::memory_order_relaxed);
+}
+
+// Default memory resource which forwards to `MallocAllocator`
+static AllocatorMemoryResource<MallocAllocator> s_mallocMemoryResource = {};
+
+static std::atomic<MemoryResource*> s_defaultMemoryResource = &s_mallocMemoryResource; // Current default memory resource
+
+MemoryResource* GetDefaultMemoryResource() noexcept
+{
+    return s_defaultMemoryResource.load(std::memory_order_acquire);
+}
+
+MemoryResource* SetDefaultMemoryResource(MemoryResource* memoryResource) noexcept
+{
+    return s_defaultMemoryResource.exchange(memoryResource ? memoryResource : &s_mallocMemoryResource, std::memory_order_acq_rel);
+}
+
+// Chunk requested from the upstream resource, the usable memory follows the header.
+struct ArenaMemoryResource::Chunk
+{
+    Chunk* Next     = nullptr; // <-- Previously used chunk
+    Size   Capacity = 0;       // <-- Number of usable bytes after the header
+};
+
+ArenaMemoryResource::ArenaMemoryResource(Size            chunkSize,
+                                         MemoryResource* upstream) noexcept :
+    _upstream(upstream ? upstream : GetDefaultMemoryResource()),
+    _chunkSize(chunkSize) {}
+
+ArenaMemoryResource::~ArenaMemoryResource() noexcept
+{
+    Release();
+}
+
+PVoid ArenaMemoryResource::Allocate(Size size,
+                                    Size alignment)
+{
+    // Arguments validation
+    if ((alignment & (alignment - 1)) != 0)
+        throw InvalidArgumentException("`alignment` was not a power of two!");
+
+    Size aligned = (_current + alignment - 1) & ~(alignment - 1);
+
+    // Requests a new chunk if the current one doesn't fit
+    if (!_chunks || aligned + size > _end)
+    {
+        Size requiredSize = size + alignment - 1;
+        Size capacity     = requiredSize > _chunkSize ? requiredSize : _chunkSize;
+
+        auto chunk = (Chunk*)_upstream->Allocate(sizeof(Chunk) + capacity, alignof(Chunk));
+
+        chunk->Next     = _chunks;
+        chunk->Capacity = capacity;
+
+        _chunks  = chunk;
+        _current = (Size)(chunk + 1);
+        _end     = _current + capacity;
+
+        aligned = (_current + alignment - 1) & ~(alignment - 1);
+    }
+
+    _current = aligned + size;
+
+    return (PVoid)aligned;
+}
+
+void ArenaMemoryResource::Deallocate(PVoid) noexcept
+{
+    // The memory is given back in bulk by `Release`.
+}
+
+void ArenaMemoryResource::Release() noexcept
+{
+    while (_chunks)
+    {
+        auto next = _chunks->Next;
+
+        _upstream->Deallocate(_chunks);
+
+        _chunks = next;
+    }
+
+    _current = 0;
+    _end     = 0;
+}
+
 } // namespace System
 
 } // namespace Axis
@@ -0,0 +1,88 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#include <Axis/SystemPch.hpp>
+
+#include <Axis/ParallelAlgorithm.hpp>
+
+namespace Axis
+{
+
+namespace System
+{
+
+// Number of the chunks per thread, the extra chunks balance the uneven chunks and the threads
+// joining late.
+static constexpr Size ChunksPerThread = 4;
+
+// Shared by all the jobs of one call, lives on the stack of the calling thread until they finish.
+struct ParallelChunkContext
+{
+    JobSystem*                    System    = nullptr; // <-- Job system running the chunks
+    Size                          Count     = 0;       // <-- Number of the elements
+    Size                          ChunkSize = 0;       // <-- Number of the elements per chunk
+    FunctionRef<void(Size, Size)> Body;                // <-- Called with the ranges of the chunks
+};
+
+// Runs the chunks in [chunkBegin, chunkEnd): submits the upper halves as the jobs and runs the
+// lowest chunk itself, so the thieves take the largest halves first.
+static void RunParallelChunks(const ParallelChunkContext& context,
+                              Size                        chunkBegin,
+                              Size                        chunkEnd) noexcept
+{
+    JobCounter counter;
+
+    while (chunkEnd - chunkBegin > 1)
+    {
+        const Size middle = chunkBegin + (chunkEnd - chunkBegin) / 2;
+
+        context.System->Submit([&context, middle, chunkEnd]() { RunParallelChunks(context, middle, chunkEnd); }, &counter);
+
+        chunkEnd = middle;
+    }
+
+    const Size begin = chunkBegin * context.ChunkSize;
+
+    context.Body(begin, std::min(begin + context.ChunkSize, context.Count));
+
+    context.System->WaitFor(counter);
+}
+
+namespace Detail
+{
+
+Size GetParallelChunkSize(const JobSystem& jobSystem,
+                          Size             count,
+                          Size             grainSize) noexcept
+{
+    const Size threadCount = jobSystem.GetWorkerCount() + 1;
+    const Size chunkCount  = threadCount * ChunksPerThread;
+
+    return std::max({grainSize, (count + chunkCount - 1) / chunkCount, (Size)1});
+}
+
+void ParallelForChunks(JobSystem&                    jobSystem,
+                       Size                          count,
+                       Size                          chunkSize,
+                       FunctionRef<void(Size, Size)> body) noexcept
+{
+    if (count == 0)
+        return;
+
+    if (count <= chunkSize)
+    {
+        body(0, count);
+        return;
+    }
+
+    const ParallelChunkContext context = {&jobSystem, count, chunkSize, body};
+
+    RunParallelChunks(context, 0, (count + chunkSize - 1) / chunkSize);
+}
+
+} // namespace Detail
+
+} // namespace System
+
+} // namespace Axis
@@ -0,0 +1,53 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file `LICENSE`, which is part of this source code package.
+
+#include <Axis/System.hpp>
+#include <Axis/SystemPch.hpp>
+#include <cerrno>
+#include <cstdio>
+#include <time.h>
+
+namespace Axis
+{
+
+namespace System
+{
+
+void Sleep(const TimePeriod& period) noexcept
+{
+    timespec remaining = {};
+
+    remaining.tv_sec  = (time_t)(period.Microseconds / TimePeriod::MicrosecondsPerSecond);
+    remaining.tv_nsec = (long)(period.Microseconds % TimePeriod::MicrosecondsPerSecond) * 1000;
+
+    // Resumes the sleep for the remaining time when a signal interrupts it
+    while (nanosleep(&remaining, &remaining) == -1 && errno == EINTR) {}
+}
+
+// The posix processes use the terminal they were started from, there's no console to create.
+Bool CreateConsole() noexcept
+{
+    return false;
+}
+
+Bool DestroyConsole() noexcept
+{
+    Bool result = true;
+
+    // Redirect the standard IO to /dev/null, the terminal itself stays with the parent process.
+    if (!std::freopen("/dev/null", "r", stdin))
+        result = false;
+
+    if (!std::freopen("/dev/null", "w", stdout))
+        result = false;
+
+    if (!std::freopen("/dev/null", "w", stderr))
+        result = false;
+
+    return result;
+}
+
+} // namespace System
+
+} // namespace Axis
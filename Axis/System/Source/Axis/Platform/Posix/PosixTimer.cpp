@@ -0,0 +1,156 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file `LICENSE`, which is part of this source code package.
+
+#include <Axis/SystemPch.hpp>
+
+#include <Axis/Config.hpp>
+#include <Axis/Platform/Posix/PosixTimer.hpp>
+#include <Axis/TimePeriod.hpp>
+#include <cstdio>
+#include <cstring>
+#include <time.h>
+
+// The time stamp counter is read directly on x86 Linux, the other targets use the clock alone.
+#if defined(AXIS_PLATFORM_LINUX) && (defined(__x86_64__) || defined(__i386__))
+#    include <cpuid.h>
+#    include <x86intrin.h>
+#    define AXIS_TIMER_USE_TSC
+#endif
+
+// Reads the monotonic clock which isn't slewed by NTP, in nanoseconds.
+static Axis::Uint64 GetRawNanoseconds() noexcept
+{
+    timespec time;
+
+    clock_gettime(CLOCK_MONOTONIC_RAW, &time);
+
+    return (Axis::Uint64)time.tv_sec * 1000000000ull + (Axis::Uint64)time.tv_nsec;
+}
+
+#ifdef AXIS_TIMER_USE_TSC
+
+// Conversion from the time stamp counter's ticks to the nanoseconds of the raw clock.
+struct TscConversion
+{
+    Axis::Bool   Available          = false; // <-- Whether the counter can be used
+    Axis::Uint64 BaseTicks          = 0;     // <-- Counter reading at the calibration
+    Axis::Uint64 BaseNanoseconds    = 0;     // <-- Clock reading at the calibration
+    double       NanosecondsPerTick = 0.0;   // <-- Measured length of a tick
+};
+
+// The counter is only used when it ticks at the constant rate across the power states (the
+// invariant TSC) and the kernel trusts it as its own clock source, so the cores agree on it.
+static Axis::Bool IsTscReliable() noexcept
+{
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+
+    if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) || !(edx & (1u << 8)))
+        return false;
+
+    std::FILE* file = std::fopen("/sys/devices/system/clocksource/clocksource0/current_clocksource", "r");
+
+    if (!file)
+        return false;
+
+    char       clockSource[32] = {};
+    const bool read            = std::fgets(clockSource, sizeof(clockSource), file) != nullptr;
+
+    std::fclose(file);
+
+    return read && std::strncmp(clockSource, "tsc", 3) == 0;
+}
+
+// Reads the counter and the clock at the same instant, as close as the two reads can be.
+static void SampleTsc(Axis::Uint64& ticks,
+                      Axis::Uint64& nanoseconds) noexcept
+{
+    const Axis::Uint64 before = __rdtsc();
+
+    nanoseconds = GetRawNanoseconds();
+    ticks       = before + (__rdtsc() - before) / 2;
+}
+
+// Measures the counter's rate against the clock over a few milliseconds, once per process.
+static TscConversion CalibrateTsc() noexcept
+{
+    constexpr Axis::Uint64 CalibrationNanoseconds = 5000000;
+
+    TscConversion conversion = {};
+
+    if (!IsTscReliable())
+        return conversion;
+
+    SampleTsc(conversion.BaseTicks, conversion.BaseNanoseconds);
+
+    Axis::Uint64 ticks       = 0;
+    Axis::Uint64 nanoseconds = 0;
+
+    do
+    {
+        SampleTsc(ticks, nanoseconds);
+    } while (nanoseconds - conversion.BaseNanoseconds < CalibrationNanoseconds);
+
+    if (ticks <= conversion.BaseTicks)
+        return conversion;
+
+    conversion.NanosecondsPerTick = (double)(nanoseconds - conversion.BaseNanoseconds) / (double)(ticks - conversion.BaseTicks);
+    conversion.Available          = true;
+
+    return conversion;
+}
+
+#endif
+
+static Axis::System::TimePeriod GetCurrentTimePeriod() noexcept
+{
+#ifdef AXIS_TIMER_USE_TSC
+    static const TscConversion s_tscConversion = CalibrateTsc();
+
+    if (s_tscConversion.Available)
+    {
+        const Axis::Uint64 elapsedTicks = __rdtsc() - s_tscConversion.BaseTicks;
+        const Axis::Uint64 nanoseconds  = s_tscConversion.BaseNanoseconds + (Axis::Uint64)((double)elapsedTicks * s_tscConversion.NanosecondsPerTick);
+
+        return Axis::System::TimePeriod((Axis::Size)(nanoseconds / 1000));
+    }
+#endif
+
+    return Axis::System::TimePeriod((Axis::Size)(GetRawNanoseconds() / 1000));
+}
+
+namespace Axis
+{
+
+namespace System
+{
+
+// Default constructor
+Timer::Timer() noexcept :
+    _lastestTime(GetCurrentTimePeriod()) {}
+
+// Default destructor
+Timer::~Timer() noexcept {}
+
+TimePeriod Timer::GetElapsedTimePeriod() const noexcept
+{
+    return GetCurrentTimePeriod() - _lastestTime;
+}
+
+TimePeriod Timer::Reset() noexcept
+{
+    const TimePeriod currentTimePeriod = GetCurrentTimePeriod();
+    const TimePeriod elapsed           = currentTimePeriod - _lastestTime;
+    _lastestTime                       = currentTimePeriod;
+
+    return elapsed;
+}
+
+TimePeriod Timer::GetTimestamp() noexcept
+{
+    return GetCurrentTimePeriod();
+}
+
+} // namespace System
+
+} // namespace Axis
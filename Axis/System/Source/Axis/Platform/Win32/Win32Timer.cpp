@@ -131,6 +131,11 @@ TimePeriod Timer::Reset() noexcept
     return elapsed;
 }
 
+TimePeriod Timer::GetTimestamp() noexcept
+{
+    return GetCurrentTimePeriod();
+}
+
 } // namespace System
 
 } // namespace Axis
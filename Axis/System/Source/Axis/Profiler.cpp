@@ -0,0 +1,438 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#include <Axis/SystemPch.hpp>
+
+#include <Axis/ConcurrentQueue.hpp>
+#include <Axis/Profiler.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+
+namespace Axis
+{
+
+namespace System
+{
+
+// Event slot of the ring, the fields are atomic since the exports read them while the owner
+// thread may be overwriting the slot; such reads are detected and dropped.
+struct ProfileEventSlot
+{
+    std::atomic<const char*> Name  = nullptr; // <-- Name of the zone
+    std::atomic<Uint64>      Start = 0;       // <-- Timestamp at the zone's beginning
+    std::atomic<Uint64>      End   = 0;       // <-- Timestamp at the zone's end
+    std::atomic<Uint32>      Depth = 0;       // <-- Number of the zones enclosing this one
+};
+
+// Ring of the events recorded by one thread, only the owner thread writes to it.
+struct alignas(CacheLineSize) ProfileEventRing
+{
+    std::atomic<Uint64>      ReserveIndex = 0;       // <-- Number of the events ever recorded, announced before the slot is written
+    std::atomic<Uint64>      WriteIndex   = 0;       // <-- Number of the events ever recorded, published after the slot is written
+    std::atomic<Bool>        InUse        = false;   // <-- Whether a thread owns the ring
+    std::atomic<const char*> ThreadName   = nullptr; // <-- Name set by `Profiler::SetThreadName`
+    Uint32                   ThreadId     = 0;       // <-- Index of the ring, exported as the thread id
+
+    ProfileEventSlot Events[Profiler::EventCapacity] = {}; // <-- Slots indexed by the write index modulo the capacity
+};
+
+static_assert((Profiler::EventCapacity & (Profiler::EventCapacity - 1)) == 0, "`Profiler::EventCapacity` must be power of two!");
+
+// Rings of all the threads which have recorded a zone, never freed since the exports may be
+// reading them while their threads exit.
+static List<ProfileEventRing*> s_profileEventRings                           = {};
+static std::mutex              s_profileEventRingMutex                       = {};
+static std::atomic<Uint64>     s_profileFrameStarts[Profiler::FrameCapacity] = {}; // <-- Timestamps of the recent frames' beginnings
+static std::atomic<Uint64>     s_profileFrameCount                           = 0;
+static std::atomic<Uint64>     s_profileClearTimestamp                       = 0;  // <-- Events started before it are dropped
+
+// Gets the ring of the calling thread, takes over the ring of an exited thread or creates a new one.
+static ProfileEventRing& AcquireProfileEventRing()
+{
+    std::scoped_lock lockGuard(s_profileEventRingMutex);
+
+    for (auto* ring : s_profileEventRings)
+    {
+        Bool inUse = false;
+
+        if (ring->InUse.compare_exchange_strong(inUse, true, std::memory_order_acquire))
+        {
+            ring->ThreadName.store(nullptr, std::memory_order_relaxed);
+            return *ring;
+        }
+    }
+
+    ProfileEventRing* ring = New<ProfileEventRing>();
+
+    ring->ThreadId = (Uint32)s_profileEventRings.GetLength();
+    ring->InUse.store(true, std::memory_order_relaxed);
+
+    s_profileEventRings.Append(ring);
+
+    return *ring;
+}
+
+static ProfileEventRing& GetThreadProfileEventRing()
+{
+    // Releases the ring to the threads started later once the thread exits.
+    struct ThreadRing
+    {
+        ProfileEventRing* Ring = nullptr;
+
+        ~ThreadRing() noexcept
+        {
+            if (Ring != nullptr)
+                Ring->InUse.store(false, std::memory_order_release);
+        }
+    };
+
+    thread_local ThreadRing threadRing;
+
+    if (threadRing.Ring == nullptr)
+        threadRing.Ring = &AcquireProfileEventRing();
+
+    return *threadRing.Ring;
+}
+
+// Copies the events of the ring recorded since the last `Profiler::Clear`, drops the ones the
+// owner thread has overwritten while they were copied.
+static void CopyProfileEvents(const ProfileEventRing& ring,
+                              List<ProfileEvent>&     events)
+{
+    const Uint64 clearTimestamp = s_profileClearTimestamp.load(std::memory_order_relaxed);
+    const Uint64 end            = ring.WriteIndex.load(std::memory_order_acquire);
+    const Uint64 begin          = end > Profiler::EventCapacity ? end - Profiler::EventCapacity : 0;
+    const Size   firstCopied    = events.GetLength();
+
+    for (Uint64 i = begin; i < end; ++i)
+    {
+        const auto& slot = ring.Events[i & (Profiler::EventCapacity - 1)];
+
+        ProfileEvent event = {};
+
+        event.Name     = slot.Name.load(std::memory_order_relaxed);
+        event.Start    = slot.Start.load(std::memory_order_relaxed);
+        event.End      = slot.End.load(std::memory_order_relaxed);
+        event.Depth    = slot.Depth.load(std::memory_order_relaxed);
+        event.ThreadId = ring.ThreadId;
+
+        events.Append(event);
+    }
+
+    // Any slot the owner thread has started rewriting meanwhile lies below the reserved index
+    // minus the capacity.
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    const Uint64 reserved   = ring.ReserveIndex.load(std::memory_order_relaxed);
+    const Uint64 firstValid = reserved > Profiler::EventCapacity ? Math::Max(begin, reserved - Profiler::EventCapacity) : begin;
+
+    Size kept = firstCopied;
+
+    for (Size i = firstCopied; i < events.GetLength(); ++i)
+    {
+        if (begin + (i - firstCopied) >= firstValid && events[i].Start >= clearTimestamp)
+            events[kept++] = events[i];
+    }
+
+    while (events.GetLength() > kept)
+        events.PopBack();
+}
+
+static void AppendJsonString(String8&    json,
+                             const char* string)
+{
+    json += '"';
+
+    for (; *string; ++string)
+    {
+        switch (*string)
+        {
+            case '"':
+                json += "\\\"";
+                break;
+            case '\\':
+                json += "\\\\";
+                break;
+            case '\n':
+                json += "\\n";
+                break;
+            case '\r':
+                json += "\\r";
+                break;
+            case '\t':
+                json += "\\t";
+                break;
+            default:
+                if ((unsigned char)*string < 0x20)
+                {
+                    // The rest of the control characters don't have the short escape sequences
+                    char escaped[8] = {};
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", (unsigned)*string);
+
+                    json += escaped;
+                }
+                else
+                    json += *string;
+                break;
+        }
+    }
+
+    json += '"';
+}
+
+// Appends the nanoseconds as the microseconds with the fraction, the unit of the trace events.
+static void AppendJsonMicroseconds(String8& json,
+                                   Uint64   nanoseconds)
+{
+    char buffer[32] = {};
+    std::snprintf(buffer, sizeof(buffer), "%llu.%03llu", (unsigned long long)(nanoseconds / 1000), (unsigned long long)(nanoseconds % 1000));
+
+    json += buffer;
+}
+
+Uint64 Profiler::GetTimestamp() noexcept
+{
+    return (Uint64)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void Profiler::RecordZone(const char* name,
+                          Uint64      start,
+                          Uint64      end,
+                          Uint32      depth) noexcept
+{
+    ProfileEventRing& ring  = GetThreadProfileEventRing();
+    const Uint64      index = ring.WriteIndex.load(std::memory_order_relaxed);
+    ProfileEventSlot& slot  = ring.Events[index & (EventCapacity - 1)];
+
+    // Announces the rewrite before touching the slot, the readers drop what they copied from it.
+    ring.ReserveIndex.store(index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.Name.store(name, std::memory_order_relaxed);
+    slot.Start.store(start, std::memory_order_relaxed);
+    slot.End.store(end, std::memory_order_relaxed);
+    slot.Depth.store(depth, std::memory_order_relaxed);
+
+    ring.WriteIndex.store(index + 1, std::memory_order_release);
+}
+
+void Profiler::SetThreadName(const char* name) noexcept
+{
+    GetThreadProfileEventRing().ThreadName.store(name, std::memory_order_relaxed);
+}
+
+void Profiler::BeginFrame() noexcept
+{
+    const Uint64 frameCount = s_profileFrameCount.load(std::memory_order_relaxed);
+
+    s_profileFrameStarts[frameCount % FrameCapacity].store(GetTimestamp(), std::memory_order_relaxed);
+    s_profileFrameCount.store(frameCount + 1, std::memory_order_release);
+}
+
+Uint64 Profiler::GetFrameCount() noexcept
+{
+    return s_profileFrameCount.load(std::memory_order_acquire);
+}
+
+ProfileFrameSummary Profiler::GetFrameSummary(Size framesAgo)
+{
+    ProfileFrameSummary summary = {};
+
+    const Uint64 frameCount = GetFrameCount();
+
+    // The frame's end is the next frame's start, both must still be in the ring.
+    if (framesAgo == 0 || framesAgo >= FrameCapacity || framesAgo >= frameCount)
+        return summary;
+
+    const Uint64 frameIndex = frameCount - 1 - framesAgo;
+    const Uint64 frameStart = s_profileFrameStarts[frameIndex % FrameCapacity].load(std::memory_order_relaxed);
+    const Uint64 frameEnd   = s_profileFrameStarts[(frameIndex + 1) % FrameCapacity].load(std::memory_order_relaxed);
+
+    if (frameStart < s_profileClearTimestamp.load(std::memory_order_relaxed))
+        return summary;
+
+    summary.FrameIndex = frameIndex;
+    summary.Start      = frameStart;
+    summary.Duration   = frameEnd - frameStart;
+
+    List<ProfileEvent> events = GetEvents();
+
+    // Orders the zones of every thread by their beginning, the enclosing zones first.
+    std::sort(events.begin(), events.end(), [](const ProfileEvent& left, const ProfileEvent& right) {
+        if (left.ThreadId != right.ThreadId)
+            return left.ThreadId < right.ThreadId;
+
+        return left.Start != right.Start ? left.Start < right.Start : left.Depth < right.Depth;
+    });
+
+    List<Uint64> selfTimes(events.GetLength());
+    List<Size>   openZones;
+
+    for (Size i = 0; i < events.GetLength(); ++i)
+    {
+        const ProfileEvent& event = events[i];
+
+        selfTimes[i] = event.End - event.Start;
+
+        // Closes the zones which can't enclose this one.
+        while (openZones)
+        {
+            const ProfileEvent& openZone = events[openZones[openZones.GetLength() - 1]];
+
+            if (openZone.ThreadId == event.ThreadId && openZone.Depth < event.Depth)
+                break;
+
+            openZones.PopBack();
+        }
+
+        // Subtracts the nested zone from its direct parent.
+        if (openZones)
+        {
+            const Size parent = openZones[openZones.GetLength() - 1];
+
+            if (events[parent].Depth + 1 == event.Depth)
+                selfTimes[parent] -= Math::Min(selfTimes[parent], event.End - event.Start);
+        }
+
+        openZones.Append(i);
+    }
+
+    for (Size i = 0; i < events.GetLength(); ++i)
+    {
+        const ProfileEvent& event = events[i];
+
+        if (event.End < frameStart || event.End >= frameEnd)
+            continue;
+
+        ProfileZoneStatistics* statistics = nullptr;
+
+        // The same name may come from the literals of the different modules.
+        for (auto& zone : summary.Zones)
+        {
+            if (zone.Name == event.Name || std::strcmp(zone.Name, event.Name) == 0)
+            {
+                statistics = &zone;
+                break;
+            }
+        }
+
+        if (statistics == nullptr)
+            statistics = summary.Zones.Append({event.Name, event.Depth});
+
+        const Uint64 duration = event.End - event.Start;
+
+        statistics->Depth = Math::Min(statistics->Depth, event.Depth);
+        statistics->CallCount++;
+        statistics->TotalTime += duration;
+        statistics->SelfTime += selfTimes[i];
+        statistics->MaxTime = Math::Max(statistics->MaxTime, duration);
+    }
+
+    std::sort(summary.Zones.begin(), summary.Zones.end(), [](const ProfileZoneStatistics& left, const ProfileZoneStatistics& right) {
+        return left.TotalTime > right.TotalTime;
+    });
+
+    return summary;
+}
+
+List<ProfileEvent> Profiler::GetEvents()
+{
+    List<ProfileEvent> events;
+
+    {
+        std::scoped_lock lockGuard(s_profileEventRingMutex);
+
+        for (const auto* ring : s_profileEventRings)
+            CopyProfileEvents(*ring, events);
+    }
+
+    std::sort(events.begin(), events.end(), [](const ProfileEvent& left, const ProfileEvent& right) {
+        return left.Start != right.Start ? left.Start < right.Start : left.Depth < right.Depth;
+    });
+
+    return events;
+}
+
+// Names the threads through the metadata events.
+static String8 ExportProfileThreadNames()
+{
+    String8 json;
+
+    std::scoped_lock lockGuard(s_profileEventRingMutex);
+
+    for (const auto* ring : s_profileEventRings)
+    {
+        const char* threadName = ring->ThreadName.load(std::memory_order_relaxed);
+
+        if (threadName == nullptr)
+            continue;
+
+        json += "\n    {\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": ";
+        json += String8::ToString((Size)ring->ThreadId);
+        json += ", \"args\": {\"name\": ";
+        AppendJsonString(json, threadName);
+        json += "}},";
+    }
+
+    return json;
+}
+
+String8 Profiler::ExportChromeTrace()
+{
+    const List<ProfileEvent> events = GetEvents();
+
+    String8 json = "{\n  \"displayTimeUnit\": \"ms\",\n  \"traceEvents\": [";
+
+    json += ExportProfileThreadNames();
+
+    for (Size i = 0; i < events.GetLength(); ++i)
+    {
+        const ProfileEvent& event = events[i];
+
+        json += "\n    {\"name\": ";
+        AppendJsonString(json, event.Name);
+        json += ", \"ph\": \"X\", \"pid\": 1, \"tid\": ";
+        json += String8::ToString((Size)event.ThreadId);
+        json += ", \"ts\": ";
+        AppendJsonMicroseconds(json, event.Start);
+        json += ", \"dur\": ";
+        AppendJsonMicroseconds(json, event.End - event.Start);
+        json += "},";
+    }
+
+    // Drops the trailing comma.
+    if (json[json.GetLength() - 1] == ',')
+        json.RemoveAt(json.GetLength() - 1, 1);
+
+    json += "\n  ]\n}\n";
+
+    return json;
+}
+
+void Profiler::Clear() noexcept
+{
+    // The events are dropped lazily by the exports, the rings stay untouched.
+    s_profileClearTimestamp.store(GetTimestamp(), std::memory_order_relaxed);
+}
+
+// Number of the zones open on the calling thread.
+static thread_local Uint32 t_profileZoneDepth = 0;
+
+ProfileZone::ProfileZone(const char* name) noexcept :
+    _name(name),
+    _start(Profiler::GetTimestamp()),
+    _depth(t_profileZoneDepth++) {}
+
+ProfileZone::~ProfileZone() noexcept
+{
+    --t_profileZoneDepth;
+
+    Profiler::RecordZone(_name, _start, Profiler::GetTimestamp(), _depth);
+}
+
+} // namespace System
+
+} // namespace Axis
@@ -6,6 +6,15 @@
 
 #include <Axis/Random.hpp>
 #include <chrono>
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+#if defined(AXIS_SIMD_AVX2)
+#    include <immintrin.h>
+#elif defined(AXIS_SIMD_SSE2)
+#    include <emmintrin.h>
+#endif
 
 namespace Axis
 {
@@ -18,6 +27,247 @@ using namespace std::chrono;
 Random::Random() noexcept :
     Random((Int32)duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count()) {}
 
+FastRandom::FastRandom() noexcept :
+    FastRandom((Uint64)duration_cast<nanoseconds>(system_clock::now().time_since_epoch()).count()) {}
+
+// Number of the independent generators of the bulk fills, the same on every instruction set, so the
+// fills give the same values for the same seed.
+static constexpr Size LaneCount = 4;
+
+// 64-bit lanes of the bulk generators, 4 with AVX2, 2 with SSE2 and 1 otherwise. The 32-bit halves of
+// the lanes are stored in the memory order, low half first.
+struct Uint64Batch
+{
+#if defined(AXIS_SIMD_AVX2)
+    static constexpr Size Width = 4;
+
+    __m256i Value; // <-- Lanes of the batch
+
+    static Uint64Batch Load(const Uint64* source) noexcept { return {_mm256_loadu_si256((const __m256i*)source)}; }
+
+    template <int Count>
+    Uint64Batch ShiftLeft() const noexcept { return {_mm256_slli_epi64(Value, Count)}; }
+
+    template <int Count>
+    Uint64Batch RotateLeft() const noexcept { return {_mm256_or_si256(_mm256_slli_epi64(Value, Count), _mm256_srli_epi64(Value, 64 - Count))}; }
+
+    void StoreFloats(Float32* destination,
+                     Float32  offset,
+                     Float32  scale,
+                     Float32  limit) const noexcept
+    {
+        const __m256 bits   = _mm256_cvtepi32_ps(_mm256_srli_epi32(Value, 8));
+        const __m256 result = _mm256_add_ps(_mm256_mul_ps(bits, _mm256_set1_ps(scale)), _mm256_set1_ps(offset));
+
+        _mm256_storeu_ps(destination, _mm256_min_ps(result, _mm256_set1_ps(limit)));
+    }
+
+    void StoreRange(Int32* destination,
+                    Uint32 range,
+                    Int32  minValue) const noexcept
+    {
+        const __m256i rangeValue = _mm256_set1_epi64x(range);
+        const __m256i low        = _mm256_mul_epu32(Value, rangeValue);
+        const __m256i high       = _mm256_mul_epu32(_mm256_srli_epi64(Value, 32), rangeValue);
+        const __m256i result     = _mm256_or_si256(_mm256_srli_epi64(low, 32), _mm256_and_si256(high, _mm256_set1_epi64x((Int64)0xffffffff00000000ull)));
+
+        _mm256_storeu_si256((__m256i*)destination, _mm256_add_epi32(result, _mm256_set1_epi32(minValue)));
+    }
+
+    friend Uint64Batch operator+(Uint64Batch left, Uint64Batch right) noexcept { return {_mm256_add_epi64(left.Value, right.Value)}; }
+
+    friend Uint64Batch operator^(Uint64Batch left, Uint64Batch right) noexcept { return {_mm256_xor_si256(left.Value, right.Value)}; }
+#elif defined(AXIS_SIMD_SSE2)
+    static constexpr Size Width = 2;
+
+    __m128i Value; // <-- Lanes of the batch
+
+    static Uint64Batch Load(const Uint64* source) noexcept { return {_mm_loadu_si128((const __m128i*)source)}; }
+
+    template <int Count>
+    Uint64Batch ShiftLeft() const noexcept { return {_mm_slli_epi64(Value, Count)}; }
+
+    template <int Count>
+    Uint64Batch RotateLeft() const noexcept { return {_mm_or_si128(_mm_slli_epi64(Value, Count), _mm_srli_epi64(Value, 64 - Count))}; }
+
+    void StoreFloats(Float32* destination,
+                     Float32  offset,
+                     Float32  scale,
+                     Float32  limit) const noexcept
+    {
+        const __m128 bits   = _mm_cvtepi32_ps(_mm_srli_epi32(Value, 8));
+        const __m128 result = _mm_add_ps(_mm_mul_ps(bits, _mm_set1_ps(scale)), _mm_set1_ps(offset));
+
+        _mm_storeu_ps(destination, _mm_min_ps(result, _mm_set1_ps(limit)));
+    }
+
+    void StoreRange(Int32* destination,
+                    Uint32 range,
+                    Int32  minValue) const noexcept
+    {
+        const __m128i rangeValue = _mm_set1_epi32((Int32)range);
+        const __m128i low        = _mm_mul_epu32(Value, rangeValue);
+        const __m128i high       = _mm_mul_epu32(_mm_srli_epi64(Value, 32), rangeValue);
+        const __m128i result     = _mm_or_si128(_mm_srli_epi64(low, 32), _mm_and_si128(high, _mm_set_epi32(-1, 0, -1, 0)));
+
+        _mm_storeu_si128((__m128i*)destination, _mm_add_epi32(result, _mm_set1_epi32(minValue)));
+    }
+
+    friend Uint64Batch operator+(Uint64Batch left, Uint64Batch right) noexcept { return {_mm_add_epi64(left.Value, right.Value)}; }
+
+    friend Uint64Batch operator^(Uint64Batch left, Uint64Batch right) noexcept { return {_mm_xor_si128(left.Value, right.Value)}; }
+#else
+    static constexpr Size Width = 1;
+
+    Uint64 Value; // <-- Lanes of the batch
+
+    static Uint64Batch Load(const Uint64* source) noexcept { return {*source}; }
+
+    template <int Count>
+    Uint64Batch ShiftLeft() const noexcept { return {Value << Count}; }
+
+    template <int Count>
+    Uint64Batch RotateLeft() const noexcept { return {Detail::RotateLeft(Value, Count)}; }
+
+    void StoreFloats(Float32* destination,
+                     Float32  offset,
+                     Float32  scale,
+                     Float32  limit) const noexcept
+    {
+        destination[0] = std::min((Float32)((Uint32)Value >> 8) * scale + offset, limit);
+        destination[1] = std::min((Float32)((Uint32)(Value >> 32) >> 8) * scale + offset, limit);
+    }
+
+    void StoreRange(Int32* destination,
+                    Uint32 range,
+                    Int32  minValue) const noexcept
+    {
+        destination[0] = (Int32)((Uint32)minValue + Detail::ScaleToRange((Uint32)Value, range));
+        destination[1] = (Int32)((Uint32)minValue + Detail::ScaleToRange((Uint32)(Value >> 32), range));
+    }
+
+    friend Uint64Batch operator+(Uint64Batch left, Uint64Batch right) noexcept { return {left.Value + right.Value}; }
+
+    friend Uint64Batch operator^(Uint64Batch left, Uint64Batch right) noexcept { return {left.Value ^ right.Value}; }
+#endif
+};
+
+// xoshiro256++ generators of the bulk fills, run side by side in the lanes of the batches.
+struct RandomLanes
+{
+    static constexpr Size GroupCount = LaneCount / Uint64Batch::Width;
+    static constexpr Size StepSize   = LaneCount * 2; // Number of the 32-bit values per step
+
+    Uint64Batch States[4][GroupCount]; // <-- State words of the generators, one lane per generator
+
+    explicit RandomLanes(FastRandom& random) noexcept
+    {
+        Uint64 states[4][LaneCount];
+
+        for (Size lane = 0; lane < LaneCount; ++lane)
+        {
+            Uint64 seed = random.NextUint64();
+
+            for (Size word = 0; word < 4; ++word)
+                states[word][lane] = Detail::SplitMix64(seed);
+        }
+
+        for (Size word = 0; word < 4; ++word)
+        {
+            for (Size group = 0; group < GroupCount; ++group)
+                States[word][group] = Uint64Batch::Load(states[word] + group * Uint64Batch::Width);
+        }
+    }
+
+    // Advances the generators of the group, as `FastRandom::NextUint64` does.
+    Uint64Batch Next(Size group) noexcept
+    {
+        Uint64Batch& first  = States[0][group];
+        Uint64Batch& second = States[1][group];
+        Uint64Batch& third  = States[2][group];
+        Uint64Batch& fourth = States[3][group];
+
+        const Uint64Batch result  = (first + fourth).RotateLeft<23>() + first;
+        const Uint64Batch shifted = second.ShiftLeft<17>();
+
+        third  = third ^ first;
+        fourth = fourth ^ second;
+        second = second ^ third;
+        first  = first ^ fourth;
+
+        third  = third ^ shifted;
+        fourth = fourth.RotateLeft<45>();
+
+        return result;
+    }
+
+    // Calls the `store` with every batch of the step and the destination of the batch, the remaining
+    // values go through a buffer.
+    template <class T, class Store>
+    void Fill(T*           destination,
+              Size         count,
+              const Store& store) noexcept
+    {
+        // The groups are unrolled, so the states stay in the registers.
+        const auto step = [&]<Size... Groups>(T* stepDestination, std::index_sequence<Groups...>) {
+            (store(Next(Groups), stepDestination + Groups * Uint64Batch::Width * 2), ...);
+        };
+
+        const Size wholeCount = count - count % StepSize;
+
+        for (Size i = 0; i < wholeCount; i += StepSize)
+            step(destination + i, std::make_index_sequence<GroupCount>());
+
+        if (wholeCount != count)
+        {
+            alignas(32) T buffer[StepSize];
+
+            step(buffer, std::make_index_sequence<GroupCount>());
+
+            std::memcpy(destination + wholeCount, buffer, (count - wholeCount) * sizeof(T));
+        }
+    }
+};
+
+void FastRandom::FillFloats(Float32* destination,
+                            Size     count,
+                            Float32  minValue,
+                            Float32  maxValue) noexcept
+{
+    if (count == 0)
+        return;
+
+    RandomLanes lanes(*this);
+
+    // The rounding could reach `maxValue`, the values are clamped below it.
+    const Float32 scale = (maxValue - minValue) * (1.0f / 16777216.0f);
+    const Float32 limit = maxValue > minValue ? std::nextafter(maxValue, minValue) : minValue;
+
+    lanes.Fill(destination, count, [&](const Uint64Batch& batch, Float32* batchDestination) {
+        batch.StoreFloats(batchDestination, minValue, scale, limit);
+    });
+}
+
+void FastRandom::FillRange(Int32* destination,
+                           Size   count,
+                           Int32  minValue,
+                           Int32  maxValue)
+{
+    if (minValue > maxValue)
+        throw InvalidArgumentException("`minValue` was greater than `maxValue`!");
+
+    if (count == 0)
+        return;
+
+    RandomLanes lanes(*this);
+
+    const Uint32 range = (Uint32)((Int64)maxValue - minValue);
+
+    lanes.Fill(destination, count, [&](const Uint64Batch& batch, Int32* batchDestination) {
+        batch.StoreRange(batchDestination, range, minValue);
+    });
+}
+
 } // namespace System
 
-} // namespace Axis
\ No newline at end of file
+} // namespace Axis
@@ -0,0 +1,189 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#include <Axis/SystemPch.hpp>
+
+#include <Axis/StringId.hpp>
+#include <Axis/TrackingAllocator.hpp>
+#include <atomic>
+#include <cstring>
+
+namespace Axis
+{
+
+namespace System
+{
+
+// Tag of the interning tables' allocations in `AllocationTracker`
+struct StringIdAllocationTag
+{
+    static constexpr const char* Name = "System::StringId";
+};
+
+// Header of the interned string, followed by its code units and the null terminator.
+struct InternedString
+{
+    Size   Length = 0; // <-- Number of code units, excluding the null terminator
+    Uint32 Id     = 0; // <-- Id of the string
+};
+
+// Open addressing table of the interned strings, probed linearly from the id.
+struct InternedStringSlots
+{
+    Size                                SlotCount = 0;       // <-- Power of two, at least twice the number of the strings
+    std::atomic<const InternedString*>* Slots     = nullptr; // <-- Null if the slot is empty
+};
+
+struct InternTable
+{
+    static constexpr Size InitialSlotCount = 1024; // <-- Number of the slots before the first growth
+    static constexpr Size ChunkSize        = 64 * 1024;
+
+    // Appended under `Mutex`, the strings and the slot arrays are never moved nor freed, so the
+    // readers holding the previous slots can finish their lookups.
+    AllocatorMemoryResource<TaggedAllocator<StringIdAllocationTag>> Upstream = {};
+    ArenaMemoryResource                                             Arena    = ArenaMemoryResource(ChunkSize, &Upstream);
+    std::atomic<const InternedStringSlots*>                         Slots    = nullptr; // <-- Current slots
+    std::atomic<Size>                                               Count    = 0;       // <-- Number of the interned strings
+    std::mutex                                                      Mutex    = {};      // <-- Guards the insertions
+};
+
+// Gets the table of the strings with the given code unit size, created on the first use so the
+// ids can be interned during the static initialization.
+static InternTable& GetInternTable(Size codeUnitSize) noexcept
+{
+    static InternTable s_internTables[3];
+
+    return s_internTables[codeUnitSize == 1 ? 0 : (codeUnitSize == 2 ? 1 : 2)];
+}
+
+// Finds the string with the given id, or the empty slot where it would be inserted.
+static std::atomic<const InternedString*>& FindSlot(const InternedStringSlots& slots,
+                                                    Uint32                     id) noexcept
+{
+    const Size mask = slots.SlotCount - 1;
+
+    // The ids are already well distributed hashes.
+    for (Size index = id & mask;; index = (index + 1) & mask)
+    {
+        auto& slot   = slots.Slots[index];
+        auto  string = slot.load(std::memory_order_acquire);
+
+        if (string == nullptr || string->Id == id)
+            return slot;
+    }
+}
+
+// Checks whether the interned string is the one being interned, not another one with the same id.
+static Bool IsSameString(const InternedString* internedString,
+                         const void*           string,
+                         Size                  length,
+                         Size                  codeUnitSize) noexcept
+{
+    return internedString->Length == length && std::memcmp(internedString + 1, string, length * codeUnitSize) == 0;
+}
+
+// Allocates the slots twice as large as the current ones and moves the strings into them.
+static const InternedStringSlots* GrowSlots(InternTable&               table,
+                                            const InternedStringSlots* slots)
+{
+    const Size slotCount = slots ? slots->SlotCount * 2 : InternTable::InitialSlotCount;
+
+    auto newSlots = (InternedStringSlots*)table.Arena.Allocate(sizeof(InternedStringSlots), alignof(InternedStringSlots));
+    auto entries  = (std::atomic<const InternedString*>*)table.Arena.Allocate(sizeof(std::atomic<const InternedString*>) * slotCount, alignof(std::atomic<const InternedString*>));
+
+    for (Size i = 0; i < slotCount; ++i)
+        new (entries + i) std::atomic<const InternedString*>(nullptr);
+
+    new (newSlots) InternedStringSlots{slotCount, entries};
+
+    if (slots)
+    {
+        for (Size i = 0; i < slots->SlotCount; ++i)
+        {
+            if (auto string = slots->Slots[i].load(std::memory_order_relaxed))
+                FindSlot(*newSlots, string->Id).store(string, std::memory_order_relaxed);
+        }
+    }
+
+    // Publishes the filled slots to the readers.
+    table.Slots.store(newSlots, std::memory_order_release);
+
+    return newSlots;
+}
+
+Bool Detail::StringIdTable::Intern(const void* string,
+                                   Size        length,
+                                   Size        codeUnitSize,
+                                   Uint32      id)
+{
+    auto& table = GetInternTable(codeUnitSize);
+
+    // The string has already been interned, the common case.
+    if (auto slots = table.Slots.load(std::memory_order_acquire))
+    {
+        if (auto internedString = FindSlot(*slots, id).load(std::memory_order_acquire))
+            return IsSameString(internedString, string, length, codeUnitSize);
+    }
+
+    std::scoped_lock lockGuard(table.Mutex);
+
+    auto slots = table.Slots.load(std::memory_order_relaxed);
+    auto count = table.Count.load(std::memory_order_relaxed);
+
+    // Another thread might have interned it in the meantime.
+    if (slots)
+    {
+        if (auto internedString = FindSlot(*slots, id).load(std::memory_order_relaxed))
+            return IsSameString(internedString, string, length, codeUnitSize);
+    }
+
+    // Keeps the load factor under 1/2, the probes stay short.
+    if (!slots || (count + 1) * 2 > slots->SlotCount)
+        slots = GrowSlots(table, slots);
+
+    const Size byteCount = (length + 1) * codeUnitSize;
+
+    auto internedString = (InternedString*)table.Arena.Allocate(sizeof(InternedString) + byteCount, alignof(InternedString));
+
+    new (internedString) InternedString{length, id};
+
+    std::memcpy(internedString + 1, string, length * codeUnitSize);
+    std::memset((Uint8*)(internedString + 1) + length * codeUnitSize, 0, codeUnitSize);
+
+    // Publishes the copied characters to the readers.
+    FindSlot(*slots, id).store(internedString, std::memory_order_release);
+
+    table.Count.store(count + 1, std::memory_order_relaxed);
+
+    return true;
+}
+
+const void* Detail::StringIdTable::Find(Uint32 id,
+                                        Size   codeUnitSize,
+                                        Size&  length) noexcept
+{
+    auto slots = GetInternTable(codeUnitSize).Slots.load(std::memory_order_acquire);
+
+    if (!slots)
+        return nullptr;
+
+    auto internedString = FindSlot(*slots, id).load(std::memory_order_acquire);
+
+    if (!internedString)
+        return nullptr;
+
+    length = internedString->Length;
+
+    return internedString + 1;
+}
+
+Size Detail::StringIdTable::GetCount(Size codeUnitSize) noexcept
+{
+    return GetInternTable(codeUnitSize).Count.load(std::memory_order_relaxed);
+}
+
+} // namespace System
+
+} // namespace Axis
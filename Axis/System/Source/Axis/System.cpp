@@ -0,0 +1,45 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#include <Axis/SystemPch.hpp>
+
+#include <Axis/System.hpp>
+#include <Axis/Timer.hpp>
+#include <thread>
+
+namespace Axis
+{
+
+namespace System
+{
+
+// The last part of the wait that is yielded rather than slept, covers how late the scheduler
+// wakes the thread up. `::Sleep` on Windows has the millisecond granularity at best.
+#ifdef AXIS_PLATFORM_WINDOWS
+static constexpr TimePeriod SpinPeriod = TimePeriod(2000);
+#else
+static constexpr TimePeriod SpinPeriod = TimePeriod(500);
+#endif
+
+void PreciseSleepUntil(const TimePeriod& deadline) noexcept
+{
+    while (true)
+    {
+        const TimePeriod now = Timer::GetTimestamp();
+
+        if (now >= deadline)
+            return;
+
+        const TimePeriod remaining = deadline - now;
+
+        if (remaining > SpinPeriod)
+            Sleep(remaining - SpinPeriod);
+        else
+            std::this_thread::yield();
+    }
+}
+
+} // namespace System
+
+} // namespace Axis
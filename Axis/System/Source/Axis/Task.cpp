@@ -0,0 +1,113 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#include <Axis/SystemPch.hpp>
+
+#include <Axis/Exception.hpp>
+#include <Axis/Task.hpp>
+
+namespace Axis
+{
+
+namespace System
+{
+
+void TaskScheduler::Spawn(Task<void> task)
+{
+    if (!task.IsValid())
+        throw InvalidArgumentException("`task` was empty!");
+
+    const std::coroutine_handle<> handle = task._handle;
+
+    _spawnedTasks.Append(std::move(task));
+
+    handle.resume();
+}
+
+void TaskScheduler::RunFrame()
+{
+    // Takes the waiting coroutines first, the ones suspending again during this frame wait for the
+    // next one.
+    std::swap(_resuming, _nextFrame);
+    std::swap(_checkingConditions, _conditions);
+
+    {
+        std::scoped_lock lock(_postedMutex);
+
+        for (const auto& handle : _posted)
+            _resuming.Append(handle);
+
+        _posted.Clear();
+    }
+
+    Size checked = 0;
+
+    try
+    {
+        for (; checked < _checkingConditions.GetLength(); ++checked)
+        {
+            auto& waiter = _checkingConditions[checked];
+
+            if (waiter.Condition())
+                _resuming.Append(waiter.Handle);
+            else
+                _conditions.Append(std::move(waiter));
+        }
+    }
+    catch (...)
+    {
+        // Keeps the unchecked waiters (the throwing one included) and defers the ready coroutines to
+        // the next frame, so none of the handles are lost.
+        for (; checked < _checkingConditions.GetLength(); ++checked)
+            _conditions.Append(std::move(_checkingConditions[checked]));
+
+        _checkingConditions.Clear();
+
+        std::swap(_resuming, _nextFrame);
+
+        throw;
+    }
+
+    _checkingConditions.Clear();
+
+    for (const auto& handle : _resuming)
+        handle.resume();
+
+    _resuming.Clear();
+
+    // Releases the finished spawned tasks, keeps the order of the others.
+    std::exception_ptr exception = {};
+    Size               kept      = 0;
+
+    for (auto& task : _spawnedTasks)
+    {
+        if (!task.IsDone())
+        {
+            _spawnedTasks[kept++] = std::move(task);
+            continue;
+        }
+
+        if (!exception)
+            exception = task._handle.promise().Exception;
+
+        task = {};
+    }
+
+    while (_spawnedTasks.GetLength() > kept)
+        _spawnedTasks.PopBack();
+
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+void TaskScheduler::Post(std::coroutine_handle<> handle)
+{
+    std::scoped_lock lock(_postedMutex);
+
+    _posted.Append(handle);
+}
+
+} // namespace System
+
+} // namespace Axis
@@ -0,0 +1,338 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#include <Axis/SystemPch.hpp>
+
+#include <Axis/Exception.hpp>
+#include <Axis/TrackingAllocator.hpp>
+#include <atomic>
+#include <cstring>
+
+namespace Axis
+{
+
+namespace System
+{
+
+// Counters of the allocations made from a single call site.
+struct AllocationCallSiteCounter
+{
+    Size LiveBytes           = 0; // <-- Bytes allocated but not yet deallocated
+    Size LiveAllocationCount = 0; // <-- Number of allocations not yet deallocated
+    Size AllocationCount     = 0; // <-- Total number of allocations
+};
+
+struct AllocationCounter
+{
+    const char*         Tag                      = nullptr; // <-- Name of the tag
+    std::atomic<Size>   LiveBytes                = 0;       // <-- Bytes allocated but not yet deallocated
+    std::atomic<Size>   PeakBytes                = 0;       // <-- Highest value of `LiveBytes`
+    std::atomic<Size>   LiveAllocationCount      = 0;       // <-- Number of allocations not yet deallocated
+    std::atomic<Size>   AllocationCount          = 0;       // <-- Total number of allocations
+    std::atomic<Size>   FrameAllocationCount     = 0;       // <-- Number of allocations made during the current frame
+    std::atomic<Size>   LastFrameAllocationCount = 0;       // <-- Number of allocations made during the previous frame
+    std::mutex          CallSiteMutex            = {};      // <-- Guards `CallSites`
+    std::unordered_map<PVoid, AllocationCallSiteCounter> CallSites = {}; // <-- Counters per call site
+};
+
+// Registered tags, the counters are never moved so the pointers stay valid.
+static AllocationCounter   s_allocationCounters[AllocationTracker::MaxTagCount] = {};
+static std::atomic<Size>   s_allocationCounterCount                            = 0;
+static std::mutex          s_allocationCounterMutex                            = {};
+static std::atomic<Bool>   s_callSiteCaptureEnabled                            = false;
+
+// Finds the registered tag by its name, returns nullptr if it wasn't registered.
+static AllocationCounter* FindAllocationCounter(const char* tag) noexcept
+{
+    Size counterCount = s_allocationCounterCount.load(std::memory_order_acquire);
+
+    for (Size i = 0; i < counterCount; ++i)
+    {
+        if (std::strcmp(s_allocationCounters[i].Tag, tag) == 0)
+            return &s_allocationCounters[i];
+    }
+
+    return nullptr;
+}
+
+// Takes a snapshot of the given counters.
+static AllocationStatistics GetAllocationStatistics(AllocationCounter& counter)
+{
+    AllocationStatistics statistics = {};
+
+    statistics.Tag                      = counter.Tag;
+    statistics.LiveBytes                = counter.LiveBytes.load(std::memory_order_relaxed);
+    statistics.PeakBytes                = counter.PeakBytes.load(std::memory_order_relaxed);
+    statistics.LiveAllocationCount      = counter.LiveAllocationCount.load(std::memory_order_relaxed);
+    statistics.AllocationCount          = counter.AllocationCount.load(std::memory_order_relaxed);
+    statistics.LastFrameAllocationCount = counter.LastFrameAllocationCount.load(std::memory_order_relaxed);
+
+    std::scoped_lock lockGuard(counter.CallSiteMutex);
+
+    statistics.CallSites.ReserveFor(counter.CallSites.size());
+
+    for (const auto& [address, callSite] : counter.CallSites)
+        statistics.CallSites.Append({address, callSite.LiveBytes, callSite.LiveAllocationCount, callSite.AllocationCount});
+
+    return statistics;
+}
+
+AllocationCounter* AllocationTracker::RegisterTag(const char* tag)
+{
+    // Arguments validation
+    if (!tag)
+        throw InvalidArgumentException("`tag` was nullptr!");
+
+    std::scoped_lock lockGuard(s_allocationCounterMutex);
+
+    if (auto counter = FindAllocationCounter(tag))
+        return counter;
+
+    Size counterCount = s_allocationCounterCount.load(std::memory_order_relaxed);
+
+    if (counterCount == MaxTagCount)
+        throw InvalidOperationException("The number of allocation tags exceeded `AllocationTracker::MaxTagCount`!");
+
+    s_allocationCounters[counterCount].Tag = tag;
+
+    // Publishes the new counter to `FindAllocationCounter`
+    s_allocationCounterCount.store(counterCount + 1, std::memory_order_release);
+
+    return &s_allocationCounters[counterCount];
+}
+
+PVoid AllocationTracker::RecordAllocation(AllocationCounter* counter,
+                                          Size               size,
+                                          PVoid              callSite) noexcept
+{
+    counter->AllocationCount.fetch_add(1, std::memory_order_relaxed);
+    counter->FrameAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    counter->LiveAllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+    Size liveBytes = counter->LiveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+    Size peakBytes = counter->PeakBytes.load(std::memory_order_relaxed);
+
+    while (liveBytes > peakBytes && !counter->PeakBytes.compare_exchange_weak(peakBytes, liveBytes, std::memory_order_relaxed)) {}
+
+    if (!s_callSiteCaptureEnabled.load(std::memory_order_relaxed))
+        return nullptr;
+
+    try
+    {
+        std::scoped_lock lockGuard(counter->CallSiteMutex);
+
+        auto& callSiteCounter = counter->CallSites[callSite];
+
+        callSiteCounter.LiveBytes += size;
+        callSiteCounter.LiveAllocationCount += 1;
+        callSiteCounter.AllocationCount += 1;
+    }
+    catch (...)
+    {
+        // Out of memory while growing the call site table, the allocation is only counted for the tag.
+        return nullptr;
+    }
+
+    return callSite;
+}
+
+void AllocationTracker::RecordDeallocation(AllocationCounter* counter,
+                                           Size               size,
+                                           PVoid              callSite) noexcept
+{
+    counter->LiveAllocationCount.fetch_sub(1, std::memory_order_relaxed);
+    counter->LiveBytes.fetch_sub(size, std::memory_order_relaxed);
+
+    if (!callSite)
+        return;
+
+    std::scoped_lock lockGuard(counter->CallSiteMutex);
+
+    auto it = counter->CallSites.find(callSite);
+
+    if (it != counter->CallSites.end())
+    {
+        it->second.LiveBytes -= size;
+        it->second.LiveAllocationCount -= 1;
+    }
+}
+
+void AllocationTracker::SetCallSiteCaptureEnabled(Bool enabled) noexcept
+{
+    s_callSiteCaptureEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+Bool AllocationTracker::IsCallSiteCaptureEnabled() noexcept
+{
+    return s_callSiteCaptureEnabled.load(std::memory_order_relaxed);
+}
+
+void AllocationTracker::BeginFrame() noexcept
+{
+    Size counterCount = s_allocationCounterCount.load(std::memory_order_acquire);
+
+    for (Size i = 0; i < counterCount; ++i)
+    {
+        auto& counter = s_allocationCounters[i];
+
+        counter.LastFrameAllocationCount.store(counter.FrameAllocationCount.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+}
+
+void AllocationTracker::ResetPeaks() noexcept
+{
+    Size counterCount = s_allocationCounterCount.load(std::memory_order_acquire);
+
+    for (Size i = 0; i < counterCount; ++i)
+    {
+        auto& counter = s_allocationCounters[i];
+
+        counter.PeakBytes.store(counter.LiveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+}
+
+List<AllocationStatistics> AllocationTracker::GetStatistics()
+{
+    Size counterCount = s_allocationCounterCount.load(std::memory_order_acquire);
+
+    List<AllocationStatistics> statistics;
+    statistics.ReserveFor(counterCount);
+
+    for (Size i = 0; i < counterCount; ++i)
+        statistics.Append(GetAllocationStatistics(s_allocationCounters[i]));
+
+    return statistics;
+}
+
+AllocationStatistics AllocationTracker::GetStatistics(const char* tag)
+{
+    // Arguments validation
+    if (!tag)
+        throw InvalidArgumentException("`tag` was nullptr!");
+
+    auto counter = FindAllocationCounter(tag);
+
+    if (!counter)
+    {
+        AllocationStatistics statistics = {};
+        statistics.Tag                  = tag;
+
+        return statistics;
+    }
+
+    return GetAllocationStatistics(*counter);
+}
+
+// Appends the JSON string literal with the escaped characters.
+static void AppendJsonString(String8&    json,
+                             const char* string)
+{
+    json += '"';
+
+    for (; *string; ++string)
+    {
+        switch (*string)
+        {
+            case '"':
+                json += "\\\"";
+                break;
+            case '\\':
+                json += "\\\\";
+                break;
+            case '\n':
+                json += "\\n";
+                break;
+            case '\r':
+                json += "\\r";
+                break;
+            case '\t':
+                json += "\\t";
+                break;
+            default:
+                if ((unsigned char)*string < 0x20)
+                {
+                    // The rest of the control characters don't have the short escape sequences
+                    char escaped[8] = {};
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", (unsigned)*string);
+
+                    json += escaped;
+                }
+                else
+                    json += *string;
+                break;
+        }
+    }
+
+    json += '"';
+}
+
+// Appends the JSON `"key": value` member.
+static void AppendJsonNumber(String8&    json,
+                             const char* key,
+                             Size        value)
+{
+    AppendJsonString(json, key);
+    json += ": ";
+    json += String8::ToString(value);
+}
+
+String8 AllocationTracker::DumpToJson()
+{
+    auto statistics = GetStatistics();
+
+    String8 json = "{\n  \"tags\": [";
+
+    for (Size i = 0; i < statistics.GetLength(); ++i)
+    {
+        const auto& tagStatistics = statistics[i];
+
+        json += i == 0 ? "\n    {\n      " : ",\n    {\n      ";
+
+        AppendJsonString(json, "name");
+        json += ": ";
+        AppendJsonString(json, tagStatistics.Tag);
+        json += ",\n      ";
+        AppendJsonNumber(json, "liveBytes", tagStatistics.LiveBytes);
+        json += ",\n      ";
+        AppendJsonNumber(json, "peakBytes", tagStatistics.PeakBytes);
+        json += ",\n      ";
+        AppendJsonNumber(json, "liveAllocationCount", tagStatistics.LiveAllocationCount);
+        json += ",\n      ";
+        AppendJsonNumber(json, "allocationCount", tagStatistics.AllocationCount);
+        json += ",\n      ";
+        AppendJsonNumber(json, "lastFrameAllocationCount", tagStatistics.LastFrameAllocationCount);
+        json += ",\n      \"callSites\": [";
+
+        for (Size j = 0; j < tagStatistics.CallSites.GetLength(); ++j)
+        {
+            const auto& callSite = tagStatistics.CallSites[j];
+
+            char address[32] = {};
+            std::snprintf(address, sizeof(address), "0x%zx", (Size)callSite.Address);
+
+            json += j == 0 ? "\n        { " : ",\n        { ";
+
+            AppendJsonString(json, "address");
+            json += ": ";
+            AppendJsonString(json, address);
+            json += ", ";
+            AppendJsonNumber(json, "liveBytes", callSite.LiveBytes);
+            json += ", ";
+            AppendJsonNumber(json, "liveAllocationCount", callSite.LiveAllocationCount);
+            json += ", ";
+            AppendJsonNumber(json, "allocationCount", callSite.AllocationCount);
+            json += " }";
+        }
+
+        json += tagStatistics.CallSites.GetLength() ? "\n      ]\n    }" : "]\n    }";
+    }
+
+    json += statistics.GetLength() ? "\n  ]\n}\n" : "]\n}\n";
+
+    return json;
+}
+
+} // namespace System
+
+} // namespace Axis
@@ -340,10 +340,16 @@ class AXIS_WINDOW_API KeyboardState final
     AXIS_NODISCARD Bool IsKeyUp(Key key) const;
 
     /// \brief Gets all the keys that are pressed.
-    AXIS_NODISCARD System::List<Key> GetPressedKeys() const noexcept;
+    ///
+    /// The list is allocated from the frame arena, it's only valid until the
+    /// end of the next frame.
+    AXIS_NODISCARD System::List<Key, System::FrameArenaAllocator> GetPressedKeys() const noexcept;
 
     /// \brief Gets all the keys that are released.
-    AXIS_NODISCARD System::List<Key> GetReleasedKeys() const noexcept;
+    ///
+    /// The list is allocated from the frame arena, it's only valid until the
+    /// end of the next frame.
+    AXIS_NODISCARD System::List<Key, System::FrameArenaAllocator> GetReleasedKeys() const noexcept;
 
     /// \brief Gets the number of keys that are pressed.
     AXIS_NODISCARD Uint32 GetPressedKeyCount() const noexcept;
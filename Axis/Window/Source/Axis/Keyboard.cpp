@@ -43,9 +43,12 @@ Bool KeyboardState::IsKeyUp(Key key) const
         return !System::Math::ReadBitPosition(_keyStates2, System::Enum::GetUnderlyingValue(key) - 64);
 }
 
-System::List<Key> KeyboardState::GetPressedKeys() const noexcept
+System::List<Key, System::FrameArenaAllocator> KeyboardState::GetPressedKeys() const noexcept
 {
-    System::List<Key> pressedKeys;
+    System::List<Key, System::FrameArenaAllocator> pressedKeys;
+
+    // At most 128 keys, reserves them up front to avoid growing the list
+    pressedKeys.ReserveFor(128);
 
     for (Uint8 i = 0; i < 64; ++i)
     {
@@ -62,9 +65,12 @@ System::List<Key> KeyboardState::GetPressedKeys() const noexcept
     return pressedKeys;
 }
 
-System::List<Key> KeyboardState::GetReleasedKeys() const noexcept
+System::List<Key, System::FrameArenaAllocator> KeyboardState::GetReleasedKeys() const noexcept
 {
-    System::List<Key> releasedKeys;
+    System::List<Key, System::FrameArenaAllocator> releasedKeys;
+
+    // At most 128 keys, reserves them up front to avoid growing the list
+    releasedKeys.ReserveFor(128);
 
     for (Uint8 i = 0; i < 64; ++i)
     {
@@ -30,7 +30,7 @@ Mouse::Mouse(const System::SharedPointer<DisplayWindow>& window)
             _verticalScrollWheelValue += deltaVal;
     };
 
-    _eventToken = _window->GetMouseWheelScrollEvent().Add(mouseWheelScrollEventHandler, (UintPtr)this);
+    _eventToken = _window->GetMouseWheelScrollEvent().Add(mouseWheelScrollEventHandler);
 }
 
 Mouse::~Mouse() noexcept
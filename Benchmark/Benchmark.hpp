@@ -0,0 +1,97 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#ifndef AXIS_BENCHMARK_BENCHMARK_HPP
+#define AXIS_BENCHMARK_BENCHMARK_HPP
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace Axis
+{
+
+namespace Benchmark
+{
+
+/// \brief Per-run state passed to the benchmark functions.
+///
+/// The whole call of the benchmark function is timed; the function reports
+/// how many items it processed so that the harness can derive the throughput.
+class State
+{
+public:
+    /// \brief Sets the number of items processed by a single run.
+    ///
+    /// \param[in] itemCount Number of items (allocations, insertions, etc.)
+    inline void SetItemCount(std::size_t itemCount) noexcept { _itemCount = itemCount; }
+
+    /// \brief Gets the number of items processed by a single run.
+    inline std::size_t GetItemCount() const noexcept { return _itemCount; }
+
+    /// \brief Sets the label shown next to the result (e.g. the thread count).
+    ///
+    /// \param[in] label Null-terminated string with static storage duration.
+    inline void SetLabel(const char* label) noexcept { _label = label; }
+
+    /// \brief Gets the label shown next to the result.
+    inline const char* GetLabel() const noexcept { return _label; }
+
+private:
+    std::size_t _itemCount = 1;       ///< Number of items processed by a single run
+    const char* _label     = nullptr; ///< Additional label of the result
+};
+
+/// \brief Signature of the benchmark functions.
+using BenchmarkFunction = void (*)(State&);
+
+/// \brief Registers the benchmark function at the static initialization time.
+struct Registration
+{
+    /// \brief Registers the benchmark function.
+    ///
+    /// \param[in] name Name of the benchmark.
+    /// \param[in] function Function to be benchmarked.
+    Registration(const char*       name,
+                 BenchmarkFunction function) noexcept;
+};
+
+/// \brief Prevents the compiler from optimizing away the computation of the given value.
+template <class T>
+inline void DoNotOptimize(const T& value) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile(""
+                 :
+                 : "r,m"(value)
+                 : "memory");
+#else
+    static volatile const void* s_sink = nullptr;
+    s_sink                              = &value;
+#endif
+}
+
+} // namespace Benchmark
+
+} // namespace Axis
+
+#define AXIS_BENCHMARK_CONCAT_INTERNAL(x, y) x##y
+#define AXIS_BENCHMARK_CONCAT(x, y)          AXIS_BENCHMARK_CONCAT_INTERNAL(x, y)
+
+/// \brief Defines and registers a new benchmark function.
+///
+/// \code
+/// AXIS_BENCHMARK(ListPushBack)
+/// {
+///     state.SetItemCount(1000);
+///     ...
+/// }
+/// \endcode
+#define AXIS_BENCHMARK(name)                                                                                                         \
+    static void                                  name(::Axis::Benchmark::State& state);                                             \
+    static const ::Axis::Benchmark::Registration AXIS_BENCHMARK_CONCAT(s_benchmarkRegistration, __LINE__)(#name, &name);              \
+    static void                                  name(::Axis::Benchmark::State& state)
+
+#endif // AXIS_BENCHMARK_BENCHMARK_HPP
@@ -0,0 +1,194 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#include <Benchmark.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace Axis
+{
+
+namespace Benchmark
+{
+
+// Registered benchmark entry
+struct BenchmarkEntry
+{
+    const char*       Name     = nullptr; // <-- Name of the benchmark
+    BenchmarkFunction Function = nullptr; // <-- Benchmarked function
+};
+
+// Gets the list of registered benchmarks, constructed on first use to avoid static initialization order issues
+static std::vector<BenchmarkEntry>& GetBenchmarkEntries()
+{
+    static std::vector<BenchmarkEntry> s_benchmarkEntries;
+    return s_benchmarkEntries;
+}
+
+Registration::Registration(const char*       name,
+                           BenchmarkFunction function) noexcept
+{
+    GetBenchmarkEntries().push_back({name, function});
+}
+
+} // namespace Benchmark
+
+} // namespace Axis
+
+using namespace Axis::Benchmark;
+
+namespace
+{
+
+// Timings of the repetitions of one benchmark, in seconds.
+struct BenchmarkResult
+{
+    const char* Name      = nullptr; // <-- Name of the benchmark
+    const char* Label     = nullptr; // <-- Label set by the benchmark
+    std::size_t ItemCount = 1;       // <-- Number of items processed by a single run
+    double      Best      = 0.0;     // <-- Shortest run
+    double      Median    = 0.0;     // <-- Median run, compared against the baseline
+    double      Mean      = 0.0;     // <-- Mean of the runs
+    double      Deviation = 0.0;     // <-- Standard deviation of the runs
+};
+
+BenchmarkResult Summarize(const BenchmarkEntry& entry,
+                          const State&          state,
+                          std::vector<double>&  seconds)
+{
+    BenchmarkResult result = {entry.Name, state.GetLabel(), state.GetItemCount()};
+
+    std::sort(seconds.begin(), seconds.end());
+
+    const std::size_t count = seconds.size();
+
+    result.Best   = seconds.front();
+    result.Median = count % 2 ? seconds[count / 2] : (seconds[count / 2 - 1] + seconds[count / 2]) * 0.5;
+
+    for (double time : seconds)
+        result.Mean += time;
+
+    result.Mean /= (double)count;
+
+    for (double time : seconds)
+        result.Deviation += (time - result.Mean) * (time - result.Mean);
+
+    result.Deviation = count > 1 ? std::sqrt(result.Deviation / (double)(count - 1)) : 0.0;
+
+    return result;
+}
+
+// Writes the results in the format read by `CompareBenchmarks.py`.
+bool WriteJson(const char*                         path,
+               const std::vector<BenchmarkResult>& results,
+               std::size_t                         warmups,
+               std::size_t                         repetitions)
+{
+    std::FILE* file = std::fopen(path, "w");
+
+    if (!file)
+        return false;
+
+    std::fprintf(file, "{\n  \"warmups\": %zu,\n  \"repetitions\": %zu,\n  \"benchmarks\": [", warmups, repetitions);
+
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        const auto& result = results[i];
+
+        // The names and the labels are identifiers, they need no escaping.
+        std::fprintf(file,
+                     "%s\n    {\"name\": \"%s\", \"label\": \"%s\", \"itemCount\": %zu, \"bestMs\": %.6f, \"medianMs\": %.6f, \"meanMs\": %.6f, \"deviationMs\": %.6f, \"nsPerItem\": %.6f}",
+                     i == 0 ? "" : ",",
+                     result.Name,
+                     result.Label ? result.Label : "",
+                     result.ItemCount,
+                     result.Best * 1e3,
+                     result.Median * 1e3,
+                     result.Mean * 1e3,
+                     result.Deviation * 1e3,
+                     (result.Median * 1e9) / (double)result.ItemCount);
+    }
+
+    std::fprintf(file, "\n  ]\n}\n");
+
+    return std::fclose(file) == 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const char* filter      = nullptr; // Only runs the benchmarks whose name contains the filter
+    const char* jsonPath    = nullptr; // Writes the results to the file when set
+    std::size_t repetitions = 5;       // Number of timed runs of each benchmark
+    std::size_t warmups     = 1;       // Number of untimed runs before the timed ones
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--repetitions") == 0 && i + 1 < argc)
+            repetitions = std::max<std::size_t>(1, std::strtoull(argv[++i], nullptr, 10));
+        else if (std::strcmp(argv[i], "--warmups") == 0 && i + 1 < argc)
+            warmups = std::strtoull(argv[++i], nullptr, 10);
+        else if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+            jsonPath = argv[++i];
+        else
+            filter = argv[i];
+    }
+
+    std::printf("%-48s %-12s %12s %12s %12s %12s %12s %12s\n", "Benchmark", "Label", "Best (ms)", "Median (ms)", "Mean (ms)", "StdDev (%)", "ns/item", "Mitems/s");
+
+    std::vector<BenchmarkResult> results;
+
+    for (const auto& entry : GetBenchmarkEntries())
+    {
+        if (filter && !std::strstr(entry.Name, filter))
+            continue;
+
+        State state;
+
+        // Fills the caches and the lazily built inputs before the timed runs.
+        for (std::size_t i = 0; i < warmups; ++i)
+            entry.Function(state);
+
+        std::vector<double> seconds;
+
+        for (std::size_t i = 0; i < repetitions; ++i)
+        {
+            auto begin = std::chrono::steady_clock::now();
+
+            entry.Function(state);
+
+            auto end = std::chrono::steady_clock::now();
+
+            seconds.push_back(std::chrono::duration<double>(end - begin).count());
+        }
+
+        const BenchmarkResult result             = Summarize(entry, state, seconds);
+        const double          nanosecondsPerItem = (result.Median * 1e9) / (double)result.ItemCount;
+
+        std::printf("%-48s %-12s %12.3f %12.3f %12.3f %12.1f %12.3f %12.3f\n",
+                    result.Name,
+                    result.Label ? result.Label : "",
+                    result.Best * 1e3,
+                    result.Median * 1e3,
+                    result.Mean * 1e3,
+                    result.Mean > 0.0 ? result.Deviation / result.Mean * 100.0 : 0.0,
+                    nanosecondsPerItem,
+                    1e3 / nanosecondsPerItem);
+
+        results.push_back(result);
+    }
+
+    if (jsonPath && !WriteJson(jsonPath, results, warmups, repetitions))
+    {
+        std::fprintf(stderr, "Failed to write the results to `%s`!\n", jsonPath);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+# \copyright Simmypeet - Copyright (C)
+#            This file is subject to the terms and conditions defined in
+#            file 'LICENSE', which is part of this source code package.
+
+"""Compares the results written by the benchmark executables' `--json` option against the baseline.
+
+Exits with 1 when any benchmark's median time per item got slower than the baseline by more than
+the threshold, so it can gate the builds:
+
+    Axis-Benchmark-System --json current.json
+    python3 CompareBenchmarks.py baseline.json current.json --threshold 0.10
+
+The benchmarks only present in one of the files are reported but never fail the comparison.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load_results(path):
+    with open(path, "r", encoding="utf-8") as file:
+        document = json.load(file)
+
+    return {benchmark["name"]: benchmark for benchmark in document["benchmarks"]}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline", help="results stored from the reference build")
+    parser.add_argument("current", help="results of the build being checked")
+    parser.add_argument("--threshold", type=float, default=0.10,
+                        help="largest allowed slowdown as a fraction of the baseline (default: 0.10)")
+    parser.add_argument("--filter", default="",
+                        help="only compares the benchmarks whose name contains the filter")
+    arguments = parser.parse_args()
+
+    baseline = load_results(arguments.baseline)
+    current = load_results(arguments.current)
+
+    names = [name for name in current if arguments.filter in name]
+    width = max([len(name) for name in list(baseline) + names] + [len("Benchmark")])
+
+    print(f"{'Benchmark':<{width}} {'Baseline (ns)':>14} {'Current (ns)':>14} {'Change':>9}")
+
+    regressions = []
+
+    for name in names:
+        if name not in baseline:
+            print(f"{name:<{width}} {'-':>14} {current[name]['nsPerItem']:>14.3f} {'new':>9}")
+            continue
+
+        before = baseline[name]["nsPerItem"]
+        after = current[name]["nsPerItem"]
+        change = (after - before) / before if before > 0.0 else 0.0
+
+        marker = ""
+
+        if change > arguments.threshold:
+            regressions.append(name)
+            marker = "  <-- regressed"
+
+        print(f"{name:<{width}} {before:>14.3f} {after:>14.3f} {change:>+8.1%}{marker}")
+
+    for name in baseline:
+        if arguments.filter in name and name not in current:
+            print(f"{name:<{width}} {baseline[name]['nsPerItem']:>14.3f} {'-':>14} {'missing':>9}")
+
+    if regressions:
+        print(f"\n{len(regressions)} benchmark(s) regressed by more than {arguments.threshold:.0%}:", file=sys.stderr)
+
+        for name in regressions:
+            print(f"  {name}", file=sys.stderr)
+
+        return 1
+
+    print(f"\nNo benchmark regressed by more than {arguments.threshold:.0%}.")
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
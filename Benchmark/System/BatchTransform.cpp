@@ -0,0 +1,183 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#include <Axis/System>
+#include <Benchmark.hpp>
+#include <cmath>
+#include <vector>
+
+using namespace Axis;
+using namespace Axis::System;
+using namespace Axis::Benchmark;
+
+namespace
+{
+
+constexpr Size PointCount  = 20000; // Number of points transformed per frame, not a multiple of the batch width
+constexpr Size RepeatCount = 64;    // Number of frames
+
+constexpr Float32 Rotation = 0.7f;
+
+struct PointSet
+{
+    std::vector<Vector3F> Points3;
+    std::vector<Vector2F> Points2;
+    std::vector<Float32>  X;
+    std::vector<Float32>  Y;
+    std::vector<Float32>  Z;
+};
+
+const PointSet& GetPoints()
+{
+    static const PointSet points = []() {
+        PointSet result;
+
+        Uint32 seed = 42;
+
+        const auto generate = [&]() {
+            seed = seed * 1664525u + 1013904223u;
+            return (Float32)(seed >> 8) / (Float32)(1u << 24) * 200.0f - 100.0f;
+        };
+
+        for (Size i = 0; i < PointCount; ++i)
+        {
+            result.Points3.emplace_back(generate(), generate(), generate());
+            result.Points2.emplace_back(result.Points3.back().X, result.Points3.back().Y);
+            result.X.push_back(result.Points3.back().X);
+            result.Y.push_back(result.Points3.back().Y);
+            result.Z.push_back(result.Points3.back().Z);
+        }
+
+        return result;
+    }();
+
+    return points;
+}
+
+FloatMatrix4x4 GetMatrix()
+{
+    return FloatMatrix4x4::GetTranslationMatrix({1.0f, -2.0f, 3.0f}) * FloatMatrix4x4::GetMatrixRotationY(0.7f);
+}
+
+} // namespace
+
+// One point at a time, as the scene code does.
+AXIS_BENCHMARK(TransformPoints_PerPoint)
+{
+    state.SetLabel("before");
+
+    const auto&          points = GetPoints().Points3;
+    const FloatMatrix4x4 matrix = GetMatrix();
+
+    std::vector<Vector3F> result(PointCount);
+
+    for (Size repeat = 0; repeat < RepeatCount; ++repeat)
+    {
+        for (Size i = 0; i < PointCount; ++i)
+            result[i] = matrix.TransformPoint(points[i]);
+
+        DoNotOptimize(result.data());
+    }
+
+    state.SetItemCount(PointCount * RepeatCount);
+}
+
+AXIS_BENCHMARK(TransformPoints_Batch)
+{
+    state.SetLabel("after");
+
+    const auto&          points = GetPoints().Points3;
+    const FloatMatrix4x4 matrix = GetMatrix();
+
+    std::vector<Vector3F> result(PointCount);
+
+    for (Size repeat = 0; repeat < RepeatCount; ++repeat)
+    {
+        Math::TransformPoints(Span<Vector3F>(points.data(), points.data() + PointCount), matrix, result.data());
+        DoNotOptimize(result.data());
+    }
+
+    state.SetItemCount(PointCount * RepeatCount);
+}
+
+AXIS_BENCHMARK(TransformPoints_BatchSoA)
+{
+    state.SetLabel("after");
+
+    const auto&          points = GetPoints();
+    const FloatMatrix4x4 matrix = GetMatrix();
+
+    std::vector<Float32> x(PointCount), y(PointCount), z(PointCount);
+
+    for (Size repeat = 0; repeat < RepeatCount; ++repeat)
+    {
+        Math::TransformPoints(points.X.data(), points.Y.data(), points.Z.data(), PointCount, matrix, x.data(), y.data(), z.data());
+        DoNotOptimize(x.data());
+    }
+
+    state.SetItemCount(PointCount * RepeatCount);
+}
+
+// One point at a time, as `SpriteBatch` rotates the corners of the sprites.
+AXIS_BENCHMARK(RotateTranslate2D_PerPoint)
+{
+    state.SetLabel("before");
+
+    const auto&    points      = GetPoints().Points2;
+    const Vector2F translation = {10.0f, -5.0f};
+
+    std::vector<Vector2F> result(PointCount);
+
+    for (Size repeat = 0; repeat < RepeatCount; ++repeat)
+    {
+        const Float32 sin = std::sin(Rotation);
+        const Float32 cos = std::cos(Rotation);
+
+        for (Size i = 0; i < PointCount; ++i)
+        {
+            result[i] = Vector2F(translation.X + points[i].X * cos - points[i].Y * sin,
+                                 translation.Y + points[i].X * sin + points[i].Y * cos);
+        }
+
+        DoNotOptimize(result.data());
+    }
+
+    state.SetItemCount(PointCount * RepeatCount);
+}
+
+AXIS_BENCHMARK(RotateTranslate2D_Batch)
+{
+    state.SetLabel("after");
+
+    const auto&    points      = GetPoints().Points2;
+    const Vector2F translation = {10.0f, -5.0f};
+
+    std::vector<Vector2F> result(PointCount);
+
+    for (Size repeat = 0; repeat < RepeatCount; ++repeat)
+    {
+        Math::RotateTranslate2D(Span<Vector2F>(points.data(), points.data() + PointCount), Rotation, translation, result.data());
+        DoNotOptimize(result.data());
+    }
+
+    state.SetItemCount(PointCount * RepeatCount);
+}
+
+AXIS_BENCHMARK(RotateTranslate2D_BatchSoA)
+{
+    state.SetLabel("after");
+
+    const auto&    points      = GetPoints();
+    const Vector2F translation = {10.0f, -5.0f};
+
+    std::vector<Float32> x(PointCount), y(PointCount);
+
+    for (Size repeat = 0; repeat < RepeatCount; ++repeat)
+    {
+        Math::RotateTranslate2D(points.X.data(), points.Y.data(), PointCount, Rotation, translation, x.data(), y.data());
+        DoNotOptimize(x.data());
+    }
+
+    state.SetItemCount(PointCount * RepeatCount);
+}
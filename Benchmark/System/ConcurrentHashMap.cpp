@@ -0,0 +1,255 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#include <Axis/System>
+#include <Benchmark.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+
+using namespace Axis;
+using namespace Axis::System;
+using namespace Axis::Benchmark;
+
+namespace
+{
+
+constexpr Size KeyCount        = 1 << 12;  // Number of the cached keys, e.g. the pipeline states
+constexpr Size OperationCount  = 1 << 20;  // Number of the operations per run, split across the threads
+constexpr Size WriteInterval   = 64;       // One operation in this many inserts or removes a transient key
+constexpr Size TransientOffset = KeyCount; // Keys above this one come and go
+
+// Cache guarded by the mutex, what the engine would have without the concurrent map.
+class MutexCache
+{
+public:
+    Bool Find(Size key) const
+    {
+        std::scoped_lock lock(_mutex);
+
+        return _map.Find(key) != _map.end();
+    }
+
+    void Insert(Size key, Size value)
+    {
+        std::scoped_lock lock(_mutex);
+
+        _map.Insert({key, value});
+    }
+
+    void Remove(Size key)
+    {
+        std::scoped_lock lock(_mutex);
+
+        _map.Remove(key);
+    }
+
+private:
+    mutable std::mutex  _mutex;
+    HashMap<Size, Size> _map;
+};
+
+// Cache guarded by the reader-writer lock, the readers only contend on the lock's counter.
+class SharedMutexCache
+{
+public:
+    Bool Find(Size key) const
+    {
+        std::shared_lock lock(_mutex);
+
+        return _map.Find(key) != _map.end();
+    }
+
+    void Insert(Size key, Size value)
+    {
+        std::unique_lock lock(_mutex);
+
+        _map.Insert({key, value});
+    }
+
+    void Remove(Size key)
+    {
+        std::unique_lock lock(_mutex);
+
+        _map.Remove(key);
+    }
+
+private:
+    mutable std::shared_mutex _mutex;
+    HashMap<Size, Size>       _map;
+};
+
+// Adapts the concurrent map to the interface of the locked caches.
+class ConcurrentCache
+{
+public:
+    Bool Find(Size key) const { return _map.Contains(key); }
+
+    void Insert(Size key, Size value) { _map.TryInsert(key, value); }
+
+    void Remove(Size key) { _map.Remove(key); }
+
+private:
+    ConcurrentHashMap<Size, Size> _map;
+};
+
+// Looks the cached keys up from every thread, one operation in `WriteInterval` inserts or removes a
+// transient key so the readers see the writers' traffic.
+template <class Cache>
+void RunReadMostly(State& state,
+                   Size   threadCount)
+{
+    static Cache cache;
+    static Bool  filled = false;
+
+    if (!filled)
+    {
+        for (Size key = 0; key < KeyCount; ++key)
+            cache.Insert(key, key);
+
+        filled = true;
+    }
+
+    std::atomic<Size> found = 0;
+    List<std::thread> threads;
+
+    const Size perThread = OperationCount / threadCount;
+
+    for (Size thread = 0; thread < threadCount; ++thread)
+    {
+        threads.Append(std::thread([&, thread]() {
+            FastRandom random(thread + 1);
+            Size       threadFound = 0;
+
+            for (Size i = 0; i < perThread; ++i)
+            {
+                const Uint32 roll = random.NextUint32();
+
+                if (roll % WriteInterval != 0)
+                {
+                    threadFound += (Size)cache.Find((roll >> 8) % KeyCount);
+                    continue;
+                }
+
+                const Size transientKey = TransientOffset + thread * 256 + ((roll >> 8) & 255);
+
+                if ((roll >> 16) & 1)
+                    cache.Insert(transientKey, transientKey);
+                else
+                    cache.Remove(transientKey);
+            }
+
+            found.fetch_add(threadFound, std::memory_order_relaxed);
+        }));
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    // The cached keys are never removed, most of the lookups must hit.
+    if (found.load() < perThread * threadCount / 2)
+    {
+        std::fprintf(stderr, "The cache lost the cached keys!\n");
+        std::abort();
+    }
+
+    state.SetItemCount(perThread * threadCount);
+}
+
+} // namespace
+
+// Every run starts the threads, the cost is the same on all the sides. On the machines with fewer
+// cores than the threads the runs mostly measure the context switches.
+
+AXIS_BENCHMARK(ReadMostly_Mutex_Threads1)
+{
+    state.SetLabel("before");
+    RunReadMostly<MutexCache>(state, 1);
+}
+
+AXIS_BENCHMARK(ReadMostly_SharedMutex_Threads1)
+{
+    state.SetLabel("before");
+    RunReadMostly<SharedMutexCache>(state, 1);
+}
+
+AXIS_BENCHMARK(ReadMostly_ConcurrentHashMap_Threads1)
+{
+    state.SetLabel("after");
+    RunReadMostly<ConcurrentCache>(state, 1);
+}
+
+AXIS_BENCHMARK(ReadMostly_Mutex_Threads2)
+{
+    state.SetLabel("before");
+    RunReadMostly<MutexCache>(state, 2);
+}
+
+AXIS_BENCHMARK(ReadMostly_SharedMutex_Threads2)
+{
+    state.SetLabel("before");
+    RunReadMostly<SharedMutexCache>(state, 2);
+}
+
+AXIS_BENCHMARK(ReadMostly_ConcurrentHashMap_Threads2)
+{
+    state.SetLabel("after");
+    RunReadMostly<ConcurrentCache>(state, 2);
+}
+
+AXIS_BENCHMARK(ReadMostly_Mutex_Threads4)
+{
+    state.SetLabel("before");
+    RunReadMostly<MutexCache>(state, 4);
+}
+
+AXIS_BENCHMARK(ReadMostly_SharedMutex_Threads4)
+{
+    state.SetLabel("before");
+    RunReadMostly<SharedMutexCache>(state, 4);
+}
+
+AXIS_BENCHMARK(ReadMostly_ConcurrentHashMap_Threads4)
+{
+    state.SetLabel("after");
+    RunReadMostly<ConcurrentCache>(state, 4);
+}
+
+AXIS_BENCHMARK(ReadMostly_Mutex_Threads8)
+{
+    state.SetLabel("before");
+    RunReadMostly<MutexCache>(state, 8);
+}
+
+AXIS_BENCHMARK(ReadMostly_SharedMutex_Threads8)
+{
+    state.SetLabel("before");
+    RunReadMostly<SharedMutexCache>(state, 8);
+}
+
+AXIS_BENCHMARK(ReadMostly_ConcurrentHashMap_Threads8)
+{
+    state.SetLabel("after");
+    RunReadMostly<ConcurrentCache>(state, 8);
+}
+
+AXIS_BENCHMARK(ReadMostly_Mutex_Threads16)
+{
+    state.SetLabel("before");
+    RunReadMostly<MutexCache>(state, 16);
+}
+
+AXIS_BENCHMARK(ReadMostly_SharedMutex_Threads16)
+{
+    state.SetLabel("before");
+    RunReadMostly<SharedMutexCache>(state, 16);
+}
+
+AXIS_BENCHMARK(ReadMostly_ConcurrentHashMap_Threads16)
+{
+    state.SetLabel("after");
+    RunReadMostly<ConcurrentCache>(state, 16);
+}
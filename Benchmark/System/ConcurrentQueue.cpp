@@ -0,0 +1,210 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#include <Axis/System>
+#include <Benchmark.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+using namespace Axis;
+using namespace Axis::System;
+using namespace Axis::Benchmark;
+
+namespace
+{
+
+constexpr Size ElementCount  = 1 << 16; // Number of the elements handed off per run
+constexpr Size QueueCapacity = 1024;    // Capacity of the bounded queues
+constexpr Size BatchSize     = 32;      // Number of the elements per batch push / pop
+constexpr Size ThreadCount   = 2;       // Number of the producers and the consumers of the MPMC runs
+
+// Handoff guarded by the mutex, what the engine had before.
+class MutexQueue
+{
+public:
+    Bool TryPush(Size element)
+    {
+        std::scoped_lock lock(_mutex);
+
+        if (_elements.size() == QueueCapacity)
+            return false;
+
+        _elements.push_back(element);
+
+        return true;
+    }
+
+    Bool TryPop(Size& element)
+    {
+        std::scoped_lock lock(_mutex);
+
+        if (_elements.empty())
+            return false;
+
+        element = _elements.front();
+        _elements.pop_front();
+
+        return true;
+    }
+
+private:
+    std::mutex       _mutex;
+    std::deque<Size> _elements;
+};
+
+// Pushes the elements [first, first + count), one at a time or in batches.
+template <Size Batch, class Queue>
+void Produce(Queue& queue,
+             Size   first,
+             Size   count)
+{
+    Size batch[Batch];
+
+    for (Size i = 0; i < count;)
+    {
+        Size pushed = 0;
+
+        if constexpr (Batch == 1)
+            pushed = (Size)queue.TryPush(first + i);
+        else
+        {
+            const Size batchCount = Math::Min(Batch, count - i);
+
+            for (Size j = 0; j < batchCount; ++j)
+                batch[j] = first + i + j;
+
+            pushed = queue.TryPushRange(batch, batchCount);
+        }
+
+        if (pushed == 0)
+            std::this_thread::yield();
+
+        i += pushed;
+    }
+}
+
+// Pops the elements until all of them are handed off, returns the sum of the popped ones.
+template <Size Batch, class Queue>
+Size Consume(Queue&             queue,
+             std::atomic<Size>& remaining)
+{
+    Size batch[Batch];
+    Size sum = 0;
+
+    while (remaining.load(std::memory_order_relaxed) != 0)
+    {
+        Size popped = 0;
+
+        if constexpr (Batch == 1)
+            popped = (Size)queue.TryPop(batch[0]);
+        else
+            popped = queue.TryPopRange(batch, Batch);
+
+        if (popped == 0)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        for (Size i = 0; i < popped; ++i)
+            sum += batch[i];
+
+        remaining.fetch_sub(popped, std::memory_order_relaxed);
+    }
+
+    return sum;
+}
+
+// Hands the elements off from the producers to the consumers, checks the sum of the popped ones.
+template <Size Batch, class Queue>
+void RunHandoff(State& state,
+                Queue& queue,
+                Size   producerCount,
+                Size   consumerCount)
+{
+    std::atomic<Size> remaining = ElementCount;
+    std::atomic<Size> sum       = 0;
+    List<std::thread> threads;
+
+    for (Size i = 0; i < consumerCount; ++i)
+        threads.Append(std::thread([&]() { sum.fetch_add(Consume<Batch>(queue, remaining)); }));
+
+    const Size perProducer = ElementCount / producerCount;
+
+    for (Size i = 0; i < producerCount; ++i)
+        threads.Append(std::thread([&, i]() { Produce<Batch>(queue, i * perProducer, perProducer); }));
+
+    for (auto& thread : threads)
+        thread.join();
+
+    if (sum.load() != ElementCount * (ElementCount - 1) / 2)
+    {
+        std::fprintf(stderr, "The queue lost or duplicated the elements!\n");
+        std::abort();
+    }
+
+    state.SetItemCount(ElementCount);
+}
+
+} // namespace
+
+// Every run starts the threads, the cost is the same on both sides. On the machines with fewer
+// cores than the threads the runs mostly measure the context switches.
+
+AXIS_BENCHMARK(SpscHandoff_Mutex)
+{
+    state.SetLabel("before");
+
+    MutexQueue queue;
+
+    RunHandoff<1>(state, queue, 1, 1);
+}
+
+AXIS_BENCHMARK(SpscHandoff_SpscQueue)
+{
+    state.SetLabel("after");
+
+    SpscQueue<Size> queue(QueueCapacity);
+
+    RunHandoff<1>(state, queue, 1, 1);
+}
+
+AXIS_BENCHMARK(SpscHandoff_SpscQueueBatch)
+{
+    state.SetLabel("after");
+
+    SpscQueue<Size> queue(QueueCapacity);
+
+    RunHandoff<BatchSize>(state, queue, 1, 1);
+}
+
+AXIS_BENCHMARK(MpmcHandoff_Mutex)
+{
+    state.SetLabel("before");
+
+    MutexQueue queue;
+
+    RunHandoff<1>(state, queue, ThreadCount, ThreadCount);
+}
+
+AXIS_BENCHMARK(MpmcHandoff_MpmcQueue)
+{
+    state.SetLabel("after");
+
+    MpmcQueue<Size> queue(QueueCapacity);
+
+    RunHandoff<1>(state, queue, ThreadCount, ThreadCount);
+}
+
+AXIS_BENCHMARK(MpmcHandoff_MpmcQueueBatch)
+{
+    state.SetLabel("after");
+
+    MpmcQueue<Size> queue(QueueCapacity);
+
+    RunHandoff<BatchSize>(state, queue, ThreadCount, ThreadCount);
+}
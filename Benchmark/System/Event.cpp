@@ -0,0 +1,150 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#include <Axis/System>
+#include <Benchmark.hpp>
+#include <functional>
+#include <vector>
+
+using namespace Axis;
+using namespace Axis::System;
+using namespace Axis::Benchmark;
+
+namespace
+{
+
+constexpr Size HandlerCount = 16;      // Number of handlers subscribed to the event
+constexpr Size RaiseCount   = 1 << 16; // Number of times the event is raised
+
+// The way the handlers were stored before, keyed by the token in the hash map.
+template <class T>
+class HashMapEvent;
+
+template <class... Args>
+class HashMapEvent<void(Args...)>
+{
+public:
+    Size Add(const Function<void(Args...)>& handler)
+    {
+        _handlers.Insert({++_lastToken, handler});
+        return _lastToken;
+    }
+
+    void Invoke(Args... args)
+    {
+        for (auto& handler : _handlers)
+            handler.Second(args...);
+    }
+
+private:
+    HashMap<Size, Function<void(Args...)>> _handlers  = {};
+    Size                                   _lastToken = 0;
+};
+
+Size Accumulated[HandlerCount] = {};
+
+template <Size Index>
+void Accumulate(Size value)
+{
+    Accumulated[Index] += value;
+}
+
+template <class EventType, Size... Indices>
+void AddFunctionPointers(EventType& event,
+                         std::index_sequence<Indices...>)
+{
+    (event.Add(&Accumulate<Indices>), ...);
+}
+
+template <class EventType>
+void RunRaiseWorkload(Bool   functionPointer,
+                      State& state)
+{
+    EventType event;
+
+    if (functionPointer)
+        AddFunctionPointers(event, std::make_index_sequence<HandlerCount>());
+    else
+    {
+        for (Size i = 0; i < HandlerCount; ++i)
+            event.Add([i](Size value) noexcept { Accumulated[i] += value; });
+    }
+
+    for (Size i = 0; i < RaiseCount; ++i)
+        event.Invoke(i);
+
+    DoNotOptimize(Accumulated);
+
+    state.SetItemCount(RaiseCount * HandlerCount);
+}
+
+// Exposes the register of `Event` with the same interface as `HashMapEvent`.
+template <class T>
+class DenseEvent
+{
+public:
+    Size Add(auto&& handler) { return _event.EventRegister.Add(std::forward<decltype(handler)>(handler)); }
+
+    void Invoke(Size value) { _event.Invoke(value); }
+
+private:
+    Event<T> _event = {};
+};
+
+// The handlers kept in the standard vector, the usual hand-rolled event.
+template <class T>
+class StdEvent
+{
+public:
+    Size Add(auto&& handler)
+    {
+        _handlers.emplace_back(std::forward<decltype(handler)>(handler));
+        return _handlers.size();
+    }
+
+    void Invoke(Size value)
+    {
+        for (auto& handler : _handlers)
+            handler(value);
+    }
+
+private:
+    std::vector<std::function<T>> _handlers = {};
+};
+
+} // namespace
+
+AXIS_BENCHMARK(RaiseEvent_HashMap)
+{
+    state.SetLabel("before");
+    RunRaiseWorkload<HashMapEvent<void(Size)>>(false, state);
+}
+
+AXIS_BENCHMARK(RaiseEvent_Dense)
+{
+    state.SetLabel("after");
+    RunRaiseWorkload<DenseEvent<void(Size)>>(false, state);
+}
+
+AXIS_BENCHMARK(RaiseEvent_Std)
+{
+    RunRaiseWorkload<StdEvent<void(Size)>>(false, state);
+}
+
+AXIS_BENCHMARK(RaiseEvent_HashMap_FunctionPointer)
+{
+    state.SetLabel("before");
+    RunRaiseWorkload<HashMapEvent<void(Size)>>(true, state);
+}
+
+AXIS_BENCHMARK(RaiseEvent_Dense_FunctionPointer)
+{
+    state.SetLabel("after");
+    RunRaiseWorkload<DenseEvent<void(Size)>>(true, state);
+}
+
+AXIS_BENCHMARK(RaiseEvent_Std_FunctionPointer)
+{
+    RunRaiseWorkload<StdEvent<void(Size)>>(true, state);
+}
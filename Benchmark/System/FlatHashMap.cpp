@@ -0,0 +1,140 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#include <Axis/System>
+#include <Benchmark.hpp>
+#include <unordered_map>
+#include <vector>
+
+using namespace Axis;
+using namespace Axis::System;
+using namespace Axis::Benchmark;
+
+namespace
+{
+
+constexpr Size ElementCount = 1 << 14; // Number of elements in the tables
+constexpr Size LookupCount  = 1 << 20; // Number of lookups per benchmark
+
+// Keys spread like the addresses of the cached objects
+std::vector<Size> GenerateKeys()
+{
+    std::vector<Size> keys(ElementCount * 2);
+
+    Uint64 state = 0x853C49E6748FEA9Bull;
+
+    for (auto& key : keys)
+    {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        key   = (Size)(state >> 16) & ~(Size)15;
+    }
+
+    return keys;
+}
+
+template <class Map>
+void Insert(Map& map, Size key, Size value)
+{
+    if constexpr (requires { map.Insert({key, value}); })
+        map.Insert({key, value});
+    else
+        map.insert({key, value});
+}
+
+template <class Map>
+Bool Contains(const Map& map, Size key)
+{
+    if constexpr (requires { map.Find(key); })
+        return map.Find(key) != map.end();
+    else
+        return map.find(key) != map.end();
+}
+
+template <class Map>
+void Remove(Map& map, Size key)
+{
+    if constexpr (requires { map.Remove(key); })
+        map.Remove(key);
+    else
+        map.erase(key);
+}
+
+// Looks up the present and the absent keys alternately.
+template <class Map>
+void RunLookupWorkload(State& state)
+{
+    static const auto keys = GenerateKeys();
+
+    Map map;
+
+    for (Size i = 0; i < ElementCount; ++i)
+        Insert(map, keys[i], i);
+
+    Size found = 0;
+
+    for (Size i = 0; i < LookupCount; ++i)
+        found += Contains(map, keys[(i * 7919) % keys.size()]);
+
+    DoNotOptimize(found);
+
+    state.SetItemCount(LookupCount);
+}
+
+// Fills the table, then removes and re-inserts every element.
+template <class Map>
+void RunChurnWorkload(State& state)
+{
+    static const auto keys = GenerateKeys();
+
+    Map map;
+
+    for (Size i = 0; i < ElementCount; ++i)
+        Insert(map, keys[i], i);
+
+    for (Size i = 0; i < ElementCount; ++i)
+    {
+        Remove(map, keys[i]);
+        Insert(map, keys[i + ElementCount], i);
+    }
+
+    DoNotOptimize(map);
+
+    state.SetItemCount(ElementCount * 3);
+}
+
+} // namespace
+
+AXIS_BENCHMARK(HashMap_Lookup)
+{
+    state.SetLabel("before");
+    RunLookupWorkload<HashMap<Size, Size>>(state);
+}
+
+AXIS_BENCHMARK(FlatHashMap_Lookup)
+{
+    state.SetLabel("after");
+    RunLookupWorkload<FlatHashMap<Size, Size>>(state);
+}
+
+AXIS_BENCHMARK(StdUnorderedMap_Lookup)
+{
+    RunLookupWorkload<std::unordered_map<Size, Size>>(state);
+}
+
+AXIS_BENCHMARK(HashMap_Churn)
+{
+    state.SetLabel("before");
+    RunChurnWorkload<HashMap<Size, Size>>(state);
+}
+
+AXIS_BENCHMARK(FlatHashMap_Churn)
+{
+    state.SetLabel("after");
+    RunChurnWorkload<FlatHashMap<Size, Size>>(state);
+}
+
+AXIS_BENCHMARK(StdUnorderedMap_Churn)
+{
+    RunChurnWorkload<std::unordered_map<Size, Size>>(state);
+}
@@ -0,0 +1,199 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#include <Axis/System>
+#include <Benchmark.hpp>
+#include <functional>
+
+using namespace Axis;
+using namespace Axis::System;
+using namespace Axis::Benchmark;
+
+namespace
+{
+
+constexpr Size OperationCount = 1 << 20; // Number of functions constructed / copied / invoked
+constexpr Size HandlerCount   = 64;      // Number of handlers invoked in turn
+
+// The small buffer the function objects had before, a lambda capturing more than one pointer is allocated.
+template <class T>
+using PointerSizedFunction = Function<T, DefaultAllocator, PointerSize>;
+
+// Captures three references, like the event handlers registered in `Application::Run`.
+auto MakeHandler(Size& sum,
+                 Size& scale,
+                 Size& offset)
+{
+    return [&sum, &scale, &offset](Size value) noexcept {
+        sum += value * scale + offset;
+    };
+}
+
+template <class FunctionType>
+void RunConstructWorkload(State& state)
+{
+    Size sum    = 0;
+    Size scale  = 3;
+    Size offset = 1;
+
+    for (Size i = 0; i < OperationCount; ++i)
+    {
+        FunctionType function = MakeHandler(sum, scale, offset);
+        DoNotOptimize(function);
+    }
+
+    state.SetItemCount(OperationCount);
+}
+
+template <class FunctionType>
+void RunCopyWorkload(State& state)
+{
+    Size sum    = 0;
+    Size scale  = 3;
+    Size offset = 1;
+
+    FunctionType function = MakeHandler(sum, scale, offset);
+
+    for (Size i = 0; i < OperationCount; ++i)
+    {
+        FunctionType copy = function;
+        DoNotOptimize(copy);
+    }
+
+    state.SetItemCount(OperationCount);
+}
+
+// Invokes the handlers in turn, as an event does when it's raised.
+template <class FunctionType>
+void RunInvokeWorkload(State& state)
+{
+    Size sum                  = 0;
+    Size scale[HandlerCount]  = {};
+    Size offset[HandlerCount] = {};
+
+    List<FunctionType> handlers;
+
+    for (Size i = 0; i < HandlerCount; ++i)
+    {
+        scale[i]  = i;
+        offset[i] = i * 2;
+        handlers.EmplaceBack(MakeHandler(sum, scale[i], offset[i]));
+    }
+
+    for (Size i = 0; i < OperationCount / HandlerCount; ++i)
+    {
+        for (auto& handler : handlers)
+            handler(i);
+    }
+
+    DoNotOptimize(sum);
+
+    state.SetItemCount(OperationCount);
+}
+
+// Passes the callback to a function which only invokes it, as the job bodies and the iteration visitors are.
+template <class FunctionType>
+AXIS_NODISCARD Size VisitRange(Size         count,
+                               FunctionType visitor)
+{
+    Size sum = 0;
+
+    // Hides the target from the optimizer, the visitor is usually passed across translation units.
+    FunctionType* volatile opaqueVisitor = &visitor;
+    FunctionType&          target        = *opaqueVisitor;
+
+    for (Size i = 0; i < count; ++i)
+        sum += target(i);
+
+    return sum;
+}
+
+template <class FunctionType>
+void RunVisitWorkload(State& state)
+{
+    Size scale  = 3;
+    Size offset = 1;
+    Size result = 0;
+
+    auto visitor = [&scale, &offset, &result](Size value) noexcept {
+        return value * scale + offset + result;
+    };
+
+    for (Size i = 0; i < OperationCount / HandlerCount; ++i)
+        result += VisitRange<FunctionType>(HandlerCount, visitor);
+
+    DoNotOptimize(result);
+
+    state.SetItemCount(OperationCount);
+}
+
+} // namespace
+
+AXIS_BENCHMARK(ConstructFunction_PointerSized)
+{
+    state.SetLabel("before");
+    RunConstructWorkload<PointerSizedFunction<void(Size)>>(state);
+}
+
+AXIS_BENCHMARK(ConstructFunction_Inline)
+{
+    state.SetLabel("after");
+    RunConstructWorkload<Function<void(Size)>>(state);
+}
+
+AXIS_BENCHMARK(ConstructFunction_StdFunction)
+{
+    RunConstructWorkload<std::function<void(Size)>>(state);
+}
+
+AXIS_BENCHMARK(CopyFunction_PointerSized)
+{
+    state.SetLabel("before");
+    RunCopyWorkload<PointerSizedFunction<void(Size)>>(state);
+}
+
+AXIS_BENCHMARK(CopyFunction_Inline)
+{
+    state.SetLabel("after");
+    RunCopyWorkload<Function<void(Size)>>(state);
+}
+
+AXIS_BENCHMARK(CopyFunction_StdFunction)
+{
+    RunCopyWorkload<std::function<void(Size)>>(state);
+}
+
+AXIS_BENCHMARK(InvokeFunction_PointerSized)
+{
+    state.SetLabel("before");
+    RunInvokeWorkload<PointerSizedFunction<void(Size)>>(state);
+}
+
+AXIS_BENCHMARK(InvokeFunction_Inline)
+{
+    state.SetLabel("after");
+    RunInvokeWorkload<Function<void(Size)>>(state);
+}
+
+AXIS_BENCHMARK(InvokeFunction_StdFunction)
+{
+    RunInvokeWorkload<std::function<void(Size)>>(state);
+}
+
+AXIS_BENCHMARK(VisitCallback_PointerSizedFunction)
+{
+    state.SetLabel("before");
+    RunVisitWorkload<PointerSizedFunction<Size(Size)>>(state);
+}
+
+AXIS_BENCHMARK(VisitCallback_FunctionRef)
+{
+    state.SetLabel("after");
+    RunVisitWorkload<FunctionRef<Size(Size)>>(state);
+}
+
+AXIS_BENCHMARK(VisitCallback_StdFunction)
+{
+    RunVisitWorkload<std::function<Size(Size)>>(state);
+}
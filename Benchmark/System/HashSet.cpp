@@ -0,0 +1,142 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#include <Axis/System>
+#include <Benchmark.hpp>
+#include <unordered_set>
+#include <vector>
+
+using namespace Axis;
+using namespace Axis::System;
+using namespace Axis::Benchmark;
+
+namespace
+{
+
+constexpr Size ElementCount = 1 << 14; // Number of elements in the sets
+constexpr Size LookupCount  = 1 << 20; // Number of lookups per benchmark
+
+// Keys spread like the addresses of the tracked resources
+std::vector<Size> GenerateKeys()
+{
+    std::vector<Size> keys(ElementCount * 2);
+
+    Uint64 state = 0x2545F4914F6CDD1Dull;
+
+    for (auto& key : keys)
+    {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        key   = (Size)(state >> 16) & ~(Size)15;
+    }
+
+    return keys;
+}
+
+template <class Set>
+void Insert(Set& set, Size key)
+{
+    if constexpr (requires { set.Insert(key); })
+        set.Insert(key);
+    else
+        set.insert(key);
+}
+
+template <class Set>
+Bool Contains(const Set& set, Size key)
+{
+    if constexpr (requires { set.Find(key); })
+        return set.Find(key) != set.end();
+    else
+        return set.find(key) != set.end();
+}
+
+template <class Set>
+void Clear(Set& set)
+{
+    if constexpr (requires { set.Clear(); })
+        set.Clear();
+    else
+        set.clear();
+}
+
+// Looks up the present and the absent keys alternately.
+template <class Set>
+void RunLookupWorkload(State& state)
+{
+    static const auto keys = GenerateKeys();
+
+    Set set;
+
+    for (Size i = 0; i < ElementCount; ++i)
+        Insert(set, keys[i]);
+
+    Size found = 0;
+
+    for (Size i = 0; i < LookupCount; ++i)
+        found += Contains(set, keys[(i * 7919) % keys.size()]);
+
+    DoNotOptimize(found);
+
+    state.SetItemCount(LookupCount);
+}
+
+// Fills the set with a few keys and clears it, over and over, as the command buffers track their
+// resources every frame.
+template <class Set>
+void RunRefillWorkload(State& state)
+{
+    static const auto keys = GenerateKeys();
+
+    constexpr Size KeysPerFrame = 64;
+
+    Set set;
+
+    for (Size frame = 0; frame < ElementCount / KeysPerFrame; ++frame)
+    {
+        for (Size i = 0; i < KeysPerFrame * 4; ++i)
+            Insert(set, keys[frame + i % KeysPerFrame]);
+
+        DoNotOptimize(set);
+
+        Clear(set);
+    }
+
+    state.SetItemCount(ElementCount * 4);
+}
+
+} // namespace
+
+AXIS_BENCHMARK(HashSet_Lookup)
+{
+    state.SetLabel("before");
+    RunLookupWorkload<HashSet<Size>>(state);
+}
+
+AXIS_BENCHMARK(FlatHashSet_Lookup)
+{
+    state.SetLabel("after");
+    RunLookupWorkload<FlatHashSet<Size>>(state);
+}
+
+AXIS_BENCHMARK(StdUnorderedSet_Lookup)
+{
+    RunLookupWorkload<std::unordered_set<Size>>(state);
+}
+
+AXIS_BENCHMARK(HashSet_Refill)
+{
+    state.SetLabel("before");
+    RunRefillWorkload<HashSet<Size>>(state);
+}
+
+AXIS_BENCHMARK(FlatHashSet_Refill)
+{
+    state.SetLabel("after");
+    RunRefillWorkload<FlatHashSet<Size>>(state);
+}
+
+AXIS_BENCHMARK(StdUnorderedSet_Refill)
+{
+    RunRefillWorkload<std::unordered_set<Size>>(state);
+}
@@ -0,0 +1,172 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#include <Axis/System>
+#include <Benchmark.hpp>
+#include <vector>
+
+using namespace Axis;
+using namespace Axis::System;
+using namespace Axis::Benchmark;
+
+namespace
+{
+
+constexpr Size TotalByteCount = 1 << 24; // Number of bytes hashed per benchmark
+
+// Byte at a time hash, the way the hand-written hashers worked before.
+Uint64 HashBytesFnv1a(const Byte* bytes, Size size) noexcept
+{
+    Uint64 hash = 14695981039346656037ull;
+
+    for (Size i = 0; i < size; ++i)
+        hash = (hash ^ bytes[i]) * 1099511628211ull;
+
+    return hash;
+}
+
+// Hashes `TotalByteCount` bytes in chunks of `ChunkSize` bytes, item is a byte.
+template <Size ChunkSize, class Function>
+void RunByteWorkload(State& state, Function&& hash)
+{
+    static const auto bytes = [] {
+        std::vector<Byte> bytes(ChunkSize + 64);
+
+        for (Size i = 0; i < bytes.size(); ++i)
+            bytes[i] = (Byte)(i * 31 + 7);
+
+        return bytes;
+    }();
+
+    Uint64 result = 0;
+
+    // The offset changes to defeat the loop invariant hoisting
+    for (Size i = 0; i < TotalByteCount / ChunkSize; ++i)
+        result ^= hash(bytes.data() + (i & 63), ChunkSize);
+
+    DoNotOptimize(result);
+
+    state.SetItemCount(TotalByteCount);
+}
+
+// Sampler-like descriptor with padding bytes and floating point members.
+struct Descriptor
+{
+    Uint8   MinFilter      = {};
+    Uint8   MagFilter      = {};
+    Uint8   AddressMode    = {};
+    Float32 MipLODBias     = {};
+    Bool    Anisotropy     = {};
+    Uint32  MaxAnisotropy  = {};
+    Float32 BorderColor[4] = {};
+    Float32 MinLOD         = {};
+    Float32 MaxLOD         = {};
+};
+
+constexpr Size DescriptorCount = 1 << 20; // Number of descriptors hashed per benchmark
+
+template <class Function>
+void RunDescriptorWorkload(State& state, Function&& hash)
+{
+    Descriptor descriptor = {};
+    Size       result     = 0;
+
+    for (Size i = 0; i < DescriptorCount; ++i)
+    {
+        // The first and the last members change, nothing can be hoisted out of the loop
+        descriptor.MinFilter = (Uint8)i;
+        descriptor.MaxLOD    = (Float32)i;
+
+        result ^= hash(descriptor);
+    }
+
+    DoNotOptimize(result);
+
+    state.SetItemCount(DescriptorCount);
+}
+
+Size BitCast(Float32 value) noexcept
+{
+    Uint32 bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+} // namespace
+
+AXIS_BENCHMARK(HashBytes_16_Fnv1a)
+{
+    state.SetLabel("before");
+    RunByteWorkload<16>(state, HashBytesFnv1a);
+}
+
+AXIS_BENCHMARK(HashBytes_16)
+{
+    state.SetLabel("after");
+    RunByteWorkload<16>(state, [](const Byte* bytes, Size size) { return Hashing::HashBytes(bytes, size); });
+}
+
+AXIS_BENCHMARK(HashBytes_64_Fnv1a)
+{
+    state.SetLabel("before");
+    RunByteWorkload<64>(state, HashBytesFnv1a);
+}
+
+AXIS_BENCHMARK(HashBytes_64)
+{
+    state.SetLabel("after");
+    RunByteWorkload<64>(state, [](const Byte* bytes, Size size) { return Hashing::HashBytes(bytes, size); });
+}
+
+AXIS_BENCHMARK(HashBytes_4096_Fnv1a)
+{
+    state.SetLabel("before");
+    RunByteWorkload<4096>(state, HashBytesFnv1a);
+}
+
+AXIS_BENCHMARK(HashBytes_4096)
+{
+    state.SetLabel("after");
+    RunByteWorkload<4096>(state, [](const Byte* bytes, Size size) { return Hashing::HashBytes(bytes, size); });
+}
+
+AXIS_BENCHMARK(HashDescriptor_HashCombine)
+{
+    state.SetLabel("before");
+    RunDescriptorWorkload(state, [](const Descriptor& descriptor) {
+        Size hash = 0;
+        hash      = Math::HashCombine(hash, descriptor.MinFilter);
+        hash      = Math::HashCombine(hash, descriptor.MagFilter);
+        hash      = Math::HashCombine(hash, descriptor.AddressMode);
+        hash      = Math::HashCombine(hash, BitCast(descriptor.MipLODBias));
+        hash      = Math::HashCombine(hash, descriptor.Anisotropy);
+        hash      = Math::HashCombine(hash, descriptor.MaxAnisotropy);
+
+        for (const auto& color : descriptor.BorderColor)
+            hash = Math::HashCombine(hash, BitCast(color));
+
+        hash = Math::HashCombine(hash, BitCast(descriptor.MinLOD));
+        hash = Math::HashCombine(hash, BitCast(descriptor.MaxLOD));
+        return hash;
+    });
+}
+
+AXIS_BENCHMARK(HashDescriptor_HashValues)
+{
+    state.SetLabel("after");
+    RunDescriptorWorkload(state, [](const Descriptor& descriptor) {
+        return Hashing::HashValues(descriptor.MinFilter,
+                                   descriptor.MagFilter,
+                                   descriptor.AddressMode,
+                                   descriptor.MipLODBias,
+                                   descriptor.Anisotropy,
+                                   descriptor.MaxAnisotropy,
+                                   descriptor.BorderColor[0],
+                                   descriptor.BorderColor[1],
+                                   descriptor.BorderColor[2],
+                                   descriptor.BorderColor[3],
+                                   descriptor.MinLOD,
+                                   descriptor.MaxLOD);
+    });
+}
@@ -0,0 +1,65 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#include <Axis/System>
+#include <Benchmark.hpp>
+
+using namespace Axis;
+using namespace Axis::System;
+using namespace Axis::Benchmark;
+
+namespace
+{
+
+constexpr Size KeyCount = 1 << 20; // Number of keys built per benchmark
+
+// Builds a render-pass-like lookup key of a few formats and hashes it, the way
+// the caches do on every `SetRenderTarget` call.
+template <class ListType>
+void RunKeyWorkload(Size   formatCount,
+                    State& state)
+{
+    Size result = 0;
+
+    for (Size i = 0; i < KeyCount; ++i)
+    {
+        ListType key = nullptr;
+        key.ReserveFor(formatCount);
+
+        for (Size j = 0; j < formatCount; ++j)
+            key.Append((Uint8)(i + j));
+
+        result ^= Hashing::HashBytes(key.GetData(), key.GetLength());
+    }
+
+    DoNotOptimize(result);
+
+    state.SetItemCount(KeyCount);
+}
+
+} // namespace
+
+AXIS_BENCHMARK(BuildKey_2_List)
+{
+    state.SetLabel("before");
+    RunKeyWorkload<List<Uint8>>(2, state);
+}
+
+AXIS_BENCHMARK(BuildKey_2_InlineList)
+{
+    state.SetLabel("after");
+    RunKeyWorkload<InlineList<Uint8, 4>>(2, state);
+}
+
+AXIS_BENCHMARK(BuildKey_4_List)
+{
+    state.SetLabel("before");
+    RunKeyWorkload<List<Uint8>>(4, state);
+}
+
+AXIS_BENCHMARK(BuildKey_4_InlineList)
+{
+    state.SetLabel("after");
+    RunKeyWorkload<InlineList<Uint8, 4>>(4, state);
+}
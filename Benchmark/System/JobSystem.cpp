@@ -0,0 +1,180 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#include <Axis/System>
+#include <Benchmark.hpp>
+#include <vector>
+
+using namespace Axis;
+using namespace Axis::System;
+using namespace Axis::Benchmark;
+
+namespace
+{
+
+constexpr Uint64 FibonacciNumber = 30; // Fibonacci number to compute, forks ~28000 jobs
+constexpr Uint64 FibonacciCutoff = 16; // Computes serially below this number
+
+constexpr Size ElementCount = 1 << 22; // Number of the elements to sum
+constexpr Size ChunkSize    = 1 << 14; // Number of the elements summed by one job
+
+Uint64 FibonacciSerial(Uint64 n) { return n < 2 ? n : FibonacciSerial(n - 1) + FibonacciSerial(n - 2); }
+
+Uint64 FibonacciParallel(JobSystem& jobSystem,
+                         Uint64     n)
+{
+    if (n < FibonacciCutoff)
+        return FibonacciSerial(n);
+
+    Uint64     first = 0;
+    JobCounter counter;
+
+    jobSystem.Submit([&]() { first = FibonacciParallel(jobSystem, n - 1); }, &counter);
+
+    const Uint64 second = FibonacciParallel(jobSystem, n - 2);
+
+    jobSystem.WaitFor(counter);
+
+    return first + second;
+}
+
+const std::vector<Uint32>& GetElements()
+{
+    static const std::vector<Uint32> elements = []() {
+        std::vector<Uint32> result(ElementCount);
+
+        for (Size i = 0; i < ElementCount; ++i)
+            result[i] = (Uint32)(i * 2654435761u) >> 16;
+
+        return result;
+    }();
+
+    return elements;
+}
+
+Uint64 SumRange(const Uint32* begin,
+                const Uint32* end)
+{
+    Uint64 sum = 0;
+
+    for (; begin != end; ++begin)
+        sum += *begin;
+
+    return sum;
+}
+
+void RunFibonacci(State& state,
+                  Size   workerCount)
+{
+    JobSystem jobSystem(workerCount);
+
+    DoNotOptimize(FibonacciParallel(jobSystem, FibonacciNumber));
+
+    state.SetItemCount(1);
+}
+
+void RunParallelSum(State& state,
+                    Size   workerCount)
+{
+    JobSystem jobSystem(workerCount);
+
+    const auto& elements = GetElements();
+
+    constexpr Size ChunkCount = ElementCount / ChunkSize;
+
+    Uint64     sums[ChunkCount] = {};
+    JobCounter counter;
+
+    for (Size chunk = 0; chunk < ChunkCount; ++chunk)
+    {
+        jobSystem.Submit([&, chunk]() {
+            sums[chunk] = SumRange(elements.data() + chunk * ChunkSize, elements.data() + (chunk + 1) * ChunkSize);
+        },
+                         &counter);
+    }
+
+    jobSystem.WaitFor(counter);
+
+    Uint64 sum = 0;
+
+    for (const Uint64 chunkSum : sums)
+        sum += chunkSum;
+
+    DoNotOptimize(sum);
+
+    state.SetItemCount(ElementCount);
+}
+
+} // namespace
+
+// The speedup of the job system benchmarks is bounded by the cores of the machine, the worker counts
+// above the hardware threads only show the overhead.
+
+AXIS_BENCHMARK(Fibonacci_Serial)
+{
+    state.SetLabel("before");
+
+    DoNotOptimize(FibonacciSerial(FibonacciNumber));
+
+    state.SetItemCount(1);
+}
+
+AXIS_BENCHMARK(Fibonacci_Workers1)
+{
+    state.SetLabel("after");
+    RunFibonacci(state, 1);
+}
+
+AXIS_BENCHMARK(Fibonacci_Workers2)
+{
+    state.SetLabel("after");
+    RunFibonacci(state, 2);
+}
+
+AXIS_BENCHMARK(Fibonacci_Workers4)
+{
+    state.SetLabel("after");
+    RunFibonacci(state, 4);
+}
+
+AXIS_BENCHMARK(Fibonacci_WorkersDefault)
+{
+    state.SetLabel("after");
+    RunFibonacci(state, JobSystem::GetDefaultWorkerCount());
+}
+
+AXIS_BENCHMARK(ParallelSum_Serial)
+{
+    state.SetLabel("before");
+
+    const auto& elements = GetElements();
+
+    DoNotOptimize(SumRange(elements.data(), elements.data() + ElementCount));
+
+    state.SetItemCount(ElementCount);
+}
+
+AXIS_BENCHMARK(ParallelSum_Workers1)
+{
+    state.SetLabel("after");
+    RunParallelSum(state, 1);
+}
+
+AXIS_BENCHMARK(ParallelSum_Workers2)
+{
+    state.SetLabel("after");
+    RunParallelSum(state, 2);
+}
+
+AXIS_BENCHMARK(ParallelSum_Workers4)
+{
+    state.SetLabel("after");
+    RunParallelSum(state, 4);
+}
+
+AXIS_BENCHMARK(ParallelSum_WorkersDefault)
+{
+    state.SetLabel("after");
+    RunParallelSum(state, JobSystem::GetDefaultWorkerCount());
+}
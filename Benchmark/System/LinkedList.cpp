@@ -0,0 +1,77 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#include <Axis/System>
+#include <Benchmark.hpp>
+#include <list>
+
+using namespace Axis;
+using namespace Axis::System;
+using namespace Axis::Benchmark;
+
+namespace
+{
+
+constexpr Size ElementCount = 1 << 14; // Number of elements in the lists
+constexpr Size RoundCount   = 16;      // Number of rounds
+
+template <class ListType>
+void AddBack(ListType& list, Size value)
+{
+    if constexpr (requires { list.EmplaceBack(value); })
+        list.EmplaceBack(value);
+    else
+        list.emplace_back(value);
+}
+
+template <class ListType, class Iterator>
+Iterator Remove(ListType& list, const Iterator& position)
+{
+    if constexpr (requires { list.Remove(position); })
+        return list.Remove(position);
+    else
+        return list.erase(position);
+}
+
+// Appends the elements then removes every other one while iterating, as the pending lists are swept.
+template <class ListType>
+void RunSweepWorkload(State& state)
+{
+    Size sum = 0;
+
+    for (Size round = 0; round < RoundCount; ++round)
+    {
+        ListType list;
+
+        for (Size i = 0; i < ElementCount; ++i)
+            AddBack(list, i);
+
+        for (auto it = list.begin(); it != list.end();)
+        {
+            if (*it & 1)
+                it = Remove(list, it);
+            else
+                ++it;
+        }
+
+        for (const auto& element : list)
+            sum += element;
+    }
+
+    DoNotOptimize(sum);
+
+    state.SetItemCount(RoundCount * ElementCount * 3);
+}
+
+} // namespace
+
+AXIS_BENCHMARK(LinkedList_Sweep)
+{
+    RunSweepWorkload<LinkedList<Size>>(state);
+}
+
+AXIS_BENCHMARK(StdList_Sweep)
+{
+    RunSweepWorkload<std::list<Size>>(state);
+}
@@ -0,0 +1,136 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#include <Axis/System>
+#include <Benchmark.hpp>
+#include <vector>
+
+using namespace Axis;
+using namespace Axis::System;
+using namespace Axis::Benchmark;
+
+namespace
+{
+
+// Same layout as `Axis::Renderer::SpriteBatch::Vertex`
+struct Vertex
+{
+    Vector3F Position          = {};
+    Float32  ColorMask[4]      = {};
+    Vector2F TextureCoordinate = {};
+};
+
+// Wraps the element and opts out of the trivial relocation, so the list grows
+// the way it did before (allocates a new buffer and moves element by element);
+// kept as the "before" baseline.
+template <class T>
+struct ElementWise
+{
+    T Value = {};
+};
+
+// Forwards to `MallocAllocator` but hides its `Reallocate`, so the list has to
+// allocate a new buffer and copy the bytes over.
+struct NoReallocateAllocator
+{
+    static PVoid Allocate(Size size, Size alignment) { return MallocAllocator::Allocate(size, alignment); }
+
+    static void Deallocate(PVoid ptr) noexcept { MallocAllocator::Deallocate(ptr); }
+};
+
+} // namespace
+
+template <class T>
+struct Axis::System::IsTriviallyRelocatable<ElementWise<T>> : std::false_type
+{};
+
+namespace
+{
+
+constexpr Size ElementCount = 1 << 16; // Number of elements appended per round
+constexpr Size RoundCount   = 64;      // Number of rounds
+
+// Appends the elements one by one to an empty list, letting it grow.
+template <class ListType, class T>
+void RunGrowthWorkload(const T& element,
+                       State&   state)
+{
+    for (Size round = 0; round < RoundCount; ++round)
+    {
+        ListType list;
+
+        for (Size i = 0; i < ElementCount; ++i)
+        {
+            if constexpr (requires { list.EmplaceBack(element); })
+                list.EmplaceBack(element);
+            else
+                list.emplace_back(element);
+        }
+
+        DoNotOptimize(list);
+    }
+
+    state.SetItemCount(RoundCount * ElementCount);
+}
+
+} // namespace
+
+AXIS_BENCHMARK(ListGrowth_Uint16_ElementWise)
+{
+    state.SetLabel("before");
+    RunGrowthWorkload<List<ElementWise<Uint16>>>(ElementWise<Uint16>{1}, state);
+}
+
+AXIS_BENCHMARK(ListGrowth_Uint16_NoReallocate)
+{
+    RunGrowthWorkload<List<Uint16, NoReallocateAllocator>>(Uint16(1), state);
+}
+
+AXIS_BENCHMARK(ListGrowth_Uint16_Reallocate)
+{
+    state.SetLabel("after");
+    RunGrowthWorkload<List<Uint16, MallocAllocator>>(Uint16(1), state);
+}
+
+AXIS_BENCHMARK(ListGrowth_Uint16_StdVector)
+{
+    RunGrowthWorkload<std::vector<Uint16>>(Uint16(1), state);
+}
+
+AXIS_BENCHMARK(ListGrowth_Vertex_ElementWise)
+{
+    state.SetLabel("before");
+    RunGrowthWorkload<List<ElementWise<Vertex>>>(ElementWise<Vertex>{}, state);
+}
+
+AXIS_BENCHMARK(ListGrowth_Vertex_NoReallocate)
+{
+    RunGrowthWorkload<List<Vertex, NoReallocateAllocator>>(Vertex{}, state);
+}
+
+AXIS_BENCHMARK(ListGrowth_Vertex_Reallocate)
+{
+    state.SetLabel("after");
+    RunGrowthWorkload<List<Vertex, MallocAllocator>>(Vertex{}, state);
+}
+
+AXIS_BENCHMARK(ListGrowth_Vertex_StdVector)
+{
+    RunGrowthWorkload<std::vector<Vertex>>(Vertex{}, state);
+}
+
+AXIS_BENCHMARK(ListRemoveAt_Vertex)
+{
+    List<Vertex> list(4096);
+
+    for (Size i = 0; i < 4096; ++i)
+    {
+        list.RemoveAt(0);
+        list.EmplaceBack();
+    }
+
+    DoNotOptimize(list);
+
+    state.SetItemCount(4096);
+}
@@ -0,0 +1,243 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#include <Axis/System>
+#include <Benchmark.hpp>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace Axis;
+using namespace Axis::System;
+using namespace Axis::Benchmark;
+
+namespace
+{
+
+constexpr Size MatrixCount = 1 << 10; // Number of matrices, fits in the L1 / L2 caches
+constexpr Size RepeatCount = 256;     // Number of passes over the matrices
+
+// Generates the well-conditioned matrices, the diagonal dominates the other elements.
+const std::vector<FloatMatrix4x4>& GetMatrices()
+{
+    static const std::vector<FloatMatrix4x4> matrices = []() {
+        std::vector<FloatMatrix4x4> result(MatrixCount);
+
+        Uint32 seed = 42;
+
+        for (auto& matrix : result)
+        {
+            for (Size row = 0; row < 4; ++row)
+            {
+                for (Size column = 0; column < 4; ++column)
+                {
+                    seed = seed * 1664525u + 1013904223u;
+
+                    matrix(row, column) = (Float32)(seed >> 8) / (Float32)(1u << 24) * 2.0f - 1.0f;
+                }
+
+                matrix(row, row) += 4.0f;
+            }
+        }
+
+        return result;
+    }();
+
+    return matrices;
+}
+
+const std::vector<Vector3F>& GetVectors()
+{
+    static const std::vector<Vector3F> vectors = []() {
+        std::vector<Vector3F> result;
+
+        for (const auto& matrix : GetMatrices())
+            result.emplace_back(matrix(0, 1), matrix(1, 2), matrix(2, 3));
+
+        return result;
+    }();
+
+    return vectors;
+}
+
+const Float32* GetElements(const FloatMatrix4x4& matrix) { return &matrix(0, 0); }
+
+Float32* GetElements(FloatMatrix4x4& matrix) { return &matrix(0, 0); }
+
+// Aborts the benchmarks if the SIMD kernels disagree with the scalar ones.
+void CheckAgreement()
+{
+    static const Bool s_checked = []() {
+        const auto& matrices = GetMatrices();
+
+        Float32 maxError = 0.0f;
+
+        const auto accumulateError = [&](const FloatMatrix4x4& first, const FloatMatrix4x4& second) {
+            for (Size row = 0; row < 4; ++row)
+            {
+                for (Size column = 0; column < 4; ++column)
+                    maxError = std::max(maxError, std::abs(first(row, column) - second(row, column)));
+            }
+        };
+
+        for (Size i = 0; i < MatrixCount; ++i)
+        {
+            const auto& left  = matrices[i];
+            const auto& right = matrices[(i + 1) % MatrixCount];
+
+            FloatMatrix4x4 expected;
+
+            Detail::MultiplyMatrixScalar<Float32, 4, 4, 4>(GetElements(left), GetElements(right), GetElements(expected));
+            accumulateError(left * right, expected);
+
+            Detail::TransposeMatrixScalar<Float32, 4, 4>(GetElements(left), GetElements(expected));
+            accumulateError(left.GetTransposed(), expected);
+
+            Detail::InverseMatrix4x4Scalar(GetElements(left), GetElements(expected));
+            accumulateError(left.GetInverse(), expected);
+        }
+
+        if (maxError > 1e-5f)
+        {
+            std::fprintf(stderr, "The SIMD matrix kernels disagree with the scalar ones, error: %g\n", (double)maxError);
+            std::abort();
+        }
+
+        return true;
+    }();
+
+    DoNotOptimize(s_checked);
+}
+
+template <class Function>
+void RunMatrixWorkload(State&   state,
+                       Function function)
+{
+    CheckAgreement();
+
+    const auto& matrices = GetMatrices();
+
+    FloatMatrix4x4 result;
+
+    for (Size repeat = 0; repeat < RepeatCount; ++repeat)
+    {
+        for (Size i = 0; i < MatrixCount; ++i)
+        {
+            function(matrices[i], matrices[(i + repeat + 1) % MatrixCount], result);
+            DoNotOptimize(result);
+        }
+    }
+
+    state.SetItemCount(MatrixCount * RepeatCount);
+}
+
+template <class Function>
+void RunVectorWorkload(State&   state,
+                       Function function)
+{
+    const auto& matrices = GetMatrices();
+    const auto& vectors  = GetVectors();
+
+    for (Size repeat = 0; repeat < RepeatCount; ++repeat)
+    {
+        for (Size i = 0; i < MatrixCount; ++i)
+        {
+            Vector3F result = function(matrices[(i + repeat) % MatrixCount], vectors[i]);
+            DoNotOptimize(result);
+        }
+    }
+
+    state.SetItemCount(MatrixCount * RepeatCount);
+}
+
+} // namespace
+
+AXIS_BENCHMARK(MultiplyMatrix4x4_Scalar)
+{
+    state.SetLabel("before");
+    RunMatrixWorkload(state, [](const FloatMatrix4x4& left, const FloatMatrix4x4& right, FloatMatrix4x4& result) {
+        Detail::MultiplyMatrixScalar<Float32, 4, 4, 4>(GetElements(left), GetElements(right), GetElements(result));
+    });
+}
+
+AXIS_BENCHMARK(MultiplyMatrix4x4_Simd)
+{
+    state.SetLabel("after");
+    RunMatrixWorkload(state, [](const FloatMatrix4x4& left, const FloatMatrix4x4& right, FloatMatrix4x4& result) {
+        result = left * right;
+    });
+}
+
+AXIS_BENCHMARK(TransposeMatrix4x4_Scalar)
+{
+    state.SetLabel("before");
+    RunMatrixWorkload(state, [](const FloatMatrix4x4& matrix, const FloatMatrix4x4&, FloatMatrix4x4& result) {
+        Detail::TransposeMatrixScalar<Float32, 4, 4>(GetElements(matrix), GetElements(result));
+    });
+}
+
+AXIS_BENCHMARK(TransposeMatrix4x4_Simd)
+{
+    state.SetLabel("after");
+    RunMatrixWorkload(state, [](const FloatMatrix4x4& matrix, const FloatMatrix4x4&, FloatMatrix4x4& result) {
+        result = matrix.GetTransposed();
+    });
+}
+
+AXIS_BENCHMARK(InverseMatrix4x4_Scalar)
+{
+    state.SetLabel("before");
+    RunMatrixWorkload(state, [](const FloatMatrix4x4& matrix, const FloatMatrix4x4&, FloatMatrix4x4& result) {
+        Detail::InverseMatrix4x4Scalar(GetElements(matrix), GetElements(result));
+    });
+}
+
+AXIS_BENCHMARK(InverseMatrix4x4_Simd)
+{
+    state.SetLabel("after");
+    RunMatrixWorkload(state, [](const FloatMatrix4x4& matrix, const FloatMatrix4x4&, FloatMatrix4x4& result) {
+        result = matrix.GetInverse();
+    });
+}
+
+AXIS_BENCHMARK(TransformPoint_Scalar)
+{
+    state.SetLabel("before");
+    RunVectorWorkload(state, [](const FloatMatrix4x4& matrix, const Vector3F& point) {
+        const Float32 vector[4] = {point.X, point.Y, point.Z, 1.0f};
+        Float32       result[4];
+
+        Detail::TransformVector4Scalar(GetElements(matrix), vector, result);
+
+        return Vector3F(result[0], result[1], result[2]);
+    });
+}
+
+AXIS_BENCHMARK(TransformPoint_Simd)
+{
+    state.SetLabel("after");
+    RunVectorWorkload(state, [](const FloatMatrix4x4& matrix, const Vector3F& point) {
+        return matrix.TransformPoint(point);
+    });
+}
+
+// Normalizes through the `BigFloat` magnitude, as `Normalize` did before.
+AXIS_BENCHMARK(NormalizeVector3_BigFloat)
+{
+    state.SetLabel("before");
+    RunVectorWorkload(state, [](const FloatMatrix4x4&, const Vector3F& vector) {
+        Float32 magnitude = (Float32)vector.GetMagnitude();
+
+        return Vector3F(vector.X / magnitude, vector.Y / magnitude, vector.Z / magnitude);
+    });
+}
+
+AXIS_BENCHMARK(NormalizeVector3_Simd)
+{
+    state.SetLabel("after");
+    RunVectorWorkload(state, [](const FloatMatrix4x4&, const Vector3F& vector) {
+        return vector.NormalizeCopy();
+    });
+}
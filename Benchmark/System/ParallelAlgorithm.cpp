@@ -0,0 +1,292 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#include <Axis/System>
+#include <Benchmark.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace Axis;
+using namespace Axis::System;
+using namespace Axis::Benchmark;
+
+namespace
+{
+
+constexpr Size SpriteCount    = 1 << 17; // Number of the sprites to sort
+constexpr Size ComponentCount = 1 << 20; // Number of the components to update
+constexpr Size GrainSize      = 4096;    // Minimum number of the elements per job
+
+struct Sprite
+{
+    Uint32  Texture = 0;
+    Float32 Depth   = 0.0f;
+    Uint64  Handle  = 0;
+};
+
+// Batches the sprites by the texture, then draws them back to front.
+struct SpriteOrder
+{
+    Bool operator()(const Sprite& left,
+                    const Sprite& right) const noexcept
+    {
+        return left.Texture != right.Texture ? left.Texture < right.Texture : left.Depth > right.Depth;
+    }
+};
+
+struct Particle
+{
+    Float32 Position[3] = {};
+    Float32 Velocity[3] = {};
+};
+
+const List<Sprite>& GetSprites()
+{
+    static const List<Sprite> sprites = []() {
+        List<Sprite> result(SpriteCount);
+        FastRandom   random(1);
+
+        for (Size i = 0; i < SpriteCount; ++i)
+            result[i] = {random.NextUint32() % 64, random.NextFloat(), i};
+
+        return result;
+    }();
+
+    return sprites;
+}
+
+const List<Particle>& GetParticles()
+{
+    static const List<Particle> particles = []() {
+        List<Particle> result(ComponentCount);
+        FastRandom     random(2);
+
+        for (auto& particle : result)
+        {
+            random.FillFloats(particle.Position, 3, -100.0f, 100.0f);
+            random.FillFloats(particle.Velocity, 3, -1.0f, 1.0f);
+        }
+
+        return result;
+    }();
+
+    return particles;
+}
+
+// One job system per worker count, the worker threads are reused across the runs.
+JobSystem& GetJobSystem(Size workerCount)
+{
+    static JobSystem jobSystems[] = {JobSystem(1), JobSystem(2), JobSystem(4), JobSystem(8), JobSystem(16)};
+
+    for (auto& jobSystem : jobSystems)
+    {
+        if (jobSystem.GetWorkerCount() == workerCount)
+            return jobSystem;
+    }
+
+    std::abort();
+}
+
+void UpdateParticle(Particle& particle) noexcept
+{
+    constexpr Float32 DeltaTime = 1.0f / 60.0f;
+    constexpr Float32 Gravity   = -9.8f;
+
+    particle.Velocity[1] += Gravity * DeltaTime;
+
+    for (Size axis = 0; axis < 3; ++axis)
+        particle.Position[axis] += particle.Velocity[axis] * DeltaTime;
+}
+
+void RunSortSprites(State& state,
+                    Size   workerCount)
+{
+    static List<Sprite> sprites;
+
+    sprites = GetSprites();
+
+    ParallelSort(GetJobSystem(workerCount), sprites, SpriteOrder());
+
+    // Checks the first run only, so the check doesn't count in the timing.
+    static Bool checked = false;
+
+    if (!checked && !std::is_sorted(sprites.begin(), sprites.end(), SpriteOrder()))
+    {
+        std::fprintf(stderr, "ParallelSort didn't sort the sprites!\n");
+        std::abort();
+    }
+
+    checked = true;
+
+    state.SetItemCount(SpriteCount);
+}
+
+void RunUpdateParticles(State& state,
+                        Size   workerCount)
+{
+    static List<Particle> particles = GetParticles();
+
+    ParallelFor(GetJobSystem(workerCount), particles, GrainSize, [](Particle& particle) { UpdateParticle(particle); });
+
+    DoNotOptimize(particles.GetData());
+
+    state.SetItemCount(ComponentCount);
+}
+
+void RunPrefixSum(State& state,
+                  Size   workerCount)
+{
+    static List<Uint32> offsets(ComponentCount);
+
+    const List<Particle>& particles = GetParticles();
+
+    // Counts the particles in the upper half, e.g. the offsets of the visible ones.
+    List<Uint32> visible(ComponentCount);
+
+    ParallelTransform(GetJobSystem(workerCount), Span<Particle>(particles), visible.GetData(), GrainSize, [](const Particle& particle) { return (Uint32)(particle.Position[1] > 0.0f); });
+    ParallelScan(GetJobSystem(workerCount), Span<Uint32>(visible), offsets.GetData(), GrainSize, 0u, std::plus<>());
+
+    DoNotOptimize(offsets[ComponentCount - 1]);
+
+    state.SetItemCount(ComponentCount);
+}
+
+} // namespace
+
+// The sprites are copied before every sort, both sides pay the copy. The speedup is bounded by the
+// cores of the machine, the worker counts above the hardware threads only show the overhead.
+
+AXIS_BENCHMARK(SortSprites_StdSort)
+{
+    state.SetLabel("before");
+
+    static List<Sprite> sprites;
+
+    sprites = GetSprites();
+
+    std::sort(sprites.begin(), sprites.end(), SpriteOrder());
+
+    DoNotOptimize(sprites.GetData());
+
+    state.SetItemCount(SpriteCount);
+}
+
+AXIS_BENCHMARK(SortSprites_Workers1)
+{
+    state.SetLabel("after");
+    RunSortSprites(state, 1);
+}
+
+AXIS_BENCHMARK(SortSprites_Workers2)
+{
+    state.SetLabel("after");
+    RunSortSprites(state, 2);
+}
+
+AXIS_BENCHMARK(SortSprites_Workers4)
+{
+    state.SetLabel("after");
+    RunSortSprites(state, 4);
+}
+
+AXIS_BENCHMARK(SortSprites_Workers8)
+{
+    state.SetLabel("after");
+    RunSortSprites(state, 8);
+}
+
+AXIS_BENCHMARK(SortSprites_Workers16)
+{
+    state.SetLabel("after");
+    RunSortSprites(state, 16);
+}
+
+AXIS_BENCHMARK(UpdateParticles_Serial)
+{
+    state.SetLabel("before");
+
+    static List<Particle> particles = GetParticles();
+
+    for (auto& particle : particles)
+        UpdateParticle(particle);
+
+    DoNotOptimize(particles.GetData());
+
+    state.SetItemCount(ComponentCount);
+}
+
+AXIS_BENCHMARK(UpdateParticles_Workers1)
+{
+    state.SetLabel("after");
+    RunUpdateParticles(state, 1);
+}
+
+AXIS_BENCHMARK(UpdateParticles_Workers2)
+{
+    state.SetLabel("after");
+    RunUpdateParticles(state, 2);
+}
+
+AXIS_BENCHMARK(UpdateParticles_Workers4)
+{
+    state.SetLabel("after");
+    RunUpdateParticles(state, 4);
+}
+
+AXIS_BENCHMARK(UpdateParticles_Workers8)
+{
+    state.SetLabel("after");
+    RunUpdateParticles(state, 8);
+}
+
+AXIS_BENCHMARK(UpdateParticles_Workers16)
+{
+    state.SetLabel("after");
+    RunUpdateParticles(state, 16);
+}
+
+AXIS_BENCHMARK(PrefixSum_Serial)
+{
+    state.SetLabel("before");
+
+    static List<Uint32> offsets(ComponentCount);
+
+    const List<Particle>& particles = GetParticles();
+
+    List<Uint32> visible(ComponentCount);
+
+    for (Size i = 0; i < ComponentCount; ++i)
+        visible[i] = (Uint32)(particles[i].Position[1] > 0.0f);
+
+    Uint32 running = 0;
+
+    for (Size i = 0; i < ComponentCount; ++i)
+    {
+        running += visible[i];
+        offsets[i] = running;
+    }
+
+    DoNotOptimize(offsets[ComponentCount - 1]);
+
+    state.SetItemCount(ComponentCount);
+}
+
+AXIS_BENCHMARK(PrefixSum_Workers1)
+{
+    state.SetLabel("after");
+    RunPrefixSum(state, 1);
+}
+
+AXIS_BENCHMARK(PrefixSum_Workers4)
+{
+    state.SetLabel("after");
+    RunPrefixSum(state, 4);
+}
+
+AXIS_BENCHMARK(PrefixSum_Workers16)
+{
+    state.SetLabel("after");
+    RunPrefixSum(state, 16);
+}
@@ -0,0 +1,174 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#include <Axis/System>
+#include <Benchmark.hpp>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace Axis;
+using namespace Axis::System;
+using namespace Axis::Benchmark;
+
+namespace
+{
+
+// Reproduction of the former `PoolAllocator` which served every request from the
+// shared pools under a single global lock; kept as the "before" baseline.
+struct GlobalLockPoolAllocator
+{
+    struct BlockHeader
+    {
+        BlockHeader*  Next            = nullptr;
+        PVoid         OriginalPointer = nullptr;
+        BlockHeader** Pool            = nullptr;
+    };
+
+    struct Key
+    {
+        Size MemorySize;
+        Size Alignment;
+
+        bool operator==(const Key& other) const noexcept { return MemorySize == other.MemorySize && Alignment == other.Alignment; }
+    };
+
+    struct KeyHash
+    {
+        Size operator()(const Key& key) const noexcept { return key.MemorySize ^ key.Alignment; }
+    };
+
+    static PVoid Allocate(Size size,
+                          Size alignment)
+    {
+        Size actualSize = Math::RoundToNextPowerOfTwo(size + sizeof(BlockHeader) + alignment - 1);
+
+        std::lock_guard<std::mutex> lock(s_mutex);
+
+        auto& freeList = s_pools[{actualSize, alignment}];
+
+        if (freeList)
+        {
+            auto block = (BlockHeader*)freeList;
+            freeList   = block->Next;
+            return (PVoid)(block + 1);
+        }
+
+        PVoid originalMemory = std::malloc(actualSize);
+        auto  aligned        = (BlockHeader*)(((Size)originalMemory + sizeof(BlockHeader) + alignment - 1) & ~(alignment - 1));
+
+        aligned[-1].OriginalPointer = originalMemory;
+        aligned[-1].Pool            = &freeList;
+
+        return (PVoid)aligned;
+    }
+
+    static void Deallocate(PVoid ptr) noexcept
+    {
+        auto block = (BlockHeader*)ptr - 1;
+
+        std::lock_guard<std::mutex> lock(s_mutex);
+
+        block->Next  = *block->Pool;
+        *block->Pool = block;
+    }
+
+    static std::unordered_map<Key, BlockHeader*, KeyHash> s_pools;
+    static std::mutex                                     s_mutex;
+};
+
+std::unordered_map<GlobalLockPoolAllocator::Key, GlobalLockPoolAllocator::BlockHeader*, GlobalLockPoolAllocator::KeyHash> GlobalLockPoolAllocator::s_pools = {};
+std::mutex                                                                                                             GlobalLockPoolAllocator::s_mutex = {};
+
+constexpr Size RoundCount       = 2000; // Number of allocate / deallocate rounds per thread
+constexpr Size AllocationsCount = 64;   // Number of live allocations per round
+
+// Sizes typical for the container nodes and small objects
+constexpr Size AllocationSizes[] = {16, 24, 32, 48, 64, 96, 128, 256};
+
+// Every thread repeatedly allocates a batch of mixed-size blocks and frees it.
+template <class Allocator>
+void RunAllocationWorkload(Size   threadCount,
+                           State& state)
+{
+    std::vector<std::thread> threads;
+
+    for (Size i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back([]() {
+            PVoid allocations[AllocationsCount] = {};
+
+            for (Size round = 0; round < RoundCount; ++round)
+            {
+                for (Size j = 0; j < AllocationsCount; ++j)
+                    allocations[j] = Allocator::Allocate(AllocationSizes[(round + j) % std::size(AllocationSizes)], alignof(std::max_align_t));
+
+                DoNotOptimize(allocations);
+
+                for (Size j = 0; j < AllocationsCount; ++j)
+                    Allocator::Deallocate(allocations[j]);
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    state.SetItemCount(threadCount * RoundCount * AllocationsCount);
+}
+
+} // namespace
+
+AXIS_BENCHMARK(GlobalLockPoolAllocator_1Thread)
+{
+    state.SetLabel("before");
+    RunAllocationWorkload<GlobalLockPoolAllocator>(1, state);
+}
+
+AXIS_BENCHMARK(GlobalLockPoolAllocator_4Threads)
+{
+    state.SetLabel("before");
+    RunAllocationWorkload<GlobalLockPoolAllocator>(4, state);
+}
+
+AXIS_BENCHMARK(GlobalLockPoolAllocator_16Threads)
+{
+    state.SetLabel("before");
+    RunAllocationWorkload<GlobalLockPoolAllocator>(16, state);
+}
+
+AXIS_BENCHMARK(PoolAllocator_1Thread)
+{
+    state.SetLabel("after");
+    RunAllocationWorkload<PoolAllocator>(1, state);
+}
+
+AXIS_BENCHMARK(PoolAllocator_4Threads)
+{
+    state.SetLabel("after");
+    RunAllocationWorkload<PoolAllocator>(4, state);
+}
+
+AXIS_BENCHMARK(PoolAllocator_16Threads)
+{
+    state.SetLabel("after");
+    RunAllocationWorkload<PoolAllocator>(16, state);
+}
+
+AXIS_BENCHMARK(MallocAllocator_1Thread)
+{
+    RunAllocationWorkload<MallocAllocator>(1, state);
+}
+
+AXIS_BENCHMARK(MallocAllocator_4Threads)
+{
+    RunAllocationWorkload<MallocAllocator>(4, state);
+}
+
+AXIS_BENCHMARK(MallocAllocator_16Threads)
+{
+    RunAllocationWorkload<MallocAllocator>(16, state);
+}
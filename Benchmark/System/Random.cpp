@@ -0,0 +1,123 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#include <Axis/System>
+#include <Benchmark.hpp>
+#include <vector>
+
+using namespace Axis;
+using namespace Axis::System;
+using namespace Axis::Benchmark;
+
+namespace
+{
+
+constexpr Size ValueCount  = 1 << 14; // Number of the values per pass, as a particle emitter refills
+constexpr Size RepeatCount = 256;     // Number of passes
+
+} // namespace
+
+AXIS_BENCHMARK(RandomFloats_Random)
+{
+    state.SetLabel("before");
+
+    Random               random(42);
+    std::vector<Float32> values(ValueCount);
+
+    for (Size repeat = 0; repeat < RepeatCount; ++repeat)
+    {
+        for (auto& value : values)
+            value = (Float32)random.NextDouble();
+
+        DoNotOptimize(values.data());
+    }
+
+    state.SetItemCount(ValueCount * RepeatCount);
+}
+
+AXIS_BENCHMARK(RandomFloats_FastRandom)
+{
+    state.SetLabel("after");
+
+    FastRandom           random(42);
+    std::vector<Float32> values(ValueCount);
+
+    for (Size repeat = 0; repeat < RepeatCount; ++repeat)
+    {
+        for (auto& value : values)
+            value = random.NextFloat();
+
+        DoNotOptimize(values.data());
+    }
+
+    state.SetItemCount(ValueCount * RepeatCount);
+}
+
+AXIS_BENCHMARK(RandomFloats_FillFloats)
+{
+    state.SetLabel("after");
+
+    FastRandom           random(42);
+    std::vector<Float32> values(ValueCount);
+
+    for (Size repeat = 0; repeat < RepeatCount; ++repeat)
+    {
+        random.FillFloats(values.data(), ValueCount);
+        DoNotOptimize(values.data());
+    }
+
+    state.SetItemCount(ValueCount * RepeatCount);
+}
+
+AXIS_BENCHMARK(RandomRange_Random)
+{
+    state.SetLabel("before");
+
+    Random             random(42);
+    std::vector<Int32> values(ValueCount);
+
+    for (Size repeat = 0; repeat < RepeatCount; ++repeat)
+    {
+        for (auto& value : values)
+            value = random.Next(-100, 100);
+
+        DoNotOptimize(values.data());
+    }
+
+    state.SetItemCount(ValueCount * RepeatCount);
+}
+
+AXIS_BENCHMARK(RandomRange_FastRandom)
+{
+    state.SetLabel("after");
+
+    FastRandom         random(42);
+    std::vector<Int32> values(ValueCount);
+
+    for (Size repeat = 0; repeat < RepeatCount; ++repeat)
+    {
+        for (auto& value : values)
+            value = random.Next(-100, 100);
+
+        DoNotOptimize(values.data());
+    }
+
+    state.SetItemCount(ValueCount * RepeatCount);
+}
+
+AXIS_BENCHMARK(RandomRange_FillRange)
+{
+    state.SetLabel("after");
+
+    FastRandom         random(42);
+    std::vector<Int32> values(ValueCount);
+
+    for (Size repeat = 0; repeat < RepeatCount; ++repeat)
+    {
+        random.FillRange(values.data(), ValueCount, -100, 100);
+        DoNotOptimize(values.data());
+    }
+
+    state.SetItemCount(ValueCount * RepeatCount);
+}
@@ -0,0 +1,170 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#include <Axis/System>
+#include <Benchmark.hpp>
+#include <memory>
+
+using namespace Axis;
+using namespace Axis::System;
+using namespace Axis::Benchmark;
+
+namespace
+{
+
+// Stand-ins of the graphics interfaces and their backend implementations.
+struct IResource : public ISharedFromThis
+{
+    Uint64 State = 0;
+};
+
+struct Resource final : public IResource
+{};
+
+constexpr Size FlushCount         = 1 << 18; // Number of simulated `SpriteBatch::Flush` calls
+constexpr Size FlushCountPerFrame = 64;      // Number of flushes recorded into one command buffer
+constexpr Size ObjectCount        = 1 << 16; // Number of objects created by the ownership workload
+constexpr Size CopyCount          = 8;       // Number of owners sharing every object
+
+// The way the resources were tracked by the command buffer before, every call converts
+// to `SharedPointer<void>` and inserts it into the set.
+struct SharedPointerHasher
+{
+    Size operator()(const SharedPointer<void>& pointer) const noexcept { return Hash<PVoid>()(pointer.GetPointer()); }
+};
+
+struct CommandBufferBefore
+{
+    void AddResourceStrongReference(const SharedPointer<void>& reference) { References.Insert(reference); }
+
+    void TransitState(const SharedPointer<IResource>& resource)
+    {
+        AddResourceStrongReference(resource);
+        resource->State++;
+    }
+
+    void Bind(const Span<SharedPointer<IResource>>& resources)
+    {
+        for (const auto& resource : resources)
+            Bindings[resource->State & 3] = SharedPointer<IResource>(resource);
+    }
+
+    HashSet<SharedPointer<void>, SharedPointerHasher> References = {};
+    SharedPointer<IResource>                          Bindings[4] = {};
+};
+
+// Borrows the resources and only acquires the reference when the resource is tracked the first time.
+struct CommandBufferAfter
+{
+    void AddResourceStrongReference(SharedRef<void> reference)
+    {
+        if (References.Find(reference.GetPointer()) == References.end())
+            References.Insert({reference.GetPointer(), (SharedPointer<void>)reference});
+    }
+
+    void TransitState(SharedRef<IResource> resource)
+    {
+        AddResourceStrongReference(resource);
+        resource->State++;
+    }
+
+    void Bind(const Span<SharedRef<IResource>>& resources)
+    {
+        for (const auto& resource : resources)
+            Bindings[resource->State & 3] = (SharedPointer<IResource>)resource;
+    }
+
+    FlatHashMap<PVoid, SharedPointer<void>> References  = {};
+    SharedPointer<IResource>                Bindings[4] = {};
+};
+
+// Binds the sampler, the texture and the vertex buffer then transits their states, as
+// `SpriteBatch::Flush` does, the command buffer is reset every `FlushCountPerFrame` flushes.
+template <class CommandBuffer, template <class> class Reference>
+void RunFlushWorkload(State& state)
+{
+    SharedPointer<Resource> sampler      = MakeShared<Resource>();
+    SharedPointer<Resource> textureView  = MakeShared<Resource>();
+    SharedPointer<Resource> vertexBuffer = MakeShared<Resource>();
+
+    CommandBuffer commandBuffer;
+
+    for (Size i = 0; i < FlushCount; ++i)
+    {
+        Reference<IResource> samplers[]      = {sampler};
+        Reference<IResource> textureViews[]  = {textureView};
+        Reference<IResource> vertexBuffers[] = {vertexBuffer};
+
+        commandBuffer.Bind(samplers);
+        commandBuffer.Bind(textureViews);
+        commandBuffer.Bind(vertexBuffers);
+
+        commandBuffer.TransitState(textureView);
+        commandBuffer.TransitState(vertexBuffer);
+
+        if ((i + 1) % FlushCountPerFrame == 0)
+            commandBuffer.References.Clear();
+    }
+
+    DoNotOptimize(vertexBuffer->State);
+
+    state.SetItemCount(FlushCount);
+}
+
+// Resource without the intrusive reference count, ownable by both pointers.
+struct PlainResource
+{
+    Uint64 State = 0;
+};
+
+// Creates the objects and hands them to a few owners, as the resources are shared between the
+// command buffers and the caches, then releases them all.
+template <class Pointer, class Factory>
+void RunOwnershipWorkload(Factory factory,
+                          State&  state)
+{
+    Uint64 total = 0;
+
+    for (Size i = 0; i < ObjectCount; ++i)
+    {
+        Pointer object = factory();
+        Pointer owners[CopyCount];
+
+        for (auto& owner : owners)
+            owner = object;
+
+        for (const auto& owner : owners)
+            total += owner->State;
+
+        DoNotOptimize(owners);
+    }
+
+    DoNotOptimize(total);
+
+    state.SetItemCount(ObjectCount * (CopyCount + 1));
+}
+
+} // namespace
+
+AXIS_BENCHMARK(SpriteBatchFlush_SharedPointer)
+{
+    state.SetLabel("before");
+    RunFlushWorkload<CommandBufferBefore, SharedPointer>(state);
+}
+
+AXIS_BENCHMARK(SpriteBatchFlush_SharedRef)
+{
+    state.SetLabel("after");
+    RunFlushWorkload<CommandBufferAfter, SharedRef>(state);
+}
+
+AXIS_BENCHMARK(SharedOwnership_SharedPointer)
+{
+    RunOwnershipWorkload<SharedPointer<PlainResource>>([]() { return MakeShared<PlainResource>(); }, state);
+}
+
+AXIS_BENCHMARK(SharedOwnership_StdSharedPtr)
+{
+    RunOwnershipWorkload<std::shared_ptr<PlainResource>>([]() { return std::make_shared<PlainResource>(); }, state);
+}
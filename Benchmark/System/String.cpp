@@ -0,0 +1,167 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#include <Axis/System>
+#include <Benchmark.hpp>
+#include <string>
+#include <vector>
+
+using namespace Axis;
+using namespace Axis::System;
+using namespace Axis::Benchmark;
+
+namespace
+{
+
+constexpr Size NameCount      = 1 << 10; // Number of distinct names
+constexpr Size OperationCount = 1 << 18; // Number of strings constructed / copied
+constexpr Size TextRepeat     = 256;     // Number of times the paragraph is repeated in the transcoded text
+
+// Names of 8 to 22 characters, like the asset names, the window titles and the labels.
+template <CharType T>
+const std::vector<std::basic_string<T>>& GetNames()
+{
+    static const std::vector<std::basic_string<T>> names = []() {
+        std::vector<std::basic_string<T>> result;
+
+        for (Size i = 0; i < NameCount; ++i)
+        {
+            std::basic_string<T> name;
+
+            for (const char character : "Sprite_")
+                name += (T)character;
+
+            name.pop_back();
+
+            for (Size j = 0; j < 1 + i % 15; ++j)
+                name += (T)('a' + (i + j) % 26);
+
+            result.push_back(name);
+        }
+
+        return result;
+    }();
+
+    return names;
+}
+
+template <CharType T, class StringType = String<T>>
+void RunConstructWorkload(State& state)
+{
+    const auto& names = GetNames<T>();
+
+    Size length = 0;
+
+    for (Size i = 0; i < OperationCount; ++i)
+    {
+        StringType name = names[i % NameCount].c_str();
+        StringType copy = name;
+
+        if constexpr (requires { copy.GetLength(); })
+            length += copy.GetLength();
+        else
+            length += copy.size();
+        DoNotOptimize(copy);
+    }
+
+    DoNotOptimize(length);
+
+    state.SetItemCount(OperationCount);
+}
+
+// Mostly ASCII text with some accented characters, like the UI strings.
+const std::vector<char8_t>& GetText()
+{
+    static const std::vector<char8_t> text = []() {
+        const char8_t paragraph[] = u8"Press the Start button to continue, the progress is saved at the café checkpoint. ";
+
+        std::vector<char8_t> result;
+
+        for (Size i = 0; i < TextRepeat; ++i)
+            result.insert(result.end(), paragraph, paragraph + sizeof(paragraph) - 1);
+
+        return result;
+    }();
+
+    return text;
+}
+
+// Decodes and encodes one code point at a time.
+template <CharType To, CharType From>
+Size TranscodeScalar(const From* source,
+                     Size        length,
+                     To*         destination) noexcept
+{
+    const From* end    = source + length;
+    To*         output = destination;
+
+    while (source != end)
+        output += Unicode::Encode(Unicode::DecodeNext(source, end), output);
+
+    return (Size)(output - destination);
+}
+
+template <Bool Simd>
+void RunTranscodeWorkload(State& state)
+{
+    const auto& text = GetText();
+
+    std::vector<WChar>   wide(text.size());
+    std::vector<char8_t> narrow(text.size());
+
+    Size length = 0;
+
+    for (Size i = 0; i < 64; ++i)
+    {
+        Size wideLength = 0;
+
+        if constexpr (Simd)
+        {
+            wideLength = Unicode::Transcode(text.data(), text.size(), wide.data());
+            length += Unicode::Transcode(wide.data(), wideLength, narrow.data());
+        }
+        else
+        {
+            wideLength = TranscodeScalar(text.data(), text.size(), wide.data());
+            length += TranscodeScalar(wide.data(), wideLength, narrow.data());
+        }
+
+        DoNotOptimize(narrow.data());
+    }
+
+    DoNotOptimize(length);
+
+    state.SetItemCount(text.size() * 64 * 2);
+}
+
+} // namespace
+
+AXIS_BENCHMARK(ConstructName_WString)
+{
+    state.SetLabel("before");
+    RunConstructWorkload<WChar>(state);
+}
+
+AXIS_BENCHMARK(ConstructName_String8)
+{
+    state.SetLabel("after");
+    RunConstructWorkload<Char>(state);
+}
+
+AXIS_BENCHMARK(ConstructName_StdString)
+{
+    RunConstructWorkload<Char, std::string>(state);
+}
+
+AXIS_BENCHMARK(TranscodeText_Scalar)
+{
+    state.SetLabel("before");
+    RunTranscodeWorkload<false>(state);
+}
+
+AXIS_BENCHMARK(TranscodeText_Simd)
+{
+    state.SetLabel("after");
+    RunTranscodeWorkload<true>(state);
+}
@@ -0,0 +1,161 @@
+/// \copyright Simmypeet - Copyright (C)
+///            This file is subject to the terms and conditions defined in
+///            file 'LICENSE', which is part of this source code package.
+
+#include <Axis/System>
+#include <Benchmark.hpp>
+#include <string>
+#include <vector>
+
+using namespace Axis;
+using namespace Axis::System;
+using namespace Axis::Benchmark;
+
+namespace
+{
+
+constexpr Size AssetCount  = 1 << 12; // Number of assets in the cache
+constexpr Size LookupCount = 1 << 20; // Number of lookups per benchmark
+
+// Paths shaped like the ones of the textures and the fonts loaded by the renderer.
+const std::vector<WString>& GetAssetPaths()
+{
+    static const std::vector<WString> paths = []() {
+        std::vector<WString> result;
+
+        for (Size i = 0; i < AssetCount; ++i)
+        {
+            std::wstring path = L"Content/Textures/Environment/Tile_" + std::to_wstring(i) + L".png";
+            result.emplace_back(path.c_str());
+        }
+
+        return result;
+    }();
+
+    return paths;
+}
+
+const std::vector<WStringId>& GetAssetIds()
+{
+    static const std::vector<WStringId> ids = []() {
+        std::vector<WStringId> result;
+
+        for (const auto& path : GetAssetPaths())
+            result.emplace_back(path);
+
+        return result;
+    }();
+
+    return ids;
+}
+
+// The asset cache keyed by the paths, as the assets are looked up before.
+void RunPathLookupWorkload(State& state)
+{
+    const auto& paths = GetAssetPaths();
+
+    FlatHashMap<WString, Size> cache;
+
+    for (Size i = 0; i < AssetCount; ++i)
+        cache.Insert({paths[i], i});
+
+    Size sum = 0;
+
+    for (Size i = 0; i < LookupCount; ++i)
+        sum += cache.Find(paths[(i * 7919) % AssetCount])->Second;
+
+    DoNotOptimize(sum);
+
+    state.SetItemCount(LookupCount);
+}
+
+// The asset cache keyed by the ids, the callers hold the ids of the assets they use.
+void RunIdLookupWorkload(State& state)
+{
+    const auto& ids = GetAssetIds();
+
+    FlatHashMap<WStringId, Size> cache;
+
+    for (Size i = 0; i < AssetCount; ++i)
+        cache.Insert({ids[i], i});
+
+    Size sum = 0;
+
+    for (Size i = 0; i < LookupCount; ++i)
+        sum += cache.Find(ids[(i * 7919) % AssetCount])->Second;
+
+    DoNotOptimize(sum);
+
+    state.SetItemCount(LookupCount);
+}
+
+// Interns the path before every lookup, the cost of the callers which only have the path.
+void RunInternLookupWorkload(State& state)
+{
+    const auto& paths = GetAssetPaths();
+    const auto& ids   = GetAssetIds();
+
+    FlatHashMap<WStringId, Size> cache;
+
+    for (Size i = 0; i < AssetCount; ++i)
+        cache.Insert({ids[i], i});
+
+    Size sum = 0;
+
+    for (Size i = 0; i < LookupCount; ++i)
+        sum += cache.Find(WStringId(paths[(i * 7919) % AssetCount]))->Second;
+
+    DoNotOptimize(sum);
+
+    state.SetItemCount(LookupCount);
+}
+
+// Compares the neighbouring names, as the sort and the deduplication of the assets do.
+template <class T>
+void RunCompareWorkload(const std::vector<T>& names,
+                        State&                state)
+{
+    Size equalCount = 0;
+
+    for (Size i = 0; i < LookupCount; ++i)
+    {
+        const Size index = (i * 7919) % AssetCount;
+        equalCount += names[index] == names[(index + (i & 1)) % AssetCount];
+    }
+
+    DoNotOptimize(equalCount);
+
+    state.SetItemCount(LookupCount);
+}
+
+} // namespace
+
+AXIS_BENCHMARK(AssetLookup_Path)
+{
+    state.SetLabel("before");
+    RunPathLookupWorkload(state);
+}
+
+AXIS_BENCHMARK(AssetLookup_StringId)
+{
+    state.SetLabel("after");
+    RunIdLookupWorkload(state);
+}
+
+AXIS_BENCHMARK(AssetLookup_InternAndStringId)
+{
+    state.SetLabel("after");
+    RunInternLookupWorkload(state);
+}
+
+AXIS_BENCHMARK(CompareNames_Path)
+{
+    state.SetLabel("before");
+    RunCompareWorkload(GetAssetPaths(), state);
+}
+
+AXIS_BENCHMARK(CompareNames_StringId)
+{
+    state.SetLabel("after");
+    RunCompareWorkload(GetAssetIds(), state);
+}
@@ -130,6 +130,42 @@ macro(axis_add_test target)
 
 endmacro(axis_add_test)
 
+# Adds new axis benchmark target
+macro(axis_add_benchmark target)
+    # parse the arguments
+    cmake_parse_arguments(THIS "" "RELATIVE_PATH;FOLDER;" "SOURCES;TARGETS_TO_LINK;INCLUDE_DIRECTORIES;" ${ARGN})
+
+    # Adds executable
+    add_executable(${target} ${THIS_SOURCES})
+
+    # Target folder
+    set_target_properties(${target} PROPERTIES FOLDER ${THIS_FOLDER})
+
+    # Uses C++20 standard
+    set_target_properties(${target} PROPERTIES CXX_STANDARD 20)
+
+    # C++20 standard is required
+    set_target_properties(${target} PROPERTIES CXX_STANDARD_REQUIRED TRUE)
+
+    # Adds source files to the source group
+    axis_assign_source_group("${THIS_SOURCES}" "${THIS_RELATIVE_PATH}")
+
+    # Links to the benchmark executable
+    target_link_libraries(${target} PRIVATE ${THIS_TARGETS_TO_LINK})
+
+    # Adds include directories
+    target_include_directories(${target} PRIVATE ${THIS_INCLUDE_DIRECTORIES})
+
+    # Copies shared library binary to the benchmark executable folder
+    foreach(TARGET_TO_LINK ${THIS_TARGETS_TO_LINK})
+        add_custom_command(TARGET ${target} POST_BUILD
+                           COMMAND ${CMAKE_COMMAND} -E copy_directory
+                           $<TARGET_FILE_DIR:${TARGET_TO_LINK}>
+                           $<TARGET_FILE_DIR:${target}>)
+    endforeach()
+
+endmacro(axis_add_benchmark)
+
 # Links shared library to the executable and also adds a custom command to copy the shared library to the executable folder
 macro(axis_add_example target)
 # parse the arguments
@@ -176,7 +176,7 @@ int main()
             GetImmediateGraphicsContext()->BindPipeline(_graphicsPipeline);
 
             // Binds the vertex buffer.
-            SharedPointer<IBuffer> vertexBuffers[] = {_vertexBuffer};
+            SharedRef<IBuffer> vertexBuffers[] = {_vertexBuffer};
             GetImmediateGraphicsContext()->BindVertexBuffers(0,             // Starts at vertex binding 0
                                                              vertexBuffers, // Only one vertex buffer is bound.
                                                              nullptr);      // No offsets
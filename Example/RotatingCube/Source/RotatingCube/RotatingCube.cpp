@@ -196,7 +196,7 @@ int main(int argc, char** argv)
 
             _uniformBuffer = GetGraphicsDevice()->CreateBuffer(uniformBufferDescription, nullptr);
 
-            SharedPointer<IBuffer> uniformBuffers[] = {_uniformBuffer};
+            SharedRef<IBuffer> uniformBuffers[] = {_uniformBuffer};
 
             // Binds our uniform buffer to the resource heap at binding index 0.
             _resourceHeap->BindBuffers(0,
@@ -257,7 +257,7 @@ int main(int argc, char** argv)
             // Binds the resource heap
             GetImmediateGraphicsContext()->BindResourceHeap(_resourceHeap);
 
-            SharedPointer<IBuffer> vertexBuffers[] = {_vertexBuffer};
+            SharedRef<IBuffer> vertexBuffers[] = {_vertexBuffer};
             // Binds the vertex buffer.
             GetImmediateGraphicsContext()->BindVertexBuffers(0,             // Starts at vertex binding 0
                                                              vertexBuffers, // Only one vertex buffer is bound.
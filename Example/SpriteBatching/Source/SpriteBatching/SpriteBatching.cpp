@@ -116,7 +116,7 @@ int main(int argc, char** argv)
             loadConfiguration.GenerateMip              = true;
             loadConfiguration.Usage                    = ResourceUsage::Immutable;
 
-            TextureLoader loader = TextureLoader(FileStream(texturePath, FileMode::Binary | FileMode::Read),
+            TextureLoader loader = TextureLoader(MappedFileStream(texturePath),
                                                  loadConfiguration);
 
             // Creates the texture from the loaded image.
@@ -144,9 +144,10 @@ int main(int argc, char** argv)
                 .EndCharacterRange      = WChar(126),
                 .UseCharacterRange      = true};
 
-            FileStream fontFile = FileStream(fontFilePath, FileMode::Binary | FileMode::Read);
+            // The font face looks the glyphs up across the whole file
+            MappedFileStream fontFile = MappedFileStream(fontFilePath, FileAccessPattern::Random);
 
-            _spriteFont = Axis::System::MakeShared<SpriteFont>(fontFile,
+            _spriteFont = Axis::System::MakeShared<SpriteFont>(std::move(fontFile),
                                                                24,
                                                                fontAtlasConfiguration);
 
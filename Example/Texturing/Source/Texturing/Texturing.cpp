@@ -249,7 +249,7 @@ int main(int argc, char** argv)
 
             _uniformBuffer = GetGraphicsDevice()->CreateBuffer(uniformBufferDescription, nullptr);
 
-            SharedPointer<IBuffer> uniformBuffers[] = {_uniformBuffer};
+            SharedRef<IBuffer> uniformBuffers[] = {_uniformBuffer};
 
             // Binds our uniform buffer to the resource heap at binding index 0.
             _resourceHeap->BindBuffers(0,
@@ -269,7 +269,7 @@ int main(int argc, char** argv)
             loadConfiguration.GenerateMip              = true;
             loadConfiguration.Usage                    = ResourceUsage::Immutable;
 
-            TextureLoader loader = TextureLoader(FileStream(assetPath, FileMode::Read | FileMode::Binary),
+            TextureLoader loader = TextureLoader(MappedFileStream(assetPath),
                                                  loadConfiguration);
 
             // Creates the texture from the loaded image.
@@ -281,8 +281,8 @@ int main(int argc, char** argv)
             // Creates sampler object for shader.
             _sampler = GetGraphicsDevice()->CreateSampler(SamplerDescription::GetLinearClamp());
 
-            SharedPointer<ISampler>     samplers[]     = {_sampler};
-            SharedPointer<ITextureView> textureViews[] = {_loadedImageView};
+            SharedRef<ISampler>     samplers[]     = {_sampler};
+            SharedRef<ITextureView> textureViews[] = {_loadedImageView};
 
             _resourceHeap->BindSamplers(1,
                                         samplers,
@@ -346,7 +346,7 @@ int main(int argc, char** argv)
             // Binds the resource heap
             GetImmediateGraphicsContext()->BindResourceHeap(_resourceHeap);
 
-            SharedPointer<IBuffer> vertexBuffers[] = {_vertexBuffer};
+            SharedRef<IBuffer> vertexBuffers[] = {_vertexBuffer};
             // Binds the vertex buffer.
             GetImmediateGraphicsContext()->BindVertexBuffers(0,             // Starts at vertex binding 0
                                                              vertexBuffers, // Only one vertex buffer is bound.
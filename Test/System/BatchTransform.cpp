@@ -0,0 +1,137 @@
+#include <Axis/System>
+#include <cmath>
+#include <doctest.h>
+#include <vector>
+
+using namespace Axis;
+using namespace Axis::System;
+
+namespace
+{
+
+Float32 GenerateFloat(Uint32& seed)
+{
+    seed = seed * 1664525u + 1013904223u;
+
+    return (Float32)(seed >> 8) / (Float32)(1u << 24) * 200.0f - 100.0f;
+}
+
+Bool IsNear(Float32 first,
+            Float32 second)
+{
+    return std::abs(first - second) <= 1e-4f * std::max(1.0f, std::abs(second));
+}
+
+} // namespace
+
+DOCTEST_TEST_CASE("Batch transform kernels : [Axis::System]")
+{
+    Uint32 seed = 42;
+
+    const FloatMatrix4x4 matrix = FloatMatrix4x4::GetTranslationMatrix({1.0f, -2.0f, 3.0f}) *
+                                  FloatMatrix4x4::GetMatrixRotationY(0.7f) *
+                                  FloatMatrix4x4::GetScalingMatrix({2.0f, 0.5f, 1.5f});
+
+    constexpr Float32 Rotation    = 1.2f;
+    const Vector2F    Translation = {10.0f, -5.0f};
+
+    // Every count below two batches of 8, covers the tails of the SSE2 and the AVX2 kernels.
+    for (Size count = 0; count < 19; ++count)
+    {
+        std::vector<Vector3F> points3(count);
+        std::vector<Vector2F> points2(count);
+
+        for (Size i = 0; i < count; ++i)
+        {
+            points3[i] = Vector3F(GenerateFloat(seed), GenerateFloat(seed), GenerateFloat(seed));
+            points2[i] = Vector2F(GenerateFloat(seed), GenerateFloat(seed));
+        }
+
+        // Array of the structures
+        {
+            // One past the points, the kernels mustn't write beyond the destination.
+            std::vector<Vector3F> result(count + 1, Vector3F(-1.0f));
+
+            Math::TransformPoints(Span<Vector3F>(points3.data(), points3.data() + count), matrix, result.data());
+
+            for (Size i = 0; i < count; ++i)
+            {
+                const Vector3F expected = matrix.TransformPoint(points3[i]);
+
+                DOCTEST_CHECK(IsNear(result[i].X, expected.X));
+                DOCTEST_CHECK(IsNear(result[i].Y, expected.Y));
+                DOCTEST_CHECK(IsNear(result[i].Z, expected.Z));
+            }
+
+            DOCTEST_CHECK(result[count] == Vector3F(-1.0f));
+
+            // In place
+            std::vector<Vector3F> inPlace = points3;
+
+            Math::TransformPoints(Span<Vector3F>(inPlace.data(), inPlace.data() + count), matrix, inPlace.data());
+
+            DOCTEST_CHECK(std::equal(inPlace.begin(), inPlace.end(), result.begin()));
+        }
+
+        // Structure of the arrays
+        {
+            std::vector<Float32> x(count), y(count), z(count);
+            std::vector<Float32> resultX(count + 1, -1.0f), resultY(count + 1, -1.0f), resultZ(count + 1, -1.0f);
+
+            for (Size i = 0; i < count; ++i)
+            {
+                x[i] = points3[i].X;
+                y[i] = points3[i].Y;
+                z[i] = points3[i].Z;
+            }
+
+            Math::TransformPoints(x.data(), y.data(), z.data(), count, matrix, resultX.data(), resultY.data(), resultZ.data());
+
+            for (Size i = 0; i < count; ++i)
+            {
+                const Vector3F expected = matrix.TransformPoint(points3[i]);
+
+                DOCTEST_CHECK(IsNear(resultX[i], expected.X));
+                DOCTEST_CHECK(IsNear(resultY[i], expected.Y));
+                DOCTEST_CHECK(IsNear(resultZ[i], expected.Z));
+            }
+
+            DOCTEST_CHECK(resultX[count] == -1.0f);
+            DOCTEST_CHECK(resultY[count] == -1.0f);
+            DOCTEST_CHECK(resultZ[count] == -1.0f);
+        }
+
+        // 2D rotation and translation
+        {
+            std::vector<Vector2F> result(count + 1, Vector2F(-1.0f));
+            std::vector<Float32>  x(count), y(count), resultX(count + 1, -1.0f), resultY(count + 1, -1.0f);
+
+            for (Size i = 0; i < count; ++i)
+            {
+                x[i] = points2[i].X;
+                y[i] = points2[i].Y;
+            }
+
+            Math::RotateTranslate2D(Span<Vector2F>(points2.data(), points2.data() + count), Rotation, Translation, result.data());
+            Math::RotateTranslate2D(x.data(), y.data(), count, Rotation, Translation, resultX.data(), resultY.data());
+
+            const Float32 sin = std::sin(Rotation);
+            const Float32 cos = std::cos(Rotation);
+
+            for (Size i = 0; i < count; ++i)
+            {
+                const Vector2F expected = {points2[i].X * cos - points2[i].Y * sin + Translation.X,
+                                           points2[i].X * sin + points2[i].Y * cos + Translation.Y};
+
+                DOCTEST_CHECK(IsNear(result[i].X, expected.X));
+                DOCTEST_CHECK(IsNear(result[i].Y, expected.Y));
+                DOCTEST_CHECK(IsNear(resultX[i], expected.X));
+                DOCTEST_CHECK(IsNear(resultY[i], expected.Y));
+            }
+
+            DOCTEST_CHECK(result[count] == Vector2F(-1.0f));
+            DOCTEST_CHECK(resultX[count] == -1.0f);
+            DOCTEST_CHECK(resultY[count] == -1.0f);
+        }
+    }
+}
@@ -0,0 +1,205 @@
+#include <Axis/System>
+#include <doctest.h>
+#include <thread>
+#include <vector>
+
+using namespace Axis;
+using namespace Axis::System;
+
+DOCTEST_TEST_CASE("Concurrent hash map : [Axis::System]")
+{
+    DOCTEST_SUBCASE("Inserting, finding and removing on one thread")
+    {
+        ConcurrentHashMap<Size, Size> map;
+
+        DOCTEST_CHECK(map.GetLength() == 0);
+        DOCTEST_CHECK_FALSE(map.Find(1));
+
+        // Grows the shards several times.
+        for (Size i = 0; i < 10000; ++i)
+            DOCTEST_CHECK(map.TryInsert(i, i * 2));
+
+        DOCTEST_CHECK_FALSE(map.TryInsert(5, 0));
+        DOCTEST_CHECK(map.GetLength() == 10000);
+
+        Bool allFound = true;
+
+        for (Size i = 0; i < 10000; ++i)
+        {
+            const auto value = map.Find(i);
+
+            allFound = allFound && value && *value == i * 2;
+        }
+
+        DOCTEST_CHECK(allFound);
+        DOCTEST_CHECK_FALSE(map.Contains(10000));
+
+        DOCTEST_CHECK(map.Remove(5));
+        DOCTEST_CHECK_FALSE(map.Remove(5));
+        DOCTEST_CHECK_FALSE(map.Contains(5));
+
+        // The odd keys are removed.
+        DOCTEST_CHECK(map.RemoveIf([](Size key, Size) { return key % 2 == 1; }) == 4999);
+        DOCTEST_CHECK(map.GetLength() == 5000);
+
+        Size sum = 0;
+
+        map.ForEach([&](Size key, Size value) {
+            DOCTEST_CHECK(key % 2 == 0);
+            sum += value;
+        });
+
+        DOCTEST_CHECK(sum == 2 * (4999 * 5000));
+
+        map.Clear();
+
+        DOCTEST_CHECK(map.GetLength() == 0);
+        DOCTEST_CHECK_FALSE(map.Contains(0));
+    }
+
+    DOCTEST_SUBCASE("Reclaiming the removed values")
+    {
+        ConcurrentHashMap<Size, SharedPointer<Size>> map;
+
+        auto value = MakeShared<Size>(1);
+
+        map.TryInsert(1, value);
+        map.TryInsert(2, value);
+
+        DOCTEST_CHECK(value.GetStrongCount() == 3);
+
+        {
+            // The node may still be read inside the guard.
+            Detail::EpochGuard guard;
+
+            map.Remove(1);
+            ReclaimRemovedNodes();
+
+            DOCTEST_CHECK(value.GetStrongCount() == 3);
+        }
+
+        // No thread is reading, the epoch advances past the removals.
+        map.Remove(2);
+        ReclaimRemovedNodes();
+
+        DOCTEST_CHECK(value.GetStrongCount() == 1);
+    }
+
+    DOCTEST_SUBCASE("Creating the values once")
+    {
+        ConcurrentHashMap<String8, SharedPointer<Int32>> map;
+
+        Size created = 0;
+
+        const auto first  = map.GetOrCreate(String8("Key"), [&]() { ++created; return MakeShared<Int32>(1); });
+        const auto second = map.GetOrCreate(String8("Key"), [&]() { ++created; return MakeShared<Int32>(2); });
+
+        DOCTEST_CHECK(created == 1);
+        DOCTEST_CHECK(first == second);
+        DOCTEST_CHECK(*second == 1);
+    }
+
+    DOCTEST_SUBCASE("Creating the values from many threads")
+    {
+        constexpr Size ThreadCount = 8;
+        constexpr Size KeyCount    = 1000;
+
+        ConcurrentHashMap<Size, Size> map;
+        std::atomic<Size>             nextValue = 0;
+
+        // Every thread must get the same value for the key, whichever thread has created it.
+        std::vector<std::vector<Size>> results(ThreadCount, std::vector<Size>(KeyCount));
+        std::vector<std::thread>       threads;
+
+        for (Size thread = 0; thread < ThreadCount; ++thread)
+        {
+            threads.emplace_back([&, thread]() {
+                for (Size i = 0; i < KeyCount; ++i)
+                {
+                    const Size key = (i * 7 + thread * 13) % KeyCount;
+
+                    results[thread][key] = map.GetOrCreate(key, [&]() { return nextValue.fetch_add(1); });
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        Bool agreed = true;
+
+        for (Size thread = 1; thread < ThreadCount; ++thread)
+            agreed = agreed && results[thread] == results[0];
+
+        DOCTEST_CHECK(agreed);
+        DOCTEST_CHECK(map.GetLength() == KeyCount);
+    }
+
+    DOCTEST_SUBCASE("Reading while the other threads write")
+    {
+        constexpr Size ReaderCount = 4;
+        constexpr Size KeyCount    = 4096;
+        constexpr Size RoundCount  = 20;
+
+        // The values are larger than a word so the torn reads of the freed nodes would show.
+        struct Value
+        {
+            Size Key    = 0;
+            Size Double = 0;
+        };
+
+        ConcurrentHashMap<Size, Value> map;
+
+        // The even keys are always present, the odd ones come and go.
+        for (Size key = 0; key < KeyCount; key += 2)
+            map.TryInsert(key, Value{key, key * 2});
+
+        std::atomic<Bool> done = false;
+        Bool              consistent[ReaderCount];
+
+        std::vector<std::thread> readers;
+
+        for (Size reader = 0; reader < ReaderCount; ++reader)
+        {
+            readers.emplace_back([&, reader]() {
+                consistent[reader] = true;
+
+                while (!done.load(std::memory_order_relaxed))
+                {
+                    for (Size key = 0; key < KeyCount; ++key)
+                    {
+                        const auto value = map.Find(key);
+
+                        if (value)
+                            consistent[reader] = consistent[reader] && value->Key == key && value->Double == key * 2;
+                        else
+                            consistent[reader] = consistent[reader] && key % 2 == 1;
+                    }
+                }
+            });
+        }
+
+        std::thread writer([&]() {
+            for (Size round = 0; round < RoundCount; ++round)
+            {
+                for (Size key = 1; key < KeyCount; key += 2)
+                    map.TryInsert(key, Value{key, key * 2});
+
+                for (Size key = 1; key < KeyCount; key += 2)
+                    map.Remove(key);
+            }
+
+            done.store(true, std::memory_order_relaxed);
+        });
+
+        writer.join();
+
+        for (auto& reader : readers)
+            reader.join();
+
+        for (Bool readerConsistent : consistent)
+            DOCTEST_CHECK(readerConsistent);
+
+        DOCTEST_CHECK(map.GetLength() == KeyCount / 2);
+    }
+}
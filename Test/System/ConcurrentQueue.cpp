@@ -0,0 +1,339 @@
+#include <Axis/System>
+#include <doctest.h>
+#include <thread>
+#include <vector>
+
+using namespace Axis;
+using namespace Axis::System;
+
+namespace
+{
+
+// Counts the destructions of the non-moved-from objects.
+struct DestroyCounter
+{
+    Size* Counter = nullptr;
+
+    DestroyCounter() noexcept = default;
+
+    explicit DestroyCounter(Size* counter) noexcept :
+        Counter(counter) {}
+
+    DestroyCounter(DestroyCounter&& other) noexcept :
+        Counter(other.Counter) { other.Counter = nullptr; }
+
+    DestroyCounter& operator=(DestroyCounter&& other) noexcept
+    {
+        std::swap(Counter, other.Counter);
+        return *this;
+    }
+
+    ~DestroyCounter() noexcept
+    {
+        if (Counter != nullptr)
+            ++*Counter;
+    }
+};
+
+constexpr Size StressCount = 200000; // Number of the elements pushed by each producer
+
+} // namespace
+
+DOCTEST_TEST_CASE("Concurrent SPSC queue : [Axis::System]")
+{
+    DOCTEST_SUBCASE("Pushing and popping on one thread")
+    {
+        SpscQueue<Int32> queue(5);
+
+        DOCTEST_CHECK(queue.GetCapacity() == 8);
+
+        for (Int32 i = 0; i < 8; ++i)
+            DOCTEST_CHECK(queue.TryPush(i));
+
+        DOCTEST_CHECK_FALSE(queue.TryPush(8));
+        DOCTEST_CHECK(queue.GetLength() == 8);
+
+        Int32 element = -1;
+
+        for (Int32 i = 0; i < 8; ++i)
+        {
+            DOCTEST_CHECK(queue.TryPop(element));
+            DOCTEST_CHECK(element == i);
+        }
+
+        DOCTEST_CHECK_FALSE(queue.TryPop(element));
+
+        // The ranges wrap around the end of the ring.
+        const Int32 elements[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        Int32       popped[10] = {};
+
+        DOCTEST_CHECK(queue.TryPushRange(elements, 5) == 5);
+        DOCTEST_CHECK(queue.TryPopRange(popped, 2) == 2);
+        DOCTEST_CHECK(queue.TryPushRange(elements + 5, 5) == 5);
+        DOCTEST_CHECK(queue.TryPushRange(elements, 1) == 0);
+        DOCTEST_CHECK(queue.TryPopRange(popped + 2, 10) == 8);
+
+        for (Int32 i = 0; i < 10; ++i)
+            DOCTEST_CHECK(popped[i] == i);
+
+        DOCTEST_CHECK_THROWS_AS(SpscQueue<Int32>(0), InvalidArgumentException);
+    }
+
+    DOCTEST_SUBCASE("Destroying the remaining elements")
+    {
+        Size destroyed = 0;
+
+        {
+            SpscQueue<DestroyCounter> queue(4);
+
+            queue.TryEmplace(&destroyed);
+            queue.TryEmplace(&destroyed);
+            queue.TryEmplace(&destroyed);
+
+            DestroyCounter element;
+
+            DOCTEST_CHECK(queue.TryPop(element));
+        }
+
+        DOCTEST_CHECK(destroyed == 3);
+    }
+
+    DOCTEST_SUBCASE("Handing off between the threads")
+    {
+        SpscQueue<Size> queue(64);
+
+        Bool inOrder = true;
+
+        std::thread consumer([&]() {
+            Size expected = 0;
+            Size popped[16];
+
+            while (expected < StressCount * 2)
+            {
+                // Alternates the single pops and the batches.
+                if (expected < StressCount)
+                {
+                    Size element = 0;
+
+                    if (!queue.TryPop(element))
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+
+                    inOrder = inOrder && element == expected++;
+                }
+                else
+                {
+                    const Size count = queue.TryPopRange(popped, 16);
+
+                    if (count == 0)
+                        std::this_thread::yield();
+
+                    for (Size i = 0; i < count; ++i)
+                        inOrder = inOrder && popped[i] == expected++;
+                }
+            }
+        });
+
+        for (Size i = 0; i < StressCount; ++i)
+        {
+            while (!queue.TryPush(i))
+                std::this_thread::yield();
+        }
+
+        Size batch[16];
+
+        for (Size i = StressCount; i < StressCount * 2;)
+        {
+            const Size count = Math::Min((Size)16, StressCount * 2 - i);
+
+            for (Size j = 0; j < count; ++j)
+                batch[j] = i + j;
+
+            const Size pushed = queue.TryPushRange(batch, count);
+
+            if (pushed == 0)
+                std::this_thread::yield();
+
+            i += pushed;
+        }
+
+        consumer.join();
+
+        DOCTEST_CHECK(inOrder);
+        DOCTEST_CHECK(queue.GetLength() == 0);
+    }
+}
+
+DOCTEST_TEST_CASE("Concurrent MPMC queue : [Axis::System]")
+{
+    DOCTEST_SUBCASE("Pushing and popping on one thread")
+    {
+        MpmcQueue<Int32> queue(3);
+
+        DOCTEST_CHECK(queue.GetCapacity() == 4);
+
+        for (Int32 i = 0; i < 4; ++i)
+            DOCTEST_CHECK(queue.TryPush(i));
+
+        DOCTEST_CHECK_FALSE(queue.TryPush(4));
+
+        Int32 popped[8] = {};
+
+        DOCTEST_CHECK(queue.TryPop(popped[0]));
+        DOCTEST_CHECK(popped[0] == 0);
+
+        const Int32 elements[] = {4, 5, 6};
+
+        // Only one slot is free.
+        DOCTEST_CHECK(queue.TryPushRange(elements, 3) == 1);
+        DOCTEST_CHECK(queue.GetLength() == 4);
+        DOCTEST_CHECK(queue.TryPopRange(popped, 8) == 4);
+
+        for (Int32 i = 0; i < 4; ++i)
+            DOCTEST_CHECK(popped[i] == i + 1);
+
+        DOCTEST_CHECK_FALSE(queue.TryPop(popped[0]));
+        DOCTEST_CHECK_THROWS_AS(MpmcQueue<Int32>(0), InvalidArgumentException);
+    }
+
+    DOCTEST_SUBCASE("Smallest capacities")
+    {
+        for (Size capacity = 1; capacity <= 2; ++capacity)
+        {
+            MpmcQueue<Int32> queue(capacity);
+
+            DOCTEST_CHECK(queue.GetCapacity() == 2);
+
+            DOCTEST_CHECK(queue.TryPush(1));
+            DOCTEST_CHECK(queue.TryPush(2));
+            DOCTEST_CHECK_FALSE(queue.TryPush(3));
+
+            Int32 popped = 0;
+
+            DOCTEST_CHECK(queue.TryPop(popped));
+            DOCTEST_CHECK(popped == 1);
+            DOCTEST_CHECK(queue.TryPush(3));
+            DOCTEST_CHECK(queue.TryPop(popped));
+            DOCTEST_CHECK(popped == 2);
+            DOCTEST_CHECK(queue.TryPop(popped));
+            DOCTEST_CHECK(popped == 3);
+            DOCTEST_CHECK_FALSE(queue.TryPop(popped));
+        }
+    }
+
+    DOCTEST_SUBCASE("Destroying the remaining elements")
+    {
+        Size destroyed = 0;
+
+        {
+            MpmcQueue<DestroyCounter> queue(4);
+
+            queue.TryEmplace(&destroyed);
+            queue.TryEmplace(&destroyed);
+
+            DestroyCounter element;
+
+            DOCTEST_CHECK(queue.TryPop(element));
+        }
+
+        DOCTEST_CHECK(destroyed == 2);
+    }
+
+    DOCTEST_SUBCASE("Handing off between the threads")
+    {
+        constexpr Size ProducerCount = 4;
+        constexpr Size ConsumerCount = 4;
+
+        MpmcQueue<Size> queue(128);
+
+        // Every element is popped exactly once, in the pushed order for each producer.
+        std::vector<std::vector<Uint8>> seen(ConsumerCount, std::vector<Uint8>(ProducerCount * StressCount));
+        std::atomic<Size>               poppedCount = 0;
+        Bool                            inOrder[ConsumerCount];
+
+        std::vector<std::thread> threads;
+
+        for (Size consumer = 0; consumer < ConsumerCount; ++consumer)
+        {
+            threads.emplace_back([&, consumer]() {
+                Size last[ProducerCount];
+                Size popped[8];
+
+                inOrder[consumer] = true;
+
+                for (auto& index : last)
+                    index = 0;
+
+                while (poppedCount.load(std::memory_order_relaxed) < ProducerCount * StressCount)
+                {
+                    const Size count = consumer % 2 == 0 ? queue.TryPopRange(popped, 8) : (Size)queue.TryPop(popped[0]);
+
+                    if (count == 0)
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+
+                    for (Size i = 0; i < count; ++i)
+                    {
+                        const Size producer = popped[i] / StressCount;
+                        const Size index    = popped[i] % StressCount + 1;
+
+                        inOrder[consumer] = inOrder[consumer] && index > last[producer];
+                        last[producer]    = index;
+
+                        ++seen[consumer][popped[i]];
+                    }
+
+                    poppedCount.fetch_add(count, std::memory_order_relaxed);
+                }
+            });
+        }
+
+        for (Size producer = 0; producer < ProducerCount; ++producer)
+        {
+            threads.emplace_back([&, producer]() {
+                const Size first = producer * StressCount;
+
+                for (Size i = 0; i < StressCount;)
+                {
+                    Size batch[8];
+                    Size count = Math::Min((Size)(producer % 2 == 0 ? 8 : 1), StressCount - i);
+
+                    for (Size j = 0; j < count; ++j)
+                        batch[j] = first + i + j;
+
+                    count = queue.TryPushRange(batch, count);
+
+                    if (count == 0)
+                        std::this_thread::yield();
+
+                    i += count;
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        Bool exactlyOnce = true;
+
+        for (Size element = 0; element < ProducerCount * StressCount; ++element)
+        {
+            Size count = 0;
+
+            for (const auto& consumerSeen : seen)
+                count += consumerSeen[element];
+
+            exactlyOnce = exactlyOnce && count == 1;
+        }
+
+        DOCTEST_CHECK(exactlyOnce);
+        DOCTEST_CHECK(queue.GetLength() == 0);
+
+        for (Bool consumerInOrder : inOrder)
+            DOCTEST_CHECK(consumerInOrder);
+    }
+}
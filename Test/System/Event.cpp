@@ -71,4 +71,163 @@ DOCTEST_TEST_CASE("Axis event : [Axis::System]")
         CHECK(!event.EventRegister.TokenExists(token1));
         CHECK(event.EventRegister.TokenExists(token2));
     }
-}
\ No newline at end of file
+}
+namespace
+{
+
+Int32 FunctionPointerCount = 0;
+
+void CountFunctionPointer(Int32& value)
+{
+    value += 10;
+    FunctionPointerCount++;
+}
+
+} // namespace
+
+DOCTEST_TEST_CASE("Axis event dispatch : [Axis::System]")
+{
+    DOCTEST_SUBCASE("Plain functions and subscription order")
+    {
+        Event<void(Int32&)> event;
+        List<Int32>         order;
+
+        FunctionPointerCount = 0;
+
+        event.EventRegister.Add([&](Int32&) { order.Append(1); });
+        event.EventRegister.Add([&](Int32&) { order.Append(2); });
+
+        // Plain function and lambda without captures are stored as the function pointers
+        Size functionToken = event.EventRegister.Add(CountFunctionPointer);
+        event.EventRegister.Add([](Int32& value) { value += 100; });
+
+        Int32 value = 0;
+        event(value);
+
+        DOCTEST_CHECK(value == 110);
+        DOCTEST_CHECK(FunctionPointerCount == 1);
+        DOCTEST_CHECK(order.GetLength() == 2);
+        DOCTEST_CHECK(order[0] == 1);
+        DOCTEST_CHECK(order[1] == 2);
+        DOCTEST_CHECK(event.EventRegister.GetHandlerCount() == 4);
+
+        DOCTEST_CHECK(event.EventRegister.Remove(functionToken));
+        DOCTEST_CHECK(!event.EventRegister.Remove(functionToken));
+
+        event(value);
+
+        DOCTEST_CHECK(value == 210);
+        DOCTEST_CHECK(FunctionPointerCount == 1);
+    }
+
+    DOCTEST_SUBCASE("Stale tokens")
+    {
+        Event<void()> event;
+        Int32         count = 0;
+
+        Size token1 = event.EventRegister.Add([&]() { count++; });
+
+        DOCTEST_CHECK(token1 != 0);
+        DOCTEST_CHECK(event.EventRegister.Remove(token1));
+
+        // Reuses the slot, the old token doesn't refer to the new handler
+        Size token2 = event.EventRegister.Add([&]() { count += 2; });
+
+        DOCTEST_CHECK(token1 != token2);
+        DOCTEST_CHECK(!event.EventRegister.TokenExists(token1));
+        DOCTEST_CHECK(!event.EventRegister.Remove(token1));
+        DOCTEST_CHECK(event.EventRegister.TokenExists(token2));
+
+        event();
+
+        DOCTEST_CHECK(count == 2);
+        DOCTEST_CHECK(!event.EventRegister.TokenExists(0));
+        DOCTEST_CHECK(!event.EventRegister.TokenExists(~Size(0)));
+    }
+
+    DOCTEST_SUBCASE("Changes during the raise are deferred")
+    {
+        Event<void(Int32)> event;
+        List<Int32>        calls;
+        Size               tokens[3] = {};
+
+        // Removes itself and the next handler, adds a new one
+        tokens[0] = event.EventRegister.Add([&](Int32 value) {
+            calls.Append(0);
+
+            if (value == 0)
+            {
+                DOCTEST_CHECK(event.EventRegister.Remove(tokens[0]));
+                DOCTEST_CHECK(event.EventRegister.Remove(tokens[1]));
+
+                event.EventRegister.Add([&](Int32) { calls.Append(3); });
+            }
+        });
+
+        tokens[1] = event.EventRegister.Add([&](Int32) { calls.Append(1); });
+
+        // Raises the event again from the handler
+        tokens[2] = event.EventRegister.Add([&](Int32 value) {
+            calls.Append(2);
+
+            if (value == 0)
+                event(1);
+        });
+
+        event(0);
+
+        // The removed handler isn't invoked, the added one waits for the next raise
+        DOCTEST_CHECK(calls.GetLength() == 3);
+        DOCTEST_CHECK(calls[0] == 0);
+        DOCTEST_CHECK(calls[1] == 2);
+        DOCTEST_CHECK(calls[2] == 2);
+        DOCTEST_CHECK(event.EventRegister.GetHandlerCount() == 2);
+        DOCTEST_CHECK(!event.EventRegister.TokenExists(tokens[0]));
+
+        calls.Clear();
+
+        event(2);
+
+        DOCTEST_CHECK(calls.GetLength() == 2);
+        DOCTEST_CHECK(calls[0] == 2);
+        DOCTEST_CHECK(calls[1] == 3);
+    }
+
+    DOCTEST_SUBCASE("Throwing handler")
+    {
+        Event<void()> event;
+        Int32         count = 0;
+
+        Size token = event.EventRegister.Add([&]() {
+            event.EventRegister.Add([&]() { count++; });
+            throw InvalidOperationException("Handler failed");
+        });
+
+        DOCTEST_CHECK_THROWS_AS(event(), InvalidOperationException);
+
+        // The raise has been ended, the changes are applied
+        event.EventRegister.Remove(token);
+        event();
+
+        DOCTEST_CHECK(count == 1);
+    }
+
+    DOCTEST_SUBCASE("Event token")
+    {
+        Event<void(Int32&)> event;
+        Int32               value = 0;
+
+        {
+            EventToken<void(Int32&)> token(event.EventRegister, [](Int32& value) { value++; });
+
+            event(value);
+
+            DOCTEST_CHECK(token.IsSubscribed());
+        }
+
+        event(value);
+
+        DOCTEST_CHECK(value == 1);
+        DOCTEST_CHECK(event.EventRegister.GetHandlerCount() == 0);
+    }
+}
@@ -0,0 +1,218 @@
+#include <Axis/System>
+#include <doctest.h>
+#include <unordered_map>
+
+using namespace Axis;
+using namespace Axis::System;
+
+namespace
+{
+
+// Hashes every key to the same slot, all the elements collide
+struct CollidingHasher
+{
+    AXIS_NODISCARD Size operator()(const Int32&) const noexcept { return 42; }
+};
+
+} // namespace
+
+DOCTEST_TEST_CASE("Flat hash map : [Axis::System]")
+{
+    DOCTEST_SUBCASE("Insert and Remove")
+    {
+        FlatHashMap<Int32, Bool> map;
+
+        map.Insert({1, true});
+        map.Insert({2, false});
+        map.Insert({3, true});
+        map.Insert({4, false});
+        map.Insert({5, true});
+
+        // Inserts duplicates
+        CHECK(!map.Insert({1, false}).First);
+
+        // We should have only 5 elements
+        CHECK(map.GetSize() == 5);
+
+        // Element 3 should be in the map
+        CHECK(map.Find(3) != map.end());
+
+        // Element 6 should not be in the map
+        CHECK(map.Find(6) == map.end());
+
+        // The duplicate didn't overwrite the value
+        CHECK(map.Find(1)->Second == true);
+        CHECK(map.Find(2)->Second == false);
+
+        CHECK(map.Remove(1).First);
+        CHECK(!map.Remove(1).First);
+
+        // We should have only 4 elements
+        CHECK(map.GetSize() == 4);
+
+        // Element 1 should not be in the map
+        CHECK(map.Find(1) == map.end());
+
+        DOCTEST_SUBCASE("Copy constructor")
+        {
+            FlatHashMap<Int32, Bool> map2(map);
+
+            CHECK(map2.GetSize() == 4);
+            CHECK(map2.Find(1) == map2.end());
+            CHECK(map2.Find(5)->Second == true);
+        }
+
+        DOCTEST_SUBCASE("Move constructor")
+        {
+            FlatHashMap<Int32, Bool> map2(std::move(map));
+
+            CHECK(map2.GetSize() == 4);
+            CHECK(map2.Find(1) == map2.end());
+            CHECK(map.GetSize() == 0);
+            CHECK(map.Find(2) == map.end());
+        }
+    }
+
+    DOCTEST_SUBCASE("Matches `std::unordered_map`")
+    {
+        FlatHashMap<Uint32, Uint32>            map;
+        std::unordered_map<Uint32, Uint32>     reference;
+        Uint32                                 state = 12345;
+
+        for (Size i = 0; i < 20000; ++i)
+        {
+            state     = state * 1664525u + 1013904223u;
+            Uint32 key = (state >> 8) % 2048;
+
+            if (state & 1)
+            {
+                CHECK(map.Insert({key, (Uint32)i}).First == reference.insert({key, (Uint32)i}).second);
+            }
+            else
+            {
+                CHECK(map.Remove(key).First == (reference.erase(key) == 1));
+            }
+        }
+
+        CHECK(map.GetSize() == reference.size());
+        CHECK(map.GetCurrentLoadFactor() <= map.GetMaxLoadFactor());
+
+        Size count = 0;
+
+        for (const auto& pair : map)
+        {
+            auto it = reference.find(pair.First);
+
+            CHECK(it != reference.end());
+            CHECK(it->second == pair.Second);
+
+            ++count;
+        }
+
+        CHECK(count == reference.size());
+    }
+
+    DOCTEST_SUBCASE("Colliding hashes")
+    {
+        FlatHashMap<Int32, Int32, CollidingHasher> map;
+
+        for (Int32 i = 0; i < 100; ++i)
+            map.Insert({i, i * 2});
+
+        for (Int32 i = 0; i < 100; i += 2)
+            CHECK(map.Remove(i).First);
+
+        CHECK(map.GetSize() == 50);
+
+        for (Int32 i = 0; i < 100; ++i)
+        {
+            if (i % 2)
+                CHECK(map.Find(i)->Second == i * 2);
+            else
+                CHECK(map.Find(i) == map.end());
+        }
+    }
+
+    DOCTEST_SUBCASE("Remove while iterating")
+    {
+        FlatHashMap<Int32, Int32> map;
+
+        for (Int32 i = 0; i < 1000; ++i)
+            map.Insert({i, i});
+
+        auto it = map.begin();
+
+        while (it != map.end())
+        {
+            if (it->First % 3 == 0)
+                it = map.Remove(it->First).Second;
+            else
+                ++it;
+        }
+
+        CHECK(map.GetSize() == 666);
+
+        for (Int32 i = 0; i < 1000; ++i)
+            CHECK((map.Find(i) == map.end()) == (i % 3 == 0));
+    }
+
+    DOCTEST_SUBCASE("Non-trivial keys and values")
+    {
+        auto value = MakeShared<Int32>(7);
+
+        {
+            FlatHashMap<String8, SharedPointer<Int32>> map;
+
+            map.Reserve(100);
+
+            Size capacity = map.GetCapacity();
+
+            for (Int32 i = 0; i < 100; ++i)
+                map.Insert({String8::ToString(i), value});
+
+            // Reserved up front, no rehash
+            CHECK(map.GetCapacity() == capacity);
+            CHECK(value.GetStrongCount() == 101);
+
+            for (Int32 i = 0; i < 100; i += 2)
+                map.Remove(String8::ToString(i));
+
+            CHECK(value.GetStrongCount() == 51);
+            CHECK(map.Find(String8("51")) != map.end());
+            CHECK(map.Find(String8("50")) == map.end());
+
+            auto copy = map;
+
+            CHECK(value.GetStrongCount() == 101);
+
+            copy.Clear();
+
+            CHECK(copy.GetSize() == 0);
+            CHECK(copy.begin() == copy.end());
+            CHECK(value.GetStrongCount() == 51);
+        }
+
+        CHECK(value.GetStrongCount() == 1);
+    }
+
+    DOCTEST_SUBCASE("Flat hash set")
+    {
+        FlatHashSet<Int32> set;
+
+        for (Int32 i = 0; i < 100; ++i)
+            CHECK(set.Insert(i).First);
+
+        CHECK(!set.Insert(50).First);
+        CHECK(set.GetSize() == 100);
+        CHECK(*set.Find(50) == 50);
+        CHECK(set.Remove(50).First);
+        CHECK(set.Find(50) == set.end());
+        CHECK(!set.SetMaxLoadFactor(1.0f));
+        CHECK(set.SetMaxLoadFactor(0.5f));
+
+        set.Reserve(1000);
+
+        CHECK(set.GetCapacity() >= 2000);
+        CHECK(set.GetSize() == 99);
+    }
+}
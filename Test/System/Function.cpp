@@ -76,4 +76,194 @@ DOCTEST_TEST_CASE("Function object : [Axis::System]")
 
     // No leak
     DOCTEST_CHECK(InstanceCount == 0);
-}
\ No newline at end of file
+
+    // Large functor allocated from the memory resource
+    {
+        ArenaMemoryResource arenaResource(1024);
+
+        Int64 values[4] = {1, 2, 3, 4};
+
+        Function<Int64(), PolymorphicAllocator> sumFunction([values]() noexcept {
+            return values[0] + values[1] + values[2] + values[3];
+        },
+                                                            &arenaResource);
+
+        auto copiedFunction = sumFunction;
+
+        DOCTEST_CHECK(copiedFunction.GetAllocator().GetMemoryResource() == &arenaResource);
+        DOCTEST_CHECK(copiedFunction() == 10);
+    }
+}
+namespace
+{
+
+struct FunctionAllocationTag
+{
+    static constexpr const char* Name = "Test::Function";
+};
+
+using CountedAllocator = TrackingAllocator<DefaultAllocator, FunctionAllocationTag>;
+
+Size GetLiveAllocationCount()
+{
+    return AllocationTracker::GetStatistics(FunctionAllocationTag::Name).LiveAllocationCount;
+}
+
+Int32 Twice(Int32 value)
+{
+    return value * 2;
+}
+
+} // namespace
+
+DOCTEST_TEST_CASE("Function inline buffer : [Axis::System]")
+{
+    auto allocationCount = GetLiveAllocationCount();
+
+    Int64 first  = 1;
+    Int64 second = 2;
+    Int64 third  = 3;
+
+    auto byReference = [&first, &second, &third]() noexcept {
+        return first + second + third;
+    };
+
+    auto byValue = [first, second, third, fourth = Int64(4)]() noexcept {
+        return first + second + third + fourth;
+    };
+
+    // Three references fit the default inline buffer
+    Function<Int64(), CountedAllocator> inlineFunction = byReference;
+
+    DOCTEST_CHECK(inlineFunction.IsInline());
+    DOCTEST_CHECK(GetLiveAllocationCount() == allocationCount);
+
+    // Four values don't
+    Function<Int64(), CountedAllocator> allocatedFunction = byValue;
+
+    DOCTEST_CHECK(!allocatedFunction.IsInline());
+    DOCTEST_CHECK(GetLiveAllocationCount() == allocationCount + 1);
+
+    // Unless the inline buffer is enlarged
+    Function<Int64(), CountedAllocator, sizeof(Int64) * 4> largeFunction = byValue;
+
+    DOCTEST_CHECK(largeFunction.IsInline());
+    DOCTEST_CHECK(GetLiveAllocationCount() == allocationCount + 1);
+
+    // The copies allocate as well, the moves take the allocated functor along
+    {
+        auto inlineCopy    = inlineFunction;
+        auto allocatedCopy = allocatedFunction;
+
+        DOCTEST_CHECK(GetLiveAllocationCount() == allocationCount + 2);
+        DOCTEST_CHECK(inlineCopy() == 6);
+        DOCTEST_CHECK(allocatedCopy() == 10);
+
+        auto allocatedMove = std::move(allocatedCopy);
+
+        DOCTEST_CHECK(!allocatedCopy);
+        DOCTEST_CHECK(allocatedMove() == 10);
+        DOCTEST_CHECK(GetLiveAllocationCount() == allocationCount + 2);
+
+        allocatedMove = inlineCopy;
+
+        DOCTEST_CHECK(allocatedMove.IsInline());
+        DOCTEST_CHECK(allocatedMove() == 6);
+        DOCTEST_CHECK(GetLiveAllocationCount() == allocationCount + 1);
+
+        inlineCopy = allocatedFunction;
+
+        DOCTEST_CHECK(!inlineCopy.IsInline());
+        DOCTEST_CHECK(inlineCopy() == 10);
+        DOCTEST_CHECK(GetLiveAllocationCount() == allocationCount + 2);
+    }
+
+    DOCTEST_CHECK(GetLiveAllocationCount() == allocationCount + 1);
+
+    allocatedFunction = nullptr;
+
+    DOCTEST_CHECK(!allocatedFunction);
+    DOCTEST_CHECK_THROWS_AS(allocatedFunction(), InvalidOperationException);
+    DOCTEST_CHECK(GetLiveAllocationCount() == allocationCount);
+}
+
+DOCTEST_TEST_CASE("Unique function : [Axis::System]")
+{
+    auto allocationCount = GetLiveAllocationCount();
+
+    // Move-only functor
+    UniquePointer<Int32> value(New<Int32>(5));
+    auto reading = [value = std::move(value)](Int32 offset) noexcept {
+        return *value + offset;
+    };
+
+    UniqueFunction<Int32(Int32), CountedAllocator> function = std::move(reading);
+
+    DOCTEST_CHECK(function.IsInline());
+    DOCTEST_CHECK(function(1) == 6);
+
+    UniqueFunction<Int32(Int32), CountedAllocator> moved = std::move(function);
+
+    DOCTEST_CHECK(!function);
+    DOCTEST_CHECK(moved(2) == 7);
+
+    // Move-only functor which is too large
+    {
+        UniquePointer<Int32[]> values(NewArray<Int32>(3));
+        values[2] = 9;
+
+        UniqueFunction<Int32(Int32), CountedAllocator, PointerSize> allocated = [values = std::move(values), padding = Int64(0)](Int32 index) noexcept {
+            return values[index] + (Int32)padding;
+        };
+
+        DOCTEST_CHECK(!allocated.IsInline());
+        DOCTEST_CHECK(allocated(2) == 9);
+        DOCTEST_CHECK(GetLiveAllocationCount() == allocationCount + 1);
+    }
+
+    DOCTEST_CHECK(GetLiveAllocationCount() == allocationCount);
+
+    DOCTEST_CHECK(!std::is_copy_constructible_v<UniqueFunction<void()>>);
+    DOCTEST_CHECK(std::is_copy_constructible_v<Function<void()>>);
+}
+
+DOCTEST_TEST_CASE("Function reference : [Axis::System]")
+{
+    Int32 sum = 0;
+
+    auto accumulate = [&sum](Int32 value) {
+        sum += value;
+    };
+
+    // Refers to the lambda, the changes are visible through the reference
+    FunctionRef<void(Int32)> reference = accumulate;
+
+    reference(2);
+    reference(3);
+
+    DOCTEST_CHECK(sum == 5);
+
+    // Plain functions are stored by value
+    FunctionRef<Int32(Int32)> functionReference = Twice;
+
+    DOCTEST_CHECK(functionReference(4) == 8);
+
+    functionReference = &Twice;
+
+    DOCTEST_CHECK(functionReference(5) == 10);
+
+    // Refers to a function object
+    Function<Int32(Int32)>    function       = [](Int32 value) noexcept { return value + 1; };
+    FunctionRef<Int32(Int32)> functionObject = function;
+
+    DOCTEST_CHECK(functionObject(1) == 2);
+
+    // Passes a temporary to a function call
+    auto invoke = [](FunctionRef<Int32(Int32)> callback, Int32 value) {
+        return callback(value);
+    };
+
+    DOCTEST_CHECK(invoke([offset = 10](Int32 value) { return value + offset; }, 5) == 15);
+
+    DOCTEST_CHECK(sizeof(FunctionRef<void()>) == PointerSize * 2);
+}
@@ -0,0 +1,216 @@
+#include <Axis/System>
+#include <doctest.h>
+
+using namespace Axis;
+using namespace Axis::System;
+
+namespace
+{
+
+constexpr Size BucketCount = 1024;  // Number of buckets in the distribution tests
+constexpr Size KeyCount    = 65536; // Number of keys in the distribution tests
+
+Uint64 NextRandom(Uint64& state)
+{
+    Uint64 value = (state += 0x9E3779B97F4A7C15ull);
+    value        = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+    value        = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+    return value ^ (value >> 31);
+}
+
+// Chi-squared statistic of the key distribution over the buckets, its expected
+// value is `BucketCount - 1` with the standard deviation of about 45.
+template <class Function>
+Float64 GetChiSquared(Function&& getBucket)
+{
+    List<Size> buckets(BucketCount, 0);
+
+    for (Size i = 0; i < KeyCount; ++i)
+        buckets[getBucket(i)]++;
+
+    constexpr Float64 expected = (Float64)KeyCount / BucketCount;
+
+    Float64 chiSquared = 0;
+
+    for (const auto& count : buckets)
+        chiSquared += ((Float64)count - expected) * ((Float64)count - expected) / expected;
+
+    return chiSquared;
+}
+
+template <class Hasher>
+void CheckDistribution(Hasher&& hasher)
+{
+    // Both the low bits (modulo) and the high bits (multiplicative) of the hash are used by the tables
+    const Float64 lowBits  = GetChiSquared([&](Size i) { return hasher(i) & (BucketCount - 1); });
+    const Float64 highBits = GetChiSquared([&](Size i) { return (Size)((Uint64)hasher(i) >> 54); });
+
+    DOCTEST_CHECK(lowBits < BucketCount + 300);
+    DOCTEST_CHECK(highBits < BucketCount + 300);
+}
+
+struct PaddedDescriptor
+{
+    Uint8   Mode  = 0;
+    Float32 Bias  = 0;
+    Uint32  Level = 0;
+};
+
+struct PackedDescriptor
+{
+    Uint32 First  = 0;
+    Uint32 Second = 0;
+};
+
+} // namespace
+
+DOCTEST_TEST_CASE("Hashing : [Axis::System]")
+{
+    DOCTEST_SUBCASE("Byte ranges")
+    {
+        Byte bytes[256] = {};
+
+        for (Size i = 0; i < sizeof(bytes); ++i)
+            bytes[i] = (Byte)i;
+
+        // Every prefix has different hash, including the empty one
+        HashSet<Uint64> hashes;
+
+        for (Size i = 0; i <= sizeof(bytes); ++i)
+            hashes.Insert(Hashing::HashBytes(bytes, i));
+
+        DOCTEST_CHECK(hashes.GetSize() == sizeof(bytes) + 1);
+
+        // Deterministic and seeded
+        DOCTEST_CHECK(Hashing::HashBytes(bytes, 100) == Hashing::HashBytes(bytes, 100));
+        DOCTEST_CHECK(Hashing::HashBytes(bytes, 100, 1) != Hashing::HashBytes(bytes, 100, 2));
+
+        // Only the bytes in the range are read
+        Byte copy[100];
+        std::memcpy(copy, bytes + 50, sizeof(copy));
+
+        DOCTEST_CHECK(Hashing::HashBytes(copy, sizeof(copy)) == Hashing::HashBytes(bytes + 50, sizeof(copy)));
+    }
+
+    DOCTEST_SUBCASE("Avalanche")
+    {
+        Uint64 state = 42;
+
+        // Flipping any input bit flips every output bit with the probability of about one half
+        for (Size size : {3, 8, 12, 16, 24, 48, 100})
+        {
+            constexpr Size sampleCount = 100;
+
+            Size flipCounts[64] = {};
+
+            for (Size sample = 0; sample < sampleCount; ++sample)
+            {
+                Byte bytes[100];
+
+                for (auto& byte : bytes)
+                    byte = (Byte)NextRandom(state);
+
+                const Uint64 hash = Hashing::HashBytes(bytes, size);
+
+                for (Size bit = 0; bit < size * 8; ++bit)
+                {
+                    bytes[bit / 8] ^= (Byte)(1 << (bit % 8));
+
+                    const Uint64 difference = hash ^ Hashing::HashBytes(bytes, size);
+
+                    bytes[bit / 8] ^= (Byte)(1 << (bit % 8));
+
+                    for (Size outputBit = 0; outputBit < 64; ++outputBit)
+                        flipCounts[outputBit] += (difference >> outputBit) & 1;
+                }
+            }
+
+            const Float64 trialCount = (Float64)sampleCount * size * 8;
+
+            for (Size outputBit = 0; outputBit < 64; ++outputBit)
+            {
+                DOCTEST_CHECK(flipCounts[outputBit] / trialCount > 0.45);
+                DOCTEST_CHECK(flipCounts[outputBit] / trialCount < 0.55);
+            }
+        }
+    }
+
+    DOCTEST_SUBCASE("Bucket distribution")
+    {
+        // Sequential integers
+        CheckDistribution([](Size i) { return Hash<Size>()(i); });
+
+        // Aligned addresses with zero low bits
+        CheckDistribution([](Size i) { return Hash<PVoid>()(reinterpret_cast<PVoid>(0x10000 + i * 64)); });
+
+        // Similar short strings
+        List<String8> strings;
+        strings.ReserveFor(KeyCount);
+
+        for (Size i = 0; i < KeyCount; ++i)
+            strings.Append(String8::ToString(i));
+
+        CheckDistribution([&](Size i) { return Hash<String8>()(strings[i]); });
+
+        // Descriptors differing in one member
+        CheckDistribution([](Size i) { return Hashing::HashValues((Uint8)1, (Float32)i, (Uint32)(i % 16)); });
+    }
+
+    DOCTEST_SUBCASE("Strings")
+    {
+        String8 string = "Hello, World!";
+
+        DOCTEST_CHECK(Hash<String8>()(string) == Hash<StringView<Char>>()(StringView<Char>(string)));
+        DOCTEST_CHECK(Hash<String8>()(string) == Hash<StringView<Char>>()("Hello, World!"));
+        DOCTEST_CHECK(Hash<String8>()(string) != Hash<String8>()("Hello, World?"));
+        DOCTEST_CHECK(Hash<String8>()(String8()) == Hash<StringView<Char>>()(StringView<Char>("")));
+
+        WString wideString = L"Hello, World!";
+
+        DOCTEST_CHECK(Hash<WString>()(wideString) == Hash<StringView<WChar>>()(L"Hello, World!"));
+
+        HashSet<String8> set;
+
+        set.Insert("First");
+        set.Insert("Second");
+
+        DOCTEST_CHECK(set.Find("First") != set.end());
+        DOCTEST_CHECK(set.Find("Third") == set.end());
+    }
+
+    DOCTEST_SUBCASE("Values and descriptors")
+    {
+        DOCTEST_CHECK(Hash<Float32>()(0.0f) == Hash<Float32>()(-0.0f));
+        DOCTEST_CHECK(Hash<Float64>()(1.0) != Hash<Float64>()(-1.0));
+
+        // The padding bytes differ but aren't hashed
+        alignas(PaddedDescriptor) std::byte firstStorage[sizeof(PaddedDescriptor)];
+        alignas(PaddedDescriptor) std::byte secondStorage[sizeof(PaddedDescriptor)];
+
+        std::memset(firstStorage, 0xAA, sizeof(firstStorage));
+        std::memset(secondStorage, 0x55, sizeof(secondStorage));
+
+        auto& first  = *new (firstStorage) PaddedDescriptor;
+        auto& second = *new (secondStorage) PaddedDescriptor;
+
+        first.Mode = second.Mode = 3;
+        first.Bias = second.Bias = 0.5f;
+        first.Level = second.Level = 8;
+
+        auto hashDescriptor = [](const PaddedDescriptor& descriptor) {
+            return Hashing::HashValues(descriptor.Mode, descriptor.Bias, descriptor.Level);
+        };
+
+        DOCTEST_CHECK(hashDescriptor(first) == hashDescriptor(second));
+
+        second.Level = 9;
+
+        DOCTEST_CHECK(hashDescriptor(first) != hashDescriptor(second));
+
+        // The members are hashed in one pass, not combined one by one
+        DOCTEST_CHECK(Hashing::HashPod(PackedDescriptor{1, 2}) == Hashing::HashValues((Uint32)1, (Uint32)2));
+        DOCTEST_CHECK(Hashing::HashPod(PackedDescriptor{1, 2}) != Hashing::HashPod(PackedDescriptor{2, 1}));
+
+        DOCTEST_CHECK(Hashing::Combine(1, 2) != Hashing::Combine(2, 1));
+    }
+}
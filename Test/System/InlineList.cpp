@@ -0,0 +1,291 @@
+#include <Axis/System>
+#include <doctest.h>
+
+using namespace Axis;
+using namespace Axis::System;
+
+namespace
+{
+
+struct InlineListAllocationTag
+{
+    static constexpr const char* Name = "Test::InlineList";
+};
+
+using CountedAllocator = TrackingAllocator<DefaultAllocator, InlineListAllocationTag>;
+
+Size GetLiveAllocationCount()
+{
+    return AllocationTracker::GetStatistics(InlineListAllocationTag::Name).LiveAllocationCount;
+}
+
+// Keeps track of the live instances, neither trivially relocatable nor nothrow copyable
+struct Counted
+{
+    static inline Int32 LiveCount = 0;
+    static inline Int32 ThrowAfter = -1; // Number of copies until the copy constructor throws, negative never throws
+
+    Counted(Int32 value = 0) :
+        Value(value) { LiveCount++; }
+
+    Counted(const Counted& other) :
+        Value(other.Value)
+    {
+        if (ThrowAfter == 0)
+            throw InvalidOperationException("Copy failed");
+
+        if (ThrowAfter > 0)
+            ThrowAfter--;
+
+        LiveCount++;
+    }
+
+    Counted& operator=(const Counted& other)
+    {
+        Value = other.Value;
+        return *this;
+    }
+
+    ~Counted() noexcept { LiveCount--; }
+
+    Int32 Value = 0;
+};
+
+} // namespace
+
+DOCTEST_TEST_CASE("Inline list : [Axis::System]")
+{
+    DOCTEST_SUBCASE("Stays in place up to the inline capacity")
+    {
+        auto allocationCount = GetLiveAllocationCount();
+
+        InlineList<Int32, 4, CountedAllocator> list;
+
+        for (Int32 i = 0; i < 4; ++i)
+            list.Append(i);
+
+        DOCTEST_CHECK(list.IsInline());
+        DOCTEST_CHECK(list.GetCapacity() == 4);
+        DOCTEST_CHECK(GetLiveAllocationCount() == allocationCount);
+
+        // Spills to the allocator
+        list.Append(4);
+
+        DOCTEST_CHECK(!list.IsInline());
+        DOCTEST_CHECK(list.GetCapacity() >= 5);
+        DOCTEST_CHECK(GetLiveAllocationCount() == allocationCount + 1);
+
+        for (Int32 i = 0; i < 5; ++i)
+            DOCTEST_CHECK(list[i] == i);
+
+        // Shrinking doesn't move the elements back
+        list.PopBack();
+        list.PopBack();
+
+        DOCTEST_CHECK(list.GetLength() == 3);
+        DOCTEST_CHECK(!list.IsInline());
+    }
+
+    DOCTEST_SUBCASE("Constructors and assignments")
+    {
+        InlineList<Int32, 4> empty;
+        InlineList<Int32, 4> small  = {1, 2, 3};
+        InlineList<Int32, 4> large  = {1, 2, 3, 4, 5, 6};
+        InlineList<Int32, 4> filled(6, 7);
+
+        DOCTEST_CHECK(!empty);
+        DOCTEST_CHECK(empty.begin() == empty.end());
+        DOCTEST_CHECK(small.GetLength() == 3);
+        DOCTEST_CHECK(small.IsInline());
+        DOCTEST_CHECK(large.GetLength() == 6);
+        DOCTEST_CHECK(!large.IsInline());
+        DOCTEST_CHECK(filled.GetLength() == 6);
+        DOCTEST_CHECK(filled[5] == 7);
+
+        // Copies
+        InlineList<Int32, 4> smallCopy(small);
+        InlineList<Int32, 4> largeCopy(large);
+
+        DOCTEST_CHECK(smallCopy.GetLength() == 3);
+        DOCTEST_CHECK(smallCopy[2] == 3);
+        DOCTEST_CHECK(largeCopy.GetLength() == 6);
+        DOCTEST_CHECK(largeCopy[5] == 6);
+        DOCTEST_CHECK(largeCopy.GetData() != large.GetData());
+
+        smallCopy = large;
+
+        DOCTEST_CHECK(smallCopy.GetLength() == 6);
+        DOCTEST_CHECK(smallCopy[5] == 6);
+
+        largeCopy = small;
+
+        DOCTEST_CHECK(largeCopy.GetLength() == 3);
+        DOCTEST_CHECK(largeCopy[0] == 1);
+
+        // Moves, the allocated memory is taken along and the inline elements are moved
+        auto largeData = large.GetData();
+
+        InlineList<Int32, 4> largeMoved(std::move(large));
+        InlineList<Int32, 4> smallMoved(std::move(small));
+
+        DOCTEST_CHECK(largeMoved.GetData() == largeData);
+        DOCTEST_CHECK(largeMoved.GetLength() == 6);
+        DOCTEST_CHECK(large.GetLength() == 0);
+        DOCTEST_CHECK(large.IsInline());
+        DOCTEST_CHECK(smallMoved.GetLength() == 3);
+        DOCTEST_CHECK(smallMoved.IsInline());
+        DOCTEST_CHECK(smallMoved[1] == 2);
+        DOCTEST_CHECK(small.GetLength() == 0);
+
+        smallMoved = std::move(largeMoved);
+
+        DOCTEST_CHECK(smallMoved.GetData() == largeData);
+        DOCTEST_CHECK(smallMoved.GetLength() == 6);
+        DOCTEST_CHECK(largeMoved.GetLength() == 0);
+
+        // The moved from list is usable
+        largeMoved.Append(10);
+
+        DOCTEST_CHECK(largeMoved[0] == 10);
+    }
+
+    DOCTEST_SUBCASE("Insertion and removal")
+    {
+        InlineList<String8, 2> list;
+
+        list.Append("B");
+        list.Emplace(0, "A");
+
+        DOCTEST_CHECK(list.IsInline());
+
+        // Grows while inserting in the middle
+        list.Emplace(1, "AB");
+        list.EmplaceBack("C");
+
+        DOCTEST_CHECK(list.GetLength() == 4);
+        DOCTEST_CHECK(list[0] == "A");
+        DOCTEST_CHECK(list[1] == "AB");
+        DOCTEST_CHECK(list[2] == "B");
+        DOCTEST_CHECK(list[3] == "C");
+
+        // The argument refers to an element of the list being moved
+        list.Append(list[0]);
+        list.Emplace(0, list[3]);
+
+        DOCTEST_CHECK(list[0] == "C");
+        DOCTEST_CHECK(list[5] == "A");
+
+        list.RemoveAt(0);
+        list.RemoveAt(1);
+
+        DOCTEST_CHECK(list.GetLength() == 4);
+        DOCTEST_CHECK(list[0] == "A");
+        DOCTEST_CHECK(list[1] == "B");
+
+        DOCTEST_CHECK_THROWS_AS(list.RemoveAt(4), ArgumentOutOfRangeException);
+        DOCTEST_CHECK_THROWS_AS(list.Emplace(5, "D"), ArgumentOutOfRangeException);
+        DOCTEST_CHECK_THROWS_AS((void)list[4], ArgumentOutOfRangeException);
+
+        list.Resize(6);
+
+        DOCTEST_CHECK(list[1] == "B");
+        DOCTEST_CHECK(list[5] == "");
+
+        list.Resize(1);
+
+        DOCTEST_CHECK(list.GetLength() == 1);
+        DOCTEST_CHECK(list[0] == "A");
+
+        list.Clear();
+
+        DOCTEST_CHECK(list.GetLength() == 0);
+    }
+
+    DOCTEST_SUBCASE("Copy assigning the elements with the throwing copy")
+    {
+        auto allocationCount = GetLiveAllocationCount();
+
+        InlineList<String8, 2, CountedAllocator> small = {"A", "B"};
+        InlineList<String8, 2, CountedAllocator> large = {"C", "D", "E"};
+
+        DOCTEST_CHECK(GetLiveAllocationCount() == allocationCount + 1);
+
+        // The source fits in place, the copies go to the inline storage and the memory is released
+        large = small;
+
+        DOCTEST_CHECK(large.IsInline());
+        DOCTEST_CHECK(large.GetLength() == 2);
+        DOCTEST_CHECK(large[1] == "B");
+        DOCTEST_CHECK(GetLiveAllocationCount() == allocationCount);
+
+        small = InlineList<String8, 2, CountedAllocator>{"F"};
+        large = small;
+
+        DOCTEST_CHECK(large.IsInline());
+        DOCTEST_CHECK(large.GetLength() == 1);
+        DOCTEST_CHECK(large[0] == "F");
+        DOCTEST_CHECK(GetLiveAllocationCount() == allocationCount);
+    }
+
+    DOCTEST_SUBCASE("Non-trivially relocatable elements")
+    {
+        {
+            InlineList<Counted, 2> list;
+
+            for (Int32 i = 0; i < 10; ++i)
+                list.Emplace(i / 2, i);
+
+            DOCTEST_CHECK(Counted::LiveCount == 10);
+
+            list.RemoveAt(3);
+            list.Reset(5);
+
+            DOCTEST_CHECK(Counted::LiveCount == 9);
+            DOCTEST_CHECK(list[8].Value == 5);
+
+            InlineList<Counted, 2> copy = list;
+
+            DOCTEST_CHECK(Counted::LiveCount == 18);
+        }
+
+        DOCTEST_CHECK(Counted::LiveCount == 0);
+    }
+
+    DOCTEST_SUBCASE("Strong exception guarantee")
+    {
+        {
+            InlineList<Counted, 2> list = {Counted(1), Counted(2)};
+
+            // Throws while copying the elements to the allocated memory
+            Counted::ThrowAfter = 1;
+
+            DOCTEST_CHECK_THROWS_AS(list.EmplaceBack(3), InvalidOperationException);
+            DOCTEST_CHECK(list.GetLength() == 2);
+            DOCTEST_CHECK(list.IsInline());
+            DOCTEST_CHECK(list[1].Value == 2);
+
+            Counted::ThrowAfter = 1;
+
+            DOCTEST_CHECK_THROWS_AS(list.Emplace(1, 3), InvalidOperationException);
+            DOCTEST_CHECK(list.GetLength() == 2);
+            DOCTEST_CHECK(list[0].Value == 1);
+            DOCTEST_CHECK(list[1].Value == 2);
+
+            Counted::ThrowAfter = -1;
+
+            InlineList<Counted, 2> other = {Counted(3), Counted(4), Counted(5)};
+
+            Counted::ThrowAfter = 2;
+
+            DOCTEST_CHECK_THROWS_AS(list = other, InvalidOperationException);
+            DOCTEST_CHECK(list.GetLength() == 2);
+            DOCTEST_CHECK(list[1].Value == 2);
+
+            Counted::ThrowAfter = -1;
+
+            DOCTEST_CHECK(Counted::LiveCount == 5);
+        }
+
+        DOCTEST_CHECK(Counted::LiveCount == 0);
+    }
+}
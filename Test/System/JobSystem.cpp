@@ -0,0 +1,191 @@
+#include <Axis/System>
+#include <atomic>
+#include <doctest.h>
+#include <thread>
+#include <vector>
+
+using namespace Axis;
+using namespace Axis::System;
+
+namespace
+{
+
+// Computes the fibonacci number by forking the jobs down to the cutoff.
+Uint64 Fibonacci(JobSystem& jobSystem,
+                 Uint64     n)
+{
+    if (n < 12)
+        return n < 2 ? n : Fibonacci(jobSystem, n - 1) + Fibonacci(jobSystem, n - 2);
+
+    Uint64     first = 0;
+    JobCounter counter;
+
+    jobSystem.Submit([&]() { first = Fibonacci(jobSystem, n - 1); }, &counter);
+
+    const Uint64 second = Fibonacci(jobSystem, n - 2);
+
+    jobSystem.WaitFor(counter);
+
+    return first + second;
+}
+
+} // namespace
+
+DOCTEST_TEST_CASE("Job system : [Axis::System]")
+{
+    DOCTEST_SUBCASE("Submitting and waiting")
+    {
+        JobSystem jobSystem(4);
+
+        DOCTEST_CHECK(jobSystem.GetWorkerCount() == 4);
+        DOCTEST_CHECK_FALSE(jobSystem.IsWorkerThread());
+
+        constexpr Size JobCount = 10000;
+
+        std::atomic<Size> sum = 0;
+        JobCounter        counter;
+
+        for (Size i = 0; i < JobCount; ++i)
+            jobSystem.Submit([&, i]() { sum.fetch_add(i, std::memory_order_relaxed); }, &counter);
+
+        jobSystem.WaitFor(counter);
+
+        DOCTEST_CHECK(counter.IsDone());
+        DOCTEST_CHECK(sum.load() == JobCount * (JobCount - 1) / 2);
+
+        // The counter can be reused.
+        jobSystem.Submit([&]() { sum.fetch_add(1, std::memory_order_relaxed); }, &counter);
+        jobSystem.WaitFor(counter);
+
+        DOCTEST_CHECK(sum.load() == JobCount * (JobCount - 1) / 2 + 1);
+
+        // Waits without running the job, so only a worker can run it.
+        std::atomic<Bool> isWorkerThread = false;
+        std::atomic<Bool> ran            = false;
+
+        jobSystem.Submit([&]() {
+            isWorkerThread = jobSystem.IsWorkerThread();
+            ran            = true;
+        });
+
+        while (!ran)
+            std::this_thread::yield();
+
+        DOCTEST_CHECK(isWorkerThread.load());
+    }
+
+    DOCTEST_SUBCASE("Fork-join inside the jobs")
+    {
+        JobSystem jobSystem(3);
+
+        Uint64     result = 0;
+        JobCounter counter;
+
+        jobSystem.Submit([&]() { result = Fibonacci(jobSystem, 25); }, &counter);
+        jobSystem.WaitFor(counter);
+
+        DOCTEST_CHECK(result == 75025);
+
+        // Forks from the calling thread as well.
+        DOCTEST_CHECK(Fibonacci(jobSystem, 24) == 46368);
+    }
+
+    DOCTEST_SUBCASE("Dependencies")
+    {
+        JobSystem jobSystem(4);
+
+        constexpr Size FirstCount = 100;
+
+        std::atomic<Size> firstFinished      = 0;
+        std::atomic<Size> seenByDependent[3] = {};
+        JobCounter        first;
+        JobCounter        second;
+
+        for (Size i = 0; i < FirstCount; ++i)
+        {
+            jobSystem.Submit([&]() {
+                std::this_thread::yield();
+                firstFinished.fetch_add(1);
+            },
+                             &first);
+        }
+
+        for (auto& seen : seenByDependent)
+            jobSystem.Submit([&]() { seen = firstFinished.load(); }, first, &second);
+
+        jobSystem.WaitFor(second);
+
+        for (const auto& seen : seenByDependent)
+            DOCTEST_CHECK(seen.load() == FirstCount);
+
+        // The dependency has already finished, the job starts right away.
+        Bool ran = false;
+
+        jobSystem.Submit([&]() { ran = true; }, first, &second);
+        jobSystem.WaitFor(second);
+
+        DOCTEST_CHECK(ran);
+
+        // A chain of the dependencies, each link waits for the previous one.
+        constexpr Size ChainLength = 50;
+
+        std::vector<Size> order;
+        JobCounter        links[ChainLength];
+
+        jobSystem.Submit([&]() { order.push_back(0); }, &links[0]);
+
+        for (Size i = 1; i < ChainLength; ++i)
+            jobSystem.Submit([&, i]() { order.push_back(i); }, links[i - 1], &links[i]);
+
+        jobSystem.WaitFor(links[ChainLength - 1]);
+
+        DOCTEST_CHECK(order.size() == ChainLength);
+
+        for (Size i = 0; i < order.size(); ++i)
+            DOCTEST_CHECK(order[i] == i);
+    }
+
+    DOCTEST_SUBCASE("Submitting from the other threads")
+    {
+        JobSystem jobSystem(2);
+
+        constexpr Size ThreadCount   = 4;
+        constexpr Size JobsPerThread = 2000;
+
+        std::atomic<Size>        executed = 0;
+        std::vector<std::thread> threads;
+
+        for (Size thread = 0; thread < ThreadCount; ++thread)
+        {
+            threads.emplace_back([&]() {
+                JobCounter counter;
+
+                for (Size i = 0; i < JobsPerThread; ++i)
+                    jobSystem.Submit([&]() { executed.fetch_add(1, std::memory_order_relaxed); }, &counter);
+
+                jobSystem.WaitFor(counter);
+            });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        DOCTEST_CHECK(executed.load() == ThreadCount * JobsPerThread);
+    }
+
+    DOCTEST_SUBCASE("Destructor runs the remaining jobs")
+    {
+        std::atomic<Size> executed = 0;
+
+        {
+            JobSystem jobSystem(1);
+
+            for (Size i = 0; i < 1000; ++i)
+                jobSystem.Submit([&]() { executed.fetch_add(1, std::memory_order_relaxed); });
+        }
+
+        DOCTEST_CHECK(executed.load() == 1000);
+
+        DOCTEST_CHECK_THROWS_AS(JobSystem(0), InvalidArgumentException);
+    }
+}
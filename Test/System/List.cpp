@@ -412,5 +412,59 @@ DOCTEST_TEST_CASE("Axis list data structure : [Axis::System]")
             // Checks the validity of list
             CHECK(list.GetLength() == 0);
         }
+
+        DOCTEST_SUBCASE("Trivially relocatable elements")
+        {
+            static_assert(TriviallyRelocatable<SharedPointer<Int32>>);
+            static_assert(TriviallyRelocatable<List<Int32>>);
+            static_assert(!TriviallyRelocatable<std::string>);
+
+            // Grows the list by reallocation, the elements are relocated bytewise
+            List<SharedPointer<Int32>> list;
+
+            for (Int32 i = 0; i < 100; ++i)
+                list.Append(MakeShared<Int32>(i));
+
+            CHECK(list.GetLength() == 100);
+
+            for (Int32 i = 0; i < 100; ++i)
+            {
+                CHECK(*list[i] == i);
+                CHECK(list[i].GetStrongCount() == 1);
+            }
+
+            // Appends the element of the list itself while the list is full
+            while (list.GetLength() < 128)
+                list.Append(MakeShared<Int32>(0));
+
+            list.Append(list[0]);
+
+            CHECK(list.GetLength() == 129);
+            CHECK(list[128] == list[0]);
+            CHECK(list[0].GetStrongCount() == 2);
+
+            // Emplaces in the middle
+            auto emplaced = MakeShared<Int32>(-1);
+
+            list.Emplace(50, emplaced);
+
+            CHECK(list.GetLength() == 130);
+            CHECK(*list[49] == 49);
+            CHECK(*list[50] == -1);
+            CHECK(*list[51] == 50);
+            CHECK(emplaced.GetStrongCount() == 2);
+
+            // Removes the element, it must be destructed
+            list.RemoveAt(50);
+
+            CHECK(list.GetLength() == 129);
+            CHECK(*list[50] == 50);
+            CHECK(emplaced.GetStrongCount() == 1);
+
+            list.RemoveAt(0);
+
+            CHECK(*list[0] == 1);
+            CHECK(list[127].GetStrongCount() == 1);
+        }
     }
 }
\ No newline at end of file
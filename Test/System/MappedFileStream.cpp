@@ -0,0 +1,119 @@
+#include <Axis/System>
+#include <cstdio>
+#include <doctest.h>
+#include <filesystem>
+#include <string>
+
+using namespace Axis;
+using namespace Axis::System;
+
+namespace
+{
+
+// Writes the bytes to the file in the temporary directory and returns its path.
+std::wstring WriteTemporaryFile(const char* name,
+                                const Byte* bytes,
+                                Size        length)
+{
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+
+    std::FILE* file = std::fopen(path.string().c_str(), "wb");
+
+    DOCTEST_REQUIRE(file != nullptr);
+    DOCTEST_REQUIRE(std::fwrite(bytes, 1, length, file) == length);
+
+    std::fclose(file);
+
+    return path.wstring();
+}
+
+} // namespace
+
+DOCTEST_TEST_CASE("Mapped file stream : [Axis::System]")
+{
+    Byte content[10000] = {};
+
+    for (Size i = 0; i < sizeof(content); ++i)
+        content[i] = (Byte)(i * 7);
+
+    const std::wstring path = WriteTemporaryFile("AxisMappedFileStream.bin", content, sizeof(content));
+
+    DOCTEST_SUBCASE("View")
+    {
+        MappedFileStream stream(path.c_str());
+
+        DOCTEST_CHECK(stream.IsOpen());
+        DOCTEST_CHECK(stream.CanRead());
+        DOCTEST_CHECK_FALSE(stream.CanWrite());
+        DOCTEST_CHECK(stream.GetLength() == sizeof(content));
+
+        const Span<Byte> view = stream.GetView();
+
+        DOCTEST_REQUIRE(view.GetLength() == sizeof(content));
+        DOCTEST_CHECK(std::memcmp(view.GetData(), content, sizeof(content)) == 0);
+
+        // Only hints, must accept any range.
+        stream.Prefetch(0, sizeof(content));
+        stream.Prefetch(4097, 100000);
+        stream.Prefetch(sizeof(content), 1);
+    }
+
+    DOCTEST_SUBCASE("Read and seek")
+    {
+        MappedFileStream stream(path.c_str(), FileAccessPattern::Random);
+
+        Byte buffer[16] = {};
+
+        DOCTEST_CHECK(stream.Read(buffer, 4, 8) == 8);
+        DOCTEST_CHECK(std::memcmp(buffer + 4, content, 8) == 0);
+        DOCTEST_CHECK(stream.GetPosition() == 8);
+
+        DOCTEST_CHECK(stream.Seek(-4, SeekOrigin::End) == sizeof(content) - 4);
+        DOCTEST_CHECK(stream.Read(buffer, 0, 16) == 4);
+        DOCTEST_CHECK(std::memcmp(buffer, content + sizeof(content) - 4, 4) == 0);
+        DOCTEST_CHECK(stream.Read(buffer, 0, 16) == 0);
+
+        DOCTEST_CHECK(stream.Seek(-100, SeekOrigin::Current) == sizeof(content) - 100);
+        DOCTEST_CHECK_THROWS_AS(stream.Seek(-1, SeekOrigin::Begin), ArgumentOutOfRangeException);
+        DOCTEST_CHECK_THROWS_AS(stream.Write(buffer, 0, 1), InvalidOperationException);
+    }
+
+    DOCTEST_SUBCASE("Move")
+    {
+        MappedFileStream stream(path.c_str());
+        MappedFileStream moved(std::move(stream));
+
+        DOCTEST_CHECK_FALSE(stream.IsOpen());
+        DOCTEST_CHECK_THROWS_AS((void)stream.GetLength(), InvalidOperationException);
+        DOCTEST_CHECK(moved.GetView()[9999] == content[9999]);
+
+        stream = std::move(moved);
+
+        DOCTEST_CHECK(stream.IsOpen());
+        DOCTEST_CHECK(stream.GetView()[1234] == content[1234]);
+    }
+
+    DOCTEST_SUBCASE("Empty file")
+    {
+        const std::wstring emptyPath = WriteTemporaryFile("AxisMappedFileStreamEmpty.bin", content, 0);
+
+        MappedFileStream stream(emptyPath.c_str());
+
+        DOCTEST_CHECK(stream.IsOpen());
+        DOCTEST_CHECK(stream.GetLength() == 0);
+        DOCTEST_CHECK(stream.GetView().GetLength() == 0);
+
+        Byte buffer[4] = {};
+
+        DOCTEST_CHECK(stream.Read(buffer, 0, 4) == 0);
+
+        std::filesystem::remove(emptyPath);
+    }
+
+    DOCTEST_SUBCASE("Missing file")
+    {
+        DOCTEST_CHECK_THROWS_AS(MappedFileStream(L"AxisMissingFile.bin"), FileNotFoundException);
+    }
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,200 @@
+#include <Axis/System>
+#include <cmath>
+#include <doctest.h>
+
+using namespace Axis;
+using namespace Axis::System;
+
+namespace
+{
+
+// Generates the well-conditioned matrices, the diagonal dominates the other elements.
+template <Bool IsColumnMajor = true>
+Matrix<Float32, 4, 4, IsColumnMajor> GenerateMatrix(Uint32& seed)
+{
+    Matrix<Float32, 4, 4, IsColumnMajor> matrix;
+
+    for (Size row = 0; row < 4; ++row)
+    {
+        for (Size column = 0; column < 4; ++column)
+        {
+            seed = seed * 1664525u + 1013904223u;
+
+            matrix(row, column) = (Float32)(seed >> 8) / (Float32)(1u << 24) * 2.0f - 1.0f;
+        }
+
+        matrix(row, row) += 4.0f;
+    }
+
+    return matrix;
+}
+
+template <Bool IsColumnMajor>
+Bool IsMatrixEqual(const Matrix<Float32, 4, 4, IsColumnMajor>& first,
+                   const Matrix<Float32, 4, 4, IsColumnMajor>& second,
+                   Float32                                     tolerance = 1e-5f)
+{
+    for (Size row = 0; row < 4; ++row)
+    {
+        for (Size column = 0; column < 4; ++column)
+        {
+            if (std::abs(first(row, column) - second(row, column)) > tolerance)
+                return false;
+        }
+    }
+
+    return true;
+}
+
+template <Bool IsColumnMajor>
+const Float32* GetElements(const Matrix<Float32, 4, 4, IsColumnMajor>& matrix)
+{
+    return &matrix(0, 0);
+}
+
+template <Bool IsColumnMajor>
+Float32* GetElements(Matrix<Float32, 4, 4, IsColumnMajor>& matrix)
+{
+    return &matrix(0, 0);
+}
+
+constexpr FloatMatrix4x4 GetConstantProduct()
+{
+    FloatMatrix4x4 translation = FloatMatrix4x4::GetTranslationMatrix({1.0f, 2.0f, 3.0f});
+    FloatMatrix4x4 scaling     = FloatMatrix4x4::GetScalingMatrix({2.0f, 2.0f, 2.0f});
+
+    return (translation * scaling).GetTransposed().GetTransposed();
+}
+
+} // namespace
+
+DOCTEST_TEST_CASE("Matrix template class : [Axis::System]")
+{
+    DOCTEST_SUBCASE("Constant evaluation")
+    {
+        constexpr FloatMatrix4x4 product = GetConstantProduct();
+        constexpr FloatMatrix4x4 inverse = product.GetInverse();
+
+        static_assert(product(0, 0) == 2.0f && product(0, 3) == 1.0f && product(2, 3) == 3.0f);
+        static_assert(inverse(0, 0) == 0.5f && inverse(0, 3) == -0.5f && inverse(2, 3) == -1.5f);
+        static_assert(product.TransformPoint(Vector3F(1.0f, 1.0f, 1.0f)) == Vector3F(3.0f, 4.0f, 5.0f));
+        static_assert(product.TransformDirection(Vector3F(1.0f, 1.0f, 1.0f)) == Vector3F(2.0f, 2.0f, 2.0f));
+
+        DOCTEST_CHECK(IsMatrixEqual(GetConstantProduct(), product));
+        DOCTEST_CHECK(IsMatrixEqual(product.GetInverse(), inverse));
+    }
+
+    DOCTEST_SUBCASE("Non-square matrices")
+    {
+        Matrix<Int32, 2, 3> left({{1, 2, 3}, {4, 5, 6}});
+        Matrix<Int32, 3, 2> right({{7, 8}, {9, 10}, {11, 12}});
+
+        auto product = left * right;
+
+        DOCTEST_CHECK(product(0, 0) == 58);
+        DOCTEST_CHECK(product(0, 1) == 64);
+        DOCTEST_CHECK(product(1, 0) == 139);
+        DOCTEST_CHECK(product(1, 1) == 154);
+
+        Matrix<Int32, 3, 2, false> transposed = Matrix<Int32, 2, 3, false>({{1, 2, 3}, {4, 5, 6}}).GetTransposed();
+
+        DOCTEST_CHECK(transposed(0, 1) == 4);
+        DOCTEST_CHECK(transposed(2, 0) == 3);
+    }
+
+    DOCTEST_SUBCASE("SIMD kernels agree with the scalar ones")
+    {
+        Uint32 seed = 42;
+
+        for (Size i = 0; i < 256; ++i)
+        {
+            const FloatMatrix4x4 left  = GenerateMatrix(seed);
+            const FloatMatrix4x4 right = GenerateMatrix(seed);
+
+            FloatMatrix4x4 expected;
+
+            Detail::MultiplyMatrixScalar<Float32, 4, 4, 4>(GetElements(left), GetElements(right), GetElements(expected));
+            DOCTEST_CHECK(IsMatrixEqual(left * right, expected));
+
+            Detail::TransposeMatrixScalar<Float32, 4, 4>(GetElements(left), GetElements(expected));
+            DOCTEST_CHECK(IsMatrixEqual(left.GetTransposed(), expected, 0.0f));
+
+            Detail::InverseMatrix4x4Scalar(GetElements(left), GetElements(expected));
+            DOCTEST_CHECK(IsMatrixEqual(left.GetInverse(), expected));
+
+            // The inverse undoes the matrix
+            DOCTEST_CHECK(IsMatrixEqual(left * left.GetInverse(), FloatMatrix4x4::GetIdentityMatrix()));
+            DOCTEST_CHECK(IsMatrixEqual(left.GetInverse() * left, FloatMatrix4x4::GetIdentityMatrix()));
+
+            const Vector3F point(right(0, 0), right(1, 1), right(2, 2));
+            const Float32  vector[4] = {point.X, point.Y, point.Z, 1.0f};
+            Float32        transformed[4];
+
+            Detail::TransformVector4Scalar(GetElements(left), vector, transformed);
+
+            const Vector3F result = left.TransformPoint(point);
+
+            DOCTEST_CHECK(std::abs(result.X - transformed[0]) < 1e-5f);
+            DOCTEST_CHECK(std::abs(result.Y - transformed[1]) < 1e-5f);
+            DOCTEST_CHECK(std::abs(result.Z - transformed[2]) < 1e-5f);
+        }
+    }
+
+    DOCTEST_SUBCASE("Row-major matrices")
+    {
+        Uint32 seed = 7;
+
+        for (Size i = 0; i < 64; ++i)
+        {
+            const auto left  = GenerateMatrix<false>(seed);
+            const auto right = GenerateMatrix<false>(seed);
+
+            const auto product = left * right;
+
+            for (Size row = 0; row < 4; ++row)
+            {
+                for (Size column = 0; column < 4; ++column)
+                {
+                    Float32 expected = 0.0f;
+
+                    for (Size common = 0; common < 4; ++common)
+                        expected += left(row, common) * right(common, column);
+
+                    DOCTEST_CHECK(std::abs(product(row, column) - expected) < 1e-5f);
+                }
+            }
+
+            DOCTEST_CHECK(IsMatrixEqual(left * left.GetInverse(), Matrix<Float32, 4, 4, false>::GetIdentityMatrix()));
+
+            const Vector3F transformed = left.TransformDirection(Vector3F(1.0f, 0.0f, 0.0f));
+
+            DOCTEST_CHECK(transformed == Vector3F(left(0, 0), left(1, 0), left(2, 0)));
+        }
+    }
+
+    DOCTEST_SUBCASE("Vector3 length and normalize")
+    {
+        Uint32 seed = 1;
+
+        for (Size i = 0; i < 256; ++i)
+        {
+            const FloatMatrix4x4 matrix = GenerateMatrix(seed);
+            const Vector3F       vector(matrix(0, 1), matrix(1, 2) * 100.0f, matrix(2, 3) * 0.01f);
+
+            const Float32 expected = (Float32)std::sqrt((double)vector.X * vector.X + (double)vector.Y * vector.Y + (double)vector.Z * vector.Z);
+
+            DOCTEST_CHECK(std::abs(vector.GetLength() - expected) <= expected * 1e-6f);
+            DOCTEST_CHECK(std::abs(vector.NormalizeCopy().GetLength() - 1.0f) < 1e-6f);
+
+            Vector3F normalized = vector;
+            normalized.Normalize();
+
+            DOCTEST_CHECK(std::abs(normalized.X - vector.X / expected) < 1e-6f);
+            DOCTEST_CHECK(std::abs(normalized.Y - vector.Y / expected) < 1e-6f);
+            DOCTEST_CHECK(std::abs(normalized.Z - vector.Z / expected) < 1e-6f);
+        }
+
+        static_assert(Vector3F(3.0f, 4.0f, 12.0f).GetLength() == 13.0f);
+        static_assert(Vector3<Float64>(0.0, 3.0, 4.0).NormalizeCopy() == Vector3<Float64>(0.0, 0.6, 0.8));
+    }
+}
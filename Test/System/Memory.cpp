@@ -1,9 +1,36 @@
 #include <Axis/System>
 #include <doctest.h>
+#include <thread>
+#include <vector>
 
 using namespace Axis;
 using namespace Axis::System;
 
+namespace
+{
+
+// Touches the pool allocator while the thread exits, after the thread's pool cache has been destroyed.
+struct ThreadExitDeallocation
+{
+    PVoid Memory    = nullptr;
+    Bool* Completed = nullptr;
+
+    ~ThreadExitDeallocation() noexcept
+    {
+        if (!Completed)
+            return;
+
+        PoolAllocator::Deallocate(Memory);
+        PoolAllocator::Deallocate(PoolAllocator::Allocate(32, 8));
+
+        *Completed = true;
+    }
+};
+
+thread_local ThreadExitDeallocation t_threadExitDeallocation = {};
+
+} // namespace
+
 DOCTEST_TEST_CASE("Axis memory allocation : [Axis-System]")
 {
     DOCTEST_SUBCASE("Allocators")
@@ -37,6 +64,233 @@ DOCTEST_TEST_CASE("Axis memory allocation : [Axis-System]")
             // Frees the allocated memory
             PoolAllocator::Deallocate(allocatedMemory);
         }
+
+        DOCTEST_SUBCASE("`Axis::PoolAllocator` across multiple threads")
+        {
+            constexpr Size ThreadCount     = 8;
+            constexpr Size AllocationCount = 1024;
+
+            // Memory allocated on one thread and deallocated on another
+            PVoid allocatedMemories[ThreadCount][AllocationCount] = {};
+
+            std::vector<std::thread> threads;
+
+            // Each thread allocates and writes its own blocks
+            for (Size i = 0; i < ThreadCount; ++i)
+            {
+                threads.emplace_back([&, i]() {
+                    for (Size j = 0; j < AllocationCount; ++j)
+                    {
+                        Size size      = 8 + (j % 7) * 24;
+                        Size alignment = Size(1) << (j % 6);
+
+                        auto memory = PoolAllocator::Allocate(size, alignment);
+
+                        DOCTEST_CHECK(reinterpret_cast<uintptr_t>(memory) % alignment == 0);
+
+                        std::memset(memory, (int)i, size);
+
+                        allocatedMemories[i][j] = memory;
+                    }
+                });
+            }
+
+            for (auto& thread : threads)
+                thread.join();
+
+            threads.clear();
+
+            // Each thread verifies and deallocates the blocks of its neighbour
+            for (Size i = 0; i < ThreadCount; ++i)
+            {
+                threads.emplace_back([&, i]() {
+                    Size owner = (i + 1) % ThreadCount;
+
+                    for (Size j = 0; j < AllocationCount; ++j)
+                    {
+                        DOCTEST_CHECK(*(Byte*)allocatedMemories[owner][j] == (Byte)owner);
+
+                        PoolAllocator::Deallocate(allocatedMemories[owner][j]);
+                    }
+                });
+            }
+
+            for (auto& thread : threads)
+                thread.join();
+        }
+
+        DOCTEST_SUBCASE("`Axis::PoolAllocator` after the thread's cache is destroyed")
+        {
+            Bool completed = false;
+
+            std::thread thread([&]() {
+                // Constructed before the pool cache, so it's destroyed after it.
+                t_threadExitDeallocation.Completed = &completed;
+                t_threadExitDeallocation.Memory    = PoolAllocator::Allocate(32, 8);
+            });
+
+            thread.join();
+
+            DOCTEST_CHECK(completed);
+        }
+
+        DOCTEST_SUBCASE("Allocate memory with `Axis::FrameArenaAllocator`")
+        {
+            Size frameNumber = FrameArenaAllocator::GetFrameNumber();
+
+            // Allocates memory for 16 bytes with alignment of 16 bytes
+            auto allocatedMemory = (Uint8*)FrameArenaAllocator::Allocate(16, 16);
+
+            // Checks if the allocated memory is aligned
+            DOCTEST_CHECK(reinterpret_cast<uintptr_t>(allocatedMemory) % 16 == 0);
+
+            std::memset(allocatedMemory, 0xAB, 16);
+
+            // Allocations larger than the chunk size
+            auto largeMemory = (Uint8*)FrameArenaAllocator::Allocate(FrameArenaAllocator::ChunkSize * 2, 64);
+
+            DOCTEST_CHECK(reinterpret_cast<uintptr_t>(largeMemory) % 64 == 0);
+
+            std::memset(largeMemory, 0xCD, FrameArenaAllocator::ChunkSize * 2);
+
+            // Containers can use the arena as well
+            List<Int32, FrameArenaAllocator> list;
+
+            for (Int32 i = 0; i < 1000; ++i)
+                list.Append(i);
+
+            FrameArenaAllocator::Reset();
+
+            DOCTEST_CHECK(FrameArenaAllocator::GetFrameNumber() == frameNumber + 1);
+
+            // The memory of the previous frame is still valid
+            DOCTEST_CHECK(allocatedMemory[15] == 0xAB);
+            DOCTEST_CHECK(largeMemory[(FrameArenaAllocator::ChunkSize * 2) - 1] == 0xCD);
+
+            for (Int32 i = 0; i < 1000; ++i)
+                DOCTEST_CHECK(list[i] == i);
+
+            FrameArenaAllocator::Reset();
+
+            DOCTEST_CHECK(FrameArenaAllocator::GetFrameNumber() == frameNumber + 2);
+        }
+
+        DOCTEST_SUBCASE("Reallocate memory")
+        {
+            static_assert(ReallocatableAllocatorType<MallocAllocator>);
+            static_assert(ReallocatableAllocatorType<PoolAllocator>);
+            static_assert(ReallocatableAllocatorType<FrameArenaAllocator>);
+
+            auto reallocate = [](auto allocator) {
+                auto memory = (Uint8*)allocator.Reallocate(nullptr, 0, 64, 32);
+
+                DOCTEST_CHECK(((Size)memory % 32) == 0);
+
+                for (Size i = 0; i < 64; ++i)
+                    memory[i] = (Uint8)i;
+
+                // Grows the memory, the contents are preserved
+                memory = (Uint8*)allocator.Reallocate(memory, 64, 4096, 32);
+
+                DOCTEST_CHECK(((Size)memory % 32) == 0);
+
+                for (Size i = 0; i < 64; ++i)
+                    DOCTEST_CHECK(memory[i] == (Uint8)i);
+
+                // Shrinks the memory
+                memory = (Uint8*)allocator.Reallocate(memory, 4096, 16, 32);
+
+                for (Size i = 0; i < 16; ++i)
+                    DOCTEST_CHECK(memory[i] == (Uint8)i);
+
+                allocator.Deallocate(memory);
+            };
+
+            reallocate(MallocAllocator());
+            reallocate(PoolAllocator());
+            reallocate(FrameArenaAllocator());
+        }
+
+        DOCTEST_SUBCASE("Containers with `Axis::PolymorphicAllocator`")
+        {
+            // Counts the live allocations and forwards them to the default resource
+            struct CountingMemoryResource final : public MemoryResource
+            {
+                PVoid Allocate(Size size,
+                               Size alignment) override
+                {
+                    ++AllocationCount;
+                    return GetDefaultMemoryResource()->Allocate(size, alignment);
+                }
+
+                void Deallocate(PVoid ptr) noexcept override
+                {
+                    --AllocationCount;
+                    GetDefaultMemoryResource()->Deallocate(ptr);
+                }
+
+                Size AllocationCount = 0;
+            };
+
+            // Stateless allocators don't take any space in the containers
+            DOCTEST_CHECK(sizeof(List<Int32>) == sizeof(PVoid) + sizeof(Size) * 2);
+
+            CountingMemoryResource countingResource;
+
+            {
+                List<Int32, PolymorphicAllocator> list(&countingResource);
+
+                for (Int32 i = 0; i < 100; ++i)
+                    list.Append(i);
+
+                DOCTEST_CHECK(countingResource.AllocationCount > 0);
+
+                // The copy uses the same memory resource
+                auto copiedList = list;
+
+                DOCTEST_CHECK(copiedList.GetAllocator() == list.GetAllocator());
+                DOCTEST_CHECK(copiedList[99] == 99);
+
+                // The moved list takes the memory resource along
+                List<Int32, PolymorphicAllocator> movedList;
+                movedList = std::move(copiedList);
+
+                DOCTEST_CHECK(movedList.GetAllocator().GetMemoryResource() == &countingResource);
+
+                HashMap<Int32, Int32, Hash<Int32>, EqualityComparer<Int32>, PolymorphicAllocator> hashMap(&countingResource);
+
+                for (Int32 i = 0; i < 100; ++i)
+                    hashMap.Insert({i, i * 2});
+
+                DOCTEST_CHECK(hashMap.Find(50)->Second == 100);
+
+                LinkedList<Int32, PolymorphicAllocator> linkedList(&countingResource);
+
+                linkedList.EmplaceBack(1);
+                linkedList.EmplaceBack(2);
+
+                String<WChar, PolymorphicAllocator> string(L"Axis polymorphic allocator string", &countingResource);
+
+                DOCTEST_CHECK(string == L"Axis polymorphic allocator string");
+            }
+
+            // Everything was returned to the memory resource
+            DOCTEST_CHECK(countingResource.AllocationCount == 0);
+
+            ArenaMemoryResource arenaResource(1024);
+
+            {
+                List<Int32, PolymorphicAllocator> list(&arenaResource);
+
+                for (Int32 i = 0; i < 1000; ++i)
+                    list.Append(i);
+
+                for (Int32 i = 0; i < 1000; ++i)
+                    DOCTEST_CHECK(list[i] == i);
+            }
+
+            arenaResource.Release();
+        }
     }
 
     DOCTEST_SUBCASE("`Axis::New` and `Axis::Delete`")
@@ -82,6 +336,56 @@ DOCTEST_TEST_CASE("Axis memory allocation : [Axis-System]")
             DOCTEST_CHECK(objectAlive == false);
         }
 
+        DOCTEST_SUBCASE("Frees through the memory resource selected at the allocation time")
+        {
+            // Counts the live allocations and forwards them to `Axis::MallocAllocator`
+            struct CountingMemoryResource final : public MemoryResource
+            {
+                PVoid Allocate(Size size,
+                               Size alignment) override
+                {
+                    ++AllocationCount;
+                    return MallocAllocator::Allocate(size, alignment);
+                }
+
+                void Deallocate(PVoid ptr) noexcept override
+                {
+                    --AllocationCount;
+                    MallocAllocator::Deallocate(ptr);
+                }
+
+                Size AllocationCount = 0;
+            };
+
+            struct alignas(32) AlignedValue
+            {
+                Int32 Value = 0;
+            };
+
+            CountingMemoryResource firstResource;
+            CountingMemoryResource secondResource;
+
+            auto previousResource = SetDefaultMemoryResource(&firstResource);
+
+            auto instance = AllocatedNew<PolymorphicAllocator, AlignedValue>(AlignedValue{7});
+            auto array    = AllocatedNewArray<PolymorphicAllocator, Int64>(8);
+
+            DOCTEST_CHECK((Size)instance % alignof(AlignedValue) == 0);
+            DOCTEST_CHECK(instance->Value == 7);
+            DOCTEST_CHECK(firstResource.AllocationCount == 2);
+
+            // The default resource changes while the memory is still alive
+            SetDefaultMemoryResource(&secondResource);
+
+            AllocatedDelete<PolymorphicAllocator>(instance);
+            AllocatedDeleteArray<PolymorphicAllocator>(array);
+
+            DOCTEST_CHECK(firstResource.AllocationCount == 0);
+            DOCTEST_CHECK(secondResource.AllocationCount == 0);
+
+            SetDefaultMemoryResource(previousResource);
+        }
+
         DOCTEST_SUBCASE("Creates an instance in dynamic memory with `Axis::New` which throws exception")
         {
             struct TestClass
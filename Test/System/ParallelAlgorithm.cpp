@@ -0,0 +1,191 @@
+#include <Axis/System>
+#include <algorithm>
+#include <atomic>
+#include <doctest.h>
+#include <functional>
+
+using namespace Axis;
+using namespace Axis::System;
+
+namespace
+{
+
+struct Sprite
+{
+    Uint32  Texture = 0;
+    Float32 Depth   = 0.0f;
+    Uint32  Index   = 0;
+};
+
+// Sorts the sprites by the texture, then the depth.
+struct SpriteOrder
+{
+    Bool operator()(const Sprite& left,
+                    const Sprite& right) const noexcept
+    {
+        return left.Texture != right.Texture ? left.Texture < right.Texture : left.Depth < right.Depth;
+    }
+};
+
+} // namespace
+
+DOCTEST_TEST_CASE("Parallel algorithms : [Axis::System]")
+{
+    JobSystem jobSystem(3);
+
+    // Covers the empty, serial, single-chunk and unevenly-chunked lengths.
+    constexpr Size Lengths[] = {0, 1, 7, 1000, 4096, 4097, 100003};
+
+    DOCTEST_SUBCASE("Parallel for")
+    {
+        for (const Size length : Lengths)
+        {
+            List<std::atomic<Uint32>> visits(length);
+
+            ParallelFor(jobSystem, 0, length, 64, [&](Size index) { visits[index].fetch_add(1, std::memory_order_relaxed); });
+
+            Bool visitedOnce = true;
+
+            for (const auto& visit : visits)
+                visitedOnce = visitedOnce && visit.load() == 1;
+
+            DOCTEST_CHECK(visitedOnce);
+        }
+
+        List<Uint32> values(50000, 1u);
+
+        ParallelFor(jobSystem, values, 256, [](Uint32& value) { value *= 3; });
+
+        DOCTEST_CHECK(std::all_of(values.begin(), values.end(), [](Uint32 value) { return value == 3; }));
+
+        // Offset ranges.
+        std::atomic<Size> sum = 0;
+
+        ParallelFor(jobSystem, 100, 10100, 16, [&](Size index) { sum.fetch_add(index, std::memory_order_relaxed); });
+
+        DOCTEST_CHECK(sum.load() == (100 + 10099) * 10000 / 2);
+    }
+
+    DOCTEST_SUBCASE("Parallel reduce and transform")
+    {
+        for (const Size length : Lengths)
+        {
+            List<Uint64> values(length);
+
+            for (Size i = 0; i < length; ++i)
+                values[i] = i * 7 + 1;
+
+            const Uint64 sum = ParallelReduce(jobSystem, Span<Uint64>(values), 128, (Uint64)0, std::plus<>());
+
+            DOCTEST_CHECK(sum == (Uint64)length * (length == 0 ? 0 : (length - 1)) * 7 / 2 + length);
+
+            List<Float64> halves(length);
+
+            ParallelTransform(jobSystem, Span<Uint64>(values), halves.GetData(), 128, [](Uint64 value) { return value * 0.5; });
+
+            Bool transformed = true;
+
+            for (Size i = 0; i < length; ++i)
+                transformed = transformed && halves[i] == values[i] * 0.5;
+
+            DOCTEST_CHECK(transformed);
+        }
+
+        // The chunks are combined in order, the non-commutative reductions work.
+        const Uint64 last = ParallelReduce(
+            jobSystem, 0, 20000, 100, (Uint64)0, [](Size index) { return (Uint64)index; }, [](Uint64, Uint64 right) { return right; });
+
+        DOCTEST_CHECK(last == 19999);
+
+        const Uint64 maximum = ParallelReduce(
+            jobSystem, 0, 30000, 100, (Uint64)0, [](Size index) { return (Uint64)((index * 7919) % 30011); }, [](Uint64 left, Uint64 right) { return std::max(left, right); });
+
+        DOCTEST_CHECK(maximum == 30010);
+    }
+
+    DOCTEST_SUBCASE("Parallel scan")
+    {
+        for (const Size length : Lengths)
+        {
+            List<Uint64> values(length);
+
+            for (Size i = 0; i < length; ++i)
+                values[i] = (i * 2654435761u) % 100;
+
+            List<Uint64> scanned(length);
+
+            ParallelScan(jobSystem, Span<Uint64>(values), scanned.GetData(), 64, (Uint64)0, std::plus<>());
+
+            Uint64 running = 0;
+            Bool   matches = true;
+
+            for (Size i = 0; i < length; ++i)
+            {
+                running += values[i];
+                matches = matches && scanned[i] == running;
+            }
+
+            DOCTEST_CHECK(matches);
+
+            // Scans in place.
+            ParallelScan(jobSystem, Span<Uint64>(values), values.GetData(), 64, (Uint64)0, std::plus<>());
+
+            DOCTEST_CHECK(std::equal(values.begin(), values.end(), scanned.begin()));
+        }
+    }
+
+    DOCTEST_SUBCASE("Parallel sort")
+    {
+        FastRandom random(7);
+
+        for (const Size length : Lengths)
+        {
+            List<Sprite> sprites(length);
+
+            for (Size i = 0; i < length; ++i)
+                sprites[i] = {random.NextUint32() % 32, random.NextFloat(), (Uint32)i};
+
+            List<Sprite> expected = sprites;
+
+            std::sort(expected.begin(), expected.end(), SpriteOrder());
+
+            ParallelSort(jobSystem, sprites, SpriteOrder(), 256);
+
+            Bool sorted = true;
+
+            for (Size i = 0; i < length; ++i)
+                sorted = sorted && sprites[i].Texture == expected[i].Texture && sprites[i].Depth == expected[i].Depth;
+
+            DOCTEST_CHECK(sorted);
+
+            // Nothing is lost or duplicated.
+            List<Uint32> indices(length);
+
+            for (Size i = 0; i < length; ++i)
+                indices[i] = sprites[i].Index;
+
+            std::sort(indices.begin(), indices.end());
+
+            Bool permutation = true;
+
+            for (Size i = 0; i < length; ++i)
+                permutation = permutation && indices[i] == i;
+
+            DOCTEST_CHECK(permutation);
+        }
+
+        // Many equal keys and the already sorted input.
+        List<Uint32> values(70000);
+
+        for (Size i = 0; i < values.GetLength(); ++i)
+            values[i] = (Uint32)(i % 3);
+
+        ParallelSort(jobSystem, values.GetData(), values.GetData() + values.GetLength(), std::less<>(), 1000);
+
+        DOCTEST_CHECK(std::is_sorted(values.begin(), values.end()));
+
+        ParallelSort(jobSystem, values, std::greater<>(), 1000);
+
+        DOCTEST_CHECK(std::is_sorted(values.begin(), values.end(), std::greater<>()));
+    }
+}
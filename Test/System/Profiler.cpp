@@ -0,0 +1,203 @@
+#include <Axis/System>
+#include <doctest.h>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace Axis;
+using namespace Axis::System;
+
+namespace
+{
+
+// Spins for at least the given nanoseconds, so the zones have measurable lengths.
+void SpinFor(Uint64 nanoseconds)
+{
+    const Uint64 end = Profiler::GetTimestamp() + nanoseconds;
+
+    while (Profiler::GetTimestamp() < end) {}
+}
+
+const ProfileZoneStatistics* FindZone(const ProfileFrameSummary& summary,
+                                      const char*                name)
+{
+    for (const auto& zone : summary.Zones)
+    {
+        if (std::strcmp(zone.Name, name) == 0)
+            return &zone;
+    }
+
+    return nullptr;
+}
+
+Size CountEvents(const List<ProfileEvent>& events,
+                 const char*               name)
+{
+    Size count = 0;
+
+    for (const auto& event : events)
+        count += std::strcmp(event.Name, name) == 0;
+
+    return count;
+}
+
+} // namespace
+
+// The zones are constructed directly, `AXIS_PROFILE_SCOPE` may be compiled out.
+DOCTEST_TEST_CASE("Profiler : [Axis::System]")
+{
+    Profiler::Clear();
+
+    DOCTEST_SUBCASE("Nested zones")
+    {
+        {
+            ProfileZone outer("Test::Outer");
+
+            SpinFor(100000);
+
+            {
+                ProfileZone inner("Test::Inner");
+
+                SpinFor(100000);
+            }
+        }
+
+        const auto events = Profiler::GetEvents();
+
+        DOCTEST_REQUIRE(events.GetLength() == 2);
+
+        // Ordered by the start timestamps, the enclosing zone first.
+        DOCTEST_CHECK(std::strcmp(events[0].Name, "Test::Outer") == 0);
+        DOCTEST_CHECK(std::strcmp(events[1].Name, "Test::Inner") == 0);
+        DOCTEST_CHECK(events[1].Depth == events[0].Depth + 1);
+        DOCTEST_CHECK(events[0].Start <= events[1].Start);
+        DOCTEST_CHECK(events[0].End >= events[1].End);
+        DOCTEST_CHECK(events[1].End - events[1].Start >= 100000);
+    }
+
+    DOCTEST_SUBCASE("Frame summary")
+    {
+        Profiler::BeginFrame();
+
+        for (Size i = 0; i < 3; ++i)
+        {
+            ProfileZone outer("Test::Frame::Outer");
+
+            SpinFor(50000);
+
+            ProfileZone inner("Test::Frame::Inner");
+
+            SpinFor(50000);
+        }
+
+        Profiler::BeginFrame();
+
+        // Recorded in the frame still running, not part of the summary.
+        {
+            ProfileZone later("Test::Frame::Later");
+        }
+
+        const auto summary = Profiler::GetFrameSummary();
+
+        DOCTEST_CHECK(summary.FrameIndex + 2 == Profiler::GetFrameCount());
+        DOCTEST_CHECK(summary.Duration > 0);
+        DOCTEST_CHECK(FindZone(summary, "Test::Frame::Later") == nullptr);
+
+        const auto* outer = FindZone(summary, "Test::Frame::Outer");
+        const auto* inner = FindZone(summary, "Test::Frame::Inner");
+
+        DOCTEST_REQUIRE(outer != nullptr);
+        DOCTEST_REQUIRE(inner != nullptr);
+
+        DOCTEST_CHECK(outer->CallCount == 3);
+        DOCTEST_CHECK(inner->CallCount == 3);
+        DOCTEST_CHECK(inner->Depth == outer->Depth + 1);
+        DOCTEST_CHECK(outer->TotalTime >= inner->TotalTime);
+        DOCTEST_CHECK(outer->SelfTime == outer->TotalTime - inner->TotalTime);
+        DOCTEST_CHECK(inner->SelfTime == inner->TotalTime);
+        DOCTEST_CHECK(outer->MaxTime * 3 >= outer->TotalTime);
+        DOCTEST_CHECK(summary.Duration >= outer->TotalTime);
+
+        // Ordered by the total time.
+        DOCTEST_CHECK(summary.Zones[0].TotalTime >= summary.Zones[summary.Zones.GetLength() - 1].TotalTime);
+
+        DOCTEST_CHECK(Profiler::GetFrameSummary(0).Zones.GetLength() == 0);
+        DOCTEST_CHECK(Profiler::GetFrameSummary(Profiler::FrameCapacity).Zones.GetLength() == 0);
+    }
+
+    DOCTEST_SUBCASE("Chrome trace export")
+    {
+        Profiler::SetThreadName("Test \"Main\"");
+
+        {
+            ProfileZone zone("Test::Exported");
+        }
+
+        {
+            ProfileZone zone("Test::Exported\n\t\x01");
+        }
+
+        const String8 trace = Profiler::ExportChromeTrace();
+
+        DOCTEST_CHECK(std::strstr(trace.GetCString(), "\"traceEvents\": [") != nullptr);
+        DOCTEST_CHECK(std::strstr(trace.GetCString(), "{\"name\": \"Test::Exported\", \"ph\": \"X\"") != nullptr);
+        DOCTEST_CHECK(std::strstr(trace.GetCString(), "\"args\": {\"name\": \"Test \\\"Main\\\"\"}") != nullptr);
+        DOCTEST_CHECK(std::strstr(trace.GetCString(), "{\"name\": \"Test::Exported\\n\\t\\u0001\", \"ph\": \"X\"") != nullptr);
+        DOCTEST_CHECK(std::strstr(trace.GetCString(), "},\n  ]") == nullptr);
+
+        Profiler::SetThreadName(nullptr);
+    }
+
+    DOCTEST_SUBCASE("Recording from many threads")
+    {
+        constexpr Size ThreadCount = 4;
+        constexpr Size ZoneCount   = Profiler::EventCapacity + 100;
+
+        std::vector<std::thread> threads;
+        std::atomic<Size>        finishedCount = 0;
+
+        // Overflows the rings, only the newest events are kept.
+        for (Size thread = 0; thread < ThreadCount; ++thread)
+        {
+            threads.emplace_back([&]() {
+                for (Size i = 0; i < ZoneCount; ++i)
+                    ProfileZone zone("Test::Thread");
+
+                // Keeps the thread alive, a thread started later would take over its ring.
+                finishedCount.fetch_add(1);
+
+                while (finishedCount.load() != ThreadCount)
+                    std::this_thread::yield();
+            });
+        }
+
+        // Reads the rings while the threads are writing.
+        for (Size i = 0; i < 10; ++i)
+            DOCTEST_CHECK(CountEvents(Profiler::GetEvents(), "Test::Thread") <= ThreadCount * Profiler::EventCapacity);
+
+        for (auto& thread : threads)
+            thread.join();
+
+        const auto events = Profiler::GetEvents();
+
+        DOCTEST_CHECK(CountEvents(events, "Test::Thread") == ThreadCount * Profiler::EventCapacity);
+
+        Bool ordered = true;
+
+        for (Size i = 1; i < events.GetLength(); ++i)
+            ordered = ordered && events[i - 1].Start <= events[i].Start;
+
+        DOCTEST_CHECK(ordered);
+    }
+
+    DOCTEST_SUBCASE("Clearing")
+    {
+        {
+            ProfileZone zone("Test::Cleared");
+        }
+
+        Profiler::Clear();
+
+        DOCTEST_CHECK(CountEvents(Profiler::GetEvents(), "Test::Cleared") == 0);
+    }
+}
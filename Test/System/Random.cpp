@@ -1,5 +1,8 @@
 #include <Axis/System>
+#include <algorithm>
+#include <cmath>
 #include <doctest.h>
+#include <vector>
 
 using namespace Axis;
 using namespace Axis::System;
@@ -18,4 +21,167 @@ DOCTEST_TEST_CASE("Random data structure : [Axis-System]")
         DOCTEST_CHECK(random1.Next() == random2.Next()); // Attemp 3
         DOCTEST_CHECK(random1.Next() == random2.Next()); // Attemp 4
     }
-}
\ No newline at end of file
+}
+DOCTEST_TEST_CASE("Fast random number generator : [Axis-System]")
+{
+    DOCTEST_SUBCASE("`Axis::FastRandom` sequence")
+    {
+        // Values of the xoshiro256++ reference implementation, seeded with SplitMix64.
+        FastRandom random(42);
+
+        DOCTEST_CHECK(random.NextUint64() == 0xd0764d4f4476689full);
+        DOCTEST_CHECK(random.NextUint64() == 0x519e4174576f3791ull);
+        DOCTEST_CHECK(random.NextUint64() == 0xfbe07cfb0c24ed8cull);
+
+        FastRandom jumped(42);
+        jumped.Jump();
+
+        DOCTEST_CHECK(jumped.NextUint64() == 0xc0b6f4be293b1ae5ull);
+
+        FastRandom longJumped(42);
+        longJumped.LongJump();
+
+        DOCTEST_CHECK(longJumped.NextUint64() == 0x02019a87bfc0bb07ull);
+
+        static_assert(sizeof(FastRandom) == 32);
+    }
+
+    DOCTEST_SUBCASE("`Axis::FastRandom` ranges")
+    {
+        FastRandom random(7);
+
+        for (Size i = 0; i < 10000; ++i)
+        {
+            const Float32 floatValue  = random.NextFloat();
+            const Float64 doubleValue = random.NextDouble();
+            const Int32   value       = random.Next(-3, 5);
+
+            DOCTEST_CHECK(floatValue >= 0.0f);
+            DOCTEST_CHECK(floatValue < 1.0f);
+            DOCTEST_CHECK(doubleValue >= 0.0);
+            DOCTEST_CHECK(doubleValue < 1.0);
+            DOCTEST_CHECK(value >= -3);
+            DOCTEST_CHECK(value < 5);
+        }
+
+        DOCTEST_CHECK(random.Next(4, 4) == 4);
+        DOCTEST_CHECK_THROWS_AS((void)random.Next(5, 4), InvalidArgumentException);
+
+        Int32 values[3] = {};
+        DOCTEST_CHECK_THROWS_AS(random.FillRange(values, 3, 5, 4), InvalidArgumentException);
+    }
+
+    DOCTEST_SUBCASE("`Axis::FastRandom` bulk fills")
+    {
+        // Every count below three steps, the values past the count must stay untouched.
+        for (Size count = 0; count < 24; ++count)
+        {
+            std::vector<Float32> floats(count + 1, -1.0f);
+            std::vector<Int32>   integers(count + 1, -100);
+
+            FastRandom random(count);
+
+            random.FillFloats(floats.data(), count, 2.0f, 3.0f);
+            random.FillRange(integers.data(), count, -10, 10);
+
+            for (Size i = 0; i < count; ++i)
+            {
+                DOCTEST_CHECK(floats[i] >= 2.0f);
+                DOCTEST_CHECK(floats[i] < 3.0f);
+                DOCTEST_CHECK(integers[i] >= -10);
+                DOCTEST_CHECK(integers[i] < 10);
+            }
+
+            DOCTEST_CHECK(floats[count] == -1.0f);
+            DOCTEST_CHECK(integers[count] == -100);
+        }
+
+        // The same seed gives the same values.
+        std::vector<Float32> first(100), second(100);
+
+        FastRandom firstRandom(3);
+        FastRandom secondRandom(3);
+
+        firstRandom.FillFloats(first.data(), first.size());
+        secondRandom.FillFloats(second.data(), second.size());
+
+        DOCTEST_CHECK(first == second);
+
+        // The whole range of `Int32`
+        std::vector<Int32> integers(1000);
+
+        firstRandom.FillRange(integers.data(), integers.size(), INT32_MIN, INT32_MAX);
+
+        DOCTEST_CHECK(std::count_if(integers.begin(), integers.end(), [](Int32 value) { return value < 0; }) > 400);
+        DOCTEST_CHECK(std::count_if(integers.begin(), integers.end(), [](Int32 value) { return value > 0; }) > 400);
+    }
+
+    DOCTEST_SUBCASE("`Axis::FastRandom` statistical smoke test")
+    {
+        constexpr Size Count       = 1 << 16;
+        constexpr Size BucketCount = 16;
+
+        // Chi-squared with 15 degrees of freedom, exceeded with the probability of 0.001.
+        constexpr Float64 ChiSquaredLimit = 37.7;
+
+        const auto chiSquared = [&](const Size (&buckets)[BucketCount]) {
+            const Float64 expected = (Float64)Count / BucketCount;
+
+            Float64 result = 0.0;
+
+            for (const Size bucket : buckets)
+                result += ((Float64)bucket - expected) * ((Float64)bucket - expected) / expected;
+
+            return result;
+        };
+
+        FastRandom random(1234);
+
+        std::vector<Float32> floats(Count);
+        random.FillFloats(floats.data(), Count);
+
+        Float64 sum        = 0.0;
+        Float64 squaredSum = 0.0;
+        Size    buckets[BucketCount] = {};
+
+        for (const Float32 value : floats)
+        {
+            sum += value;
+            squaredSum += (Float64)value * value;
+            ++buckets[(Size)(value * BucketCount)];
+        }
+
+        const Float64 mean     = sum / Count;
+        const Float64 variance = squaredSum / Count - mean * mean;
+
+        DOCTEST_CHECK(std::abs(mean - 0.5) < 0.01);
+        DOCTEST_CHECK(std::abs(variance - 1.0 / 12.0) < 0.005);
+        DOCTEST_CHECK(chiSquared(buckets) < ChiSquaredLimit);
+
+        std::vector<Int32> integers(Count);
+        random.FillRange(integers.data(), Count, 100, 100 + (Int32)BucketCount);
+
+        Size rangeBuckets[BucketCount] = {};
+
+        for (const Int32 value : integers)
+            ++rangeBuckets[value - 100];
+
+        DOCTEST_CHECK(chiSquared(rangeBuckets) < ChiSquaredLimit);
+
+        // The scalar sequence and the jumped streams
+        Size scalarBuckets[BucketCount] = {};
+        Size jumpedBuckets[BucketCount] = {};
+
+        FastRandom jumped = random;
+        jumped.Jump();
+
+        for (Size i = 0; i < Count; ++i)
+        {
+            ++scalarBuckets[random.Next(0, (Int32)BucketCount)];
+            ++jumpedBuckets[jumped.Next(0, (Int32)BucketCount)];
+        }
+
+        DOCTEST_CHECK(chiSquared(scalarBuckets) < ChiSquaredLimit);
+        DOCTEST_CHECK(chiSquared(jumpedBuckets) < ChiSquaredLimit);
+    }
+}
@@ -1,5 +1,6 @@
 #include <Axis/System>
 #include <doctest.h>
+#include <thread>
 
 using namespace Axis;
 using namespace Axis::System;
@@ -270,5 +271,111 @@ DOCTEST_TEST_CASE("Axis smart pointers : [Axis::System]")
 
             DOCTEST_CHECK(ptr == anotherPtr);
         }
+
+        DOCTEST_SUBCASE("Concurrent reference counting")
+        {
+            constexpr Size ThreadCount    = 4;
+            constexpr Size IterationCount = 100000;
+
+            {
+                SharedPointer<TestStruct> ptr     = Axis::System::MakeShared<TestStruct>();
+                WeakPointer<TestStruct>   weakPtr = ptr;
+
+                std::thread       threads[ThreadCount];
+                std::atomic<Size> generatedCount = 0;
+
+                // Copies and releases the pointer from all the threads at the same time
+                for (auto& thread : threads)
+                {
+                    thread = std::thread([&]() {
+                        for (Size i = 0; i < IterationCount; ++i)
+                        {
+                            SharedPointer<TestStruct> copy      = ptr;
+                            SharedPointer<TestStruct> generated = weakPtr.Generate();
+
+                            if (generated)
+                                generatedCount.fetch_add(1, std::memory_order_relaxed);
+                        }
+                    });
+                }
+
+                for (auto& thread : threads)
+                    thread.join();
+
+                DOCTEST_CHECK(generatedCount == ThreadCount * IterationCount);
+
+                DOCTEST_CHECK(ptr.GetStrongCount() == 1);
+                DOCTEST_CHECK(ptr.GetWeakCount() == 2);
+                DOCTEST_CHECK(Instances == 1);
+
+                // The object is released, the weak pointer can't generate the shared pointer anymore
+                ptr = nullptr;
+
+                DOCTEST_CHECK(Instances == 0);
+                DOCTEST_CHECK(!weakPtr.Generate());
+            }
+
+            // The last strong reference is released on any of the threads
+            for (Size i = 0; i < 100; ++i)
+            {
+                SharedPointer<TestStruct> ptr = Axis::System::MakeShared<TestStruct>();
+
+                std::thread threads[ThreadCount];
+
+                for (auto& thread : threads)
+                    thread = std::thread([copy = ptr]() mutable { copy = nullptr; });
+
+                ptr = nullptr;
+
+                for (auto& thread : threads)
+                    thread.join();
+
+                DOCTEST_CHECK(Instances == 0);
+            }
+        }
+    }
+
+    DOCTEST_SUBCASE("`Axis::SharedRef`")
+    {
+        SharedPointer<TestStructDerived> ptr = Axis::System::MakeShared<TestStructDerived>();
+
+        // Borrowing doesn't touch the reference count
+        SharedRef<TestStructDerived> ref     = ptr;
+        SharedRef<TestStruct>        baseRef = ref;
+        SharedRef<void>              voidRef = ptr;
+
+        DOCTEST_CHECK(ptr.GetStrongCount() == 1);
+        DOCTEST_CHECK(ref);
+        DOCTEST_CHECK(ref.GetPointer() == ptr.GetPointer());
+        DOCTEST_CHECK(baseRef->num1 == 64);
+        DOCTEST_CHECK((*ref).num2 == 128);
+        DOCTEST_CHECK(voidRef.GetPointer() == (PVoid)ptr.GetPointer());
+        DOCTEST_CHECK(ref == SharedRef<TestStructDerived>(ptr));
+        DOCTEST_CHECK(ref != nullptr);
+        DOCTEST_CHECK(SharedRef<TestStruct>() == nullptr);
+        DOCTEST_CHECK((TestStructDerived*)baseRef == ptr.GetPointer());
+
+        // Acquires the strong reference
+        {
+            SharedPointer<TestStruct> acquired = (SharedPointer<TestStruct>)ref;
+
+            DOCTEST_CHECK(acquired == (SharedPointer<TestStruct>)ptr);
+            DOCTEST_CHECK(ptr.GetStrongCount() == 2);
+
+            // Casts back to the derived type
+            auto derived = (SharedPointer<TestStructDerived>)baseRef;
+
+            DOCTEST_CHECK(derived == ptr);
+            DOCTEST_CHECK(ptr.GetStrongCount() == 3);
+        }
+
+        DOCTEST_CHECK(ptr.GetStrongCount() == 1);
+
+        // The null reference acquires the null pointer
+        DOCTEST_CHECK(!(SharedPointer<TestStruct>)SharedRef<TestStruct>());
+
+        ptr = nullptr;
+
+        DOCTEST_CHECK(Instances == 0);
     }
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include <Axis/System>
 #include <doctest.h>
+#include <string>
 
 using namespace Axis;
 using namespace Axis::System;
@@ -253,4 +254,111 @@ DOCTEST_TEST_CASE("Axis string data structure : [Axis-System]")
             DOCTEST_CHECK(true);
         }
     }
-}
\ No newline at end of file
+}
+namespace
+{
+
+struct StringAllocationTag
+{
+    static constexpr const char* Name = "Test::String";
+};
+
+using CountedString = String<Char, TrackingAllocator<DefaultAllocator, StringAllocationTag>>;
+
+Size GetLiveAllocationCount()
+{
+    return AllocationTracker::GetStatistics(StringAllocationTag::Name).LiveAllocationCount;
+}
+
+} // namespace
+
+DOCTEST_TEST_CASE("Axis string small string layout : [Axis-System]")
+{
+    // Three words, the small string length shares the last byte with the capacity's flag.
+    DOCTEST_CHECK(sizeof(String8) == sizeof(PVoid) + sizeof(Size) * 2);
+    DOCTEST_CHECK(sizeof(WString) == sizeof(String8));
+    DOCTEST_CHECK(String8::SmallStringSize == sizeof(String8) - 2);
+    DOCTEST_CHECK(WString::SmallStringSize == sizeof(WString) / sizeof(WChar) - 2);
+
+    auto allocationCount = GetLiveAllocationCount();
+
+    DOCTEST_SUBCASE("Small strings are stored in place")
+    {
+        std::string   characters(CountedString::SmallStringSize, 'a');
+        CountedString longest(characters.c_str());
+
+        DOCTEST_CHECK(longest.GetLength() == CountedString::SmallStringSize);
+        DOCTEST_CHECK(longest.GetCString()[CountedString::SmallStringSize] == Char(0));
+        DOCTEST_CHECK(GetLiveAllocationCount() == allocationCount);
+
+        // One more character moves the string to the allocated buffer.
+        longest += 'b';
+
+        DOCTEST_CHECK(longest.GetLength() == CountedString::SmallStringSize + 1);
+        DOCTEST_CHECK(longest[CountedString::SmallStringSize] == 'b');
+        DOCTEST_CHECK(longest.GetCString()[CountedString::SmallStringSize + 1] == Char(0));
+        DOCTEST_CHECK(GetLiveAllocationCount() == allocationCount + 1);
+
+        for (Size i = 0; i < CountedString::SmallStringSize; ++i)
+            DOCTEST_CHECK(longest[i] == 'a');
+    }
+
+    DOCTEST_SUBCASE("Growing, inserting and removing")
+    {
+        CountedString string;
+
+        for (Size i = 0; i < 100; ++i)
+            string += Char('0' + i % 10);
+
+        DOCTEST_CHECK(string.GetLength() == 100);
+        DOCTEST_CHECK(GetLiveAllocationCount() == allocationCount + 1);
+
+        string.RemoveAt(10, 85);
+
+        DOCTEST_CHECK(string == "012345678956789");
+
+        const Char inserted[] = "abc";
+
+        string.Insert(inserted, inserted + 3, 2);
+
+        DOCTEST_CHECK(string == "01abc2345678956789");
+
+        string.Insert(inserted, inserted + 3, string.GetLength());
+
+        DOCTEST_CHECK(string == "01abc2345678956789abc");
+
+        // The allocated buffer is kept.
+        CountedString other = string;
+        other               = CountedString("short");
+
+        DOCTEST_CHECK(other == "short");
+    }
+
+    DOCTEST_SUBCASE("Moving small and allocated strings")
+    {
+        CountedString small = "small";
+        CountedString large = "This string doesn't fit in the small string buffer";
+
+        CountedString movedSmall = std::move(small);
+        CountedString movedLarge = std::move(large);
+
+        DOCTEST_CHECK(movedSmall == "small");
+        DOCTEST_CHECK(movedLarge == "This string doesn't fit in the small string buffer");
+        DOCTEST_CHECK(small == nullptr);
+        DOCTEST_CHECK(large == nullptr);
+        DOCTEST_CHECK(GetLiveAllocationCount() == allocationCount + 1);
+
+        movedSmall = std::move(movedLarge);
+
+        DOCTEST_CHECK(movedSmall == "This string doesn't fit in the small string buffer");
+        DOCTEST_CHECK(movedLarge == nullptr);
+        DOCTEST_CHECK(GetLiveAllocationCount() == allocationCount + 1);
+
+        // The moved-from string is usable.
+        movedLarge += "again";
+
+        DOCTEST_CHECK(movedLarge == "again");
+    }
+
+    DOCTEST_CHECK(GetLiveAllocationCount() == allocationCount);
+}
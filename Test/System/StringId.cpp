@@ -0,0 +1,182 @@
+#include <Axis/System>
+#include <doctest.h>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace Axis;
+using namespace Axis::System;
+using namespace Axis::System::Literals;
+
+namespace
+{
+
+// The ids of the literals are calculated at compile time.
+constexpr StringId DiffuseId = "Texture/Diffuse"_sid;
+
+static_assert(DiffuseId == StringId::FromLiteral("Texture/Diffuse"));
+static_assert(DiffuseId != "Texture/Normal"_sid);
+static_assert(StringId::FromLiteral("").IsEmpty());
+
+} // namespace
+
+DOCTEST_TEST_CASE("String id : [Axis::System]")
+{
+    DOCTEST_SUBCASE("Interning")
+    {
+        String8 path = "Texture/Diffuse";
+
+        StringId first(path);
+        StringId second(StringView<Char>("Texture/Diffuse"));
+        StringId third(StringView<Char>("Texture/Specular"));
+
+        CHECK(first == second);
+        CHECK(first != third);
+        CHECK(first == DiffuseId);
+
+        // The string is retrieved back from the table.
+        CHECK(first.IsInterned());
+        CHECK(first.GetString().GetLength() == path.GetLength());
+        CHECK(String8(first.GetString()) == path);
+        CHECK(first.GetString().GetCString()[path.GetLength()] == Char(0));
+
+        // The string is copied only once.
+        Size internedCount = StringId::GetInternedCount();
+
+        StringId again(StringView<Char>("Texture/Specular"));
+
+        CHECK(again == third);
+        CHECK(StringId::GetInternedCount() == internedCount);
+    }
+
+    DOCTEST_SUBCASE("Literal which hasn't been interned")
+    {
+        constexpr StringId id = "StringId/NeverInterned"_sid;
+
+        CHECK(!id.IsInterned());
+        CHECK(id.GetString() == nullptr);
+
+        StringId internedId(StringView<Char>("StringId/NeverInterned?"));
+
+        CHECK(internedId != id);
+        CHECK(!id.IsInterned());
+    }
+
+    DOCTEST_SUBCASE("Empty string")
+    {
+        StringId empty(StringView<Char>(""));
+
+        CHECK(empty == StringId());
+        CHECK(empty.IsEmpty());
+        CHECK(empty.GetValue() == 0);
+        CHECK(empty.IsInterned());
+        CHECK(empty.GetString().GetLength() == 0);
+        CHECK(empty.GetString().GetCString() != nullptr);
+    }
+
+    DOCTEST_SUBCASE("Wide strings")
+    {
+        WString title = L"Axis Window";
+
+        WStringId id(title);
+
+        CHECK(id == L"Axis Window"_sid);
+        CHECK(WString(id.GetString()) == title);
+        CHECK(WStringId::GetInternedCount() >= 1);
+    }
+
+    DOCTEST_SUBCASE("Keys of the hash map")
+    {
+        FlatHashMap<StringId, Size> map;
+
+        for (Size i = 0; i < 256; ++i)
+        {
+            std::string name = "StringId/Key/" + std::to_string(i);
+            map.Insert({StringId(StringView<Char>(name.c_str())), i});
+        }
+
+        CHECK(map.GetSize() == 256);
+
+        for (Size i = 0; i < 256; ++i)
+        {
+            std::string name = "StringId/Key/" + std::to_string(i);
+
+            auto it = map.Find(StringId(StringView<Char>(name.c_str())));
+
+            REQUIRE(it != map.end());
+            CHECK(it->Second == i);
+        }
+    }
+
+    DOCTEST_SUBCASE("Collision")
+    {
+        // Finds two different strings with the same id, there's one among ~2^16 strings.
+        std::unordered_map<Uint32, std::string> names;
+        std::string                             first;
+        std::string                             second;
+
+        for (Size i = 0; first.empty(); ++i)
+        {
+            std::string name = "StringId/Collision/" + std::to_string(i);
+            Uint32      id   = StringId::Calculate(name.c_str(), name.size()).GetValue();
+
+            auto [it, inserted] = names.emplace(id, name);
+
+            if (!inserted)
+            {
+                first  = it->second;
+                second = name;
+            }
+        }
+
+        StringId id(StringView<Char>(first.c_str()));
+
+        CHECK_THROWS_AS(StringId(StringView<Char>(second.c_str())), InvalidArgumentException);
+
+        // The interned string is left untouched.
+        CHECK(String8(id.GetString()) == String8(first.c_str()));
+
+        StringId triedId;
+
+        CHECK_FALSE(StringId::TryIntern(StringView<Char>(second.c_str()), triedId));
+        CHECK(triedId.IsEmpty());
+        CHECK(StringId::TryIntern(StringView<Char>(first.c_str()), triedId));
+        CHECK(triedId == id);
+    }
+
+    DOCTEST_SUBCASE("Interning across multiple threads")
+    {
+        constexpr Size ThreadCount = 8;
+        constexpr Size NameCount   = 4096;
+
+        std::vector<std::vector<StringId>> ids(ThreadCount);
+        std::vector<std::thread>           threads;
+
+        // Every thread interns the same names, the table grows while the others look it up.
+        for (Size i = 0; i < ThreadCount; ++i)
+        {
+            threads.emplace_back([&, i]() {
+                for (Size j = 0; j < NameCount; ++j)
+                {
+                    std::string name = "StringId/Thread/" + std::to_string((j + i * 97) % NameCount);
+                    ids[i].push_back(StringId(StringView<Char>(name.c_str())));
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        for (Size i = 0; i < ThreadCount; ++i)
+        {
+            for (Size j = 0; j < NameCount; ++j)
+            {
+                std::string name = "StringId/Thread/" + std::to_string((j + i * 97) % NameCount);
+
+                CHECK(ids[i][j] == StringId::Calculate(name.c_str(), name.size()));
+                CHECK(String8(ids[i][j].GetString()) == String8(name.c_str()));
+            }
+        }
+    }
+}
@@ -0,0 +1,287 @@
+#include <Axis/System>
+#include <doctest.h>
+#include <stdexcept>
+#include <thread>
+
+using namespace Axis;
+using namespace Axis::System;
+
+namespace
+{
+
+Task<Int32> Add(Int32 left,
+                Int32 right)
+{
+    co_return left + right;
+}
+
+Task<Int32> Sum(Int32 count)
+{
+    Int32 sum = 0;
+
+    for (Int32 i = 0; i < count; ++i)
+        sum += co_await Add(i, 0);
+
+    co_return sum;
+}
+
+Task<Size> CountDown(Size depth)
+{
+    if (depth == 0)
+        co_return 0;
+
+    co_return co_await CountDown(depth - 1) + 1;
+}
+
+Task<Int32> Throw()
+{
+    throw std::runtime_error("Failed");
+
+    co_return 0;
+}
+
+// Counts the destructions of the non-moved-from objects.
+struct DestroyCounter
+{
+    Size* Counter = nullptr;
+
+    explicit DestroyCounter(Size* counter) noexcept :
+        Counter(counter) {}
+
+    DestroyCounter(DestroyCounter&& other) noexcept :
+        Counter(other.Counter) { other.Counter = nullptr; }
+
+    ~DestroyCounter() noexcept
+    {
+        if (Counter != nullptr)
+            ++*Counter;
+    }
+};
+
+Task<void> WaitForFrame(TaskScheduler& scheduler,
+                        DestroyCounter counter,
+                        Bool&          resumed)
+{
+    // The frame owns the counter, it's incremented once the frame gets destroyed.
+    DOCTEST_CHECK(counter.Counter != nullptr);
+
+    co_await scheduler.NextFrame();
+
+    resumed = true;
+}
+
+} // namespace
+
+DOCTEST_TEST_CASE("Coroutine tasks : [Axis::System]")
+{
+    TaskScheduler scheduler;
+
+    DOCTEST_SUBCASE("Awaiting the tasks")
+    {
+        Int32 result = 0;
+        Bool  caught = false;
+        Size  depth  = 0;
+
+        // The closure must outlive the coroutine, the coroutine refers to its captures.
+        auto body = [&]() -> Task<void> {
+            result = co_await Sum(100);
+
+            try
+            {
+                co_await Throw();
+            }
+            catch (const std::runtime_error&)
+            {
+                caught = true;
+            }
+
+            depth = co_await CountDown(1000);
+        };
+
+        scheduler.Spawn(body());
+
+        // The tasks finishing synchronously are done after the spawn.
+        DOCTEST_CHECK(result == 4950);
+        DOCTEST_CHECK(caught);
+        DOCTEST_CHECK(depth == 1000);
+
+        scheduler.RunFrame();
+
+        DOCTEST_CHECK(scheduler.GetPendingTaskCount() == 0);
+    }
+
+    DOCTEST_SUBCASE("Waiting for the frames and the conditions")
+    {
+        Size frames = 0;
+        Bool flag   = false;
+        Bool ready  = false;
+
+        auto body = [&]() -> Task<void> {
+            for (Size i = 0; i < 3; ++i)
+            {
+                co_await scheduler.NextFrame();
+                ++frames;
+            }
+
+            co_await scheduler.WaitUntil([&]() { return flag; });
+
+            ready = true;
+        };
+
+        scheduler.Spawn(body());
+
+        DOCTEST_CHECK(frames == 0);
+
+        for (Size i = 1; i <= 3; ++i)
+        {
+            scheduler.RunFrame();
+            DOCTEST_CHECK(frames == i);
+        }
+
+        scheduler.RunFrame();
+        scheduler.RunFrame();
+
+        DOCTEST_CHECK_FALSE(ready);
+        DOCTEST_CHECK(scheduler.GetPendingTaskCount() == 1);
+
+        flag = true;
+        scheduler.RunFrame();
+
+        DOCTEST_CHECK(ready);
+        DOCTEST_CHECK(scheduler.GetPendingTaskCount() == 0);
+    }
+
+    DOCTEST_SUBCASE("Running on the job system")
+    {
+        JobSystem jobSystem(2);
+
+        const std::thread::id frameThread = std::this_thread::get_id();
+
+        Int64 result        = 0;
+        Bool  ranOnWorker   = false;
+        Bool  resumedOnMain = false;
+        Bool  caught        = false;
+
+        auto body = [&]() -> Task<void> {
+            result = co_await scheduler.Run(jobSystem, [&]() {
+                ranOnWorker = jobSystem.IsWorkerThread();
+
+                Int64 sum = 0;
+
+                for (Int64 i = 0; i < 1000; ++i)
+                    sum += i;
+
+                return sum;
+            });
+
+            resumedOnMain = std::this_thread::get_id() == frameThread;
+
+            try
+            {
+                co_await scheduler.Run(jobSystem, []() { throw std::runtime_error("Failed"); });
+            }
+            catch (const std::runtime_error&)
+            {
+                caught = true;
+            }
+        };
+
+        scheduler.Spawn(body());
+
+        while (scheduler.GetPendingTaskCount() != 0)
+        {
+            scheduler.RunFrame();
+            std::this_thread::yield();
+        }
+
+        DOCTEST_CHECK(result == 499500);
+        DOCTEST_CHECK(ranOnWorker);
+        DOCTEST_CHECK(resumedOnMain);
+        DOCTEST_CHECK(caught);
+    }
+
+    DOCTEST_SUBCASE("Exceptions of the spawned tasks")
+    {
+        auto body = [&]() -> Task<void> {
+            co_await scheduler.NextFrame();
+
+            throw std::runtime_error("Failed");
+        };
+
+        scheduler.Spawn(body());
+
+        DOCTEST_CHECK_THROWS_AS(scheduler.RunFrame(), std::runtime_error);
+        DOCTEST_CHECK(scheduler.GetPendingTaskCount() == 0);
+
+        DOCTEST_CHECK_THROWS_AS(scheduler.Spawn(Task<void>()), InvalidArgumentException);
+    }
+
+    DOCTEST_SUBCASE("Throwing conditions")
+    {
+        Bool firstFlag   = false;
+        Bool secondFlag  = false;
+        Bool shouldThrow = false;
+        Size finished    = 0;
+
+        auto waitFirst = [&]() -> Task<void> {
+            co_await scheduler.WaitUntil([&]() { return firstFlag; });
+            ++finished;
+        };
+
+        auto waitSecond = [&]() -> Task<void> {
+            co_await scheduler.WaitUntil([&]() {
+                if (shouldThrow)
+                    throw std::runtime_error("Failed");
+
+                return secondFlag;
+            });
+            ++finished;
+        };
+
+        auto waitFrame = [&]() -> Task<void> {
+            co_await scheduler.NextFrame();
+            ++finished;
+        };
+
+        scheduler.Spawn(waitFirst());
+        scheduler.Spawn(waitSecond());
+        scheduler.Spawn(waitFrame());
+
+        firstFlag   = true;
+        shouldThrow = true;
+
+        DOCTEST_CHECK_THROWS_AS(scheduler.RunFrame(), std::runtime_error);
+        DOCTEST_CHECK(finished == 0);
+
+        // The coroutines already due resume on the next frame, the throwing waiter is kept.
+        shouldThrow = false;
+        scheduler.RunFrame();
+
+        DOCTEST_CHECK(finished == 2);
+        DOCTEST_CHECK(scheduler.GetPendingTaskCount() == 1);
+
+        secondFlag = true;
+        scheduler.RunFrame();
+
+        DOCTEST_CHECK(finished == 3);
+        DOCTEST_CHECK(scheduler.GetPendingTaskCount() == 0);
+    }
+
+    DOCTEST_SUBCASE("Destroying the unfinished tasks")
+    {
+        // The scheduler destroys the suspended coroutines along with their locals.
+        Size destroyed = 0;
+        Bool resumed   = false;
+
+        {
+            TaskScheduler localScheduler;
+
+            localScheduler.Spawn(WaitForFrame(localScheduler, DestroyCounter{&destroyed}, resumed));
+
+            DOCTEST_CHECK(destroyed == 0);
+        }
+
+        DOCTEST_CHECK(destroyed == 1);
+        DOCTEST_CHECK_FALSE(resumed);
+    }
+}
@@ -0,0 +1,88 @@
+#include <Axis/System>
+#include <algorithm>
+#include <doctest.h>
+#include <vector>
+
+using namespace Axis;
+using namespace Axis::System;
+
+DOCTEST_TEST_CASE("Timer : [Axis::System]")
+{
+    DOCTEST_SUBCASE("Monotonic")
+    {
+        TimePeriod last = Timer::GetTimestamp();
+
+        Bool monotonic = true;
+
+        for (Size i = 0; i < 100000; ++i)
+        {
+            const TimePeriod now = Timer::GetTimestamp();
+
+            monotonic = monotonic && now >= last;
+            last      = now;
+        }
+
+        DOCTEST_CHECK(monotonic);
+    }
+
+    DOCTEST_SUBCASE("Sleep")
+    {
+        Timer timer;
+
+        Sleep(TimePeriod::FromMilliseconds(5));
+
+        const TimePeriod elapsed = timer.Reset();
+
+        DOCTEST_CHECK(elapsed >= TimePeriod::FromMilliseconds(5));
+        DOCTEST_CHECK(timer.GetElapsedTimePeriod() < elapsed);
+    }
+
+    DOCTEST_SUBCASE("Precise sleep")
+    {
+        const TimePeriod deadline = Timer::GetTimestamp() + TimePeriod::FromMilliseconds(3);
+
+        PreciseSleepUntil(deadline);
+
+        DOCTEST_CHECK(Timer::GetTimestamp() >= deadline);
+
+        // The deadline has passed, returns immediately.
+        Timer timer;
+
+        PreciseSleepUntil(deadline);
+
+        DOCTEST_CHECK(timer.GetElapsedTimePeriod() < TimePeriod::FromMilliseconds(1));
+    }
+
+    // Paces the frames the way `Application::Run` does with the fixed time step.
+    DOCTEST_SUBCASE("Pacing jitter at 60 Hz")
+    {
+        constexpr Size FrameCount = 60;
+
+        const TimePeriod frameTime = TimePeriod::FromSeconds(1.0 / 60.0);
+
+        std::vector<Size> jitters;
+
+        TimePeriod deadline = Timer::GetTimestamp();
+
+        for (Size i = 0; i < FrameCount; ++i)
+        {
+            deadline += frameTime;
+
+            PreciseSleepUntil(deadline);
+
+            const TimePeriod wokeAt = Timer::GetTimestamp();
+
+            DOCTEST_REQUIRE(wokeAt >= deadline);
+
+            jitters.push_back((wokeAt - deadline).GetTotalMicroseconds());
+        }
+
+        std::sort(jitters.begin(), jitters.end());
+
+        DOCTEST_MESSAGE("Median jitter: ", jitters[FrameCount / 2], " us, worst: ", jitters.back(), " us");
+
+        // A plain `Sleep` is late by the scheduler's granularity, about a millisecond on Windows. The
+        // bound is loose for the loaded machines, the typical value is a few microseconds.
+        DOCTEST_CHECK(jitters[FrameCount / 2] < 500);
+    }
+}
@@ -0,0 +1,161 @@
+#include <Axis/System>
+#include <doctest.h>
+
+using namespace Axis;
+using namespace Axis::System;
+
+namespace
+{
+
+struct TestAllocationTag
+{
+    static constexpr const char* Name = "Test::TrackingAllocator";
+};
+
+struct TestCallSiteAllocationTag
+{
+    static constexpr const char* Name = "Test::TrackingAllocator::CallSite";
+};
+
+struct TestEscapedAllocationTag
+{
+    static constexpr const char* Name = "Test::\"Tracking\"\\Allocator\n\t\x01";
+};
+
+} // namespace
+
+DOCTEST_TEST_CASE("Tracking allocator : [Axis::System]")
+{
+    using TestAllocator = TrackingAllocator<DefaultAllocator, TestAllocationTag>;
+
+    DOCTEST_SUBCASE("Counts the allocations")
+    {
+        auto before = AllocationTracker::GetStatistics(TestAllocationTag::Name);
+
+        TestAllocator allocator;
+
+        auto memory = allocator.Allocate(100, 64);
+
+        // The header doesn't break the alignment
+        DOCTEST_CHECK(reinterpret_cast<uintptr_t>(memory) % 64 == 0);
+
+        auto during = AllocationTracker::GetStatistics(TestAllocationTag::Name);
+
+        DOCTEST_CHECK(during.LiveBytes == before.LiveBytes + 100);
+        DOCTEST_CHECK(during.LiveAllocationCount == before.LiveAllocationCount + 1);
+        DOCTEST_CHECK(during.AllocationCount == before.AllocationCount + 1);
+        DOCTEST_CHECK(during.PeakBytes >= during.LiveBytes);
+
+        allocator.Deallocate(memory);
+
+        auto after = AllocationTracker::GetStatistics(TestAllocationTag::Name);
+
+        DOCTEST_CHECK(after.LiveBytes == before.LiveBytes);
+        DOCTEST_CHECK(after.LiveAllocationCount == before.LiveAllocationCount);
+        DOCTEST_CHECK(after.AllocationCount == before.AllocationCount + 1);
+    }
+
+    DOCTEST_SUBCASE("Used through containers and smart pointers")
+    {
+        auto before = AllocationTracker::GetStatistics(TestAllocationTag::Name);
+
+        {
+            List<Int32, TestAllocator> list;
+
+            for (Int32 i = 0; i < 1000; ++i)
+                list.Append(i);
+
+            auto instance = AllocatedNew<TestAllocator, Int64>(64);
+
+            auto sharedPointer = AllocatedMakeShared<Int64, TestAllocator>(128);
+
+            DOCTEST_CHECK(*instance == 64);
+            DOCTEST_CHECK(*sharedPointer == 128);
+
+            auto during = AllocationTracker::GetStatistics(TestAllocationTag::Name);
+
+            DOCTEST_CHECK(during.LiveBytes >= before.LiveBytes + sizeof(Int32) * 1000 + sizeof(Int64) * 2);
+            DOCTEST_CHECK(during.LiveAllocationCount == before.LiveAllocationCount + 3);
+
+            AllocatedDelete<TestAllocator>(instance);
+        }
+
+        auto after = AllocationTracker::GetStatistics(TestAllocationTag::Name);
+
+        DOCTEST_CHECK(after.LiveBytes == before.LiveBytes);
+        DOCTEST_CHECK(after.LiveAllocationCount == before.LiveAllocationCount);
+    }
+
+    DOCTEST_SUBCASE("Per frame counters and peaks")
+    {
+        TestAllocator allocator;
+
+        AllocationTracker::BeginFrame();
+
+        auto first  = allocator.Allocate(1000, 8);
+        auto second = allocator.Allocate(1000, 8);
+
+        allocator.Deallocate(first);
+        allocator.Deallocate(second);
+
+        AllocationTracker::BeginFrame();
+
+        auto statistics = AllocationTracker::GetStatistics(TestAllocationTag::Name);
+
+        DOCTEST_CHECK(statistics.LastFrameAllocationCount == 2);
+        DOCTEST_CHECK(statistics.PeakBytes >= statistics.LiveBytes + 2000);
+
+        AllocationTracker::ResetPeaks();
+
+        DOCTEST_CHECK(AllocationTracker::GetStatistics(TestAllocationTag::Name).PeakBytes == statistics.LiveBytes);
+    }
+
+    DOCTEST_SUBCASE("Call site capture and JSON dump")
+    {
+        TrackingAllocator<DefaultAllocator, TestCallSiteAllocationTag> allocator;
+
+        AllocationTracker::SetCallSiteCaptureEnabled(true);
+
+        auto memory = allocator.Allocate(32, 8);
+
+        AllocationTracker::SetCallSiteCaptureEnabled(false);
+
+        auto statistics = AllocationTracker::GetStatistics(TestCallSiteAllocationTag::Name);
+
+        DOCTEST_CHECK(statistics.CallSites.GetLength() == 1);
+        DOCTEST_CHECK(statistics.CallSites[0].Address != nullptr);
+        DOCTEST_CHECK(statistics.CallSites[0].LiveBytes == 32);
+
+        // The deallocation is recorded to the same call site even if the capture was disabled meanwhile
+        allocator.Deallocate(memory);
+
+        statistics = AllocationTracker::GetStatistics(TestCallSiteAllocationTag::Name);
+
+        DOCTEST_CHECK(statistics.CallSites[0].LiveBytes == 0);
+        DOCTEST_CHECK(statistics.CallSites[0].AllocationCount == 1);
+
+        auto json = AllocationTracker::DumpToJson();
+
+        DOCTEST_CHECK(std::strstr(json.GetCString(), "\"name\": \"Test::TrackingAllocator::CallSite\"") != nullptr);
+        DOCTEST_CHECK(std::strstr(json.GetCString(), "\"callSites\": [") != nullptr);
+    }
+
+    DOCTEST_SUBCASE("Escaping the tag names in JSON")
+    {
+        TrackingAllocator<DefaultAllocator, TestEscapedAllocationTag> allocator;
+
+        allocator.Deallocate(allocator.Allocate(16, 8));
+
+        auto json = AllocationTracker::DumpToJson();
+
+        DOCTEST_CHECK(std::strstr(json.GetCString(), "\"name\": \"Test::\\\"Tracking\\\"\\\\Allocator\\n\\t\\u0001\"") != nullptr);
+    }
+
+    DOCTEST_SUBCASE("Unregistered tag")
+    {
+        auto statistics = AllocationTracker::GetStatistics("Test::TrackingAllocator::Unregistered");
+
+        DOCTEST_CHECK(statistics.AllocationCount == 0);
+        DOCTEST_CHECK(statistics.CallSites.GetLength() == 0);
+    }
+}
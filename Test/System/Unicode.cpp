@@ -0,0 +1,177 @@
+#include <Axis/System>
+#include <doctest.h>
+#include <vector>
+
+using namespace Axis;
+using namespace Axis::System;
+
+namespace
+{
+
+// Builds the text mixing the ASCII runs, longer than the SIMD blocks, with the multi-byte characters.
+std::vector<char32_t> GenerateCodePoints()
+{
+    const char32_t characters[] = {U'é', U'ß', U'€', U'中', U'文', 0x1F600, 0x10FFFF, 0xFFFD, 0x7F, 0x80, 0x7FF, 0x800, 0xFFFF, 0x10000};
+
+    std::vector<char32_t> codePoints;
+
+    for (Size i = 0; i < 64; ++i)
+    {
+        for (Size j = 0; j < i % 37; ++j)
+            codePoints.push_back(U'a' + (char32_t)(j % 26));
+
+        codePoints.push_back(characters[i % (sizeof(characters) / sizeof(characters[0]))]);
+    }
+
+    return codePoints;
+}
+
+template <CharType T>
+std::vector<T> Encode(const std::vector<char32_t>& codePoints)
+{
+    std::vector<T> result;
+
+    for (auto codePoint : codePoints)
+    {
+        T    units[4] = {};
+        Size count    = Unicode::Encode(codePoint, units);
+
+        result.insert(result.end(), units, units + count);
+    }
+
+    return result;
+}
+
+template <CharType To, CharType From>
+std::vector<To> Transcode(const std::vector<From>& source)
+{
+    std::vector<To> result(Unicode::GetTranscodedLength<To>(source.data(), source.size()));
+
+    Size written = Unicode::Transcode(source.data(), source.size(), result.data());
+
+    DOCTEST_CHECK(written == result.size());
+
+    return result;
+}
+
+template <CharType T>
+std::vector<char32_t> Decode(const T* begin,
+                             const T* end)
+{
+    std::vector<char32_t> result;
+
+    while (begin != end)
+        result.push_back(Unicode::DecodeNext(begin, end));
+
+    return result;
+}
+
+} // namespace
+
+DOCTEST_TEST_CASE("Unicode transcoding : [Axis::System]")
+{
+    DOCTEST_SUBCASE("Every code point round trips")
+    {
+        for (char32_t codePoint = 0; codePoint <= Unicode::MaxCodePoint; ++codePoint)
+        {
+            if (codePoint >= 0xD800 && codePoint <= 0xDFFF)
+                continue;
+
+            char8_t  utf8[4]  = {};
+            char16_t utf16[2] = {};
+
+            Size utf8Length  = Unicode::Encode(codePoint, utf8);
+            Size utf16Length = Unicode::Encode(codePoint, utf16);
+
+            const char8_t*  utf8Current  = utf8;
+            const char16_t* utf16Current = utf16;
+
+            if (utf8Length != Unicode::GetEncodedLength<char8_t>(codePoint) ||
+                utf16Length != Unicode::GetEncodedLength<char16_t>(codePoint) ||
+                Unicode::DecodeNext(utf8Current, utf8 + utf8Length) != codePoint ||
+                Unicode::DecodeNext(utf16Current, utf16 + utf16Length) != codePoint ||
+                utf8Current != utf8 + utf8Length ||
+                utf16Current != utf16 + utf16Length)
+            {
+                DOCTEST_FAIL("The code point " << (Uint32)codePoint << " doesn't round trip");
+            }
+        }
+    }
+
+    DOCTEST_SUBCASE("Strings round trip between the encodings")
+    {
+        const auto codePoints = GenerateCodePoints();
+        const auto utf8       = Encode<char8_t>(codePoints);
+        const auto utf16      = Encode<char16_t>(codePoints);
+        const auto utf32      = Encode<char32_t>(codePoints);
+
+        DOCTEST_CHECK(Transcode<char16_t>(utf8) == utf16);
+        DOCTEST_CHECK(Transcode<char32_t>(utf8) == utf32);
+        DOCTEST_CHECK(Transcode<char8_t>(utf16) == utf8);
+        DOCTEST_CHECK(Transcode<char32_t>(utf16) == utf32);
+        DOCTEST_CHECK(Transcode<char8_t>(utf32) == utf8);
+        DOCTEST_CHECK(Transcode<char16_t>(utf32) == utf16);
+
+        // Every starting offset, the SIMD blocks aren't aligned.
+        for (Size offset = 0; offset < 32; ++offset)
+        {
+            std::vector<char32_t> tail(utf32.begin() + offset, utf32.end());
+
+            DOCTEST_CHECK(Transcode<char32_t>(Transcode<char8_t>(tail)) == tail);
+        }
+    }
+
+    DOCTEST_SUBCASE("Invalid sequences")
+    {
+        constexpr char32_t Replacement = Unicode::ReplacementCharacter;
+
+        // Truncated, stray continuation, overlong, surrogate and out of range sequences
+        const Uint8 utf8[] = {'a', 0xC3, 'b', 0x80, 0xC0, 0xAF, 0xED, 0xA0, 0x80, 0xF4, 0x90, 0x80, 0x80, 0xE2, 0x82};
+
+        std::vector<char8_t> source(utf8, utf8 + sizeof(utf8));
+
+        const std::vector<char32_t> expected = {'a', Replacement, 'b', Replacement, Replacement, Replacement,
+                                                Replacement, Replacement, Replacement, Replacement, Replacement,
+                                                Replacement, Replacement, Replacement, Replacement};
+
+        DOCTEST_CHECK(Decode(source.data(), source.data() + source.size()) == expected);
+        DOCTEST_CHECK(Transcode<char32_t>(source) == expected);
+
+        // Unpaired surrogates
+        const std::vector<char16_t> utf16 = {0xD800, 'a', 0xDC00, 0xD83D, 0xDE00, 0xD83D};
+
+        DOCTEST_CHECK(Transcode<char32_t>(utf16) == std::vector<char32_t>{Replacement, 'a', Replacement, 0x1F600, Replacement});
+
+        const std::vector<char32_t> utf32 = {0xD800, 0x110000, 'a'};
+
+        DOCTEST_CHECK(Transcode<char8_t>(utf32) == Encode<char8_t>({Replacement, Replacement, 'a'}));
+    }
+
+    DOCTEST_SUBCASE("Strings of different character types")
+    {
+        // "Grüße, 世界 😀"
+        const char8_t  utf8[]  = u8"Grüße, 世界 \U0001F600";
+        const char16_t utf16[] = u"Grüße, 世界 \U0001F600";
+
+        StringU16 fromUtf8 = utf8;
+        StringU8  fromUtf16 = utf16;
+
+        DOCTEST_CHECK(fromUtf8 == StringU16(utf16));
+        DOCTEST_CHECK(fromUtf16 == StringU8(utf8));
+        DOCTEST_CHECK(fromUtf8.GetLength() == sizeof(utf16) / sizeof(char16_t) - 1);
+        DOCTEST_CHECK(fromUtf16.GetLength() == sizeof(utf8) - 1);
+
+        // The wide string survives the trip through UTF-8.
+        WString title = L"Fenêtre \U0001F600";
+        String8 utf8Title = title;
+
+        DOCTEST_CHECK(WString(utf8Title) == title);
+
+        // Appending transcodes as well
+        String8 text = "Pi: ";
+        text += U'π';
+        text += u"≈ 3.14";
+
+        DOCTEST_CHECK(text == String8((const Char*)u8"Pi: π≈ 3.14"));
+    }
+}